@@ -0,0 +1,531 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+/*!
+    \page qtconcurrentalgorithm.html
+    \title Concurrent Sort, Scan and Transform-Reduce
+    \brief Sorting, prefix sums and reductions of random-access sequences in parallel.
+    \ingroup thread
+
+    The QtConcurrent::sort(), QtConcurrent::inclusiveScan(),
+    QtConcurrent::exclusiveScan() and QtConcurrent::transformReduce()
+    functions are parallel versions of \c std::sort(),
+    \c std::inclusive_scan(), \c std::exclusive_scan() and
+    \c std::transform_reduce(). They work on sequences with random-access
+    iterators, such as QList, \c std::vector and QSpan, or on pairs of
+    random-access iterators.
+
+    These functions are part of the \l {Qt Concurrent} framework.
+
+    \section1 Sorting
+
+    QtConcurrent::sort() sorts the items of a sequence in place, using
+    \c operator<() or the comparison function passed to it:
+
+    \code
+    QList<QString> names = ...;
+    QFuture<void> future = QtConcurrent::sort(names);
+    ...
+    future.waitForFinished();
+    \endcode
+
+    The sequence is split into one chunk per thread of the thread pool. The
+    chunks are sorted in parallel and then merged in rounds, each of which
+    is spread over all threads as well. Like \c std::sort(), the sort isn't
+    stable. The type of the items needs to be default constructible for
+    the merge rounds to be spread over the threads; otherwise each round
+    merges pairs of sorted runs in place.
+
+    \section1 Scans
+
+    QtConcurrent::inclusiveScan() and QtConcurrent::exclusiveScan() compute
+    running totals. The inclusive scan of an item includes the item itself,
+    the exclusive scan starts with an initial value and doesn't:
+
+    \code
+    QList<int> sizes = { 3, 1, 4, 1, 5 };
+    QtConcurrent::blockingExclusiveScan(sizes, 0);
+    // sizes is now { 0, 3, 4, 8, 9 }
+    \endcode
+
+    The operation, \c std::plus by default, needs to be associative, since
+    the items are combined in a different grouping than in a sequential
+    scan. The scans go over the sequence twice, once to total each chunk and
+    once to write the results, so they pay off for large sequences.
+
+    \section1 Transform-Reduce
+
+    QtConcurrent::transformReduce() calls a transform function for each
+    item and combines the results, and an initial value, into one result:
+
+    \code
+    QList<QString> lines = ...;
+    qsizetype characters = QtConcurrent::blockingTransformReduce(
+            lines, qsizetype(0), std::plus<>(),
+            [](const QString &line) { return line.size(); });
+    \endcode
+
+    The reduce operation needs to be associative and commutative. Unlike
+    QtConcurrent::mappedReduced(), the reduction itself runs in parallel:
+    each chunk is reduced by its own thread, and only the results of the
+    chunks are combined.
+
+    \section1 Cancellation and Progress
+
+    The functions return a QFuture that reports progress in steps of work
+    done. Canceling the future stops the algorithm after the step that is
+    running, which leaves the sequence in an unspecified order, or with only
+    part of the results written. Suspending the future pauses it in the same
+    way.
+
+    The \c blocking variants wait for the result instead of returning a
+    future. All functions have overloads that take a QThreadPool to run on;
+    the others use QThreadPool::globalInstance().
+
+    \section1 Sequences and Iterators
+
+    The functions that sort or scan a sequence work on it in place, and only
+    hold iterators into it. The sequence, or the data a QSpan refers to, has
+    to stay alive until the future is finished. QtConcurrent::transformReduce()
+    keeps a copy of the sequence passed to it, as QtConcurrent::mappedReduced()
+    does.
+*/
+
+/*!
+  \class QtConcurrent::PhasedKernel
+  \inmodule QtConcurrent
+  \internal
+*/
+
+/*!
+  \class QtConcurrent::SortKernel
+  \inmodule QtConcurrent
+  \internal
+*/
+
+/*!
+  \class QtConcurrent::ScanKernel
+  \inmodule QtConcurrent
+  \internal
+*/
+
+/*!
+  \class QtConcurrent::TransformReduceKernel
+  \inmodule QtConcurrent
+  \internal
+*/
+
+/*!
+  \class QtConcurrent::AlgorithmSequenceHolder
+  \inmodule QtConcurrent
+  \internal
+*/
+
+/*!
+  \fn int QtConcurrent::algorithmChunkCount(QThreadPool *pool, qsizetype count, int chunksPerThread)
+  \internal
+*/
+
+/*!
+    \fn template <typename Sequence, typename Compare> QFuture<void> QtConcurrent::sort(QThreadPool *pool, Sequence &&sequence, Compare &&compare)
+    \since 6.12
+
+    Sorts the items of \a sequence in place, using \a compare to order
+    them. \a compare defaults to \c std::less.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Iterator, typename Compare> QFuture<void> QtConcurrent::sort(QThreadPool *pool, Iterator begin, Iterator end, Compare &&compare)
+    \since 6.12
+
+    Sorts the items from \a begin to \a end in place, using \a compare
+    to order them. \a compare defaults to \c std::less.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename Compare> QFuture<void> QtConcurrent::sort(Sequence &&sequence, Compare &&compare)
+    \since 6.12
+
+    Sorts the items of \a sequence in place, using \a compare to order
+    them. \a compare defaults to \c std::less.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Iterator, typename Compare> QFuture<void> QtConcurrent::sort(Iterator begin, Iterator end, Compare &&compare)
+    \since 6.12
+
+    Sorts the items from \a begin to \a end in place, using \a compare
+    to order them. \a compare defaults to \c std::less.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename BinaryOperation> QFuture<void> QtConcurrent::inclusiveScan(QThreadPool *pool, Sequence &&sequence, BinaryOperation &&operation)
+    \since 6.12
+
+    Replaces each item of \a sequence with the result of combining it
+    with all items before it, using \a operation. \a operation defaults
+    to \c std::plus and needs to be associative.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename InputIterator, typename OutputIterator, typename BinaryOperation> QFuture<void> QtConcurrent::inclusiveScan(QThreadPool *pool, InputIterator begin, InputIterator end, OutputIterator destination, BinaryOperation &&operation)
+    \since 6.12
+
+    Writes the inclusive scan of the items from \a begin to \a end to
+    the items starting at \a destination. Each result combines an item
+    with all items before it, using \a operation. \a operation defaults
+    to \c std::plus and needs to be associative. \a destination may be
+    \a begin.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename BinaryOperation> QFuture<void> QtConcurrent::inclusiveScan(Sequence &&sequence, BinaryOperation &&operation)
+    \since 6.12
+
+    Replaces each item of \a sequence with the result of combining it
+    with all items before it, using \a operation. \a operation defaults
+    to \c std::plus and needs to be associative.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename InputIterator, typename OutputIterator, typename BinaryOperation> QFuture<void> QtConcurrent::inclusiveScan(InputIterator begin, InputIterator end, OutputIterator destination, BinaryOperation &&operation)
+    \since 6.12
+
+    Writes the inclusive scan of the items from \a begin to \a end to
+    the items starting at \a destination. Each result combines an item
+    with all items before it, using \a operation. \a operation defaults
+    to \c std::plus and needs to be associative. \a destination may be
+    \a begin.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename T, typename BinaryOperation> QFuture<void> QtConcurrent::exclusiveScan(QThreadPool *pool, Sequence &&sequence, T &&initialValue, BinaryOperation &&operation)
+    \since 6.12
+
+    Replaces each item of \a sequence with the result of combining
+    \a initialValue with all items before it, using \a operation.
+    \a operation defaults to \c std::plus and needs to be associative.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation> QFuture<void> QtConcurrent::exclusiveScan(QThreadPool *pool, InputIterator begin, InputIterator end, OutputIterator destination, T &&initialValue, BinaryOperation &&operation)
+    \since 6.12
+
+    Writes the exclusive scan of the items from \a begin to \a end to
+    the items starting at \a destination. Each result combines
+    \a initialValue with all items before the item, using \a operation.
+    \a operation defaults to \c std::plus and needs to be associative.
+    \a destination may be \a begin.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename T, typename BinaryOperation> QFuture<void> QtConcurrent::exclusiveScan(Sequence &&sequence, T &&initialValue, BinaryOperation &&operation)
+    \since 6.12
+
+    Replaces each item of \a sequence with the result of combining
+    \a initialValue with all items before it, using \a operation.
+    \a operation defaults to \c std::plus and needs to be associative.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation> QFuture<void> QtConcurrent::exclusiveScan(InputIterator begin, InputIterator end, OutputIterator destination, T &&initialValue, BinaryOperation &&operation)
+    \since 6.12
+
+    Writes the exclusive scan of the items from \a begin to \a end to
+    the items starting at \a destination. Each result combines
+    \a initialValue with all items before the item, using \a operation.
+    \a operation defaults to \c std::plus and needs to be associative.
+    \a destination may be \a begin.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename T, typename ReduceOperation, typename TransformOperation> QFuture<std::decay_t<T>> QtConcurrent::transformReduce(QThreadPool *pool, Sequence &&sequence, T &&initialValue, ReduceOperation &&reduce, TransformOperation &&transform)
+    \since 6.12
+
+    Calls \a transform once for each item in \a sequence, and combines
+    the results and \a initialValue using \a reduce. \a reduce needs
+    to be associative and commutative. Returns a future with the result.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Iterator, typename T, typename ReduceOperation, typename TransformOperation> QFuture<std::decay_t<T>> QtConcurrent::transformReduce(QThreadPool *pool, Iterator begin, Iterator end, T &&initialValue, ReduceOperation &&reduce, TransformOperation &&transform)
+    \since 6.12
+
+    Calls \a transform once for each item from \a begin to \a end,
+    and combines the results and \a initialValue using \a reduce.
+    \a reduce needs to be associative and commutative. Returns a future with the result.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename T, typename ReduceOperation, typename TransformOperation> QFuture<std::decay_t<T>> QtConcurrent::transformReduce(Sequence &&sequence, T &&initialValue, ReduceOperation &&reduce, TransformOperation &&transform)
+    \since 6.12
+
+    Calls \a transform once for each item in \a sequence, and combines
+    the results and \a initialValue using \a reduce. \a reduce needs
+    to be associative and commutative. Returns a future with the result.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Iterator, typename T, typename ReduceOperation, typename TransformOperation> QFuture<std::decay_t<T>> QtConcurrent::transformReduce(Iterator begin, Iterator end, T &&initialValue, ReduceOperation &&reduce, TransformOperation &&transform)
+    \since 6.12
+
+    Calls \a transform once for each item from \a begin to \a end,
+    and combines the results and \a initialValue using \a reduce.
+    \a reduce needs to be associative and commutative. Returns a future with the result.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename Compare> void QtConcurrent::blockingSort(QThreadPool *pool, Sequence &&sequence, Compare &&compare)
+    \since 6.12
+
+    Sorts the items of \a sequence in place, using \a compare to order
+    them. \a compare defaults to \c std::less.
+    All work is done in threads taken from the QThreadPool \a pool.
+    This function blocks until the items are sorted.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Iterator, typename Compare> void QtConcurrent::blockingSort(QThreadPool *pool, Iterator begin, Iterator end, Compare &&compare)
+    \since 6.12
+
+    Sorts the items from \a begin to \a end in place, using \a compare
+    to order them. \a compare defaults to \c std::less.
+    All work is done in threads taken from the QThreadPool \a pool.
+    This function blocks until the items are sorted.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename Compare> void QtConcurrent::blockingSort(Sequence &&sequence, Compare &&compare)
+    \since 6.12
+
+    Sorts the items of \a sequence in place, using \a compare to order
+    them. \a compare defaults to \c std::less.
+    All work is done in threads taken from the global QThreadPool.
+    This function blocks until the items are sorted.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Iterator, typename Compare> void QtConcurrent::blockingSort(Iterator begin, Iterator end, Compare &&compare)
+    \since 6.12
+
+    Sorts the items from \a begin to \a end in place, using \a compare
+    to order them. \a compare defaults to \c std::less.
+    All work is done in threads taken from the global QThreadPool.
+    This function blocks until the items are sorted.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename BinaryOperation> void QtConcurrent::blockingInclusiveScan(QThreadPool *pool, Sequence &&sequence, BinaryOperation &&operation)
+    \since 6.12
+
+    Replaces each item of \a sequence with the result of combining it
+    with all items before it, using \a operation. \a operation defaults
+    to \c std::plus and needs to be associative.
+    All work is done in threads taken from the QThreadPool \a pool.
+    This function blocks until the scan is done.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename InputIterator, typename OutputIterator, typename BinaryOperation> void QtConcurrent::blockingInclusiveScan(QThreadPool *pool, InputIterator begin, InputIterator end, OutputIterator destination, BinaryOperation &&operation)
+    \since 6.12
+
+    Writes the inclusive scan of the items from \a begin to \a end to
+    the items starting at \a destination. Each result combines an item
+    with all items before it, using \a operation. \a operation defaults
+    to \c std::plus and needs to be associative. \a destination may be
+    \a begin.
+    All work is done in threads taken from the QThreadPool \a pool.
+    This function blocks until the scan is done.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename BinaryOperation> void QtConcurrent::blockingInclusiveScan(Sequence &&sequence, BinaryOperation &&operation)
+    \since 6.12
+
+    Replaces each item of \a sequence with the result of combining it
+    with all items before it, using \a operation. \a operation defaults
+    to \c std::plus and needs to be associative.
+    All work is done in threads taken from the global QThreadPool.
+    This function blocks until the scan is done.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename InputIterator, typename OutputIterator, typename BinaryOperation> void QtConcurrent::blockingInclusiveScan(InputIterator begin, InputIterator end, OutputIterator destination, BinaryOperation &&operation)
+    \since 6.12
+
+    Writes the inclusive scan of the items from \a begin to \a end to
+    the items starting at \a destination. Each result combines an item
+    with all items before it, using \a operation. \a operation defaults
+    to \c std::plus and needs to be associative. \a destination may be
+    \a begin.
+    All work is done in threads taken from the global QThreadPool.
+    This function blocks until the scan is done.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename T, typename BinaryOperation> void QtConcurrent::blockingExclusiveScan(QThreadPool *pool, Sequence &&sequence, T &&initialValue, BinaryOperation &&operation)
+    \since 6.12
+
+    Replaces each item of \a sequence with the result of combining
+    \a initialValue with all items before it, using \a operation.
+    \a operation defaults to \c std::plus and needs to be associative.
+    All work is done in threads taken from the QThreadPool \a pool.
+    This function blocks until the scan is done.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation> void QtConcurrent::blockingExclusiveScan(QThreadPool *pool, InputIterator begin, InputIterator end, OutputIterator destination, T &&initialValue, BinaryOperation &&operation)
+    \since 6.12
+
+    Writes the exclusive scan of the items from \a begin to \a end to
+    the items starting at \a destination. Each result combines
+    \a initialValue with all items before the item, using \a operation.
+    \a operation defaults to \c std::plus and needs to be associative.
+    \a destination may be \a begin.
+    All work is done in threads taken from the QThreadPool \a pool.
+    This function blocks until the scan is done.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename T, typename BinaryOperation> void QtConcurrent::blockingExclusiveScan(Sequence &&sequence, T &&initialValue, BinaryOperation &&operation)
+    \since 6.12
+
+    Replaces each item of \a sequence with the result of combining
+    \a initialValue with all items before it, using \a operation.
+    \a operation defaults to \c std::plus and needs to be associative.
+    All work is done in threads taken from the global QThreadPool.
+    This function blocks until the scan is done.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation> void QtConcurrent::blockingExclusiveScan(InputIterator begin, InputIterator end, OutputIterator destination, T &&initialValue, BinaryOperation &&operation)
+    \since 6.12
+
+    Writes the exclusive scan of the items from \a begin to \a end to
+    the items starting at \a destination. Each result combines
+    \a initialValue with all items before the item, using \a operation.
+    \a operation defaults to \c std::plus and needs to be associative.
+    \a destination may be \a begin.
+    All work is done in threads taken from the global QThreadPool.
+    This function blocks until the scan is done.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename T, typename ReduceOperation, typename TransformOperation> std::decay_t<T> QtConcurrent::blockingTransformReduce(QThreadPool *pool, Sequence &&sequence, T &&initialValue, ReduceOperation &&reduce, TransformOperation &&transform)
+    \since 6.12
+
+    Calls \a transform once for each item in \a sequence, and combines
+    the results and \a initialValue using \a reduce. \a reduce needs
+    to be associative and commutative. Returns the result.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Iterator, typename T, typename ReduceOperation, typename TransformOperation> std::decay_t<T> QtConcurrent::blockingTransformReduce(QThreadPool *pool, Iterator begin, Iterator end, T &&initialValue, ReduceOperation &&reduce, TransformOperation &&transform)
+    \since 6.12
+
+    Calls \a transform once for each item from \a begin to \a end,
+    and combines the results and \a initialValue using \a reduce.
+    \a reduce needs to be associative and commutative. Returns the result.
+    All work is done in threads taken from the QThreadPool \a pool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Sequence, typename T, typename ReduceOperation, typename TransformOperation> std::decay_t<T> QtConcurrent::blockingTransformReduce(Sequence &&sequence, T &&initialValue, ReduceOperation &&reduce, TransformOperation &&transform)
+    \since 6.12
+
+    Calls \a transform once for each item in \a sequence, and combines
+    the results and \a initialValue using \a reduce. \a reduce needs
+    to be associative and commutative. Returns the result.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
+
+/*!
+    \fn template <typename Iterator, typename T, typename ReduceOperation, typename TransformOperation> std::decay_t<T> QtConcurrent::blockingTransformReduce(Iterator begin, Iterator end, T &&initialValue, ReduceOperation &&reduce, TransformOperation &&transform)
+    \since 6.12
+
+    Calls \a transform once for each item from \a begin to \a end,
+    and combines the results and \a initialValue using \a reduce.
+    \a reduce needs to be associative and commutative. Returns the result.
+    All work is done in threads taken from the global QThreadPool.
+
+    \sa {Concurrent Sort, Scan and Transform-Reduce}
+*/
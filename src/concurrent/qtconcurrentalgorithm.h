@@ -0,0 +1,400 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTCONCURRENT_ALGORITHM_H
+#define QTCONCURRENT_ALGORITHM_H
+
+#if 0
+#pragma qt_class(QtConcurrentAlgorithm)
+#endif
+
+#include <QtConcurrent/qtconcurrent_global.h>
+
+#if !defined(QT_NO_CONCURRENT) || defined(Q_QDOC)
+
+#include <QtConcurrent/qtconcurrentalgorithmkernel.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtConcurrent {
+
+// sort() on sequences
+template <typename Sequence, typename Compare = std::less<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+QFuture<void> sort(QThreadPool *pool, Sequence &&sequence, Compare &&compare = {})
+{
+    using Iterator = decltype(sequence.begin());
+    return startThreadEngine(new SortKernel<Iterator, std::decay_t<Compare>>(
+            pool, sequence.begin(), sequence.end(), std::forward<Compare>(compare)));
+}
+
+template <typename Sequence, typename Compare = std::less<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+QFuture<void> sort(Sequence &&sequence, Compare &&compare = {})
+{
+    return sort(QThreadPool::globalInstance(), std::forward<Sequence>(sequence),
+                std::forward<Compare>(compare));
+}
+
+// sort() on iterators
+template <typename Iterator, typename Compare = std::less<>,
+          QtPrivate::IfIsRandomAccessIterator<Iterator> = true>
+QFuture<void> sort(QThreadPool *pool, Iterator begin, Iterator end, Compare &&compare = {})
+{
+    return startThreadEngine(new SortKernel<Iterator, std::decay_t<Compare>>(
+            pool, begin, end, std::forward<Compare>(compare)));
+}
+
+template <typename Iterator, typename Compare = std::less<>,
+          QtPrivate::IfIsRandomAccessIterator<Iterator> = true>
+QFuture<void> sort(Iterator begin, Iterator end, Compare &&compare = {})
+{
+    return sort(QThreadPool::globalInstance(), begin, end, std::forward<Compare>(compare));
+}
+
+// inclusiveScan() on sequences, in place
+template <typename Sequence, typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+QFuture<void> inclusiveScan(QThreadPool *pool, Sequence &&sequence,
+                            BinaryOperation &&operation = {})
+{
+    using Iterator = decltype(sequence.begin());
+    using T = typename std::iterator_traits<Iterator>::value_type;
+    return startThreadEngine(
+            new ScanKernel<Iterator, Iterator, T, std::decay_t<BinaryOperation>, true>(
+                    pool, sequence.begin(), sequence.end(), sequence.begin(), std::nullopt,
+                    std::forward<BinaryOperation>(operation)));
+}
+
+template <typename Sequence, typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+QFuture<void> inclusiveScan(Sequence &&sequence, BinaryOperation &&operation = {})
+{
+    return inclusiveScan(QThreadPool::globalInstance(), std::forward<Sequence>(sequence),
+                         std::forward<BinaryOperation>(operation));
+}
+
+// inclusiveScan() on iterators
+template <typename InputIterator, typename OutputIterator,
+          typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessIterator<InputIterator> = true,
+          QtPrivate::IfIsRandomAccessIterator<OutputIterator> = true>
+QFuture<void> inclusiveScan(QThreadPool *pool, InputIterator begin, InputIterator end,
+                            OutputIterator destination, BinaryOperation &&operation = {})
+{
+    using T = typename std::iterator_traits<InputIterator>::value_type;
+    return startThreadEngine(
+            new ScanKernel<InputIterator, OutputIterator, T, std::decay_t<BinaryOperation>, true>(
+                    pool, begin, end, destination, std::nullopt,
+                    std::forward<BinaryOperation>(operation)));
+}
+
+template <typename InputIterator, typename OutputIterator,
+          typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessIterator<InputIterator> = true,
+          QtPrivate::IfIsRandomAccessIterator<OutputIterator> = true>
+QFuture<void> inclusiveScan(InputIterator begin, InputIterator end, OutputIterator destination,
+                            BinaryOperation &&operation = {})
+{
+    return inclusiveScan(QThreadPool::globalInstance(), begin, end, destination,
+                         std::forward<BinaryOperation>(operation));
+}
+
+// exclusiveScan() on sequences, in place
+template <typename Sequence, typename T, typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+QFuture<void> exclusiveScan(QThreadPool *pool, Sequence &&sequence, T &&initialValue,
+                            BinaryOperation &&operation = {})
+{
+    using Iterator = decltype(sequence.begin());
+    return startThreadEngine(
+            new ScanKernel<Iterator, Iterator, std::decay_t<T>, std::decay_t<BinaryOperation>,
+                           false>(
+                    pool, sequence.begin(), sequence.end(), sequence.begin(),
+                    std::optional<std::decay_t<T>>(std::forward<T>(initialValue)),
+                    std::forward<BinaryOperation>(operation)));
+}
+
+template <typename Sequence, typename T, typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+QFuture<void> exclusiveScan(Sequence &&sequence, T &&initialValue,
+                            BinaryOperation &&operation = {})
+{
+    return exclusiveScan(QThreadPool::globalInstance(), std::forward<Sequence>(sequence),
+                         std::forward<T>(initialValue), std::forward<BinaryOperation>(operation));
+}
+
+// exclusiveScan() on iterators
+template <typename InputIterator, typename OutputIterator, typename T,
+          typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessIterator<InputIterator> = true,
+          QtPrivate::IfIsRandomAccessIterator<OutputIterator> = true>
+QFuture<void> exclusiveScan(QThreadPool *pool, InputIterator begin, InputIterator end,
+                            OutputIterator destination, T &&initialValue,
+                            BinaryOperation &&operation = {})
+{
+    return startThreadEngine(
+            new ScanKernel<InputIterator, OutputIterator, std::decay_t<T>,
+                           std::decay_t<BinaryOperation>, false>(
+                    pool, begin, end, destination,
+                    std::optional<std::decay_t<T>>(std::forward<T>(initialValue)),
+                    std::forward<BinaryOperation>(operation)));
+}
+
+template <typename InputIterator, typename OutputIterator, typename T,
+          typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessIterator<InputIterator> = true,
+          QtPrivate::IfIsRandomAccessIterator<OutputIterator> = true>
+QFuture<void> exclusiveScan(InputIterator begin, InputIterator end, OutputIterator destination,
+                            T &&initialValue, BinaryOperation &&operation = {})
+{
+    return exclusiveScan(QThreadPool::globalInstance(), begin, end, destination,
+                         std::forward<T>(initialValue), std::forward<BinaryOperation>(operation));
+}
+
+// transformReduce() on sequences
+template <typename Sequence, typename T, typename ReduceOperation, typename TransformOperation,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+QFuture<std::decay_t<T>> transformReduce(QThreadPool *pool, Sequence &&sequence,
+                                         T &&initialValue, ReduceOperation &&reduce,
+                                         TransformOperation &&transform)
+{
+    using DecayedSequence = std::decay_t<Sequence>;
+    using Kernel = TransformReduceKernel<typename DecayedSequence::const_iterator, std::decay_t<T>,
+                                         std::decay_t<ReduceOperation>,
+                                         std::decay_t<TransformOperation>>;
+    return startThreadEngine(new AlgorithmSequenceHolder<DecayedSequence, Kernel>(
+            pool, std::forward<Sequence>(sequence), std::forward<T>(initialValue),
+            std::forward<ReduceOperation>(reduce), std::forward<TransformOperation>(transform)));
+}
+
+template <typename Sequence, typename T, typename ReduceOperation, typename TransformOperation,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+QFuture<std::decay_t<T>> transformReduce(Sequence &&sequence, T &&initialValue,
+                                         ReduceOperation &&reduce, TransformOperation &&transform)
+{
+    return transformReduce(QThreadPool::globalInstance(), std::forward<Sequence>(sequence),
+                           std::forward<T>(initialValue), std::forward<ReduceOperation>(reduce),
+                           std::forward<TransformOperation>(transform));
+}
+
+// transformReduce() on iterators
+template <typename Iterator, typename T, typename ReduceOperation, typename TransformOperation,
+          QtPrivate::IfIsRandomAccessIterator<Iterator> = true>
+QFuture<std::decay_t<T>> transformReduce(QThreadPool *pool, Iterator begin, Iterator end,
+                                         T &&initialValue, ReduceOperation &&reduce,
+                                         TransformOperation &&transform)
+{
+    return startThreadEngine(
+            new TransformReduceKernel<Iterator, std::decay_t<T>, std::decay_t<ReduceOperation>,
+                                      std::decay_t<TransformOperation>>(
+                    pool, begin, end, std::forward<T>(initialValue),
+                    std::forward<ReduceOperation>(reduce),
+                    std::forward<TransformOperation>(transform)));
+}
+
+template <typename Iterator, typename T, typename ReduceOperation, typename TransformOperation,
+          QtPrivate::IfIsRandomAccessIterator<Iterator> = true>
+QFuture<std::decay_t<T>> transformReduce(Iterator begin, Iterator end, T &&initialValue,
+                                         ReduceOperation &&reduce, TransformOperation &&transform)
+{
+    return transformReduce(QThreadPool::globalInstance(), begin, end,
+                           std::forward<T>(initialValue), std::forward<ReduceOperation>(reduce),
+                           std::forward<TransformOperation>(transform));
+}
+
+// blockingSort() on sequences
+template <typename Sequence, typename Compare = std::less<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+void blockingSort(QThreadPool *pool, Sequence &&sequence, Compare &&compare = {})
+{
+    QFuture<void> future = sort(pool, std::forward<Sequence>(sequence),
+                                std::forward<Compare>(compare));
+    future.waitForFinished();
+}
+
+template <typename Sequence, typename Compare = std::less<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+void blockingSort(Sequence &&sequence, Compare &&compare = {})
+{
+    QFuture<void> future = sort(QThreadPool::globalInstance(), std::forward<Sequence>(sequence),
+                                std::forward<Compare>(compare));
+    future.waitForFinished();
+}
+
+// blockingSort() on iterators
+template <typename Iterator, typename Compare = std::less<>,
+          QtPrivate::IfIsRandomAccessIterator<Iterator> = true>
+void blockingSort(QThreadPool *pool, Iterator begin, Iterator end, Compare &&compare = {})
+{
+    QFuture<void> future = sort(pool, begin, end, std::forward<Compare>(compare));
+    future.waitForFinished();
+}
+
+template <typename Iterator, typename Compare = std::less<>,
+          QtPrivate::IfIsRandomAccessIterator<Iterator> = true>
+void blockingSort(Iterator begin, Iterator end, Compare &&compare = {})
+{
+    QFuture<void> future = sort(QThreadPool::globalInstance(), begin, end,
+                                std::forward<Compare>(compare));
+    future.waitForFinished();
+}
+
+// blockingInclusiveScan() on sequences, in place
+template <typename Sequence, typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+void blockingInclusiveScan(QThreadPool *pool, Sequence &&sequence,
+                           BinaryOperation &&operation = {})
+{
+    QFuture<void> future = inclusiveScan(pool, std::forward<Sequence>(sequence),
+                                         std::forward<BinaryOperation>(operation));
+    future.waitForFinished();
+}
+
+template <typename Sequence, typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+void blockingInclusiveScan(Sequence &&sequence, BinaryOperation &&operation = {})
+{
+    QFuture<void> future = inclusiveScan(QThreadPool::globalInstance(),
+                                         std::forward<Sequence>(sequence),
+                                         std::forward<BinaryOperation>(operation));
+    future.waitForFinished();
+}
+
+// blockingInclusiveScan() on iterators
+template <typename InputIterator, typename OutputIterator,
+          typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessIterator<InputIterator> = true,
+          QtPrivate::IfIsRandomAccessIterator<OutputIterator> = true>
+void blockingInclusiveScan(QThreadPool *pool, InputIterator begin, InputIterator end,
+                           OutputIterator destination, BinaryOperation &&operation = {})
+{
+    QFuture<void> future = inclusiveScan(pool, begin, end, destination,
+                                         std::forward<BinaryOperation>(operation));
+    future.waitForFinished();
+}
+
+template <typename InputIterator, typename OutputIterator,
+          typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessIterator<InputIterator> = true,
+          QtPrivate::IfIsRandomAccessIterator<OutputIterator> = true>
+void blockingInclusiveScan(InputIterator begin, InputIterator end, OutputIterator destination,
+                           BinaryOperation &&operation = {})
+{
+    QFuture<void> future = inclusiveScan(QThreadPool::globalInstance(), begin, end, destination,
+                                         std::forward<BinaryOperation>(operation));
+    future.waitForFinished();
+}
+
+// blockingExclusiveScan() on sequences, in place
+template <typename Sequence, typename T, typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+void blockingExclusiveScan(QThreadPool *pool, Sequence &&sequence, T &&initialValue,
+                           BinaryOperation &&operation = {})
+{
+    QFuture<void> future = exclusiveScan(pool, std::forward<Sequence>(sequence),
+                                         std::forward<T>(initialValue),
+                                         std::forward<BinaryOperation>(operation));
+    future.waitForFinished();
+}
+
+template <typename Sequence, typename T, typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+void blockingExclusiveScan(Sequence &&sequence, T &&initialValue,
+                           BinaryOperation &&operation = {})
+{
+    QFuture<void> future = exclusiveScan(QThreadPool::globalInstance(),
+                                         std::forward<Sequence>(sequence),
+                                         std::forward<T>(initialValue),
+                                         std::forward<BinaryOperation>(operation));
+    future.waitForFinished();
+}
+
+// blockingExclusiveScan() on iterators
+template <typename InputIterator, typename OutputIterator, typename T,
+          typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessIterator<InputIterator> = true,
+          QtPrivate::IfIsRandomAccessIterator<OutputIterator> = true>
+void blockingExclusiveScan(QThreadPool *pool, InputIterator begin, InputIterator end,
+                           OutputIterator destination, T &&initialValue,
+                           BinaryOperation &&operation = {})
+{
+    QFuture<void> future = exclusiveScan(pool, begin, end, destination,
+                                         std::forward<T>(initialValue),
+                                         std::forward<BinaryOperation>(operation));
+    future.waitForFinished();
+}
+
+template <typename InputIterator, typename OutputIterator, typename T,
+          typename BinaryOperation = std::plus<>,
+          QtPrivate::IfIsRandomAccessIterator<InputIterator> = true,
+          QtPrivate::IfIsRandomAccessIterator<OutputIterator> = true>
+void blockingExclusiveScan(InputIterator begin, InputIterator end, OutputIterator destination,
+                           T &&initialValue, BinaryOperation &&operation = {})
+{
+    QFuture<void> future = exclusiveScan(QThreadPool::globalInstance(), begin, end, destination,
+                                         std::forward<T>(initialValue),
+                                         std::forward<BinaryOperation>(operation));
+    future.waitForFinished();
+}
+
+// blockingTransformReduce() on sequences
+template <typename Sequence, typename T, typename ReduceOperation, typename TransformOperation,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+std::decay_t<T> blockingTransformReduce(QThreadPool *pool, Sequence &&sequence, T &&initialValue,
+                                        ReduceOperation &&reduce, TransformOperation &&transform)
+{
+    QFuture<std::decay_t<T>> future =
+            transformReduce(pool, std::forward<Sequence>(sequence), std::forward<T>(initialValue),
+                            std::forward<ReduceOperation>(reduce),
+                            std::forward<TransformOperation>(transform));
+    return future.takeResult();
+}
+
+template <typename Sequence, typename T, typename ReduceOperation, typename TransformOperation,
+          QtPrivate::IfIsRandomAccessSequence<Sequence> = true>
+std::decay_t<T> blockingTransformReduce(Sequence &&sequence, T &&initialValue,
+                                        ReduceOperation &&reduce, TransformOperation &&transform)
+{
+    QFuture<std::decay_t<T>> future =
+            transformReduce(QThreadPool::globalInstance(), std::forward<Sequence>(sequence),
+                            std::forward<T>(initialValue), std::forward<ReduceOperation>(reduce),
+                            std::forward<TransformOperation>(transform));
+    return future.takeResult();
+}
+
+// blockingTransformReduce() on iterators
+template <typename Iterator, typename T, typename ReduceOperation, typename TransformOperation,
+          QtPrivate::IfIsRandomAccessIterator<Iterator> = true>
+std::decay_t<T> blockingTransformReduce(QThreadPool *pool, Iterator begin, Iterator end,
+                                        T &&initialValue, ReduceOperation &&reduce,
+                                        TransformOperation &&transform)
+{
+    QFuture<std::decay_t<T>> future =
+            transformReduce(pool, begin, end, std::forward<T>(initialValue),
+                            std::forward<ReduceOperation>(reduce),
+                            std::forward<TransformOperation>(transform));
+    return future.takeResult();
+}
+
+template <typename Iterator, typename T, typename ReduceOperation, typename TransformOperation,
+          QtPrivate::IfIsRandomAccessIterator<Iterator> = true>
+std::decay_t<T> blockingTransformReduce(Iterator begin, Iterator end, T &&initialValue,
+                                        ReduceOperation &&reduce, TransformOperation &&transform)
+{
+    QFuture<std::decay_t<T>> future =
+            transformReduce(QThreadPool::globalInstance(), begin, end,
+                            std::forward<T>(initialValue), std::forward<ReduceOperation>(reduce),
+                            std::forward<TransformOperation>(transform));
+    return future.takeResult();
+}
+
+} // namespace QtConcurrent
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_CONCURRENT
+
+#endif
@@ -0,0 +1,470 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTCONCURRENT_ALGORITHMKERNEL_H
+#define QTCONCURRENT_ALGORITHMKERNEL_H
+
+#include <QtConcurrent/qtconcurrent_global.h>
+
+#if !defined(QT_NO_CONCURRENT) || defined(Q_QDOC)
+
+#include <QtConcurrent/qtconcurrentiteratekernel.h>
+#include <QtConcurrent/qtconcurrentreducekernel.h>
+#include <QtConcurrent/qtconcurrentthreadengine.h>
+#include <QtCore/qatomic.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+
+template <typename Iterator>
+using IfIsRandomAccessIterator = typename std::enable_if<
+    std::is_convertible<typename std::iterator_traits<Iterator>::iterator_category,
+                        std::random_access_iterator_tag>::value,
+    bool>::type;
+
+template <typename Sequence>
+using IfIsRandomAccessSequence = IfIsRandomAccessIterator<
+    decltype(std::declval<std::remove_reference_t<Sequence> &>().begin())>;
+
+} // namespace QtPrivate
+
+namespace QtConcurrent {
+
+/*
+    Chunks are made no smaller than this, so that spreading the work over
+    the threads doesn't cost more than it gains.
+*/
+enum {
+    MinimumAlgorithmChunkSize = 2048
+};
+
+inline int algorithmChunkCount(QThreadPool *pool, qsizetype count, int chunksPerThread)
+{
+    const qsizetype maximum = qsizetype(std::max(pool->maxThreadCount(), 1)) * chunksPerThread;
+    const qsizetype wanted = (count + MinimumAlgorithmChunkSize - 1) / MinimumAlgorithmChunkSize;
+    return int(std::max(qsizetype(1), std::min(maximum, wanted)));
+}
+
+/*
+    The PhasedKernel class runs an algorithm as a sequence of phases, each
+    made of a number of tasks. The tasks of one phase are independent of each
+    other and are handed out to the threads in any order. The thread that
+    completes the last task of a phase calls finishPhase(), and only then are
+    the tasks of the next phase handed out.
+
+    A phase always runs to completion; cancellation takes effect before the
+    next one starts, so that the data is left in a consistent state.
+*/
+template <typename T>
+class PhasedKernel : public ThreadEngine<T>
+{
+public:
+    explicit PhasedKernel(QThreadPool *pool) : ThreadEngine<T>(pool) { }
+
+    virtual void runTask(int phase, int task) = 0;
+    virtual void finishPhase(int) { }
+
+    void start() override
+    {
+        progressReportingEnabled = this->isProgressReportingEnabled();
+        if (progressReportingEnabled && !phaseEnds.isEmpty())
+            this->setProgressRange(0, phaseEnds.last());
+        readyTasks.storeRelaxed(phaseEnds.isEmpty() ? 0 : phaseEnds.first());
+    }
+
+    bool shouldStartThread() override
+    {
+        return nextTask.loadRelaxed() < readyTasks.loadRelaxed() && !this->shouldThrottleThread();
+    }
+
+    ThreadFunctionResult threadFunction() override
+    {
+        for (;;) {
+            // Atomically reserve a task of the phase that's running.
+            int task = nextTask.loadRelaxed();
+            do {
+                if (task >= readyTasks.loadAcquire())
+                    return ThreadFinished;
+            } while (!nextTask.testAndSetRelaxed(task, task + 1, task));
+
+            this->waitForResume(); // (only waits if the qfuture is paused.)
+
+            if (shouldStartThread())
+                this->startThread();
+
+            const int phase = phaseOf(task);
+            runTask(phase, task - (phase > 0 ? phaseEnds.at(phase - 1) : 0));
+
+            const int completed = completedTasks.fetchAndAddOrdered(1) + 1;
+            if (progressReportingEnabled)
+                this->setProgressValue(completed);
+
+            if (completed == phaseEnds.at(phase)) {
+                finishPhase(phase);
+                finishedPhases = phase + 1;
+                if (phase + 1 < phaseEnds.size() && !this->isCanceled())
+                    readyTasks.storeRelease(phaseEnds.at(phase + 1));
+            }
+
+            if (this->shouldThrottleThread())
+                return ThrottleThread;
+        }
+    }
+
+protected:
+    // Must be called from the constructor, with taskCount > 0.
+    void addPhase(int taskCount)
+    {
+        Q_ASSERT(taskCount > 0);
+        phaseEnds.append((phaseEnds.isEmpty() ? 0 : phaseEnds.last()) + taskCount);
+    }
+
+    // Only valid in finish(), once all threads are done.
+    int phasesFinished() const { return finishedPhases; }
+
+private:
+    int phaseOf(int task) const
+    {
+        int phase = 0;
+        while (task >= phaseEnds.at(phase))
+            ++phase;
+        return phase;
+    }
+
+    QVarLengthArray<int, 16> phaseEnds; // cumulative task counts
+    QAtomicInt nextTask;
+    QAtomicInt readyTasks;
+    QAtomicInt completedTasks;
+    int finishedPhases = 0;
+    bool progressReportingEnabled = false;
+};
+
+/*
+    Sorts the chunks of the range in parallel, then merges pairs of sorted
+    runs in rounds until one run is left. Every merge round is split into as
+    many tasks as there are chunks, each producing one chunk of output, by
+    finding the positions in the two runs that the output chunk starts and
+    ends at. The merge rounds move the elements back and forth between the
+    range and a buffer, and types that can't be put into a buffer are merged
+    in place, one task per pair of runs.
+*/
+template <typename Iterator, typename Compare>
+class SortKernel : public PhasedKernel<void>
+{
+    using ValueType = typename std::iterator_traits<Iterator>::value_type;
+    static constexpr bool UseBuffer = std::is_default_constructible_v<ValueType>;
+
+public:
+    template <typename C = Compare>
+    SortKernel(QThreadPool *pool, Iterator _begin, Iterator _end, C &&_compare)
+        : PhasedKernel<void>(pool),
+          begin(_begin),
+          count(std::distance(_begin, _end)),
+          chunkCount(algorithmChunkCount(pool, count, 1)),
+          compare(std::forward<C>(_compare))
+    {
+        while ((1 << mergeRounds) < chunkCount)
+            ++mergeRounds;
+
+        addPhase(chunkCount);
+        for (int round = 0; round < mergeRounds; ++round)
+            addPhase(chunkCount);
+        if constexpr (UseBuffer) {
+            if (mergeRounds > 0)
+                buffer.reset(new ValueType[count]);
+            // the result of an odd number of rounds is in the buffer
+            if (mergeRounds % 2)
+                addPhase(chunkCount);
+        }
+    }
+
+    void runTask(int phase, int task) override
+    {
+        Compare comp = compare;
+        if (phase == 0) {
+            std::sort(begin + chunkBegin(task), begin + chunkBegin(task + 1), comp);
+        } else if (phase > mergeRounds) {
+            std::move(buffer.get() + chunkBegin(task), buffer.get() + chunkBegin(task + 1),
+                      begin + chunkBegin(task));
+        } else if constexpr (UseBuffer) {
+            if (phase % 2)
+                mergeChunk(begin, buffer.get(), phase, task, comp);
+            else
+                mergeChunk(buffer.get(), begin, phase, task, comp);
+        } else {
+            const int runChunks = 1 << (phase - 1);
+            if (task % (2 * runChunks) == 0) {
+                const int middle = std::min(task + runChunks, chunkCount);
+                const int end = std::min(task + 2 * runChunks, chunkCount);
+                std::inplace_merge(begin + chunkBegin(task), begin + chunkBegin(middle),
+                                   begin + chunkBegin(end), comp);
+            }
+        }
+    }
+
+    void finish() override
+    {
+        // If canceled with the elements in the buffer, move them back.
+        if constexpr (UseBuffer) {
+            const int rounds = std::clamp(phasesFinished() - 1, 0, mergeRounds);
+            if (rounds % 2 && phasesFinished() <= mergeRounds + 1)
+                std::move(buffer.get(), buffer.get() + count, begin);
+        }
+        buffer.reset();
+    }
+
+private:
+    qsizetype chunkBegin(int chunk) const
+    {
+        return qsizetype(qint64(count) * chunk / chunkCount);
+    }
+
+    // Returns how many elements of the first run are among the first
+    // outputIndex elements of merging both runs. std::merge takes from the
+    // first run if elements are equal, and so does this.
+    template <typename RunIterator>
+    static qsizetype splitPosition(RunIterator first, qsizetype firstCount,
+                                   RunIterator second, qsizetype secondCount,
+                                   qsizetype outputIndex, Compare &comp)
+    {
+        qsizetype low = std::max(qsizetype(0), outputIndex - secondCount);
+        qsizetype high = std::min(outputIndex, firstCount);
+        while (low < high) {
+            const qsizetype i = low + (high - low) / 2;
+            const qsizetype j = outputIndex - i;
+            if (j > 0 && i < firstCount && !comp(second[j - 1], first[i]))
+                low = i + 1;
+            else
+                high = i;
+        }
+        return low;
+    }
+
+    template <typename Source, typename Destination>
+    void mergeChunk(Source source, Destination destination, int round, int task, Compare &comp)
+    {
+        const int runChunks = 1 << (round - 1);
+        const int firstChunk = task / (2 * runChunks) * (2 * runChunks);
+        const qsizetype first = chunkBegin(firstChunk);
+        const qsizetype middle = chunkBegin(std::min(firstChunk + runChunks, chunkCount));
+        const qsizetype end = chunkBegin(std::min(firstChunk + 2 * runChunks, chunkCount));
+
+        const qsizetype outputBegin = chunkBegin(task) - first;
+        const qsizetype outputEnd = chunkBegin(task + 1) - first;
+        const qsizetype i0 = splitPosition(source + first, middle - first, source + middle,
+                                           end - middle, outputBegin, comp);
+        const qsizetype i1 = splitPosition(source + first, middle - first, source + middle,
+                                           end - middle, outputEnd, comp);
+
+        std::merge(std::make_move_iterator(source + first + i0),
+                   std::make_move_iterator(source + first + i1),
+                   std::make_move_iterator(source + middle + (outputBegin - i0)),
+                   std::make_move_iterator(source + middle + (outputEnd - i1)),
+                   destination + first + outputBegin, comp);
+    }
+
+    const Iterator begin;
+    const qsizetype count;
+    const int chunkCount;
+    int mergeRounds = 0;
+    Compare compare;
+    std::unique_ptr<ValueType[]> buffer;
+};
+
+/*
+    Scans in two passes over the range: first the chunks are reduced in
+    parallel, and the thread that reduces the last one combines the chunk
+    sums into the value carried into each chunk. Then all chunks are scanned
+    in parallel, each starting from its carry. The last chunk doesn't need
+    to be reduced.
+*/
+template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation,
+          bool Inclusive>
+class ScanKernel : public PhasedKernel<void>
+{
+public:
+    template <typename Op = BinaryOperation>
+    ScanKernel(QThreadPool *pool, InputIterator _begin, InputIterator _end,
+               OutputIterator _destination, std::optional<T> &&initialValue, Op &&_operation)
+        : PhasedKernel<void>(pool),
+          begin(_begin),
+          destination(_destination),
+          count(std::distance(_begin, _end)),
+          chunkCount(count > 0 ? algorithmChunkCount(pool, count, ChunksPerThread) : 0),
+          operation(std::forward<Op>(_operation)),
+          carries(chunkCount)
+    {
+        if (chunkCount > 1)
+            addPhase(chunkCount - 1);
+        if (chunkCount > 0) {
+            addPhase(chunkCount);
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_GCC("-Wmaybe-uninitialized") // older GCC don't like libstdc++'s std::optional
+            carries[0] = std::move(initialValue);
+QT_WARNING_POP
+        }
+    }
+
+    void runTask(int phase, int task) override
+    {
+        BinaryOperation op = operation;
+        if (phase == 0 && chunkCount > 1) {
+            InputIterator it = begin + chunkBegin(task);
+            const InputIterator end = begin + chunkBegin(task + 1);
+            T sum = *it;
+            while (++it != end)
+                sum = std::invoke(op, std::move(sum), *it);
+            carries[task + 1] = std::move(sum);
+            return;
+        }
+
+        // Chunks are never empty.
+        qsizetype i = chunkBegin(task);
+        const qsizetype end = chunkBegin(task + 1);
+        if constexpr (Inclusive) {
+            T sum = carries[task] ? std::invoke(op, std::move(*carries[task]), begin[i])
+                                  : T(begin[i]);
+            destination[i] = sum;
+            while (++i < end) {
+                sum = std::invoke(op, std::move(sum), begin[i]);
+                destination[i] = sum;
+            }
+        } else {
+            T sum = std::move(*carries[task]);
+            for (; i < end; ++i) {
+                // The input may be the output, so read before writing.
+                T next = std::invoke(op, sum, begin[i]);
+                destination[i] = std::move(sum);
+                sum = std::move(next);
+            }
+        }
+    }
+
+    void finishPhase(int phase) override
+    {
+        if (phase != 0 || chunkCount < 2)
+            return;
+        BinaryOperation op = operation;
+        for (int chunk = 1; chunk < chunkCount; ++chunk) {
+            if (carries[chunk - 1])
+                carries[chunk] = std::invoke(op, *carries[chunk - 1], std::move(*carries[chunk]));
+        }
+    }
+
+private:
+    qsizetype chunkBegin(int chunk) const
+    {
+        return qsizetype(qint64(count) * chunk / chunkCount);
+    }
+
+    const InputIterator begin;
+    const OutputIterator destination;
+    const qsizetype count;
+    const int chunkCount;
+    BinaryOperation operation;
+    std::vector<std::optional<T>> carries;
+};
+
+/*
+    Reduces the transformed elements of each chunk in parallel. The thread
+    that finishes the last chunk folds the partial results into the initial
+    value, in the order of the chunks.
+*/
+template <typename Iterator, typename T, typename ReduceOperation, typename TransformOperation>
+class TransformReduceKernel : public PhasedKernel<T>
+{
+public:
+    template <typename U = T, typename Reduce = ReduceOperation,
+              typename Transform = TransformOperation>
+    TransformReduceKernel(QThreadPool *pool, Iterator _begin, Iterator _end, U &&initialValue,
+                          Reduce &&_reduce, Transform &&_transform)
+        : PhasedKernel<T>(pool),
+          begin(_begin),
+          count(std::distance(_begin, _end)),
+          chunkCount(count > 0 ? algorithmChunkCount(pool, count, ChunksPerThread) : 0),
+          reduce(std::forward<Reduce>(_reduce)),
+          transform(std::forward<Transform>(_transform)),
+          partialResults(chunkCount),
+          reducedResult(std::forward<U>(initialValue))
+    {
+        if (chunkCount > 0)
+            this->addPhase(chunkCount);
+    }
+
+    void runTask(int, int task) override
+    {
+        ReduceOperation r = reduce;
+        TransformOperation t = transform;
+        Iterator it = begin + chunkBegin(task);
+        const Iterator end = begin + chunkBegin(task + 1);
+        T partial = std::invoke(t, *it);
+        while (++it != end)
+            partial = std::invoke(r, std::move(partial), std::invoke(t, *it));
+        partialResults[task] = std::move(partial);
+    }
+
+    void finishPhase(int) override
+    {
+        ReduceOperation r = reduce;
+        for (std::optional<T> &partial : partialResults)
+            reducedResult = std::invoke(r, std::move(reducedResult), std::move(*partial));
+        partialResults.clear();
+    }
+
+    T *result() override
+    {
+        return &reducedResult;
+    }
+
+private:
+    qsizetype chunkBegin(int chunk) const
+    {
+        return qsizetype(qint64(count) * chunk / chunkCount);
+    }
+
+    const Iterator begin;
+    const qsizetype count;
+    const int chunkCount;
+    ReduceOperation reduce;
+    TransformOperation transform;
+    std::vector<std::optional<T>> partialResults;
+    T reducedResult;
+};
+
+/*
+    Holds a copy of the sequence that a read-only algorithm runs on.
+*/
+template <typename Sequence, typename Base>
+struct AlgorithmSequenceHolder : private QtPrivate::SequenceHolder<Sequence>, public Base
+{
+    template <typename S = Sequence, typename... Args>
+    AlgorithmSequenceHolder(QThreadPool *pool, S &&_sequence, Args &&...args)
+        : QtPrivate::SequenceHolder<Sequence>(std::forward<S>(_sequence)),
+          Base(pool, this->sequence.cbegin(), this->sequence.cend(), std::forward<Args>(args)...)
+    { }
+
+    void finish() override
+    {
+        Base::finish();
+        // Clear the sequence to make sure all temporaries are destroyed
+        // before finished is signaled.
+        this->sequence = Sequence();
+    }
+};
+
+} // namespace QtConcurrent
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_CONCURRENT
+
+#endif
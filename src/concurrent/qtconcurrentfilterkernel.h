@@ -59,7 +59,7 @@ public:
           sequence(_sequence),
           keep(std::forward<Keep>(_keep)),
           reduce(std::forward<Reduce>(_reduce)),
-          reducer(pool, OrderedReduce)
+          reducer(pool, OrderedReduce, this->chunkSize)
     { }
 
     bool runIteration(typename Sequence::const_iterator it, int index, T *) override
@@ -139,7 +139,7 @@ public:
           reducedResult(this->defaultValue.value),
           keep(std::forward<Keep>(_keep)),
           reduce(std::forward<Reduce>(_reduce)),
-          reducer(pool, reduceOption)
+          reducer(pool, reduceOption, this->chunkSize)
     { }
 
     template <typename Keep = KeepFunctor, typename Reduce = ReduceFunctor>
@@ -150,7 +150,7 @@ public:
           reducedResult(this->defaultValue.value),
           keep(std::forward<Keep>(_keep)),
           reduce(std::forward<Reduce>(_reduce)),
-          reducer(pool, reduceOption)
+          reducer(pool, reduceOption, this->chunkSize)
     {
     }
 
@@ -58,6 +58,13 @@ namespace QtConcurrent {
   \internal
  */
 
+/*! \fn int QtConcurrent::partitionChunkSize(QThreadPool *pool, int iterationCount)
+  \internal
+
+  Returns the size of the chunks that \a iterationCount iterations run on
+  \a pool are partitioned into.
+ */
+
 /*!
   \class QtConcurrent::IterateKernel
   \inmodule QtConcurrent
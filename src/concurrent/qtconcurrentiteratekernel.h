@@ -143,6 +143,22 @@ inline bool selectIteration(std::random_access_iterator_tag)
     return true; // for
 }
 
+/*
+    Random-access ranges are partitioned up front into ChunksPerThread
+    contiguous chunks per pool thread. Blocks handed out to the threads never
+    cross a chunk boundary, which bounds the block size for load balancing and
+    lets the reduce kernel file pending results by chunk.
+*/
+enum {
+    ChunksPerThread = 4
+};
+
+inline int partitionChunkSize(QThreadPool *pool, int iterationCount)
+{
+    const int chunkCount = std::max(pool->maxThreadCount(), 1) * int(ChunksPerThread);
+    return std::max(1, int((qint64(iterationCount) + chunkCount - 1) / chunkCount));
+}
+
 template <typename Iterator, typename T>
 class IterateKernel : public ThreadEngine<T>
 {
@@ -159,6 +175,7 @@ public:
           current(_begin),
           iterationCount(selectIteration(IteratorCategory()) ? static_cast<int>(std::distance(_begin, _end)) : 0),
           forIteration(selectIteration(IteratorCategory())),
+          chunkSize(forIteration ? partitionChunkSize(pool, iterationCount) : 1),
           progressReportingEnabled(true)
     {
     }
@@ -171,6 +188,7 @@ public:
           current(_begin),
           iterationCount(selectIteration(IteratorCategory()) ? static_cast<int>(std::distance(_begin, _end)) : 0),
           forIteration(selectIteration(IteratorCategory())),
+          chunkSize(forIteration ? partitionChunkSize(pool, iterationCount) : 1),
           progressReportingEnabled(true),
           defaultValue(U())
     {
@@ -184,6 +202,7 @@ public:
           current(_begin),
           iterationCount(selectIteration(IteratorCategory()) ? static_cast<int>(std::distance(_begin, _end)) : 0),
           forIteration(selectIteration(IteratorCategory())),
+          chunkSize(forIteration ? partitionChunkSize(pool, iterationCount) : 1),
           progressReportingEnabled(true),
           defaultValue(std::forward<U>(_defaultValue))
     {
@@ -231,11 +250,19 @@ public:
             if (currentIndex.loadRelaxed() >= iterationCount)
                 break;
 
-            // Atomically reserve a block of iterationCount for this thread.
-            const int beginIndex = currentIndex.fetchAndAddRelease(currentBlockSize);
-            const int endIndex = qMin(beginIndex + currentBlockSize, iterationCount);
-
-            if (beginIndex >= endIndex) {
+            // Atomically reserve a block of iterationCount for this thread,
+            // without crossing the end of the chunk the block starts in.
+            int beginIndex = currentIndex.loadRelaxed();
+            int endIndex = beginIndex;
+            do {
+                if (beginIndex >= iterationCount)
+                    break;
+                const qint64 chunkEnd = (qint64(beginIndex) / chunkSize + 1) * chunkSize;
+                endIndex = int(qMin(qMin(qint64(beginIndex) + currentBlockSize, chunkEnd),
+                                    qint64(iterationCount)));
+            } while (!currentIndex.testAndSetRelease(beginIndex, endIndex, beginIndex));
+
+            if (beginIndex >= iterationCount) {
                 // No more work
                 break;
             }
@@ -322,6 +349,7 @@ public:
     QAtomicInt completed;
     const int iterationCount;
     const bool forIteration;
+    const int chunkSize;
     bool progressReportingEnabled;
     DefaultValueContainer<ResultType> defaultValue;
 };
@@ -43,6 +43,12 @@
             \l {QtConcurrent::mapped}{QtConcurrent::mapped()},
             \l {QtConcurrent::mappedReduced}{QtConcurrent::mappedReduced()}
         \li \c <QtConcurrentMap>
+    \row
+        \li \l {QtConcurrent::sort}{QtConcurrent::sort()},
+            \l {QtConcurrent::inclusiveScan}{QtConcurrent::inclusiveScan()},
+            \l {QtConcurrent::exclusiveScan}{QtConcurrent::exclusiveScan()},
+            \l {QtConcurrent::transformReduce}{QtConcurrent::transformReduce()}
+        \li \c <QtConcurrentAlgorithm>
     \endtable
 
     \inheaderfile QtConcurrent
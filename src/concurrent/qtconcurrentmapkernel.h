@@ -74,7 +74,7 @@ public:
           reducedResult(this->defaultValue.value),
           map(std::forward<F1>(_map)),
           reduce(std::forward<F2>(_reduce)),
-          reducer(pool, reduceOptions)
+          reducer(pool, reduceOptions, this->chunkSize)
     { }
 
     template<typename F1 = MapFunctor, typename F2 = ReduceFunctor>
@@ -85,7 +85,7 @@ public:
           reducedResult(this->defaultValue.value),
           map(std::forward<F1>(_map)),
           reduce(std::forward<F2>(_reduce)),
-          reducer(pool, reduceOptions)
+          reducer(pool, reduceOptions, this->chunkSize)
     {
     }
 
@@ -11,12 +11,13 @@
 
 #include <QtCore/qatomic.h>
 #include <QtCore/qlist.h>
-#include <QtCore/qmap.h>
 #include <QtCore/qmutex.h>
 #include <QtCore/qthread.h>
 #include <QtCore/qthreadpool.h>
 
+#include <algorithm>
 #include <mutex>
+#include <utility>
 
 QT_BEGIN_NAMESPACE
 
@@ -78,14 +79,22 @@ Q_DECLARE_OPERATORS_FOR_FLAGS(ReduceOptions)
 template <typename ReduceFunctor, typename ReduceResultType, typename T>
 class ReduceKernel
 {
-    typedef QMap<int, IntermediateResults<T> > ResultsMap;
+    // Results that can't be reduced right away are filed into one slot per
+    // chunk of iterations, starting with the chunk that ordered reduction
+    // has progressed to. The iterate kernel doesn't hand out blocks across
+    // chunk boundaries, so a slot only ever holds a few blocks. Unordered
+    // reduction files all results into the first slot.
+    typedef QList<IntermediateResults<T> > ResultsSlot;
+    typedef QList<ResultsSlot> ResultsSlots;
 
     const ReduceOptions reduceOptions;
+    const int chunkSize;
 
     QMutex mutex;
-    int progress, resultsMapSize;
+    int progress, firstChunk;
+    QAtomicInt resultsCount;
     const int threadCount;
-    ResultsMap resultsMap;
+    ResultsSlots resultsSlots;
 
     bool canReduce(int begin) const
     {
@@ -95,6 +104,38 @@ class ReduceKernel
                     && progress == begin));
     }
 
+    void storeResult(const IntermediateResults<T> &result)
+    {
+        const qsizetype slot = (reduceOptions & UnorderedReduce)
+                ? 0 : result.begin / chunkSize - firstChunk;
+        if (slot >= resultsSlots.size())
+            resultsSlots.resize(slot + 1);
+        resultsSlots[slot].append(result);
+        resultsCount.ref();
+    }
+
+    // Takes the stored result that continues the ordered reduction, if any.
+    bool takeNextResult(IntermediateResults<T> *next)
+    {
+        // The slots of chunks that were passed are empty.
+        const int chunk = progress / chunkSize;
+        resultsSlots.remove(0, qMin(qsizetype(chunk - firstChunk), resultsSlots.size()));
+        firstChunk = chunk;
+
+        if (resultsSlots.isEmpty())
+            return false;
+
+        ResultsSlot &slot = resultsSlots.first();
+        for (qsizetype i = 0; i < slot.size(); ++i) {
+            if (slot.at(i).begin == progress) {
+                *next = slot.takeAt(i);
+                resultsCount.deref();
+                return true;
+            }
+        }
+        return false;
+    }
+
     void reduceResult(ReduceFunctor &reduce,
                       ReduceResultType &r,
                       const IntermediateResults<T> &result)
@@ -106,18 +147,22 @@ class ReduceKernel
 
     void reduceResults(ReduceFunctor &reduce,
                        ReduceResultType &r,
-                       ResultsMap &map)
+                       ResultsSlots &results)
     {
-        typename ResultsMap::iterator it = map.begin();
-        while (it != map.end()) {
-            reduceResult(reduce, r, it.value());
-            ++it;
+        for (ResultsSlot &slot : results) {
+            std::sort(slot.begin(), slot.end(),
+                      [](const IntermediateResults<T> &lhs, const IntermediateResults<T> &rhs) {
+                          return lhs.begin < rhs.begin;
+                      });
+            for (const IntermediateResults<T> &result : std::as_const(slot))
+                reduceResult(reduce, r, result);
         }
     }
 
 public:
-    ReduceKernel(QThreadPool *pool, ReduceOptions _reduceOptions)
-        : reduceOptions(_reduceOptions), progress(0), resultsMapSize(0),
+    ReduceKernel(QThreadPool *pool, ReduceOptions _reduceOptions, int _chunkSize = 1)
+        : reduceOptions(_reduceOptions), chunkSize(std::max(_chunkSize, 1)),
+          progress(0), firstChunk(0),
           threadCount(std::max(pool->maxThreadCount(), 1))
     { }
 
@@ -127,8 +172,7 @@ public:
     {
         std::unique_lock<QMutex> locker(mutex);
         if (!canReduce(result.begin)) {
-            ++resultsMapSize;
-            resultsMap.insert(result.begin, result);
+            storeResult(result);
             return;
         }
 
@@ -142,15 +186,15 @@ public:
             locker.lock();
 
             // reduce all stored results as well
-            while (!resultsMap.isEmpty()) {
-                ResultsMap resultsMapCopy = resultsMap;
-                resultsMap.clear();
+            while (!resultsSlots.isEmpty()) {
+                ResultsSlots resultsSlotsCopy = std::exchange(resultsSlots, ResultsSlots());
+                const int count = int(resultsSlotsCopy.first().size());
 
                 locker.unlock();
-                reduceResults(reduce, r, resultsMapCopy);
+                reduceResults(reduce, r, resultsSlotsCopy);
                 locker.lock();
 
-                resultsMapSize -= resultsMapCopy.size();
+                resultsCount.fetchAndSubRelaxed(count);
             }
 
             progress = 0;
@@ -164,18 +208,13 @@ public:
             progress += result.end - result.begin;
 
             // reduce as many other results as possible
-            typename ResultsMap::iterator it = resultsMap.begin();
-            while (it != resultsMap.end()) {
-                if (it.value().begin != progress)
-                    break;
-
+            IntermediateResults<T> next;
+            while (takeNextResult(&next)) {
                 locker.unlock();
-                reduceResult(reduce, r, it.value());
+                reduceResult(reduce, r, next);
                 locker.lock();
 
-                --resultsMapSize;
-                progress += it.value().end - it.value().begin;
-                it = resultsMap.erase(it);
+                progress += next.end - next.begin;
             }
         }
     }
@@ -183,19 +222,17 @@ public:
     // final reduction
     void finish(ReduceFunctor &reduce, ReduceResultType &r)
     {
-        reduceResults(reduce, r, resultsMap);
+        reduceResults(reduce, r, resultsSlots);
     }
 
     inline bool shouldThrottle()
     {
-        std::lock_guard<QMutex> locker(mutex);
-        return (resultsMapSize > (ReduceQueueThrottleLimit * threadCount));
+        return (resultsCount.loadRelaxed() > (ReduceQueueThrottleLimit * threadCount));
     }
 
     inline bool shouldStartThread()
     {
-        std::lock_guard<QMutex> locker(mutex);
-        return (resultsMapSize <= (ReduceQueueStartLimit * threadCount));
+        return (resultsCount.loadRelaxed() <= (ReduceQueueStartLimit * threadCount));
     }
 };
 
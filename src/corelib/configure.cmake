@@ -315,6 +315,27 @@ inotify_rm_watch(0, 1);
 }
 ")
 
+# fanotify
+qt_config_compile_test(fanotify
+    LABEL "fanotify with directory file handles"
+    CODE
+"#include <sys/fanotify.h>
+#include <fcntl.h>
+
+int main(void)
+{
+    /* BEGIN TEST: */
+int fd = fanotify_init(FAN_CLASS_NOTIF | FAN_CLOEXEC | FAN_NONBLOCK | FAN_REPORT_DFID_NAME,
+                       O_RDONLY);
+fanotify_mark(fd, FAN_MARK_ADD | FAN_MARK_FILESYSTEM, FAN_CREATE | FAN_ONDIR, AT_FDCWD, \"/\");
+struct file_handle *handle = nullptr;
+open_by_handle_at(fd, handle, O_PATH);
+(void)sizeof(struct fanotify_event_info_fid);
+    /* END TEST: */
+    return 0;
+}
+")
+
 # fsnotify
 qt_config_compile_test(fsnotify
     LABEL "libfsnotify"
@@ -573,6 +594,25 @@ int main()
 }
 ")
 
+# epoll
+qt_config_compile_test(epoll
+    LABEL "epoll"
+    CODE
+"#include <sys/epoll.h>
+
+int main(void)
+{
+    /* BEGIN TEST: */
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN;
+    int fd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_ctl(fd, EPOLL_CTL_ADD, 0, &ev);
+    epoll_wait(fd, &ev, 1, 0);
+    /* END TEST: */
+    return 0;
+}
+")
+
 # renameat2
 qt_config_compile_test(renameat2
     LABEL "renameat2()"
@@ -852,6 +892,11 @@ qt_feature("fsnotify"
     CONDITION TEST_fsnotify
 )
 qt_feature_definition("inotify" "QT_NO_INOTIFY" NEGATE VALUE "1")
+qt_feature("fanotify" PRIVATE
+    LABEL "fanotify"
+    PURPOSE "Provides recursive QFileSystemWatcher watches through fanotify(7), where permitted."
+    CONDITION LINUX AND QT_FEATURE_inotify AND TEST_fanotify
+)
 qt_feature("ipc_posix"
     LABEL "Defaulting legacy IPC to POSIX"
     CONDITION TEST_posix_shm AND TEST_posix_sem AND (
@@ -883,6 +928,12 @@ qt_feature("linkat" PRIVATE
     AUTODETECT ( LINUX AND NOT ANDROID ) OR HURD
     CONDITION TEST_linkat
 )
+qt_feature("epoll" PRIVATE
+    LABEL "epoll()"
+    AUTODETECT LINUX
+    CONDITION UNIX AND NOT WASM AND TEST_epoll
+    PURPOSE "Provides an epoll(7) based event dispatcher (QT_EVENT_DISPATCHER=epoll)."
+)
 qt_feature("liburing" PRIVATE
     LABEL "liburing"
     AUTODETECT LINUX
@@ -1325,6 +1376,8 @@ qt_configure_add_summary_entry(ARGS "cxx23_stacktrace")
 qt_configure_add_summary_entry(ARGS "doubleconversion")
 qt_configure_add_summary_entry(ARGS "system-doubleconversion")
 qt_configure_add_summary_entry(ARGS "forkfd_pidfd" CONDITION LINUX)
+qt_configure_add_summary_entry(ARGS "epoll" CONDITION LINUX)
+qt_configure_add_summary_entry(ARGS "fanotify" CONDITION LINUX)
 qt_configure_add_summary_entry(ARGS "glib")
 qt_configure_add_summary_entry(ARGS "icu")
 qt_configure_add_summary_entry(ARGS "jemalloc")
@@ -0,0 +1,28 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+#include <QDebug>
+#include <QFile>
+#include <QJsonDocumentView>
+#include <QJsonParseError>
+
+void printVersion(QFile *file)
+{
+    //! [0]
+    if (!file->open(QIODevice::ReadOnly))
+        return;
+    const uchar *mapped = file->map(0, file->size());
+    if (!mapped)
+        return;
+
+    const QByteArray data =
+            QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), file->size());
+    QJsonParseError error;
+    const QJsonDocumentView document = QJsonDocumentView::fromJson(data, &error);
+    if (document.isNull()) {
+        qWarning() << error.errorString() << "at" << error.offset;
+        return;
+    }
+    qDebug() << document["package"]["version"].toString();
+    //! [0]
+}
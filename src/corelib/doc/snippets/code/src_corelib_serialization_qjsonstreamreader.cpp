@@ -0,0 +1,49 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+#include <QDebug>
+#include <QFile>
+#include <QJsonObject>
+#include <QJsonStreamReader>
+
+using namespace Qt::StringLiterals;
+
+void handleAccount(const QString &name, qint64 balance);
+void applySettings(const QJsonObject &settings);
+
+void readAccounts(QFile *file)
+{
+    //! [0]
+    // [ { "name": "...", "balance": 42, "history": [ ... ] }, ... ]
+    QJsonStreamReader reader(file);
+    if (!reader.readNextValue() || !reader.isStartArray())
+        return;
+    while (reader.readNextValue()) {
+        QString name;
+        qint64 balance = 0;
+        while (reader.readNextValue()) {
+            if (reader.name() == "name"_L1)
+                name = reader.toString();
+            else if (reader.name() == "balance"_L1)
+                balance = reader.toInteger();
+            else
+                reader.skipCurrentValue();
+        }
+        handleAccount(name, balance);
+    }
+    if (reader.hasError())
+        qWarning() << reader.errorString() << "at" << reader.error().offset;
+    //! [0]
+}
+
+void readSettings(QJsonStreamReader &reader)
+{
+    //! [1]
+    while (reader.readNextValue()) {
+        if (reader.name() == "settings"_L1)
+            applySettings(reader.readValue().toObject());
+        else
+            reader.skipCurrentValue();
+    }
+    //! [1]
+}
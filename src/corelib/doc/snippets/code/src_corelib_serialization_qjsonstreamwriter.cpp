@@ -0,0 +1,28 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+#include <QFile>
+#include <QJsonStreamWriter>
+
+struct Account
+{
+    QString name;
+    qint64 balance;
+};
+
+void writeAccounts(QFile *file, const QList<Account> &accounts)
+{
+    //! [0]
+    QJsonStreamWriter writer(file);
+    writer.startArray();
+    for (const Account &account : accounts) {
+        writer.startObject();
+        writer.appendKey(u"name");
+        writer.append(account.name);
+        writer.appendKey(u"balance");
+        writer.append(account.balance);
+        writer.endObject();
+    }
+    writer.endArray();
+    //! [0]
+}
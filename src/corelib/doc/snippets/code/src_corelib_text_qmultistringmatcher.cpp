@@ -0,0 +1,20 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+#include <QDebug>
+#include <QMultiStringMatcher>
+#include <QStringList>
+
+using namespace Qt::StringLiterals;
+
+void printAlerts(const QStringList &lines)
+{
+    //! [0]
+    const QMultiStringMatcher matcher({ u"error"_s, u"warning"_s, u"timeout"_s },
+                                      Qt::CaseInsensitive);
+    for (const QString &line : lines) {
+        if (const QMultiStringMatcher::Match match = matcher.match(line); match.isValid())
+            qDebug() << matcher.patterns().at(match.patternIndex) << "in" << line;
+    }
+    //! [0]
+}
@@ -6,6 +6,7 @@
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
 #include <QRegularExpressionMatchIterator>
+#include <QVarLengthArray>
 
 int main() {
 
@@ -341,4 +342,29 @@ int main() {
         //! [36]
     }
 
+    {
+        //! [37]
+        // shared by all worker threads
+        const QCompiledRegularExpression re(QRegularExpression(R"((\w+)=(\d+))"));
+
+        // in a worker thread
+        qsizetype offsets[6];
+        if (re.match(u"timeout=30", offsets)) {
+            qDebug() << offsets[2] << offsets[3]; // 0 7, the key
+            qDebug() << offsets[4] << offsets[5]; // 8 10, the value
+        }
+        //! [37]
+    }
+
+    {
+        //! [38]
+        const QCompiledRegularExpression re(QRegularExpression(R"(\berror\b)"),
+                                            QRegularExpression::DontCheckSubjectStringMatchOption);
+        const QList<QStringView> lines = { u"ok", u"error: disk full", u"ok" };
+        QVarLengthArray<qsizetype, 6> offsets(lines.size() * 2);
+        qDebug() << re.matchBatch(lines, offsets); // 1
+        qDebug() << offsets[2] << offsets[3];      // 0 5
+        //! [38]
+    }
+
 }
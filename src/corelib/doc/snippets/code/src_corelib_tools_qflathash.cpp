@@ -0,0 +1,31 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+#include <QFlatHash>
+#include <QObject>
+#include <QString>
+
+using namespace Qt::StringLiterals;
+
+void examples()
+{
+    {
+        //! [0]
+        QFlatHash<const QObject *, int> depth;
+        depth.reserve(1024);
+        depth.insert(nullptr, 0);
+        if (depth.contains(nullptr))
+            ++depth[nullptr];
+        //! [0]
+    }
+
+    {
+        //! [1]
+        QFlatHash<QString, int> keywords = { { u"if"_s, 1 }, { u"else"_s, 2 }, { u"while"_s, 3 } };
+        const QString source = u"while (true)"_s;
+        const QStringView token = QStringView(source).first(5);
+        int id = keywords.value(token, -1); // no temporary QString
+        //! [1]
+        Q_UNUSED(id);
+    }
+}
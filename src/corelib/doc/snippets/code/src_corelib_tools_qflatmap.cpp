@@ -0,0 +1,23 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+#include <QFlatMap>
+#include <QString>
+
+using namespace Qt::StringLiterals;
+
+void examples()
+{
+    {
+        //! [0]
+        QList<QString> names = { u"while"_s, u"if"_s, u"else"_s };
+        QList<int> ids = { 3, 1, 2 };
+        const QFlatMap<QString, int, std::less<>> keywords(std::move(names), std::move(ids));
+
+        const QString source = u"while (true)"_s;
+        const QStringView token = QStringView(source).first(5);
+        int id = keywords.value(token, -1); // no temporary QString
+        //! [0]
+        Q_UNUSED(id);
+    }
+}
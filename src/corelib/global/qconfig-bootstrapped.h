@@ -43,6 +43,7 @@
 #define QT_NO_DEPRECATED
 
 // Keep feature-test macros in alphabetic order by feature name:
+#define QT_FEATURE_async_io -1
 #define QT_FEATURE_cborstreamreader -1
 #define QT_FEATURE_cborstreamwriter 1
 #define QT_FEATURE_commandlineparser 1
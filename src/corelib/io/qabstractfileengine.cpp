@@ -1081,6 +1081,11 @@ qint64 QAbstractFileEngine::readLine(char *data, qint64 maxlen)
 
    \value UnMapExtension Whether the file engine provides the ability to
    unmap memory that was previously mapped.
+
+   \value IOQueueExtension Whether the file engine can keep several reads
+   and writes in flight on behalf of the caller. The input argument is an
+   IOQueueExtensionOption holding the number of transfers, or 0 to stop
+   queuing. This value was added in Qt 6.12.
 */
 
 /*!
@@ -146,7 +146,8 @@ public:
         AtEndExtension,
         FastReadLineExtension,
         MapExtension,
-        UnMapExtension
+        UnMapExtension,
+        IOQueueExtension
     };
     class ExtensionOption
     {};
@@ -176,6 +177,13 @@ public:
         constexpr UnMapExtensionOption(uchar *p) : address(p) {}
     };
 
+    class IOQueueExtensionOption : public ExtensionOption {
+        Q_DISABLE_COPY_MOVE(IOQueueExtensionOption)
+    public:
+        int depth = 0;
+        constexpr IOQueueExtensionOption(int d) : depth(d) {}
+    };
+
     virtual bool extension(Extension extension, const ExtensionOption *option = nullptr, ExtensionReturn *output = nullptr);
     virtual bool supportsExtension(Extension extension) const;
 
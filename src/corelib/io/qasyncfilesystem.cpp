@@ -0,0 +1,480 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:significant reason:default
+
+#include "qasyncfilesystem_p.h"
+#include "qasyncfilesystem_p_p.h"
+
+#include "qiooperation_p.h"
+#include "qiooperation_p_p.h"
+#include "qrandomaccessasyncfile_p_p.h" // QtPrivate::asyncFileThreadPool
+
+#include <QtCore/qfile.h> // QtPrivate::toFilesystemPath
+#include <QtCore/qfuture.h>
+#include <QtCore/private/qfilesystemengine_p.h>
+#include <QtCore/private/qfilesystementry_p.h>
+#include <QtCore/private/qsystemerror_p.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QAsyncFileSystem
+    \inmodule QtCore
+    \since 6.12
+
+    \brief The QAsyncFileSystem class performs file system operations
+    asynchronously.
+
+    The operations are submitted to the same io_uring as QRandomAccessAsyncFile
+    where the kernel supports them, so that many of them need no system call
+    of their own. Otherwise they run on a thread pool.
+
+    Like with QRandomAccessAsyncFile, every operation returns a QIOOperation
+    that emits QIOOperation::finished() once it is complete. The operations are
+    children of the QAsyncFileSystem object, and deleting it cancels them.
+*/
+
+QAsyncFileSystemPrivate::QAsyncFileSystemPrivate()
+{
+    QtPrivate::asyncFileThreadPool.ref();
+}
+
+QAsyncFileSystemPrivate::~QAsyncFileSystemPrivate()
+{
+    QtPrivate::asyncFileThreadPool.deref();
+}
+
+void QAsyncFileSystemPrivate::init()
+{
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    m_ioring = QIORing::sharedInstance();
+#endif
+}
+
+void QAsyncFileSystemPrivate::cancelAndWait(QIOOperation *op)
+{
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    const QList<QIORing::RequestHandle> handles = m_opHandles.value(op);
+    QList<QIORing::RequestHandle> cancelHandles;
+    for (QIORing::RequestHandle handle : handles) {
+        QIORingRequest<QIORing::Operation::Cancel> cancelRequest;
+        cancelRequest.handle = handle;
+        cancelHandles.append(m_ioring->queueRequest(std::move(cancelRequest)));
+    }
+    for (QIORing::RequestHandle handle : std::as_const(cancelHandles))
+        m_ioring->waitForRequest(handle);
+    for (QIORing::RequestHandle handle : handles)
+        m_ioring->waitForRequest(handle);
+#else
+    // The thread pool works on copies, so it's enough that the continuation
+    // is dropped with the operation.
+    Q_UNUSED(op);
+#endif
+}
+
+void QAsyncFileSystemPrivate::cancelAndWaitForAll()
+{
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    const auto ops = m_opHandles.keys();
+    for (QIOOperation *op : ops) {
+        QIOOperationPrivate::get(op)->error = QIOOperation::Error::Aborted;
+        cancelAndWait(op);
+    }
+#endif
+}
+
+template <typename Operation>
+Operation *QAsyncFileSystemPrivate::createOperation(QIOOperation::Type type,
+                                                   QtPrivate::QIOOperationDataStorage *storage)
+{
+    Q_Q(QAsyncFileSystem);
+    auto *priv = new QIOOperationPrivate(storage);
+    priv->type = type;
+    return new Operation(*priv, q);
+}
+
+// Runs \a work on the shared thread pool and finishes \a op with the error it
+// returns. The work must not touch \a op, which may be gone by the time it
+// finishes.
+template <typename Work>
+void QAsyncFileSystemPrivate::runInThreadPool(QIOOperation *op, Work &&work)
+{
+    QtFuture::makeReadyVoidFuture()
+            .then(QtPrivate::asyncFileThreadPool(), std::forward<Work>(work))
+            .then(op, [op](QIOOperation::Error error) {
+                QIOOperationPrivate::get(op)->operationComplete(error);
+            });
+}
+
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+void QAsyncFileSystemPrivate::queueCompletion(QIOOperationPrivate *priv, QIOOperation::Error error)
+{
+    m_opHandles.remove(priv->q_func());
+    QMetaObject::invokeMethod(priv->q_ptr, [priv, error]() {
+        priv->operationComplete(error);
+    }, Qt::QueuedConnection);
+}
+
+template <QIORing::Operation Op>
+void QAsyncFileSystemPrivate::queueOnRing(QIOOperation *op, QIORingRequest<Op> &&request,
+                                          QIOOperation::Error error)
+{
+    request.setCallback([this, op, error](const QIORingRequest<Op> &request) {
+        auto *priv = QIOOperationPrivate::get(op);
+        if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result)) {
+            if (priv->error == QIOOperation::Error::Aborted || *err == QFileDevice::AbortError)
+                queueCompletion(priv, QIOOperation::Error::Aborted);
+            else
+                queueCompletion(priv, error);
+        } else {
+            if constexpr (Op == QIORing::Operation::StatPath) {
+                const auto &result = std::get<QIORingResult<Op>>(request.result);
+                priv->dataStorage->getMetaData() = result.metaData;
+            }
+            queueCompletion(priv, QIOOperation::Error::None);
+        }
+    });
+    m_opHandles[op].append(m_ioring->queueRequest(std::move(request)));
+}
+
+bool QAsyncFileSystemPrivate::readFileOnRing(QIOReadOperation *op, const QString &fileName)
+{
+    using Operation = QIORing::Operation;
+    if (!m_ioring->isAvailable(Operation::Open) || !m_ioring->isAvailable(Operation::Read)
+        || !m_ioring->isAvailable(Operation::Close)) {
+        return false;
+    }
+    // Opening into a fixed file slot lets the read and the close refer to the
+    // file before we know its descriptor, so all three go out linked, in one
+    // submission.
+    const qint32 slot = m_ioring->allocateFileSlot();
+    if (slot < 0)
+        return false;
+
+    struct ChainState
+    {
+        qint32 slot;
+        int pendingRequests = 3;
+    };
+    auto state = std::make_shared<ChainState>(ChainState{ slot });
+    auto *priv = QIOOperationPrivate::get(op);
+    // Every request of the chain gets its callback, even if an earlier one
+    // failed, so the last one to come in finishes the operation:
+    auto requestDone = [this, priv, state] {
+        if (--state->pendingRequests == 0) {
+            m_ioring->releaseFileSlot(state->slot);
+            queueCompletion(priv, priv->error);
+        }
+    };
+    auto setError = [priv](QFileDevice::FileError err, QIOOperation::Error error) {
+        if (priv->error != QIOOperation::Error::None)
+            return; // the first error wins
+        priv->error = err == QFileDevice::AbortError ? QIOOperation::Error::Aborted : error;
+    };
+
+    QIORingRequest<Operation::Open> openRequest;
+    openRequest.path = QtPrivate::toFilesystemPath(fileName);
+    openRequest.flags = QIODevice::ReadOnly;
+    openRequest.fixedFileSlot = slot;
+    openRequest.requestFlags = QIORing::RequestFlag::Link;
+    openRequest.setCallback([=](const QIORingRequest<Operation::Open> &request) {
+        if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result))
+            setError(*err, QIOOperation::Error::Open);
+        requestDone();
+    });
+
+    QIORingRequest<Operation::Read> readRequest;
+    readRequest.fd = slot;
+    readRequest.offset = 0;
+    readRequest.destination = as_writable_bytes(QSpan(priv->dataStorage->getByteArray()));
+    // Close the file even if the read fails:
+    readRequest.requestFlags = QIORing::RequestFlag::FixedFile | QIORing::RequestFlag::HardLink;
+    readRequest.setCallback([=](const QIORingRequest<Operation::Read> &request) {
+        if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result)) {
+            setError(*err, QIOOperation::Error::Read);
+            priv->dataStorage->getByteArray().clear();
+        } else if (const auto *result = std::get_if<QIORingResult<Operation::Read>>(
+                           &request.result)) {
+            priv->appendBytesProcessed(result->bytesRead);
+            priv->dataStorage->getByteArray().truncate(result->bytesRead);
+        }
+        requestDone();
+    });
+
+    QIORingRequest<Operation::Close> closeRequest;
+    closeRequest.fd = slot;
+    closeRequest.requestFlags = QIORing::RequestFlag::FixedFile;
+    closeRequest.setCallback([=](const QIORingRequest<Operation::Close> &) {
+        requestDone();
+    });
+
+    auto &handles = m_opHandles[op];
+    handles.append(m_ioring->queueRequest(std::move(openRequest)));
+    handles.append(m_ioring->queueRequest(std::move(readRequest)));
+    handles.append(m_ioring->queueRequest(std::move(closeRequest)));
+    return true;
+}
+#endif // QT_RANDOMACCESSASYNCFILE_QIORING
+
+QIOOperation *QAsyncFileSystemPrivate::rename(const QString &oldName, const QString &newName)
+{
+    auto *op = createOperation<QIOOperation>(QIOOperation::Type::Rename,
+                                             new QtPrivate::QIOOperationDataStorage());
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    if (m_ioring && m_ioring->isAvailable(QIORing::Operation::Rename)) {
+        QIORingRequest<QIORing::Operation::Rename> request;
+        request.oldPath = QtPrivate::toFilesystemPath(oldName);
+        request.newPath = QtPrivate::toFilesystemPath(newName);
+        request.noReplace = true; // like QFile::rename()
+        queueOnRing(op, std::move(request), QIOOperation::Error::Rename);
+        return op;
+    }
+#endif
+    runInThreadPool(op, [source = QFileSystemEntry(oldName), target = QFileSystemEntry(newName)] {
+        QSystemError error;
+        return QFileSystemEngine::renameFile(source, target, error)
+                ? QIOOperation::Error::None
+                : QIOOperation::Error::Rename;
+    });
+    return op;
+}
+
+QIOOperation *QAsyncFileSystemPrivate::remove(const QString &fileName)
+{
+    auto *op = createOperation<QIOOperation>(QIOOperation::Type::Remove,
+                                             new QtPrivate::QIOOperationDataStorage());
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    if (m_ioring && m_ioring->isAvailable(QIORing::Operation::Unlink)) {
+        QIORingRequest<QIORing::Operation::Unlink> request;
+        request.path = QtPrivate::toFilesystemPath(fileName);
+        queueOnRing(op, std::move(request), QIOOperation::Error::Remove);
+        return op;
+    }
+#endif
+    runInThreadPool(op, [entry = QFileSystemEntry(fileName)] {
+        QSystemError error;
+        return QFileSystemEngine::removeFile(entry, error)
+                ? QIOOperation::Error::None
+                : QIOOperation::Error::Remove;
+    });
+    return op;
+}
+
+QIOOperation *QAsyncFileSystemPrivate::mkdir(const QString &dirName)
+{
+    auto *op = createOperation<QIOOperation>(QIOOperation::Type::MakeDirectory,
+                                             new QtPrivate::QIOOperationDataStorage());
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    if (m_ioring && m_ioring->isAvailable(QIORing::Operation::MakeDirectory)) {
+        QIORingRequest<QIORing::Operation::MakeDirectory> request;
+        request.path = QtPrivate::toFilesystemPath(dirName);
+        queueOnRing(op, std::move(request), QIOOperation::Error::MakeDirectory);
+        return op;
+    }
+#endif
+    runInThreadPool(op, [entry = QFileSystemEntry(dirName)] {
+        return QFileSystemEngine::mkdir(entry)
+                ? QIOOperation::Error::None
+                : QIOOperation::Error::MakeDirectory;
+    });
+    return op;
+}
+
+QIOOperation *QAsyncFileSystemPrivate::rmdir(const QString &dirName)
+{
+    auto *op = createOperation<QIOOperation>(QIOOperation::Type::Remove,
+                                             new QtPrivate::QIOOperationDataStorage());
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    if (m_ioring && m_ioring->isAvailable(QIORing::Operation::Unlink)) {
+        QIORingRequest<QIORing::Operation::Unlink> request;
+        request.path = QtPrivate::toFilesystemPath(dirName);
+        request.directory = true;
+        queueOnRing(op, std::move(request), QIOOperation::Error::Remove);
+        return op;
+    }
+#endif
+    runInThreadPool(op, [entry = QFileSystemEntry(dirName)] {
+        return QFileSystemEngine::rmdir(entry)
+                ? QIOOperation::Error::None
+                : QIOOperation::Error::Remove;
+    });
+    return op;
+}
+
+QIOStatOperation *QAsyncFileSystemPrivate::stat(const QString &path)
+{
+    auto *dataStorage = new QtPrivate::QIOOperationDataStorage(QFileSystemMetaData());
+    auto *op = createOperation<QIOStatOperation>(QIOOperation::Type::Stat, dataStorage);
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    if (m_ioring && m_ioring->isAvailable(QIORing::Operation::StatPath)) {
+        QIORingRequest<QIORing::Operation::StatPath> request;
+        request.path = QtPrivate::toFilesystemPath(path);
+        queueOnRing(op, std::move(request), QIOOperation::Error::Stat);
+        return op;
+    }
+#endif
+    // The work gets its own copy of the metadata, the operation may be
+    // deleted while it runs:
+    auto metaData = std::make_shared<QFileSystemMetaData>();
+    QtFuture::makeReadyVoidFuture()
+            .then(QtPrivate::asyncFileThreadPool(), [entry = QFileSystemEntry(path), metaData] {
+                QFileSystemEngine::fillMetaData(entry, *metaData,
+                                                QFileSystemMetaData::PosixStatFlags);
+                return metaData->exists() ? QIOOperation::Error::None
+                                          : QIOOperation::Error::Stat;
+            })
+            .then(op, [op, metaData](QIOOperation::Error error) {
+                auto *priv = QIOOperationPrivate::get(op);
+                priv->dataStorage->getMetaData() = *metaData;
+                priv->operationComplete(error);
+            });
+    return op;
+}
+
+QIOReadOperation *QAsyncFileSystemPrivate::readFile(const QString &fileName, qint64 maxSize)
+{
+    QByteArray array;
+    array.resizeForOverwrite(maxSize);
+    auto *dataStorage = new QtPrivate::QIOOperationDataStorage(std::move(array));
+    auto *op = createOperation<QIOReadOperation>(QIOOperation::Type::Read, dataStorage);
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    if (m_ioring && readFileOnRing(op, fileName))
+        return op;
+#endif
+    auto result = std::make_shared<QByteArray>();
+    QtFuture::makeReadyVoidFuture()
+            .then(QtPrivate::asyncFileThreadPool(), [fileName, maxSize, result] {
+                QFile file(fileName);
+                if (!file.open(QIODevice::ReadOnly | QIODevice::Unbuffered))
+                    return QIOOperation::Error::Open;
+                *result = file.read(maxSize);
+                return file.error() == QFileDevice::NoError ? QIOOperation::Error::None
+                                                            : QIOOperation::Error::Read;
+            })
+            .then(op, [op, result](QIOOperation::Error error) {
+                auto *priv = QIOOperationPrivate::get(op);
+                priv->appendBytesProcessed(result->size());
+                priv->dataStorage->getByteArray() = std::move(*result);
+                priv->operationComplete(error);
+            });
+    return op;
+}
+
+/*!
+    \internal
+
+    Creates a QAsyncFileSystem object with the given \a parent.
+*/
+QAsyncFileSystem::QAsyncFileSystem(QObject *parent)
+    : QObject{*new QAsyncFileSystemPrivate, parent}
+{
+    d_func()->init();
+}
+
+/*!
+    \internal
+
+    Destroys the object, cancelling all of its unfinished operations.
+*/
+QAsyncFileSystem::~QAsyncFileSystem()
+{
+    Q_D(QAsyncFileSystem);
+    // The operations are our children, wait for them while we still can:
+    d->cancelAndWaitForAll();
+}
+
+/*!
+    \internal
+
+    Renames the file \a oldName to \a newName. Like QFile::rename(), this fails
+    if \a newName already exists.
+
+    \include qrandomaccessasyncfile.cpp returns-qiooperation
+*/
+QIOOperation *QAsyncFileSystem::rename(const QString &oldName, const QString &newName)
+{
+    Q_D(QAsyncFileSystem);
+    return d->rename(oldName, newName);
+}
+
+/*!
+    \internal
+
+    Removes the file \a fileName.
+
+    \include qrandomaccessasyncfile.cpp returns-qiooperation
+*/
+QIOOperation *QAsyncFileSystem::remove(const QString &fileName)
+{
+    Q_D(QAsyncFileSystem);
+    return d->remove(fileName);
+}
+
+/*!
+    \internal
+
+    Creates the directory \a dirName. The parent directory has to exist.
+
+    \include qrandomaccessasyncfile.cpp returns-qiooperation
+*/
+QIOOperation *QAsyncFileSystem::mkdir(const QString &dirName)
+{
+    Q_D(QAsyncFileSystem);
+    return d->mkdir(dirName);
+}
+
+/*!
+    \internal
+
+    Removes the empty directory \a dirName.
+
+    \include qrandomaccessasyncfile.cpp returns-qiooperation
+*/
+QIOOperation *QAsyncFileSystem::rmdir(const QString &dirName)
+{
+    Q_D(QAsyncFileSystem);
+    return d->rmdir(dirName);
+}
+
+/*!
+    \internal
+
+    Retrieves the metadata of \a path, following symbolic links. The result is
+    available from QIOStatOperation::metaData() once the operation finished.
+
+    \include qrandomaccessasyncfile.cpp returns-qiooperation
+*/
+QIOStatOperation *QAsyncFileSystem::stat(const QString &path)
+{
+    Q_D(QAsyncFileSystem);
+    return d->stat(path);
+}
+
+/*!
+    \internal
+
+    Reads at most \a maxSize bytes from the start of the file \a fileName,
+    opening and closing it as part of the same operation.
+
+    With io_uring, the open, read and close are submitted together as linked
+    requests.
+
+    \include qrandomaccessasyncfile.cpp returns-qiooperation
+*/
+QIOReadOperation *QAsyncFileSystem::readFile(const QString &fileName, qint64 maxSize)
+{
+    Q_D(QAsyncFileSystem);
+    if (maxSize < 0) {
+        qWarning("Using a negative maxSize in QAsyncFileSystem::readFile() is incorrect. "
+                 "Resetting to zero!");
+        maxSize = 0;
+    }
+    return d->readFile(fileName, maxSize);
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qasyncfilesystem_p.cpp"
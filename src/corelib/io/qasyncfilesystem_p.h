@@ -0,0 +1,49 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:significant reason:default
+
+#ifndef QASYNCFILESYSTEM_P_H
+#define QASYNCFILESYSTEM_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qiooperation_p.h"
+
+#include <QtCore/qobject.h>
+
+QT_BEGIN_NAMESPACE
+
+class QAsyncFileSystemPrivate;
+class Q_CORE_EXPORT QAsyncFileSystem : public QObject
+{
+    Q_OBJECT
+public:
+    explicit QAsyncFileSystem(QObject *parent = nullptr);
+    ~QAsyncFileSystem() override;
+
+    [[nodiscard]] QIOOperation *rename(const QString &oldName, const QString &newName);
+    [[nodiscard]] QIOOperation *remove(const QString &fileName);
+    [[nodiscard]] QIOOperation *mkdir(const QString &dirName);
+    [[nodiscard]] QIOOperation *rmdir(const QString &dirName);
+    [[nodiscard]] QIOStatOperation *stat(const QString &path);
+
+    // open, read and close in one go
+    [[nodiscard]] QIOReadOperation *readFile(const QString &fileName, qint64 maxSize);
+
+private:
+    Q_DECLARE_PRIVATE(QAsyncFileSystem)
+    Q_DISABLE_COPY_MOVE(QAsyncFileSystem)
+};
+
+QT_END_NAMESPACE
+
+#endif // QASYNCFILESYSTEM_P_H
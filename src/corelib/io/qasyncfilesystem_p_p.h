@@ -0,0 +1,79 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:significant reason:default
+
+#ifndef QASYNCFILESYSTEM_P_P_H
+#define QASYNCFILESYSTEM_P_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qasyncfilesystem_p.h"
+
+#include <QtCore/private/qobject_p.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+#include <QtCore/private/qioring_p.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+class QIOOperationPrivate;
+namespace QtPrivate {
+class QIOOperationDataStorage;
+}
+
+class QAsyncFileSystemPrivate : public QObjectPrivate
+{
+    Q_DECLARE_PUBLIC(QAsyncFileSystem)
+    Q_DISABLE_COPY_MOVE(QAsyncFileSystemPrivate)
+public:
+    QAsyncFileSystemPrivate();
+    ~QAsyncFileSystemPrivate() override;
+
+    static QAsyncFileSystemPrivate *get(QAsyncFileSystem *fs)
+    { return fs->d_func(); }
+
+    void init();
+    void cancelAndWait(QIOOperation *op);
+    void cancelAndWaitForAll();
+
+    QIOOperation *rename(const QString &oldName, const QString &newName);
+    QIOOperation *remove(const QString &fileName);
+    QIOOperation *mkdir(const QString &dirName);
+    QIOOperation *rmdir(const QString &dirName);
+    QIOStatOperation *stat(const QString &path);
+    QIOReadOperation *readFile(const QString &fileName, qint64 maxSize);
+
+private:
+    template <typename Operation>
+    Operation *createOperation(QIOOperation::Type type, QtPrivate::QIOOperationDataStorage *storage);
+    template <typename Work>
+    void runInThreadPool(QIOOperation *op, Work &&work);
+
+#ifdef QT_RANDOMACCESSASYNCFILE_QIORING
+    void queueCompletion(QIOOperationPrivate *priv, QIOOperation::Error error);
+    template <QIORing::Operation Op>
+    void queueOnRing(QIOOperation *op, QIORingRequest<Op> &&request, QIOOperation::Error error);
+    bool readFileOnRing(QIOReadOperation *op, const QString &fileName);
+
+    QIORing *m_ioring = nullptr;
+    // Linked requests need more than one handle per operation
+    QHash<QIOOperation *, QList<QIORing::RequestHandle>> m_opHandles;
+#endif
+};
+
+QT_END_NAMESPACE
+
+#endif // QASYNCFILESYSTEM_P_P_H
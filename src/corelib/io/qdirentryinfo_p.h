@@ -145,6 +145,7 @@ public:
 
 private:
     friend class QDirListingPrivate;
+    friend class QDirListingParallelTraversal;
     friend class QDirListing;
 
     QFileSystemEntry entry;
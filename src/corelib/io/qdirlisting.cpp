@@ -131,6 +131,28 @@
         iterated too. Symbolic link loops (e.g., link => . or link => ..) are
         automatically detected and ignored.
 
+    \value Parallel [since 6.12]
+        When combined with Recursive, sub-directories are listed concurrently
+        on threads of the global QThreadPool, and filtered there, while the
+        thread iterating over the QDirListing receives the entries in
+        batches. The entries of each directory are still listed in the order
+        the file system reports them, but the order in which directories are
+        listed is unspecified; in particular, the entries of a sub-directory
+        may be listed before the entry of the sub-directory itself. The number
+        of entries that have been listed but not yet iterated over is bounded,
+        so iterating slowly, or not at all, pauses the listing threads. This
+        flag is ignored if Recursive isn't set, for directories that aren't on
+        the native file system (e.g. resources), and if Qt was built without
+        thread support.
+
+    \value PrefetchMetaData [since 6.12]
+        Fetch the metadata (size, times, permissions, etc.) of the listed
+        entries as part of listing them, so that DirEntry functions like
+        size() or lastModified() don't have to. This is most useful combined
+        with Parallel, as the metadata is then fetched on the listing
+        threads; on Linux, they batch the requests through io_uring where
+        it's available.
+
     \omitvalue NoNameFiltersForDirs
 */
 
@@ -151,6 +173,21 @@
 #include <QtCore/private/qfilesystemengine_p.h>
 #include <QtCore/private/qfileinfo_p.h>
 #include <QtCore/private/qduplicatetracker_p.h>
+#include <QtCore/qspan.h>
+
+#if QT_CONFIG(thread) && !defined(QT_NO_FILESYSTEMITERATOR)
+#  define QT_DIRLISTING_PARALLEL
+#  include <QtCore/qmutex.h>
+#  include <QtCore/qthreadpool.h>
+#  include <QtCore/qwaitcondition.h>
+#  include <atomic>
+#  include <deque>
+#endif
+
+#if defined(QT_RANDOMACCESSASYNCFILE_QIORING) && defined(Q_OS_LINUX)
+#  include <QtCore/qfile.h> // QtPrivate::toFilesystemPath
+#  include <QtCore/private/qioring_p.h>
+#endif
 
 #include <memory>
 #include <stack>
@@ -160,11 +197,16 @@ QT_BEGIN_NAMESPACE
 
 using namespace Qt::StringLiterals;
 
+#ifdef QT_DIRLISTING_PARALLEL
+class QDirListingParallelTraversal;
+#endif
+
 class QDirListingPrivate
 {
     Q_DISABLE_COPY_MOVE(QDirListingPrivate)
 public:
-    QDirListingPrivate() = default;
+    QDirListingPrivate();
+    ~QDirListingPrivate();
 
     // the default for std::stack is std::deque, but std::vector is more apt:
     template <typename T>
@@ -184,9 +226,14 @@ public:
     void pushInitialDirectory();
 
     void checkAndPushDirectory(QDirEntryInfo &info);
+    bool shouldRecurseInto(QDirEntryInfo &info) const;
     bool matchesFilters(QDirEntryInfo &data) const;
     bool hasIterators() const;
 
+    static QFileSystemEntry &directoryEntry(QDirEntryInfo &info);
+    static void prefetchMetaData(QDirEntryInfo &info);
+    static void prefetchMetaData(QSpan<QDirEntryInfo> entries);
+
     std::unique_ptr<QAbstractFileEngine> engine;
     QDirEntryInfo initialEntryInfo;
     QStringList nameFilters;
@@ -194,12 +241,14 @@ public:
     QDirEntryInfo currentEntryInfo;
 
 #if QT_CONFIG(regularexpression)
-    std::vector<QRegularExpression> nameRegExps;
+    // Compiled up front, so that matching neither allocates nor locks, which
+    // also makes it safe to match from the threads of a parallel traversal.
+    std::vector<QCompiledRegularExpression> nameRegExps;
     bool regexMatchesName(const QString &fileName) const
     {
         if (nameRegExps.empty())
             return true;
-        auto hasMatch = [&fileName](const auto &re) { return re.match(fileName).hasMatch(); };
+        auto hasMatch = [&fileName](const auto &re) { return re.match(fileName); };
         return std::any_of(nameRegExps.cbegin(), nameRegExps.cend(), hasMatch);
     }
 #endif
@@ -213,8 +262,238 @@ public:
 
     // Loop protection
     QDuplicateTracker<QString> visitedLinks;
+
+#ifdef QT_DIRLISTING_PARALLEL
+    bool useParallelTraversal() const;
+
+    // Last, so that it's destroyed, and its threads are done, first:
+    std::unique_ptr<QDirListingParallelTraversal> parallelTraversal;
+    std::vector<QDirEntryInfo> parallelBatch;
+    size_t parallelBatchIndex = 0;
+#endif
 };
 
+#ifdef QT_DIRLISTING_PARALLEL
+/*!
+    \internal
+
+    Lists the directories of a recursive QDirListing concurrently.
+
+    Sub-directories are collected in a list of pending directories, from
+    which threads of the global QThreadPool take one at a time and list it,
+    filter its entries and pass them on to the thread iterating over the
+    QDirListing in batches, through a bounded queue. When that thread finds
+    the queue empty and no thread of the pool could be started, e.g. because
+    they are all busy, it lists the next directory itself, so the traversal
+    always makes progress.
+*/
+class QDirListingParallelTraversal
+{
+    Q_DISABLE_COPY_MOVE(QDirListingParallelTraversal)
+public:
+    explicit QDirListingParallelTraversal(QDirListingPrivate *d) : d(d) { }
+    ~QDirListingParallelTraversal();
+
+    void start(QDirEntryInfo &entryInfo);
+    bool takeBatch(std::vector<QDirEntryInfo> &batch);
+
+private:
+    // Entries are passed on in batches of this size, and the threads stop
+    // listing while this many batches are waiting to be taken:
+    static constexpr size_t BatchSize = 256;
+    static constexpr size_t MaxQueuedBatches = 64;
+
+    enum class Publish { Bounded, Unbounded };
+
+    void startWorkers();
+    void runWorker();
+    void listDirectory(const QFileSystemEntry &dirEntry, Publish publishMode);
+    bool publish(std::vector<QDirEntryInfo> &batch, std::vector<QFileSystemEntry> &directories,
+                 Publish publishMode);
+    bool hasSeenDirectory(QDirEntryInfo &entryInfo);
+
+    QDirListingPrivate *const d;
+    QThreadPool *const threadPool = QThreadPool::globalInstance();
+
+    QMutex mutex;
+    QWaitCondition batchAvailable;
+    QWaitCondition spaceAvailable;
+    QWaitCondition workersDone;
+    std::deque<std::vector<QDirEntryInfo>> batches;
+    std::vector<QFileSystemEntry> pendingDirectories;
+    QDuplicateTracker<QString> visitedDirectories;
+    int runningWorkers = 0;
+    int listingDirectories = 0;
+    std::atomic<bool> canceled = false;
+};
+
+QDirListingParallelTraversal::~QDirListingParallelTraversal()
+{
+    QMutexLocker locker(&mutex);
+    canceled.store(true, std::memory_order_relaxed);
+    spaceAvailable.wakeAll();
+    while (runningWorkers > 0)
+        workersDone.wait(&mutex);
+}
+
+void QDirListingParallelTraversal::start(QDirEntryInfo &entryInfo)
+{
+    if (hasSeenDirectory(entryInfo))
+        return;
+    QMutexLocker locker(&mutex);
+    pendingDirectories.push_back(QDirListingPrivate::directoryEntry(entryInfo));
+    startWorkers();
+}
+
+// Must be called with the mutex locked
+void QDirListingParallelTraversal::startWorkers()
+{
+    const int maxWorkers = qMax(threadPool->maxThreadCount(), 1);
+    const int wanted = int(qMin(pendingDirectories.size(), size_t(maxWorkers)));
+    while (runningWorkers < wanted) {
+        ++runningWorkers;
+        if (!threadPool->tryStart([this] { runWorker(); })) {
+            --runningWorkers;
+            break;
+        }
+    }
+    // Nobody to do the work, wake up takeBatch() to do it:
+    if (runningWorkers == 0)
+        batchAvailable.wakeAll();
+}
+
+void QDirListingParallelTraversal::runWorker()
+{
+    QMutexLocker locker(&mutex);
+    while (!canceled.load(std::memory_order_relaxed) && !pendingDirectories.empty()) {
+        // Last in, first out, so we go deep first and keep the list short
+        const QFileSystemEntry dirEntry = std::move(pendingDirectories.back());
+        pendingDirectories.pop_back();
+        ++listingDirectories;
+        locker.unlock();
+        listDirectory(dirEntry, Publish::Bounded);
+        locker.relock();
+        --listingDirectories;
+    }
+    if (--runningWorkers == 0)
+        workersDone.wakeAll();
+    // We may have been the last one to list anything:
+    batchAvailable.wakeAll();
+}
+
+/*!
+    \internal
+
+    Moves the next batch of entries into \a batch and returns \c true, or
+    returns \c false if all directories have been listed.
+*/
+bool QDirListingParallelTraversal::takeBatch(std::vector<QDirEntryInfo> &batch)
+{
+    QMutexLocker locker(&mutex);
+    for (;;) {
+        if (!batches.empty()) {
+            batch = std::move(batches.front());
+            batches.pop_front();
+            spaceAvailable.wakeOne();
+            return true;
+        }
+        if (pendingDirectories.empty()) {
+            if (listingDirectories == 0)
+                return false;
+        } else {
+            startWorkers();
+            if (runningWorkers == 0) {
+                // Couldn't start any thread (maybe we are running in one of
+                // the pool's threads ourselves), list the directory here:
+                const QFileSystemEntry dirEntry = std::move(pendingDirectories.back());
+                pendingDirectories.pop_back();
+                ++listingDirectories;
+                locker.unlock();
+                listDirectory(dirEntry, Publish::Unbounded);
+                locker.relock();
+                --listingDirectories;
+                continue;
+            }
+        }
+        batchAvailable.wait(&mutex);
+    }
+}
+
+void QDirListingParallelTraversal::listDirectory(const QFileSystemEntry &dirEntry,
+                                                 Publish publishMode)
+{
+    std::vector<QDirEntryInfo> batch;
+    std::vector<QFileSystemEntry> directories;
+    batch.reserve(BatchSize);
+
+    QFileSystemIterator it(dirEntry, d->iteratorFlags);
+    QDirEntryInfo entryInfo;
+    while (it.advance(entryInfo.entry, entryInfo.metaData)) {
+        if (canceled.load(std::memory_order_relaxed))
+            return;
+        if (d->shouldRecurseInto(entryInfo) && !hasSeenDirectory(entryInfo))
+            directories.push_back(QDirListingPrivate::directoryEntry(entryInfo));
+        if (d->matchesFilters(entryInfo))
+            batch.push_back(std::move(entryInfo));
+        entryInfo = {};
+
+        if (batch.size() == BatchSize && !publish(batch, directories, publishMode))
+            return;
+    }
+    publish(batch, directories, publishMode);
+}
+
+bool QDirListingParallelTraversal::publish(std::vector<QDirEntryInfo> &batch,
+                                           std::vector<QFileSystemEntry> &directories,
+                                           Publish publishMode)
+{
+    if (d->iteratorFlags.testAnyFlags(QDirListing::IteratorFlag::PrefetchMetaData))
+        QDirListingPrivate::prefetchMetaData(QSpan<QDirEntryInfo>(batch));
+
+    QMutexLocker locker(&mutex);
+    if (!directories.empty()) {
+        // Hand out the sub-directories first, other threads can list them
+        // while we wait for space below
+        std::move(directories.begin(), directories.end(),
+                  std::back_inserter(pendingDirectories));
+        directories.clear();
+        startWorkers();
+    }
+    if (!batch.empty()) {
+        while (publishMode == Publish::Bounded && batches.size() >= MaxQueuedBatches
+               && !canceled.load(std::memory_order_relaxed)) {
+            spaceAvailable.wait(&mutex);
+        }
+        if (canceled.load(std::memory_order_relaxed))
+            return false;
+        batches.push_back(std::exchange(batch, {}));
+        batch.reserve(BatchSize);
+        batchAvailable.wakeOne();
+    }
+    return !canceled.load(std::memory_order_relaxed);
+}
+
+// Stops symlink loops, like QDirListingPrivate::pushDirectory() does
+bool QDirListingParallelTraversal::hasSeenDirectory(QDirEntryInfo &entryInfo)
+{
+    if (!d->iteratorFlags.testAnyFlags(QDirListing::IteratorFlag::FollowDirSymlinks))
+        return false;
+    const QString canonicalPath = entryInfo.canonicalFilePath();
+    QMutexLocker locker(&mutex);
+    return visitedDirectories.hasSeen(canonicalPath);
+}
+
+bool QDirListingPrivate::useParallelTraversal() const
+{
+    using F = QDirListing::IteratorFlag;
+    return !engine && iteratorFlags.testFlags(F::Recursive | F::Parallel);
+}
+#endif // QT_DIRLISTING_PARALLEL
+
+QDirListingPrivate::QDirListingPrivate() = default;
+
+QDirListingPrivate::~QDirListingPrivate() = default;
+
 void QDirListingPrivate::init()
 {
     if (nameFilters.contains("*"_L1))
@@ -246,6 +525,16 @@ void QDirListingPrivate::beginIterating()
 #endif
     fileEngineIterators.clear();
     visitedLinks.clear();
+#ifdef QT_DIRLISTING_PARALLEL
+    parallelTraversal.reset();
+    parallelBatch.clear();
+    parallelBatchIndex = 0;
+    if (useParallelTraversal()) {
+        parallelTraversal = std::make_unique<QDirListingParallelTraversal>(this);
+        parallelTraversal->start(initialEntryInfo);
+        return;
+    }
+#endif
     pushDirectory(initialEntryInfo);
 }
 
@@ -275,22 +564,81 @@ void QDirListingPrivate::pushDirectory(QDirEntryInfo &entryInfo)
         }
     } else {
 #ifndef QT_NO_FILESYSTEMITERATOR
-        QFileSystemEntry *fentry = nullptr;
-        if (entryInfo.fileInfoOpt)
-            fentry = &entryInfo.fileInfoOpt->d_ptr->fileEntry;
-        else
-            fentry = &entryInfo.entry;
-        nativeIterators.push(std::make_unique<QFileSystemIterator>(*fentry, iteratorFlags));
+        nativeIterators.push(std::make_unique<QFileSystemIterator>(directoryEntry(entryInfo),
+                                                                   iteratorFlags));
 #else
         qWarning("Qt was built with -no-feature-filesystemiterator: no files/plugins will be found!");
 #endif
     }
 }
 
+QFileSystemEntry &QDirListingPrivate::directoryEntry(QDirEntryInfo &entryInfo)
+{
+    if (entryInfo.fileInfoOpt)
+        return entryInfo.fileInfoOpt->d_ptr->fileEntry;
+    return entryInfo.entry;
+}
+
 bool QDirListingPrivate::entryMatches(QDirEntryInfo &entryInfo)
 {
     checkAndPushDirectory(entryInfo);
-    return matchesFilters(entryInfo);
+    if (!matchesFilters(entryInfo))
+        return false;
+    if (iteratorFlags.testAnyFlags(QDirListing::IteratorFlag::PrefetchMetaData))
+        prefetchMetaData(entryInfo);
+    return true;
+}
+
+/*!
+    \internal
+
+    Fills the metadata of \a entryInfo that's behind the DirEntry getters,
+    if it's not known yet.
+*/
+void QDirListingPrivate::prefetchMetaData(QDirEntryInfo &entryInfo)
+{
+    if (entryInfo.fileInfoOpt
+        || entryInfo.metaData.hasFlags(QFileSystemMetaData::PosixStatFlags)) {
+        return;
+    }
+    // If we know whether it's a symlink already (which the native iterators
+    // usually tell us), we don't need to lstat() it:
+    const auto what = QFileSystemMetaData::PosixStatFlags
+            | entryInfo.metaData.missingFlags(QFileSystemMetaData::LinkType);
+    QFileSystemEngine::fillMetaData(entryInfo.entry, entryInfo.metaData, what);
+}
+
+void QDirListingPrivate::prefetchMetaData(QSpan<QDirEntryInfo> entries)
+{
+#if defined(QT_RANDOMACCESSASYNCFILE_QIORING) && defined(Q_OS_LINUX)
+    // Batch the stat() calls through io_uring, the entries it can't handle are
+    // taken care of below, one at a time
+    using Operation = QIORing::Operation;
+    QIORing *ioRing = entries.size() > 1 ? QIORing::sharedInstance() : nullptr;
+    if (ioRing && ioRing->isAvailable(Operation::StatPath)) {
+        std::vector<QIORing::RequestHandle> handles;
+        handles.reserve(entries.size());
+        for (QDirEntryInfo &entryInfo : entries) {
+            if (entryInfo.fileInfoOpt
+                || entryInfo.metaData.hasFlags(QFileSystemMetaData::PosixStatFlags)
+                || !entryInfo.metaData.hasFlags(QFileSystemMetaData::LinkType)) {
+                continue;
+            }
+            QIORingRequest<Operation::StatPath> request;
+            request.path = QtPrivate::toFilesystemPath(entryInfo.entry.filePath());
+            request.setCallback([&entryInfo](const QIORingRequest<Operation::StatPath> &request) {
+                using Result = QIORingResult<Operation::StatPath>;
+                if (const auto *result = std::get_if<Result>(&request.result))
+                    entryInfo.metaData.fillFromFollowedStat(result->metaData);
+            });
+            handles.push_back(ioRing->queueRequest(std::move(request)));
+        }
+        for (QIORing::RequestHandle handle : handles)
+            ioRing->waitForRequest(handle);
+    }
+#endif
+    for (QDirEntryInfo &entryInfo : entries)
+        prefetchMetaData(entryInfo);
 }
 
 /*!
@@ -309,6 +657,20 @@ bool QDirListingPrivate::entryMatches(QDirEntryInfo &entryInfo)
 */
 void QDirListingPrivate::advance()
 {
+#ifdef QT_DIRLISTING_PARALLEL
+    if (parallelTraversal) {
+        while (parallelBatchIndex == parallelBatch.size()) {
+            parallelBatch.clear();
+            parallelBatchIndex = 0;
+            if (!parallelTraversal->takeBatch(parallelBatch)) {
+                parallelTraversal.reset(); // All done
+                return;
+            }
+        }
+        currentEntryInfo = std::move(parallelBatch[parallelBatchIndex++]);
+        return;
+    }
+#endif
     if (engine) {
         while (!fileEngineIterators.empty()) {
             // Find the next valid iterator that matches the filters.
@@ -351,30 +713,33 @@ static bool isDotOrDotDot(QStringView fileName)
 }
 
 void QDirListingPrivate::checkAndPushDirectory(QDirEntryInfo &entryInfo)
+{
+    if (shouldRecurseInto(entryInfo))
+        pushDirectory(entryInfo);
+}
+
+bool QDirListingPrivate::shouldRecurseInto(QDirEntryInfo &entryInfo) const
 {
     using F = QDirListing::IteratorFlag;
     // If we're doing flat iteration, we're done.
     if (!iteratorFlags.testAnyFlags(F::Recursive))
-        return;
+        return false;
 
     // Follow symlinks only when asked
     if (!iteratorFlags.testAnyFlags(F::FollowDirSymlinks) && entryInfo.isSymLink())
-        return;
+        return false;
 
     // Never follow . and ..
     if (isDotOrDotDot(entryInfo.fileName()))
-        return;
+        return false;
 
     // No hidden directories unless requested
     const bool includeHidden = iteratorFlags.testAnyFlags(QDirListing::IteratorFlag::IncludeHidden);
     if (!includeHidden && entryInfo.isHidden())
-        return;
+        return false;
 
     // Never follow non-directory entries
-    if (!entryInfo.isDir())
-        return;
-
-    pushDirectory(entryInfo);
+    return entryInfo.isDir();
 }
 
 /*!
@@ -438,6 +803,10 @@ bool QDirListingPrivate::matchesFilters(QDirEntryInfo &entryInfo) const
 
 bool QDirListingPrivate::hasIterators() const
 {
+#ifdef QT_DIRLISTING_PARALLEL
+    if (useParallelTraversal())
+        return bool(parallelTraversal);
+#endif
     if (engine)
         return !fileEngineIterators.empty();
 
@@ -46,6 +46,8 @@ public:
         Recursive =             0x000400,
         FollowDirSymlinks =     0x000800,
         IncludeBrokenSymlinks = 0x001000,
+        Parallel =              0x002000,
+        PrefetchMetaData =      0x004000,
         NoNameFiltersForDirs  = 0x040000, // used internally
     };
     Q_DECLARE_FLAGS(IteratorFlags, IteratorFlag)
@@ -26,6 +26,15 @@ QFileDevicePrivate::QFileDevicePrivate()
 
 QFileDevicePrivate::~QFileDevicePrivate() = default;
 
+void QFileDevicePrivate::applyIOQueueDepth()
+{
+    ioQueueDepthPending = false;
+    if (fileEngine && fileEngine->supportsExtension(QAbstractFileEngine::IOQueueExtension)) {
+        const QAbstractFileEngine::IOQueueExtensionOption option(ioQueueDepth);
+        fileEngine->extension(QAbstractFileEngine::IOQueueExtension, &option);
+    }
+}
+
 QAbstractFileEngine *QFileDevicePrivate::engine() const
 {
     if (!fileEngine)
@@ -319,6 +328,65 @@ bool QFileDevice::flush()
     return true;
 }
 
+/*!
+    \since 6.12
+
+    Sets the number of reads or writes that the file keeps in flight to
+    \a depth. The default is 0, which disables queuing.
+
+    When \a depth is larger than 0, reading from the file requests up to
+    \a depth chunks of 64 KiB ahead of the current position, so that later
+    reads are served from memory while the operating system is already
+    fetching the data that follows. Writes are collected into chunks of the
+    same size, which are handed to the operating system without waiting
+    for the previous ones to complete. At most 64 transfers are kept in
+    flight. This speeds up reading and writing large files sequentially,
+    in particular on storage with a high latency.
+
+    On Linux, the transfers are submitted through io_uring if Qt was built
+    with liburing support; otherwise a thread pool performs them. Queuing
+    is only supported for regular files on Unix systems that were not
+    opened in \l{QIODeviceBase::}{Append} mode or from a \c FILE handle.
+    For other files, this setting has no effect.
+
+    Because the data is written behind the caller's back, an error that
+    occurs while writing may only be reported by a later call to write(),
+    or by flush() and close(). Call flush() to make sure that all the data
+    was written. The position of the file descriptor returned by handle()
+    is only updated when the file is closed, or when queuing is disabled.
+
+    The setting applies to the open file, and to the files opened later
+    with this object.
+
+    \sa ioQueueDepth(), flush()
+*/
+void QFileDevice::setIOQueueDepth(int depth)
+{
+    Q_D(QFileDevice);
+    depth = qMax(depth, 0);
+    if (depth == d->ioQueueDepth)
+        return;
+    d->ioQueueDepth = depth;
+    if (isOpen())
+        d->applyIOQueueDepth();
+    else
+        d->ioQueueDepthPending = true;
+}
+
+/*!
+    \since 6.12
+
+    Returns the number of reads or writes that the file keeps in flight,
+    or 0 if queuing is disabled, which is the default.
+
+    \sa setIOQueueDepth()
+*/
+int QFileDevice::ioQueueDepth() const
+{
+    Q_D(const QFileDevice);
+    return d->ioQueueDepth;
+}
+
 /*!
   Calls QFileDevice::flush() and closes the file. Errors from flush are ignored.
 
@@ -339,6 +407,9 @@ void QFileDevice::close()
     // reset cached size
     d->cachedSize = 0;
 
+    // the next file to be opened may use a different engine
+    d->ioQueueDepthPending = d->ioQueueDepth != 0;
+
     // If flush() succeeded but close() failed, copy its error condition;
     // otherwise, keep the earlier flush() error.
     if (d->fileEngine->close() && flushed)
@@ -468,6 +539,8 @@ qint64 QFileDevice::readData(char *data, qint64 len)
     unsetError();
     if (!d->ensureFlushed())
         return -1;
+    if (Q_UNLIKELY(d->ioQueueDepthPending))
+        d->applyIOQueueDepth();
 
     const qint64 read = d->fileEngine->read(data, len);
     if (read < 0) {
@@ -551,6 +624,8 @@ qint64 QFileDevice::writeData(const char *data, qint64 len)
     unsetError();
     d->lastWasWrite = true;
     bool buffered = !(d->openMode & Unbuffered);
+    if (Q_UNLIKELY(d->ioQueueDepthPending))
+        d->applyIOQueueDepth();
 
     // Flush buffered data if this read will overflow.
     if (buffered && (d->writeBuffer.size() + len) > d->writeBufferChunkSize) {
@@ -125,6 +125,9 @@ public:
     bool atEnd() const override;
     bool flush();
 
+    void setIOQueueDepth(int depth);
+    int ioQueueDepth() const;
+
     qint64 size() const override;
 
     virtual bool resize(qint64 sz);
@@ -57,14 +57,17 @@ protected:
     void setError(QFileDevice::FileError err);
     void setError(QFileDevice::FileError err, const QString &errorString);
     void setError(QFileDevice::FileError err, int errNum);
+    void applyIOQueueDepth();
 
     mutable std::unique_ptr<QAbstractFileEngine> fileEngine;
     mutable qint64 cachedSize;
 
     QFileDevice::FileHandleFlags handleFlags;
     QFileDevice::FileError error;
+    int ioQueueDepth = 0;
 
     bool lastWasWrite;
+    bool ioQueueDepthPending = false;
 };
 
 inline bool QFileDevicePrivate::ensureFlushed() const
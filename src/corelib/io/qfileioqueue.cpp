@@ -0,0 +1,464 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:significant reason:default
+
+#include "qplatformdefs.h"
+#include "qfileioqueue_p.h"
+#include "qrandomaccessasyncfile_p_p.h"
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qwaitcondition.h>
+#include <QtCore/private/qsystemerror_p.h>
+
+#if QT_CONFIG(liburing)
+#include <QtCore/private/qioring_p.h>
+#endif
+
+#include <algorithm>
+
+#include <errno.h>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+// Runs the transfers as blocking pread()/pwrite() calls on the thread pool
+// that QRandomAccessAsyncFile uses. Always available.
+class QFileIOQueueThreadPoolBackend final : public QFileIOQueue
+{
+public:
+    QFileIOQueueThreadPoolBackend(int fd, qint64 pos, int depth)
+        : QFileIOQueue(fd, pos, depth)
+    {
+        QtPrivate::asyncFileThreadPool.ref();
+    }
+
+    ~QFileIOQueueThreadPoolBackend() override
+    {
+        drain();
+        QtPrivate::asyncFileThreadPool.deref();
+    }
+
+protected:
+    void start(Chunk &chunk) override
+    {
+        QtPrivate::asyncFileThreadPool()->start([this, &chunk, data = chunk.buffer.data()] {
+            transfer(chunk, data);
+            QMutexLocker locker(&m_mutex);
+            chunk.done = true;
+            m_finished.wakeAll();
+        });
+    }
+
+    void waitFor(Chunk &chunk) override
+    {
+        QMutexLocker locker(&m_mutex);
+        while (!chunk.done)
+            m_finished.wait(&m_mutex);
+    }
+
+private:
+    void transfer(Chunk &chunk, char *data) const
+    {
+        qint64 transferred = 0;
+        while (transferred < chunk.size) {
+            const size_t len = size_t(chunk.size - transferred);
+            const QT_OFF_T offset = QT_OFF_T(chunk.offset + transferred);
+            const ssize_t ret = chunk.write
+                    ? ::pwrite(m_fd, data + transferred, len, offset)
+                    : ::pread(m_fd, data + transferred, len, offset);
+            if (ret < 0) {
+                if (errno == EINTR)
+                    continue;
+                chunk.errnum = errno;
+                break;
+            }
+            if (ret == 0) {
+                // end of file for reads; a write that makes no progress is an error
+                if (chunk.write)
+                    chunk.errnum = EIO;
+                break;
+            }
+            transferred += ret;
+        }
+        chunk.result = transferred;
+    }
+
+    QMutex m_mutex;
+    QWaitCondition m_finished;
+};
+
+#if QT_CONFIG(liburing)
+// Submits the transfers to the calling thread's QIORing. The completions are
+// delivered on that thread, so a queue using this backend must not be used
+// from another thread while transfers are in flight.
+class QFileIOQueueIORingBackend final : public QFileIOQueue
+{
+public:
+    QFileIOQueueIORingBackend(QIORing *ring, int fd, qint64 pos, int depth)
+        : QFileIOQueue(fd, pos, depth), m_ring(ring), m_handles(size_t(depth))
+    {
+        // Registered buffers stay mapped in the kernel instead of being
+        // mapped for every transfer. When the ring's buffer table is full,
+        // or the kernel doesn't support it, the chunks are used unregistered.
+        std::vector<QSpan<std::byte>> buffers(m_handles.size());
+        for (int i = 0; i < depth; ++i)
+            buffers[size_t(i)] = as_writable_bytes(QSpan(chunkAt(i).buffer));
+        m_firstBuffer = m_ring->registerBuffers(buffers);
+    }
+
+    ~QFileIOQueueIORingBackend() override
+    {
+        drain();
+        m_ring->unregisterBuffers(m_firstBuffer, depth());
+    }
+
+protected:
+    void start(Chunk &chunk) override
+    {
+        // QIORing only reports a QFileDevice::FileError, not the errno
+        const auto setError = [&chunk](QFileDevice::FileError error) {
+            chunk.errnum = error == QFileDevice::ResourceError ? ENOSPC : EIO;
+        };
+
+        QIORing::RequestHandle &handle = m_handles[size_t(indexOf(chunk))];
+        if (chunk.write) {
+            QIORingRequest<QIORing::Operation::Write> request;
+            request.fd = m_fd;
+            request.offset = quint64(chunk.offset);
+            request.source = as_bytes(QSpan(std::as_const(chunk.buffer)).first(chunk.size));
+            if (m_firstBuffer >= 0)
+                request.bufferIndex = m_firstBuffer + qint32(indexOf(chunk));
+            request.setCallback([&chunk, setError](const QIORingRequest<QIORing::Operation::Write> &request) {
+                using Result = QIORingResult<QIORing::Operation::Write>;
+                if (const auto *result = std::get_if<Result>(&request.result))
+                    chunk.result = result->bytesWritten;
+                else if (const auto *error = std::get_if<QFileDevice::FileError>(&request.result))
+                    setError(*error);
+                chunk.done = true;
+            });
+            handle = m_ring->queueRequest(std::move(request));
+        } else {
+            QIORingRequest<QIORing::Operation::Read> request;
+            request.fd = m_fd;
+            request.offset = quint64(chunk.offset);
+            request.destination = as_writable_bytes(QSpan(chunk.buffer).first(chunk.size));
+            if (m_firstBuffer >= 0)
+                request.bufferIndex = m_firstBuffer + qint32(indexOf(chunk));
+            request.setCallback([&chunk, setError](const QIORingRequest<QIORing::Operation::Read> &request) {
+                using Result = QIORingResult<QIORing::Operation::Read>;
+                if (const auto *result = std::get_if<Result>(&request.result))
+                    chunk.result = result->bytesRead;
+                else if (const auto *error = std::get_if<QFileDevice::FileError>(&request.result))
+                    setError(*error);
+                chunk.done = true;
+            });
+            handle = m_ring->queueRequest(std::move(request));
+        }
+        m_ring->submitRequests();
+    }
+
+    void waitFor(Chunk &chunk) override
+    {
+        if (!chunk.done)
+            m_ring->waitForRequest(m_handles[size_t(indexOf(chunk))]);
+        Q_ASSERT(chunk.done);
+    }
+
+private:
+    QIORing *m_ring;
+    std::vector<QIORing::RequestHandle> m_handles;
+    qint32 m_firstBuffer = -1;  // index of the first chunk's registered buffer
+};
+#endif // liburing
+
+} // unnamed namespace
+
+/*!
+    \internal
+    \class QFileIOQueue
+    \inmodule QtCore
+
+    QFileIOQueue keeps a number of fixed-size transfers in flight on a file
+    descriptor on behalf of QFSFileEngine. Sequential reads are served from
+    chunks that were requested ahead of time, and writes are collected into
+    chunks that are submitted as soon as they are full, without waiting for
+    the previous ones to complete.
+
+    Errors from a write are reported by the next call to write() or flush().
+
+    The chunk buffers are allocated once and keep their addresses for the
+    lifetime of the queue. With io_uring they are registered with the ring
+    if it has room for them.
+*/
+
+/*!
+    \internal
+
+    Creates a queue for \a fd with up to \a depth transfers in flight. The
+    logical file position starts at \a pos.
+
+    Uses the calling thread's QIORing if Qt was built with liburing and the
+    kernel supports it, and a thread pool otherwise.
+*/
+std::unique_ptr<QFileIOQueue> QFileIOQueue::create(int fd, qint64 pos, int depth)
+{
+    depth = std::clamp(depth, 1, MaxDepth);
+#if QT_CONFIG(liburing)
+    if (QIORing *ring = QIORing::sharedInstance())
+        return std::make_unique<QFileIOQueueIORingBackend>(ring, fd, pos, depth);
+#endif
+    return std::make_unique<QFileIOQueueThreadPoolBackend>(fd, pos, depth);
+}
+
+QFileIOQueue::QFileIOQueue(int fd, qint64 pos, int depth)
+    : m_fd(fd), m_chunks(size_t(depth)), m_pos(pos)
+{
+    for (Chunk &chunk : m_chunks)
+        chunk.buffer.resizeForOverwrite(ChunkSize);
+}
+
+QFileIOQueue::~QFileIOQueue()
+{
+    // the backend must have drained the queue already
+    Q_ASSERT(std::all_of(m_chunks.cbegin(), m_chunks.cend(),
+                         [](const Chunk &chunk) { return chunk.done; }));
+}
+
+QString QFileIOQueue::errorString() const
+{
+    return QSystemError::stdString(m_errnum);
+}
+
+void QFileIOQueue::drain()
+{
+    for (int i = 0; i < m_count; ++i)
+        waitFor(at(i));
+}
+
+void QFileIOQueue::pop()
+{
+    Q_ASSERT(m_count > 0);
+    m_head = (m_head + 1) % depth();
+    --m_count;
+}
+
+void QFileIOQueue::issue(Chunk &chunk)
+{
+    chunk.consumed = 0;
+    chunk.result = 0;
+    chunk.errnum = 0;
+    chunk.done = false;
+    start(chunk);
+}
+
+void QFileIOQueue::setError(const Chunk &chunk)
+{
+    if (m_error != QFileDevice::NoError)
+        return;
+    m_errnum = chunk.errnum ? chunk.errnum : EIO;
+    if (!chunk.write)
+        m_error = QFileDevice::ReadError;
+    else if (m_errnum == ENOSPC)
+        m_error = QFileDevice::ResourceError;
+    else
+        m_error = QFileDevice::WriteError;
+}
+
+/*!
+    \internal
+
+    Copies up to \a maxlen bytes of read-ahead data to \a data, or skips
+    them if \a data is \nullptr, and refills the queue behind them.
+*/
+qint64 QFileIOQueue::consume(char *data, qint64 maxlen)
+{
+    Q_ASSERT(m_mode == Mode::Reading);
+    qint64 total = 0;
+    while (total < maxlen) {
+        while (m_count < depth()) {
+            Chunk &chunk = at(m_count++);
+            chunk.offset = m_nextReadOffset;
+            chunk.size = ChunkSize;
+            chunk.write = false;
+            m_nextReadOffset += ChunkSize;
+            issue(chunk);
+        }
+
+        Chunk &head = at(0);
+        waitFor(head);
+        if (head.errnum) {
+            setError(head);
+            discardReads();
+            return total ? total : -1;
+        }
+
+        const qint64 n = qMin(head.result - head.consumed, maxlen - total);
+        if (data)
+            memcpy(data + total, head.buffer.constData() + head.consumed, size_t(n));
+        head.consumed += n;
+        total += n;
+        m_pos += n;
+        if (head.consumed < head.result)
+            break;
+
+        // A short read means we reached the end of the file. Drop what was
+        // requested beyond it, so that the next read() looks again in case
+        // the file has grown in the meantime.
+        const bool endOfFile = head.result < head.size;
+        pop();
+        if (endOfFile) {
+            discardReads();
+            break;
+        }
+    }
+    return total;
+}
+
+void QFileIOQueue::discardReads()
+{
+    Q_ASSERT(m_mode == Mode::Reading);
+    drain();
+    m_head = 0;
+    m_count = 0;
+    m_mode = Mode::Idle;
+}
+
+bool QFileIOQueue::retireWrite()
+{
+    Chunk &chunk = at(0);
+    waitFor(chunk);
+    pop();
+    if (chunk.errnum == 0 && chunk.result == chunk.size)
+        return true;
+    setError(chunk);
+    return false;
+}
+
+bool QFileIOQueue::finishWrites()
+{
+    Q_ASSERT(m_mode == Mode::Writing);
+    if (m_filling) {
+        m_filling = false;
+        issue(at(m_count - 1));
+    }
+    bool ok = true;
+    while (m_count) {
+        if (!retireWrite())
+            ok = false;
+    }
+    m_head = 0;
+    m_mode = Mode::Idle;
+    return ok;
+}
+
+/*!
+    \internal
+
+    Reads up to \a maxlen bytes into \a data from the current position.
+    Returns the number of bytes read, 0 at the end of the file, or -1 if
+    an error occurred.
+*/
+qint64 QFileIOQueue::read(char *data, qint64 maxlen)
+{
+    m_error = QFileDevice::NoError;
+    if (m_mode == Mode::Writing && !finishWrites())
+        return -1;
+    if (m_mode != Mode::Reading) {
+        m_mode = Mode::Reading;
+        m_nextReadOffset = m_pos;
+    }
+    return consume(data, maxlen);
+}
+
+/*!
+    \internal
+
+    Queues \a len bytes from \a data for writing at the current position.
+    Returns \a len, or -1 if this or an earlier write failed.
+*/
+qint64 QFileIOQueue::write(const char *data, qint64 len)
+{
+    m_error = QFileDevice::NoError;
+    if (m_mode == Mode::Reading)
+        discardReads();
+    m_mode = Mode::Writing;
+
+    qint64 total = 0;
+    while (total < len) {
+        if (!m_filling) {
+            if (m_count == depth() && !retireWrite())
+                return -1;
+            Chunk &chunk = at(m_count++);
+            chunk.offset = m_pos;
+            chunk.size = 0;
+            chunk.write = true;
+            m_filling = true;
+        }
+
+        Chunk &chunk = at(m_count - 1);
+        const qsizetype n = qsizetype(qMin(qint64(ChunkSize - chunk.size), len - total));
+        memcpy(chunk.buffer.data() + chunk.size, data + total, size_t(n));
+        chunk.size += n;
+        total += n;
+        m_pos += n;
+        if (chunk.size == ChunkSize) {
+            m_filling = false;
+            issue(chunk);
+        }
+    }
+    return total;
+}
+
+/*!
+    \internal
+
+    Submits the partially filled chunk, if any, and waits for all pending
+    writes. Returns \c false if any of them failed.
+*/
+bool QFileIOQueue::flush()
+{
+    m_error = QFileDevice::NoError;
+    return m_mode != Mode::Writing || finishWrites();
+}
+
+/*!
+    \internal
+
+    Moves the logical position to \a pos. Pending writes are completed
+    first. A forward seek within the read-ahead window keeps the data that
+    was already requested.
+*/
+bool QFileIOQueue::seek(qint64 pos)
+{
+    m_error = QFileDevice::NoError;
+    if (m_mode == Mode::Reading) {
+        if (pos >= m_pos && pos - m_pos < qint64(depth()) * ChunkSize) {
+            if (consume(nullptr, pos - m_pos) < 0)
+                m_error = QFileDevice::NoError; // reported by the next read()
+            if (m_pos == pos)
+                return true;
+        }
+        if (m_mode == Mode::Reading)
+            discardReads();
+    } else if (m_mode == Mode::Writing && !finishWrites()) {
+        return false;
+    }
+    m_pos = pos;
+    return true;
+}
+
+/*!
+    \internal
+
+    Waits for and drops any data that was read ahead, for instance because
+    the file was changed by other means.
+*/
+void QFileIOQueue::discardReadAhead()
+{
+    if (m_mode == Mode::Reading)
+        discardReads();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,108 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:significant reason:default
+
+#ifndef QFILEIOQUEUE_P_H
+#define QFILEIOQUEUE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qfiledevice.h>
+#include <QtCore/qstring.h>
+
+#include <memory>
+#include <vector>
+
+QT_REQUIRE_CONFIG(async_io);
+
+QT_BEGIN_NAMESPACE
+
+// Reads ahead and writes behind on a file descriptor, keeping up to depth
+// chunks in flight. The descriptor's own file position is neither used nor
+// updated; the queue tracks the logical position itself.
+class QFileIOQueue
+{
+    Q_DISABLE_COPY_MOVE(QFileIOQueue)
+public:
+    static constexpr qsizetype ChunkSize = 64 * 1024;
+    static constexpr int MaxDepth = 64;
+
+    static std::unique_ptr<QFileIOQueue> create(int fd, qint64 pos, int depth);
+    virtual ~QFileIOQueue();
+
+    qint64 pos() const { return m_pos; }
+    QFileDevice::FileError error() const { return m_error; }
+    QString errorString() const;
+
+    qint64 read(char *data, qint64 maxlen);
+    qint64 write(const char *data, qint64 len);
+    bool flush();
+    bool seek(qint64 pos);
+    void discardReadAhead();
+
+protected:
+    struct Chunk
+    {
+        QByteArray buffer;
+        qint64 offset = 0;
+        qsizetype size = 0;     // bytes to transfer
+        qsizetype consumed = 0; // bytes of a finished read already returned
+        qint64 result = 0;      // bytes transferred
+        int errnum = 0;
+        bool write = false;
+        bool done = true;       // owned by the backend while a transfer runs
+    };
+
+    QFileIOQueue(int fd, qint64 pos, int depth);
+
+    // Starts the transfer described by chunk. The backend sets
+    // chunk.result, or chunk.errnum on failure, and then chunk.done.
+    virtual void start(Chunk &chunk) = 0;
+    virtual void waitFor(Chunk &chunk) = 0;
+    // Waits for every started transfer; derived destructors must call it.
+    void drain();
+
+    qsizetype indexOf(const Chunk &chunk) const { return &chunk - m_chunks.data(); }
+    Chunk &chunkAt(qsizetype index) { return m_chunks[size_t(index)]; }
+    int depth() const { return int(m_chunks.size()); }
+
+    const int m_fd;
+
+private:
+    enum class Mode : quint8 { Idle, Reading, Writing };
+
+    Chunk &at(int i) { return m_chunks[(m_head + i) % m_chunks.size()]; }
+    void pop();
+    void issue(Chunk &chunk);
+    qint64 consume(char *data, qint64 maxlen);
+    void discardReads();
+    bool retireWrite();
+    bool finishWrites();
+    void setError(const Chunk &chunk);
+
+    std::vector<Chunk> m_chunks;
+    qint64 m_pos;
+    qint64 m_nextReadOffset = 0;
+    int m_head = 0;
+    int m_count = 0;        // chunks that are in flight or being filled
+    int m_errnum = 0;
+    QFileDevice::FileError m_error = QFileDevice::NoError;
+    Mode m_mode = Mode::Idle;
+    bool m_filling = false; // the last chunk is still being filled by write()
+};
+
+QT_END_NAMESPACE
+
+#endif // QFILEIOQUEUE_P_H
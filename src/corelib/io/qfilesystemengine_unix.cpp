@@ -375,7 +375,7 @@ static int qt_fstatx(int fd, struct statx *statxBuffer)
     return qt_real_statx(fd, "", AT_EMPTY_PATH, statxBuffer);
 }
 
-inline void QFileSystemMetaData::fillFromStatxBuf(const struct statx &statxBuffer)
+void QFileSystemMetaData::fillFromStatxBuf(const struct statx &statxBuffer)
 {
     // Permissions
     MetaDataFlags flags = flagsFromStMode(statxBuffer.stx_mode, statxBuffer.stx_attributes);
@@ -408,7 +408,7 @@ static int qt_lstatx(const char *, struct statx *)
 static int qt_fstatx(int, struct statx *)
 { return -ENOSYS; }
 
-inline void QFileSystemMetaData::fillFromStatxBuf(const struct statx &)
+void QFileSystemMetaData::fillFromStatxBuf(const struct statx &)
 { }
 #endif
 
@@ -633,6 +633,21 @@ void QFileSystemMetaData::fillFromDirEnt(const QT_DIRENT &entry)
 #endif
 }
 
+// Merges statData, the result of a stat(2) (i.e. following symlinks) of this
+// entry, with what we already knew about the entry itself, e.g. from
+// fillFromDirEnt(): that's what fillMetaData() would have found out, minus the
+// lstat(2).
+void QFileSystemMetaData::fillFromFollowedStat(const QFileSystemMetaData &statData)
+{
+    constexpr MetaDataFlags EntryOnlyFlags = LinkType | HiddenAttribute;
+    const MetaDataFlags knownEntryFlags = knownFlagsMask & EntryOnlyFlags;
+    const MetaDataFlags entryOnlyFlags = entryFlags & knownEntryFlags;
+
+    *this = statData;
+    knownFlagsMask = (knownFlagsMask & ~EntryOnlyFlags) | knownEntryFlags | ExistsAttribute;
+    entryFlags = (entryFlags & ~EntryOnlyFlags) | entryOnlyFlags | ExistsAttribute;
+}
+
 //static
 QFileSystemEntry QFileSystemEngine::getLinkTarget(const QFileSystemEntry &link, QFileSystemMetaData &data)
 {
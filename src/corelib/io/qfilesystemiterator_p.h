@@ -55,14 +55,25 @@ private:
     bool uncFallback;
     int uncShareIndex;
     bool onlyDirs;
+#else
+    const QT_DIRENT *nextDirEntry();
+
+#if defined(Q_OS_LINUX)
+    // We call getdents64(2) ourselves, which lets us use a bigger buffer than
+    // readdir() does for large directories.
+    int dirFd = -1;
+    std::unique_ptr<char[]> direntBuffer;
+    qsizetype bufferCapacity = 0;
+    qsizetype bufferUsed = 0;
+    qsizetype bufferOffset = 0;
 #else
     struct DirStreamCloser {
         void operator()(QT_DIR *dir) { if (dir) QT_CLOSEDIR(dir); }
     };
     using DirPtr = std::unique_ptr<QT_DIR, DirStreamCloser>;
     DirPtr dir;
+#endif
 
-    QT_DIRENT *dirEntry = nullptr;
     int lastError = 0;
     QStringDecoder toUtf16;
 #endif
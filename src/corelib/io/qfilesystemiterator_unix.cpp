@@ -8,24 +8,51 @@
 #ifndef QT_NO_FILESYSTEMITERATOR
 
 #include <qvarlengtharray.h>
+#include <QtCore/private/qcore_unix_p.h>
 
 #include <memory>
 
 #include <stdlib.h>
 #include <errno.h>
 
+#ifdef Q_OS_LINUX
+#include <sys/syscall.h>
+#endif
+
 QT_BEGIN_NAMESPACE
 
+#ifdef Q_OS_LINUX
+// The kernel fills the buffer passed to getdents64(2) with as many entries as
+// fit, so a bigger buffer means fewer system calls for big directories. Most
+// directories are small, though, so start with what glibc's readdir() uses
+// and only grow the buffer when a directory keeps filling it.
+static constexpr qsizetype InitialDirentBufferSize = 32 * 1024;
+static constexpr qsizetype MaxDirentBufferSize = 1024 * 1024;
+
+// We hand out the records that getdents64(2) fills in as QT_DIRENT, which is
+// what glibc's readdir64() does as well:
+static_assert(offsetof(QT_DIRENT, d_reclen) == 16);
+static_assert(offsetof(QT_DIRENT, d_type) == 18);
+static_assert(offsetof(QT_DIRENT, d_name) == 19);
+#endif
+
 /*
     Native filesystem iterator, which uses ::opendir()/readdir()/dirent from the system
-    libraries to iterate over the directory represented by \a entry.
+    libraries (or getdents64(2) directly, on Linux) to iterate over the directory
+    represented by \a entry.
 */
 QFileSystemIterator::QFileSystemIterator(const QFileSystemEntry &entry)
     : dirPath(entry.filePath()),
       toUtf16(QStringDecoder::Utf8)
 {
+#ifdef Q_OS_LINUX
+    dirFd = qt_safe_open(entry.nativeFilePath().constData(), O_RDONLY | O_DIRECTORY);
+    const bool opened = dirFd >= 0;
+#else
     dir.reset(QT_OPENDIR(entry.nativeFilePath().constData()));
-    if (!dir) {
+    const bool opened = bool(dir);
+#endif
+    if (!opened) {
         lastError = errno;
     } else {
         if (!dirPath.endsWith(u'/'))
@@ -42,7 +69,64 @@ QFileSystemIterator::QFileSystemIterator(const QFileSystemEntry &entry, QDir::Fi
 {
 }
 
-QFileSystemIterator::~QFileSystemIterator() = default;
+QFileSystemIterator::~QFileSystemIterator()
+{
+#ifdef Q_OS_LINUX
+    if (dirFd >= 0)
+        qt_safe_close(dirFd);
+#endif
+}
+
+/*
+    Returns the next entry of the directory, or \nullptr at its end, or on
+    error, with errno set to indicate which one it was.
+*/
+const QT_DIRENT *QFileSystemIterator::nextDirEntry()
+{
+#ifdef Q_OS_LINUX
+    if (bufferOffset == bufferUsed) {
+        if (dirFd < 0) {
+            errno = 0;
+            return nullptr;
+        }
+        // The kernel stops filling the buffer once the next entry doesn't
+        // fit, so if less than the largest possible entry was left over, there
+        // probably are more entries than we could fit.
+        const bool filledBuffer = bufferCapacity - bufferUsed < qsizetype(sizeof(QT_DIRENT));
+        if (!direntBuffer || (filledBuffer && bufferCapacity < MaxDirentBufferSize)) {
+            bufferCapacity = direntBuffer ? bufferCapacity * 2 : InitialDirentBufferSize;
+            direntBuffer.reset(new char[bufferCapacity]);
+        }
+
+        const long result = syscall(SYS_getdents64, dirFd, direntBuffer.get(), bufferCapacity);
+        if (result <= 0) {
+            // 0 is the end of the directory, -1 sets errno
+            if (result == 0)
+                errno = 0;
+            const int savedErrno = errno;
+            qt_safe_close(dirFd);
+            dirFd = -1;
+            errno = savedErrno;
+            bufferUsed = bufferOffset = 0;
+            return nullptr;
+        }
+        bufferUsed = result;
+        bufferOffset = 0;
+    }
+
+    const auto *entry = reinterpret_cast<const QT_DIRENT *>(direntBuffer.get() + bufferOffset);
+    bufferOffset += entry->d_reclen;
+    return entry;
+#else
+    // From readdir man page:
+    // If the end of the directory stream is reached, NULL is returned and errno is
+    // not changed. If an error occurs, NULL is returned and errno is set to indicate
+    // the error. To distinguish end of stream from an error, set errno to zero before
+    // calling readdir() and then check the value of errno if NULL is returned.
+    errno = 0;
+    return QT_READDIR(dir.get());
+#endif
+}
 
 bool QFileSystemIterator::advance(QFileSystemEntry &fileEntry, QFileSystemMetaData &metaData)
 {
@@ -54,17 +138,16 @@ bool QFileSystemIterator::advance(QFileSystemEntry &fileEntry, QFileSystemMetaDa
 #endif
         return QFileSystemEntry(dirPath + name, QFileSystemEntry::FromInternalPath());
     };
+#ifdef Q_OS_LINUX
+    if (dirFd < 0 && bufferOffset == bufferUsed)
+        return false;
+#else
     if (!dir)
         return false;
+#endif
 
     for (;;) {
-        // From readdir man page:
-        // If the end of the directory stream is reached, NULL is returned and errno is
-        // not changed. If an error occurs, NULL is returned and errno is set to indicate
-        // the error. To distinguish end of stream from an error, set errno to zero before
-        // calling readdir() and then check the value of errno if NULL is returned.
-        errno = 0;
-        dirEntry = QT_READDIR(dir.get());
+        const QT_DIRENT *dirEntry = nextDirEntry();
 
         if (dirEntry) {
             // POSIX allows readdir() to return a file name in struct dirent that
@@ -205,6 +205,7 @@ public:
     void fillFromStatxBuf(const struct statx &statBuffer);
     void fillFromStatBuf(const QT_STATBUF &statBuffer);
     void fillFromDirEnt(const QT_DIRENT &statBuffer);
+    void fillFromFollowedStat(const QFileSystemMetaData &statData);
 #endif
 
 #if defined(Q_OS_WIN)
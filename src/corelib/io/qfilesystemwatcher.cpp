@@ -10,6 +10,7 @@
 #include <qfileinfo.h>
 #include <qloggingcategory.h>
 #include <qset.h>
+#include <qtimer.h>
 
 #if (defined(Q_OS_LINUX) || defined(Q_OS_QNX) || defined(Q_OS_FREEBSD)) && QT_CONFIG(inotify)
 #  define USE_INOTIFY
@@ -25,6 +26,9 @@
 #elif defined(Q_OS_MACOS)
 #  include "qfilesystemwatcher_fsevents_p.h"
 #endif
+#if QT_CONFIG(fanotify)
+#  include "qfilesystemwatcher_fanotify_p.h"
+#endif
 
 #include <algorithm>
 #include <iterator>
@@ -64,6 +68,8 @@ void QFileSystemWatcherPrivate::connectEngine(QFileSystemWatcherEngine *engine)
                             this, &QFileSystemWatcherPrivate::fileChanged);
     QObjectPrivate::connect(engine, &QFileSystemWatcherEngine::directoryChanged,
                             this, &QFileSystemWatcherPrivate::directoryChanged);
+    QObjectPrivate::connect(engine, &QFileSystemWatcherEngine::entryChanged,
+                            this, &QFileSystemWatcherPrivate::entryChanged);
 }
 
 void QFileSystemWatcherPrivate::init()
@@ -95,6 +101,28 @@ void QFileSystemWatcherPrivate::initPollerEngine()
     connectEngine(poller);
 }
 
+void QFileSystemWatcherPrivate::initRecursiveEngines()
+{
+    if (!recursiveEngines.isEmpty())
+        return;
+
+    Q_Q(QFileSystemWatcher);
+#if QT_CONFIG(fanotify)
+    // one mark per file system instead of one watch per directory, but
+    // it's only permitted to privileged processes
+    if (auto *engine = QFanotifyFileSystemWatcherEngine::create(q))
+        recursiveEngines.append(engine);
+#endif
+#if defined(USE_INOTIFY)
+    // a separate instance, so the watches for the trees don't get mixed up
+    // with the ones for addPaths()
+    if (auto *engine = QInotifyFileSystemWatcherEngine::create(q))
+        recursiveEngines.append(engine);
+#endif
+    for (QFileSystemWatcherEngine *engine : std::as_const(recursiveEngines))
+        connectEngine(engine);
+}
+
 void QFileSystemWatcherPrivate::fileChanged(const QString &path, bool removed)
 {
     Q_Q(QFileSystemWatcher);
@@ -105,6 +133,7 @@ void QFileSystemWatcherPrivate::fileChanged(const QString &path, bool removed)
     }
     if (removed)
         files.removeAll(path);
+    queueChange(path);
     emit q->fileChanged(path, QFileSystemWatcher::QPrivateSignal());
 }
 
@@ -112,15 +141,67 @@ void QFileSystemWatcherPrivate::directoryChanged(const QString &path, bool remov
 {
     Q_Q(QFileSystemWatcher);
     qCDebug(lcWatcher) << "directory changed" << path << "removed?" << removed << "watching?" << directories.contains(path);
-    if (!directories.contains(path)) {
+    // the recursive engines only report their roots being removed
+    const bool isRecursive = removed && recursiveDirectories.contains(path);
+    if (!directories.contains(path) && !isRecursive) {
         // perhaps the path was removed after a change was detected, but before we delivered the signal
         return;
     }
-    if (removed)
+    if (removed) {
         directories.removeAll(path);
+        recursiveDirectories.removeAll(path);
+    }
+    queueChange(path);
     emit q->directoryChanged(path, QFileSystemWatcher::QPrivateSignal());
 }
 
+void QFileSystemWatcherPrivate::entryChanged(const QString &directory, const QString &name)
+{
+    // directoryChanged() for the directories below the recursive watches is
+    // emitted together with pathsChanged(), once per batch
+    pendingDirectoryChanges.insert(directory);
+    if (name.isEmpty())
+        queueChange(directory);
+    else if (directory.endsWith(u'/'))
+        queueChange(directory + name);
+    else
+        queueChange(directory + u'/' + name);
+}
+
+void QFileSystemWatcherPrivate::queueChange(const QString &path)
+{
+    pendingChanges.insert(path);
+    if (!debounceTimer) {
+        Q_Q(QFileSystemWatcher);
+        debounceTimer = new QTimer(q);
+        debounceTimer->setSingleShot(true);
+        QObjectPrivate::connect(debounceTimer, &QTimer::timeout,
+                                this, &QFileSystemWatcherPrivate::emitPendingChanges);
+    }
+    // not restarted by later changes, so that a steady stream of them
+    // still gets reported every debounceInterval
+    if (!debounceTimer->isActive())
+        debounceTimer->start(debounceInterval);
+}
+
+void QFileSystemWatcherPrivate::emitPendingChanges()
+{
+    Q_Q(QFileSystemWatcher);
+    QStringList paths(pendingChanges.cbegin(), pendingChanges.cend());
+    pendingChanges.clear();
+    QStringList changedDirectories(pendingDirectoryChanges.cbegin(), pendingDirectoryChanges.cend());
+    pendingDirectoryChanges.clear();
+
+    qCDebug(lcWatcher) << "paths changed" << paths;
+    changedDirectories.sort();
+    for (const QString &directory : std::as_const(changedDirectories))
+        emit q->directoryChanged(directory, QFileSystemWatcher::QPrivateSignal());
+    if (!paths.isEmpty()) {
+        paths.sort();
+        emit q->pathsChanged(paths, QFileSystemWatcher::QPrivateSignal());
+    }
+}
+
 #if defined(Q_OS_WIN)
 
 void QFileSystemWatcherPrivate::winDriveLockForRemoval(const QString &path)
@@ -188,6 +269,23 @@ void  QFileSystemWatcherPrivate::winDriveRemoved(const QString &path)
     they have been renamed or removed from disk, and directories once
     they have been removed from disk.
 
+    \section1 Watching Directory Trees
+
+    Since Qt 6.12, addRecursivePath() and addRecursivePaths() watch a
+    directory together with all the files and directories below it,
+    including the ones created later. Watching a tree this way is much
+    cheaper than adding each of its directories with addPath(): on Linux,
+    privileged processes watch a whole file system with a single fanotify
+    mark, and other processes use one inotify watch per directory, added
+    in the background as the tree gets scanned.
+
+    Changes are collected for debounceInterval() and then reported all at
+    once by the pathsChanged() signal, which carries the paths of the
+    files and directories that changed. The directoryChanged() signal is
+    emitted as well for each directory whose contents changed in the
+    batch, so existing code keeps working. The paths of the watches
+    added with addPath() are reported by pathsChanged() too.
+
     \list
     \li \b Notes:
     \list
@@ -207,6 +305,18 @@ void  QFileSystemWatcherPrivate::winDriveRemoved(const QString &path)
          being monitored, and these other open descriptors also count in
          the total. \macos uses a different backend and does not
          suffer from this issue.
+
+         \li Recursive watches are currently only supported on Linux. On
+         other platforms, addRecursivePath() and addRecursivePaths() print
+         a warning and watch nothing.
+
+         \li Without the privileges needed for fanotify, each directory
+         in a recursively watched tree counts against the inotify watch
+         limit of the user (\c{fs.inotify.max_user_watches}). Once the
+         limit is reached, a warning is printed and changes in the
+         directories that could not be watched are not reported. With
+         fanotify, file systems mounted below a recursively watched
+         directory are not watched.
     \endlist
     \endlist
 
@@ -448,6 +558,200 @@ QStringList QFileSystemWatcher::removePaths(const QStringList &paths)
     \sa directories()
 */
 
+/*!
+    \fn void QFileSystemWatcher::pathsChanged(const QStringList &paths)
+    \since 6.12
+
+    This signal is emitted at most once per debounceInterval() with the
+    sorted, duplicate-free list of \a paths that changed since it was
+    last emitted. A path may belong to a file or directory that has been
+    created, modified, renamed or removed, anywhere below a directory
+    watched with addRecursivePath(), or to a file or directory watched
+    with addPath().
+
+    If the system dropped events because they came too fast, the
+    recursively watched directories themselves are reported, and their
+    contents should be considered changed.
+
+    \sa debounceInterval(), addRecursivePaths()
+*/
+
+/*!
+    \since 6.12
+
+    Watches the directory \a directory and everything below it. Returns
+    \c true on success.
+
+    \note Recursive watches are currently only supported on Linux. On
+    other platforms, this function prints a warning and returns \c false;
+    use addPath() for each directory of the tree instead.
+
+    \sa addRecursivePaths(), removeRecursivePath(), pathsChanged()
+*/
+bool QFileSystemWatcher::addRecursivePath(const QString &directory)
+{
+    if (directory.isEmpty()) {
+        qWarning("QFileSystemWatcher::addRecursivePath: path is empty");
+        return true;
+    }
+
+    return addRecursivePaths(QStringList(directory)).isEmpty();
+}
+
+/*!
+    \since 6.12
+
+    Watches each directory in \a directories and everything below it,
+    including the files and directories that get created later. Changes
+    are reported by the pathsChanged() signal, and the directoryChanged()
+    signal for the directory that contains them.
+
+    Directories that are already being watched recursively are not added
+    again. The return value is a list of the directories that could not
+    be watched, for instance because they do not exist or are not
+    directories, or because the platform does not support recursive
+    watches.
+
+    Directories below a watched one are watched in the background, so
+    changes very early on in large trees may be missed.
+
+    \note Recursive watches are currently only supported on Linux. On
+    other platforms, this function prints a warning and returns all of
+    \a directories; use addPaths() for each directory of the trees
+    instead.
+
+    \sa addRecursivePath(), removeRecursivePaths(), recursiveDirectories()
+*/
+QStringList QFileSystemWatcher::addRecursivePaths(const QStringList &directories)
+{
+    Q_D(QFileSystemWatcher);
+
+    QStringList p = empty_paths_pruned(directories);
+    if (p.isEmpty()) {
+        qWarning("QFileSystemWatcher::addRecursivePaths: list is empty");
+        return p;
+    }
+    qCDebug(lcWatcher) << "adding recursively" << directories;
+
+    // Each engine returns what it couldn't handle, so the next one tries
+    // those only. Filter the duplicates first, otherwise a later engine
+    // would watch them again.
+    QStringList unhandled;
+    p.removeIf([&](const QString &path) {
+        if (!d->recursiveDirectories.contains(path))
+            return false;
+        unhandled.append(path);
+        return true;
+    });
+
+    d->initRecursiveEngines();
+    if (d->recursiveEngines.isEmpty() && !p.isEmpty())
+        qWarning("QFileSystemWatcher::addRecursivePaths: recursive watches are not supported on this platform");
+    for (QFileSystemWatcherEngine *engine : std::as_const(d->recursiveEngines)) {
+        if (p.isEmpty())
+            break;
+        p = engine->addRecursivePaths(p, &d->recursiveDirectories);
+    }
+
+    return unhandled + p;
+}
+
+/*!
+    \since 6.12
+
+    Stops watching the tree below \a directory. Returns \c true on
+    success.
+
+    \sa removeRecursivePaths(), addRecursivePath()
+*/
+bool QFileSystemWatcher::removeRecursivePath(const QString &directory)
+{
+    if (directory.isEmpty()) {
+        qWarning("QFileSystemWatcher::removeRecursivePath: path is empty");
+        return true;
+    }
+
+    return removeRecursivePaths(QStringList(directory)).isEmpty();
+}
+
+/*!
+    \since 6.12
+
+    Stops watching the trees below \a directories, which must have been
+    added with addRecursivePaths(). Changes that were already detected may
+    still be reported by the next pathsChanged() signal.
+
+    The return value is a list of the directories that were not being
+    watched recursively.
+
+    \sa removeRecursivePath(), addRecursivePaths()
+*/
+QStringList QFileSystemWatcher::removeRecursivePaths(const QStringList &directories)
+{
+    Q_D(QFileSystemWatcher);
+
+    QStringList p = empty_paths_pruned(directories);
+    if (p.isEmpty()) {
+        qWarning("QFileSystemWatcher::removeRecursivePaths: list is empty");
+        return p;
+    }
+    qCDebug(lcWatcher) << "removing recursively" << directories;
+
+    for (QFileSystemWatcherEngine *engine : std::as_const(d->recursiveEngines)) {
+        if (p.isEmpty())
+            break;
+        p = engine->removeRecursivePaths(p, &d->recursiveDirectories);
+    }
+
+    return p;
+}
+
+/*!
+    \since 6.12
+
+    Returns the list of directories that are being watched recursively.
+
+    \sa addRecursivePaths(), directories()
+*/
+QStringList QFileSystemWatcher::recursiveDirectories() const
+{
+    Q_D(const QFileSystemWatcher);
+    return d->recursiveDirectories;
+}
+
+/*!
+    \since 6.12
+
+    Returns how long changes are collected before pathsChanged() reports
+    them. The default is 100 milliseconds.
+
+    \sa setDebounceInterval()
+*/
+std::chrono::milliseconds QFileSystemWatcher::debounceInterval() const
+{
+    Q_D(const QFileSystemWatcher);
+    return d->debounceInterval;
+}
+
+/*!
+    \since 6.12
+
+    Sets the time changes are collected before pathsChanged() reports
+    them to \a interval. The interval starts with the first change after
+    the previous signal, and further changes do not extend it, so that a
+    steady stream of changes is still reported regularly. An interval of
+    zero reports the changes from the next iteration of the event loop.
+
+    The new interval is used from the next batch on.
+
+    \sa debounceInterval()
+*/
+void QFileSystemWatcher::setDebounceInterval(std::chrono::milliseconds interval)
+{
+    Q_D(QFileSystemWatcher);
+    d->debounceInterval = std::max(interval, std::chrono::milliseconds::zero());
+}
+
 QStringList QFileSystemWatcher::directories() const
 {
     Q_D(const QFileSystemWatcher);
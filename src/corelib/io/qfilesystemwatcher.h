@@ -7,6 +7,8 @@
 
 #include <QtCore/qobject.h>
 
+#include <chrono>
+
 QT_REQUIRE_CONFIG(filesystemwatcher);
 
 QT_BEGIN_NAMESPACE
@@ -32,9 +34,19 @@ public:
     QStringList files() const;
     QStringList directories() const;
 
+    bool addRecursivePath(const QString &directory);
+    QStringList addRecursivePaths(const QStringList &directories);
+    bool removeRecursivePath(const QString &directory);
+    QStringList removeRecursivePaths(const QStringList &directories);
+    QStringList recursiveDirectories() const;
+
+    std::chrono::milliseconds debounceInterval() const;
+    void setDebounceInterval(std::chrono::milliseconds interval);
+
 Q_SIGNALS:
     void fileChanged(const QString &path, QPrivateSignal);
     void directoryChanged(const QString &path, QPrivateSignal);
+    void pathsChanged(const QStringList &paths, QPrivateSignal);
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,334 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:significant reason:default
+
+#include "qplatformdefs.h"
+#include "qfilesystemwatcher_fanotify_p.h"
+
+#include "private/qcore_unix_p.h"
+
+#include <qdebug.h>
+#include <qfile.h>
+#include <qhash.h>
+#include <qscopeguard.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/fanotify.h>
+#include <sys/stat.h>
+#include <sys/statfs.h>
+#include <unistd.h>
+
+QT_BEGIN_NAMESPACE
+
+using namespace Qt::StringLiterals;
+
+// The mark covers the whole file system, so FAN_MODIFY would wake us up for
+// every write() anywhere on it. A file written to is reported once its
+// writer closes it instead.
+static constexpr quint64 FanotifyMask = FAN_CREATE | FAN_DELETE | FAN_MOVED_FROM | FAN_MOVED_TO
+        | FAN_CLOSE_WRITE | FAN_ATTRIB | FAN_DELETE_SELF | FAN_MOVE_SELF | FAN_ONDIR;
+
+// Directory events that can change what is below a root
+static constexpr quint64 DirectoryMovedMask = FAN_MOVED_FROM | FAN_MOVED_TO | FAN_MOVE_SELF
+        | FAN_DELETE | FAN_DELETE_SELF;
+
+// Upper bound of the handles remembered to be outside of all roots
+static constexpr qsizetype MaxCachedOutsideDirectories = 4096;
+
+static bool isSameOrBelow(const QString &path, const QString &directory)
+{
+    if (directory == "/"_L1)
+        return path.startsWith(u'/');
+    return path.startsWith(directory)
+            && (path.size() == directory.size() || path.at(directory.size()) == u'/');
+}
+
+QFanotifyFileSystemWatcherEngine *QFanotifyFileSystemWatcherEngine::create(QObject *parent)
+{
+    // FAN_REPORT_DFID_NAME needs Linux 5.9
+    const int fd = fanotify_init(FAN_CLASS_NOTIF | FAN_CLOEXEC | FAN_NONBLOCK
+                                 | FAN_REPORT_DFID_NAME, O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+        return nullptr;
+    return new QFanotifyFileSystemWatcherEngine(fd, parent);
+}
+
+QFanotifyFileSystemWatcherEngine::QFanotifyFileSystemWatcherEngine(int fd, QObject *parent)
+    : QFileSystemWatcherEngine(parent),
+      fanotifyFd(fd),
+      notifier(fd, QSocketNotifier::Read, this)
+{
+    QObject::connect(&notifier, &QSocketNotifier::activated,
+                     this, &QFanotifyFileSystemWatcherEngine::readFromFanotify);
+}
+
+QFanotifyFileSystemWatcherEngine::~QFanotifyFileSystemWatcherEngine()
+{
+    notifier.setEnabled(false);
+    for (const Root &root : roots)
+        qt_safe_close(root.fd);
+    // closing the group drops its marks
+    qt_safe_close(fanotifyFd);
+}
+
+QStringList QFanotifyFileSystemWatcherEngine::addRecursivePaths(const QStringList &paths,
+                                                                QStringList *directories)
+{
+    QStringList unhandled;
+    for (const QString &path : paths) {
+        if (!permitted || directories->contains(path) || !addRoot(path)) {
+            unhandled.push_back(path);
+            continue;
+        }
+        directories->append(path);
+    }
+    return unhandled;
+}
+
+QStringList QFanotifyFileSystemWatcherEngine::removeRecursivePaths(const QStringList &paths,
+                                                                   QStringList *directories)
+{
+    QStringList unhandled;
+    for (const QString &path : paths) {
+        const auto it = std::find_if(roots.begin(), roots.end(),
+                                     [&](const Root &root) { return root.path == path; });
+        if (it == roots.end()) {
+            unhandled.push_back(path);
+            continue;
+        }
+        removeRoot(it);
+        directories->removeAll(path);
+    }
+    return unhandled;
+}
+
+bool QFanotifyFileSystemWatcherEngine::addRoot(const QString &path)
+{
+    const int fd = qt_safe_open(QFile::encodeName(path), O_RDONLY | O_DIRECTORY);
+    if (fd == -1)
+        return false;
+    auto closeFd = qScopeGuard([fd] { qt_safe_close(fd); });
+
+    QT_STATBUF st;
+    struct statfs sfs;
+    if (QT_FSTAT(fd, &st) != 0 || fstatfs(fd, &sfs) != 0)
+        return false;
+
+    FileSystemId fsid;
+    static_assert(sizeof(fsid) == sizeof(sfs.f_fsid));
+    memcpy(fsid.data(), &sfs.f_fsid, sizeof(fsid));
+    if (fsid == FileSystemId{})
+        return false;   // the events couldn't be told apart from other file systems
+
+    const bool alreadyMarked = std::any_of(roots.cbegin(), roots.cend(),
+                                           [&](const Root &root) { return root.fsid == fsid; });
+    if (!alreadyMarked
+        && fanotify_mark(fanotifyFd, FAN_MARK_ADD | FAN_MARK_FILESYSTEM, FanotifyMask,
+                         fd, nullptr) == -1) {
+        // EPERM without CAP_SYS_ADMIN, ENODEV or EXDEV on file systems
+        // without usable file handles
+        if (errno == EPERM)
+            permitted = false;
+        return false;
+    }
+    auto unmark = qScopeGuard([&] {
+        if (!alreadyMarked)
+            fanotify_mark(fanotifyFd, FAN_MARK_REMOVE | FAN_MARK_FILESYSTEM, FanotifyMask,
+                          fd, nullptr);
+    });
+
+    // Resolve the root the same way as the directories of the events later
+    // on, so that they compare equal. This also finds out whether we're
+    // allowed to do so (CAP_DAC_READ_SEARCH) before relying on it.
+    alignas(file_handle) char storage[sizeof(file_handle) + MAX_HANDLE_SZ];
+    auto *handle = reinterpret_cast<file_handle *>(storage);
+    handle->handle_bytes = MAX_HANDLE_SZ;
+    int mountId;
+    if (name_to_handle_at(fd, "", handle, &mountId, AT_EMPTY_PATH) == -1)
+        return false;
+    const QString canonicalPath = resolveDirectory(fd, handle);
+    if (canonicalPath.isEmpty()) {
+        if (errno == EPERM)
+            permitted = false;
+        return false;
+    }
+
+    unmark.dismiss();
+    closeFd.dismiss();
+    roots.push_back({ path, canonicalPath, fd, st.st_dev, st.st_ino, fsid });
+    // some of them are inside the new root
+    directoriesOutsideRoots.clear();
+    return true;
+}
+
+void QFanotifyFileSystemWatcherEngine::removeRoot(std::vector<Root>::iterator root)
+{
+    const FileSystemId fsid = root->fsid;
+    const int fd = root->fd;
+    roots.erase(root);
+
+    const bool stillMarked = std::any_of(roots.cbegin(), roots.cend(),
+                                         [&](const Root &root) { return root.fsid == fsid; });
+    if (!stillMarked)
+        fanotify_mark(fanotifyFd, FAN_MARK_REMOVE | FAN_MARK_FILESYSTEM, FanotifyMask,
+                      fd, nullptr);
+    qt_safe_close(fd);
+}
+
+// Returns the innermost root containing \a directory.
+auto QFanotifyFileSystemWatcherEngine::findRoot(const FileSystemId &fsid,
+                                                const QString &directory) const -> const Root *
+{
+    const Root *found = nullptr;
+    for (const Root &root : roots) {
+        if (root.fsid != fsid || !isSameOrBelow(directory, root.canonicalPath))
+            continue;
+        if (!found || root.canonicalPath.size() > found->canonicalPath.size())
+            found = &root;
+    }
+    return found;
+}
+
+QString QFanotifyFileSystemWatcherEngine::resolveDirectory(int mountFd, file_handle *handle)
+{
+    const int fd = open_by_handle_at(mountFd, handle, O_PATH | O_CLOEXEC);
+    if (fd == -1)
+        return QString();   // ESTALE if it's gone by now
+    auto closeFd = qScopeGuard([fd] { qt_safe_close(fd); });
+
+    char target[PATH_MAX];
+    const QByteArray link = "/proc/self/fd/" + QByteArray::number(fd);
+    const ssize_t len = ::readlink(link.constData(), target, sizeof(target));
+    if (len <= 0 || size_t(len) == sizeof(target))
+        return QString();
+    const QString path = QFile::decodeName(QByteArray(target, len));
+    if (path.endsWith(" (deleted)"_L1))
+        return QString();
+    return path;
+}
+
+void QFanotifyFileSystemWatcherEngine::readFromFanotify()
+{
+    alignas(fanotify_event_metadata) char buffer[16 * 1024];
+
+    // Many events of a batch are about the same few directories; resolving
+    // a handle costs two system calls, so remember what they were. Most
+    // events on a busy file system are about directories outside of the
+    // roots, which directoriesOutsideRoots remembers across batches.
+    QHash<QByteArray, QString> resolved;
+    bool rootsMayBeGone = false;
+
+    for (;;) {
+        ssize_t len = qt_safe_read(fanotifyFd, buffer, sizeof(buffer));
+        if (len <= 0)
+            break;      // EAGAIN, the group is non-blocking
+
+        auto *event = reinterpret_cast<fanotify_event_metadata *>(buffer);
+        for ( ; FAN_EVENT_OK(event, len); event = FAN_EVENT_NEXT(event, len)) {
+            if (event->vers != FANOTIFY_METADATA_VERSION) {
+                qWarning("QFileSystemWatcher: unexpected fanotify metadata version %d",
+                         int(event->vers));
+                return;
+            }
+            if (event->fd >= 0)
+                qt_safe_close(event->fd);
+
+            if (event->mask & FAN_Q_OVERFLOW) {
+                // lost track, everything may have changed
+                for (const Root &root : roots)
+                    emit entryChanged(root.path, QString());
+                continue;
+            }
+            if (event->mask & (FAN_DELETE_SELF | FAN_MOVE_SELF))
+                rootsMayBeGone = true;
+            if ((event->mask & FAN_ONDIR) && (event->mask & DirectoryMovedMask)) {
+                // the directories below this one may now be elsewhere, and
+                // the handle of a deleted one may be reused
+                resolved.clear();
+                directoriesOutsideRoots.clear();
+            }
+
+            char *info = reinterpret_cast<char *>(event) + event->metadata_len;
+            char *const end = reinterpret_cast<char *>(event) + event->event_len;
+            while (info + sizeof(fanotify_event_info_header) <= end) {
+                auto *fid = reinterpret_cast<fanotify_event_info_fid *>(info);
+                if (fid->hdr.len == 0)
+                    break;
+                info += fid->hdr.len;
+                if (fid->hdr.info_type != FAN_EVENT_INFO_TYPE_DFID_NAME
+                    && fid->hdr.info_type != FAN_EVENT_INFO_TYPE_DFID) {
+                    continue;
+                }
+
+                FileSystemId fsid;
+                static_assert(sizeof(fsid) == sizeof(fid->fsid));
+                memcpy(fsid.data(), &fid->fsid, sizeof(fsid));
+                const auto anyRoot = std::find_if(roots.cbegin(), roots.cend(),
+                                                  [&](const Root &root) { return root.fsid == fsid; });
+                if (anyRoot == roots.cend())
+                    continue;
+
+                auto *handle = reinterpret_cast<file_handle *>(fid->handle);
+                QByteArray key(reinterpret_cast<const char *>(fsid.data()), sizeof(fsid));
+                key.append(reinterpret_cast<const char *>(handle),
+                           sizeof(file_handle) + handle->handle_bytes);
+                if (directoriesOutsideRoots.contains(key))
+                    continue;
+                auto it = resolved.constFind(key);
+                if (it == resolved.cend())
+                    it = resolved.insert(key, resolveDirectory(anyRoot->fd, handle));
+                const QString &directory = *it;
+                if (directory.isEmpty())
+                    continue;
+
+                const Root *root = findRoot(fsid, directory);
+                if (!root) {
+                    // somewhere else on the same file system
+                    if (directoriesOutsideRoots.size() >= MaxCachedOutsideDirectories)
+                        directoriesOutsideRoots.clear();
+                    directoriesOutsideRoots.insert(key);
+                    continue;
+                }
+
+                QString name;
+                if (fid->hdr.info_type == FAN_EVENT_INFO_TYPE_DFID_NAME) {
+                    const char *entry = reinterpret_cast<const char *>(handle->f_handle
+                                                                       + handle->handle_bytes);
+                    if (qstrcmp(entry, ".") != 0)
+                        name = QFile::decodeName(entry);
+                }
+                emit entryChanged(root->path + QStringView(directory).mid(root->canonicalPath.size()),
+                                  name);
+            }
+        }
+    }
+
+    if (rootsMayBeGone)
+        checkRoots();
+}
+
+// Drops the roots that were deleted or moved away.
+void QFanotifyFileSystemWatcherEngine::checkRoots()
+{
+    QStringList removed;
+    for (auto it = roots.begin(); it != roots.end(); ) {
+        QT_STATBUF st;
+        if (QT_STAT(QFile::encodeName(it->path), &st) == 0
+            && st.st_dev == it->device && st.st_ino == it->inode) {
+            ++it;
+            continue;
+        }
+        removed.push_back(it->path);
+        removeRoot(it);
+        it = roots.begin();
+    }
+    for (const QString &path : std::as_const(removed))
+        emit directoryChanged(path, true);
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qfilesystemwatcher_fanotify_p.cpp"
@@ -0,0 +1,93 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:significant reason:default
+
+#ifndef QFILESYSTEMWATCHER_FANOTIFY_P_H
+#define QFILESYSTEMWATCHER_FANOTIFY_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qfilesystemwatcher_p.h"
+
+QT_REQUIRE_CONFIG(filesystemwatcher);
+QT_REQUIRE_CONFIG(fanotify);
+
+#include <QtCore/qset.h>
+#include <QtCore/qsocketnotifier.h>
+
+#include <array>
+#include <vector>
+
+#include <sys/types.h>
+
+struct file_handle;
+
+QT_BEGIN_NAMESPACE
+
+// Watches whole trees with a single fanotify mark per file system, see
+// fanotify(7). The kernel reports the parent directory as a file handle
+// plus the entry name, so no per-directory state is needed, but marking a
+// file system and resolving the handles requires CAP_SYS_ADMIN and
+// CAP_DAC_READ_SEARCH. Without them this engine handles nothing and the
+// inotify one takes over. Mount points below a watched directory are not
+// covered.
+class QFanotifyFileSystemWatcherEngine : public QFileSystemWatcherEngine
+{
+    Q_OBJECT
+
+public:
+    ~QFanotifyFileSystemWatcherEngine();
+
+    static QFanotifyFileSystemWatcherEngine *create(QObject *parent);
+
+    // this engine only does recursive watches
+    QStringList addPaths(const QStringList &paths, QStringList *, QStringList *) override
+    { return paths; }
+    QStringList removePaths(const QStringList &paths, QStringList *, QStringList *) override
+    { return paths; }
+
+    QStringList addRecursivePaths(const QStringList &paths, QStringList *directories) override;
+    QStringList removeRecursivePaths(const QStringList &paths, QStringList *directories) override;
+
+private Q_SLOTS:
+    void readFromFanotify();
+
+private:
+    using FileSystemId = std::array<int, 2>;
+    struct Root {
+        QString path;           // as passed to addRecursivePaths()
+        QString canonicalPath;  // as resolved from the file handles
+        int fd;                 // mount fd for open_by_handle_at()
+        dev_t device;
+        ino_t inode;
+        FileSystemId fsid;
+    };
+
+    QFanotifyFileSystemWatcherEngine(int fd, QObject *parent);
+    bool addRoot(const QString &path);
+    void removeRoot(std::vector<Root>::iterator root);
+    const Root *findRoot(const FileSystemId &fsid, const QString &directory) const;
+    static QString resolveDirectory(int mountFd, file_handle *handle);
+    void checkRoots();
+
+    int fanotifyFd;
+    std::vector<Root> roots;
+    // file system ids and handles of directories that are not below any
+    // root, forgotten when directories get moved or deleted
+    QSet<QByteArray> directoriesOutsideRoots;
+    QSocketNotifier notifier;
+    bool permitted = true;
+};
+
+QT_END_NAMESPACE
+
+#endif // QFILESYSTEMWATCHER_FANOTIFY_P_H
@@ -9,6 +9,7 @@
 #include "private/qsystemerror_p.h"
 
 #include <qdebug.h>
+#include <qdirlisting.h>
 #include <qfile.h>
 #include <qfileinfo.h>
 #include <qscopeguard.h>
@@ -173,6 +174,8 @@ struct inotify_event {
 #define IN_UNMOUNT              0x00002000
 #define IN_Q_OVERFLOW           0x00004000
 #define IN_IGNORED              0x00008000
+#define IN_ONLYDIR              0x01000000
+#define IN_ISDIR                0x40000000
 
 #define IN_CLOSE                (IN_CLOSE_WRITE | IN_CLOSE_NOWRITE)
 #define IN_MOVE                 (IN_MOVED_FROM | IN_MOVED_TO)
@@ -198,6 +201,24 @@ static inline int inotify_init1(int flags)
 
 QT_BEGIN_NAMESPACE
 
+static constexpr quint32 TreeWatchMask = IN_ATTRIB | IN_MODIFY | IN_MOVE | IN_CREATE | IN_DELETE
+        | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+static QString treeChildPath(const QString &directory, const QString &name)
+{
+    if (directory.endsWith(u'/'))
+        return directory + name;
+    return directory + u'/' + name;
+}
+
+static bool isSameOrBelow(const QString &path, const QString &directory)
+{
+    if (directory.endsWith(u'/'))
+        return path.startsWith(directory) || path == QStringView(directory).chopped(1);
+    return path.startsWith(directory)
+            && (path.size() == directory.size() || path.at(directory.size()) == u'/');
+}
+
 QInotifyFileSystemWatcherEngine *QInotifyFileSystemWatcherEngine::create(QObject *parent)
 {
     int fd = -1;
@@ -327,6 +348,179 @@ QStringList QInotifyFileSystemWatcherEngine::removePaths(const QStringList &path
     return unhandled;
 }
 
+QStringList QInotifyFileSystemWatcherEngine::addRecursivePaths(const QStringList &paths,
+                                                               QStringList *directories)
+{
+    QStringList unhandled;
+    for (const QString &path : paths) {
+        if (directories->contains(path) || !QFileInfo(path).isDir()) {
+            unhandled.push_back(path);
+            continue;
+        }
+        if (treePathToWatch.contains(path)) {
+            // already part of another tree, which watches it all
+        } else if (addTreeWatch(path)) {
+            queueTreeScan(path, false);
+        } else {
+            unhandled.push_back(path);
+            continue;
+        }
+        treeRoots.append(path);
+        directories->append(path);
+    }
+    return unhandled;
+}
+
+QStringList QInotifyFileSystemWatcherEngine::removeRecursivePaths(const QStringList &paths,
+                                                                  QStringList *directories)
+{
+    QStringList unhandled;
+    for (const QString &path : paths) {
+        if (!treeRoots.removeOne(path)) {
+            unhandled.push_back(path);
+            continue;
+        }
+        removeTreeWatches(path, true);
+        directories->removeAll(path);
+    }
+    return unhandled;
+}
+
+// Returns false if \a path couldn't be watched, or already was (through
+// another path), so that loops in the tree don't get scanned forever.
+bool QInotifyFileSystemWatcherEngine::addTreeWatch(const QString &path)
+{
+    const int wd = inotify_add_watch(inotifyFd, QFile::encodeName(path), TreeWatchMask);
+    if (wd < 0) {
+        if (errno == ENOSPC) {
+            if (!watchLimitReached) {
+                qWarning("QFileSystemWatcher: reached the inotify watch limit, changes below %ls "
+                         "are not reported (see fs.inotify.max_user_watches)",
+                         qUtf16Printable(path));
+            }
+            watchLimitReached = true;
+        } else if (errno != ENOENT && errno != ENOTDIR && errno != EACCES) {
+            qErrnoWarning("inotify_add_watch(%ls) failed:", path.constData());
+        }
+        return false;
+    }
+    if (treeWatchToPath.contains(wd))
+        return false;
+
+    treeWatchToPath.insert(wd, path);
+    treePathToWatch.insert(path, wd);
+    return true;
+}
+
+// Stops watching \a path and the directories below it. If \a keepOtherRoots
+// is true, the ones still needed for another tree stay.
+void QInotifyFileSystemWatcherEngine::removeTreeWatches(const QString &path, bool keepOtherRoots)
+{
+    const auto isRemoved = [&](const QString &watched) {
+        if (!isSameOrBelow(watched, path))
+            return false;
+        return !keepOtherRoots
+                || std::none_of(treeRoots.cbegin(), treeRoots.cend(), [&](const QString &root) {
+                       return isSameOrBelow(watched, root);
+                   });
+    };
+
+    for (auto it = treePathToWatch.begin(); it != treePathToWatch.end(); ) {
+        if (!isRemoved(it.key())) {
+            ++it;
+            continue;
+        }
+        inotify_rm_watch(inotifyFd, it.value());
+        treeWatchToPath.remove(it.value());
+        it = treePathToWatch.erase(it);
+    }
+    pendingTreeScans.removeIf([&](const TreeScan &scan) { return isRemoved(scan.path); });
+}
+
+void QInotifyFileSystemWatcherEngine::forgetTreeWatch(int wd)
+{
+    const QString path = treeWatchToPath.take(wd);
+    if (const auto it = treePathToWatch.constFind(path);
+        it != treePathToWatch.cend() && it.value() == wd) {
+        treePathToWatch.erase(it);
+    }
+}
+
+void QInotifyFileSystemWatcherEngine::queueTreeScan(const QString &path, bool reportEntries)
+{
+    pendingTreeScans.push_back({ path, reportEntries });
+    if (treeScanQueued)
+        return;
+    treeScanQueued = true;
+    QMetaObject::invokeMethod(this, &QInotifyFileSystemWatcherEngine::scanTrees,
+                              Qt::QueuedConnection);
+}
+
+void QInotifyFileSystemWatcherEngine::scanTrees()
+{
+    treeScanQueued = false;
+
+    // Keep the event loop responsive while adding large trees
+    constexpr int MaxDirectoriesPerScan = 64;
+    for (int i = 0; i < MaxDirectoriesPerScan && !pendingTreeScans.isEmpty(); ++i) {
+        const TreeScan scan = pendingTreeScans.takeFirst();
+        if (!treePathToWatch.contains(scan.path))
+            continue;   // removed in the meantime
+
+        // Entries of new directories may have been created before we
+        // started watching, so report them as changed
+        using F = QDirListing::IteratorFlag;
+        const QDirListing::IteratorFlags flags = scan.reportEntries
+                ? F::IncludeHidden : F::DirsOnly | F::IncludeHidden;
+        for (const auto &entry : QDirListing(scan.path, flags)) {
+            if (scan.reportEntries)
+                emit entryChanged(scan.path, entry.fileName());
+            if (entry.isDir() && !entry.isSymLink()) {
+                const QString subdirectory = entry.filePath();
+                if (addTreeWatch(subdirectory))
+                    queueTreeScan(subdirectory, scan.reportEntries);
+            }
+        }
+    }
+
+    if (!pendingTreeScans.isEmpty() && !treeScanQueued) {
+        treeScanQueued = true;
+        QMetaObject::invokeMethod(this, &QInotifyFileSystemWatcherEngine::scanTrees,
+                                  Qt::QueuedConnection);
+    }
+}
+
+void QInotifyFileSystemWatcherEngine::handleTreeEvent(int wd, quint32 mask, const QString &name,
+                                                      const QString &directory)
+{
+    if (mask & IN_IGNORED) {
+        // the watch is gone: deleted, or unmounted
+        forgetTreeWatch(wd);
+        if (treeRoots.removeOne(directory)) {
+            removeTreeWatches(directory, true);
+            emit directoryChanged(directory, true);
+        }
+        return;
+    }
+    if (mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+        // reported through the parent directory, unless it's a root
+        if ((mask & IN_MOVE_SELF) && treeRoots.removeOne(directory)) {
+            removeTreeWatches(directory, true);
+            emit directoryChanged(directory, true);
+        }
+        return;
+    }
+
+    if (mask & IN_ISDIR) {
+        const QString path = treeChildPath(directory, name);
+        if (mask & IN_MOVED_FROM)
+            removeTreeWatches(path, false);
+        if ((mask & (IN_CREATE | IN_MOVED_TO)) && addTreeWatch(path))
+            queueTreeScan(path, true);
+    }
+    emit entryChanged(directory, name);
+}
+
 void QInotifyFileSystemWatcherEngine::readFromInotify()
 {
     // qDebug("QInotifyFileSystemWatcherEngine::readFromInotify");
@@ -343,13 +537,31 @@ void QInotifyFileSystemWatcherEngine::readFromInotify()
     QHash<int, inotify_event *> eventForId;
     while (at < end) {
         inotify_event *event = reinterpret_cast<inotify_event *>(at);
+        at += sizeof(inotify_event) + event->len;
+
+        if (!treeRoots.isEmpty()) {
+            if (event->mask & IN_Q_OVERFLOW) {
+                // lost track, everything may have changed
+                for (const QString &root : std::as_const(treeRoots))
+                    emit entryChanged(root, QString());
+                continue;
+            }
+            // Recursive watches report each event, QFileSystemWatcher
+            // batches them
+            const auto tree = treeWatchToPath.constFind(event->wd);
+            if (tree != treeWatchToPath.cend()) {
+                const QString directory = tree.value();
+                handleTreeEvent(event->wd, event->mask,
+                                event->len ? QFile::decodeName(event->name) : QString(),
+                                directory);
+                continue;
+            }
+        }
 
         if (eventForId.contains(event->wd))
             eventForId[event->wd]->mask |= event->mask;
         else
             eventForId.insert(event->wd, event);
-
-        at += sizeof(inotify_event) + event->len;
     }
 
     QHash<int, inotify_event *>::const_iterator it = eventForId.constBegin();
@@ -37,6 +37,8 @@ public:
 
     QStringList addPaths(const QStringList &paths, QStringList *files, QStringList *directories) override;
     QStringList removePaths(const QStringList &paths, QStringList *files, QStringList *directories) override;
+    QStringList addRecursivePaths(const QStringList &paths, QStringList *directories) override;
+    QStringList removeRecursivePaths(const QStringList &paths, QStringList *directories) override;
 
 private Q_SLOTS:
     void readFromInotify();
@@ -44,12 +46,33 @@ private Q_SLOTS:
 private:
     QString getPathFromID(int id) const;
 
+    // Recursive watches need one inotify watch per directory. Subdirectories
+    // are found by scanning the tree from the event loop a few directories
+    // at a time, so that adding a large tree doesn't block.
+    struct TreeScan {
+        QString path;
+        bool reportEntries; // the directory is new, report what's in it
+    };
+    bool addTreeWatch(const QString &path);
+    void removeTreeWatches(const QString &path, bool keepOtherRoots);
+    void forgetTreeWatch(int wd);
+    void queueTreeScan(const QString &path, bool reportEntries);
+    void scanTrees();
+    void handleTreeEvent(int wd, quint32 mask, const QString &name, const QString &directory);
+
 private:
     QInotifyFileSystemWatcherEngine(int fd, QObject *parent);
     int inotifyFd;
     QHash<QString, int> pathToID;
     QMultiHash<int, QString> idToPath;
     QSocketNotifier notifier;
+
+    QStringList treeRoots;
+    QHash<int, QString> treeWatchToPath;
+    QHash<QString, int> treePathToWatch;
+    QList<TreeScan> pendingTreeScans;
+    bool treeScanQueued = false;
+    bool watchLimitReached = false;
 };
 
 
@@ -24,9 +24,14 @@ QT_REQUIRE_CONFIG(filesystemwatcher);
 
 #include <QtCore/qstringlist.h>
 #include <QtCore/qhash.h>
+#include <QtCore/qset.h>
+
+#include <chrono>
 
 QT_BEGIN_NAMESPACE
 
+class QTimer;
+
 class QFileSystemWatcherEngine : public QObject
 {
     Q_OBJECT
@@ -50,9 +55,28 @@ public:
                                     QStringList *files,
                                     QStringList *directories) = 0;
 
+    // watches the directories in \a paths and everything below them, fills
+    // \a directories with the ones it could watch, and returns the others;
+    // engines that can't watch recursively return all of them
+    virtual QStringList addRecursivePaths(const QStringList &paths, QStringList *directories)
+    {
+        Q_UNUSED(directories);
+        return paths;
+    }
+    // the reverse of addRecursivePaths()
+    virtual QStringList removeRecursivePaths(const QStringList &paths, QStringList *directories)
+    {
+        Q_UNUSED(directories);
+        return paths;
+    }
+
 Q_SIGNALS:
     void fileChanged(const QString &path, bool removed);
     void directoryChanged(const QString &path, bool removed);
+    // something changed about the entry called \a name in \a directory,
+    // somewhere below a recursively watched path; \a name is empty if it
+    // was \a directory itself
+    void entryChanged(const QString &directory, const QString &name);
 };
 
 class QFileSystemWatcherPrivate : public QObjectPrivate
@@ -69,9 +93,23 @@ public:
     QFileSystemWatcherEngine *native, *poller;
     QStringList files, directories;
 
+    // Recursive watches, see addRecursivePaths()
+    QList<QFileSystemWatcherEngine *> recursiveEngines;
+    QStringList recursiveDirectories;
+    void initRecursiveEngines();
+
+    // Batches of changes for pathsChanged()
+    QSet<QString> pendingChanges;
+    QSet<QString> pendingDirectoryChanges;
+    QTimer *debounceTimer = nullptr;
+    std::chrono::milliseconds debounceInterval{100};
+    void queueChange(const QString &path);
+    void emitPendingChanges();
+
     // private slots
     void fileChanged(const QString &path, bool removed);
     void directoryChanged(const QString &path, bool removed);
+    void entryChanged(const QString &directory, const QString &name);
 
     void connectEngine(QFileSystemWatcherEngine *e);
 
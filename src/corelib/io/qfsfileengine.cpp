@@ -6,6 +6,9 @@
 #include "qfsfileengine_p.h"
 #include "qfsfileengine_iterator_p.h"
 #include "qfilesystemengine_p.h"
+#ifdef QT_FSFILEENGINE_IOQUEUE
+#include "qfileioqueue_p.h"
+#endif
 #include "qdatetime.h"
 #include "qset.h"
 #include <QtCore/qdebug.h>
@@ -83,6 +86,8 @@ QFSFileEnginePrivate::QFSFileEnginePrivate(QAbstractFileEngine *q)
     init();
 }
 
+QFSFileEnginePrivate::~QFSFileEnginePrivate() = default;
+
 /*!
     \internal
 */
@@ -170,6 +175,9 @@ ProcessOpenModeResult processOpenModeFlags(QIODevice::OpenMode openMode)
 QFSFileEngine::~QFSFileEngine()
 {
     Q_D(QFSFileEngine);
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    d->releaseIOQueue();
+#endif
     if (d->closeFileHandle) {
         if (d->fh) {
             fclose(d->fh);
@@ -351,6 +359,9 @@ bool QFSFileEngine::close()
 {
     Q_D(QFSFileEngine);
     d->openMode = QIODevice::NotOpen;
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    d->releaseIOQueue();
+#endif
     return d->nativeClose();
 }
 
@@ -410,6 +421,12 @@ bool QFSFileEngine::flush()
         // nothing.
         return true;
     }
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    if (d->ioQueue && !d->ioQueue->flush()) {
+        d->setErrorFromIOQueue();
+        return false;
+    }
+#endif
     return d->nativeFlush();
 }
 
@@ -421,6 +438,10 @@ bool QFSFileEngine::syncToDisk()
     Q_D(QFSFileEngine);
     if ((d->openMode & QIODevice::WriteOnly) == 0)
         return true;
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    if (d->ioQueue && !flush())
+        return false;
+#endif
     return d->nativeSyncToDisk();
 }
 
@@ -470,6 +491,58 @@ void QFSFileEnginePrivate::unmapAll()
     }
 }
 
+#ifdef QT_FSFILEENGINE_IOQUEUE
+/*!
+    \internal
+
+    Returns the queue that reads and writes go through, creating it on
+    first use, or \nullptr if they go to the file descriptor directly.
+*/
+QFileIOQueue *QFSFileEnginePrivate::activeIOQueue()
+{
+    Q_Q(QFSFileEngine);
+    if (ioQueue || ioQueueDepth == 0)
+        return ioQueue.get();
+
+    // Appending and stdio streams depend on the position of the file
+    // descriptor, which the queue does not use.
+    if (fd == -1 || fh || (openMode & QIODevice::Append) || q->isSequential())
+        return nullptr;
+    const qint64 pos = posFdFh();
+    if (pos < 0)
+        return nullptr;
+    ioQueue = QFileIOQueue::create(fd, pos, ioQueueDepth);
+    return ioQueue.get();
+}
+
+/*!
+    \internal
+
+    Completes the queued writes and deletes the queue. The file descriptor
+    is moved to the position the queue had reached, so that it can be used
+    directly again.
+*/
+void QFSFileEnginePrivate::releaseIOQueue()
+{
+    if (!ioQueue)
+        return;
+    ioQueue->flush();
+    const qint64 pos = ioQueue->pos();
+    ioQueue.reset();
+    if (fd != -1)
+        QT_LSEEK(fd, QT_OFF_T(pos), SEEK_SET);
+}
+
+/*!
+    \internal
+*/
+void QFSFileEnginePrivate::setErrorFromIOQueue()
+{
+    Q_Q(QFSFileEngine);
+    q->setError(ioQueue->error(), ioQueue->errorString());
+}
+#endif // QT_FSFILEENGINE_IOQUEUE
+
 #ifndef Q_OS_WIN
 /*!
     \internal
@@ -493,6 +566,10 @@ qint64 QFSFileEnginePrivate::sizeFdFh() const
 qint64 QFSFileEngine::pos() const
 {
     Q_D(const QFSFileEngine);
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    if (d->ioQueue)
+        return d->ioQueue->pos();
+#endif
     return d->nativePos();
 }
 
@@ -512,6 +589,17 @@ qint64 QFSFileEnginePrivate::posFdFh() const
 bool QFSFileEngine::seek(qint64 pos)
 {
     Q_D(QFSFileEngine);
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    if (d->ioQueue) {
+        if (pos < 0)
+            return false;
+        if (!d->ioQueue->seek(pos)) {
+            d->setErrorFromIOQueue();
+            return false;
+        }
+        return true;
+    }
+#endif
     return d->nativeSeek(pos);
 }
 
@@ -596,6 +684,14 @@ qint64 QFSFileEngine::read(char *data, qint64 maxlen)
         d->lastIOCommand = QFSFileEnginePrivate::IOReadCommand;
     }
 
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    if (QFileIOQueue *queue = d->activeIOQueue()) {
+        const qint64 read = queue->read(data, maxlen);
+        if (read < 0)
+            d->setErrorFromIOQueue();
+        return read;
+    }
+#endif
     return d->nativeRead(data, maxlen);
 }
 
@@ -727,6 +823,16 @@ qint64 QFSFileEngine::write(const char *data, qint64 len)
         d->lastIOCommand = QFSFileEnginePrivate::IOWriteCommand;
     }
 
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    if (QFileIOQueue *queue = d->activeIOQueue()) {
+        const qint64 written = queue->write(data, len);
+        if (written < 0)
+            d->setErrorFromIOQueue();
+        else
+            d->metaData.clearFlags(QFileSystemMetaData::SizeAttribute);
+        return written;
+    }
+#endif
     return d->nativeWrite(data, len);
 }
 
@@ -830,6 +936,11 @@ bool QFSFileEngine::extension(Extension extension, const ExtensionOption *option
         return feof(d->fh);
 
     if (extension == MapExtension) {
+#ifdef QT_FSFILEENGINE_IOQUEUE
+        // the mapping must see the data that is still queued for writing
+        if (d->ioQueue && !flush())
+            return false;
+#endif
         const MapExtensionOption *options = (const MapExtensionOption*)(option);
         MapExtensionReturn *returnValue = static_cast<MapExtensionReturn*>(output);
         returnValue->address = d->map(options->offset, options->size, options->flags);
@@ -839,6 +950,19 @@ bool QFSFileEngine::extension(Extension extension, const ExtensionOption *option
         const UnMapExtensionOption *options = (const UnMapExtensionOption*)option;
         return d->unmap(options->address);
     }
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    if (extension == IOQueueExtension) {
+        const auto *options = static_cast<const IOQueueExtensionOption *>(option);
+        const int depth = qBound(0, options->depth, int(QFileIOQueue::MaxDepth));
+        if (depth != d->ioQueueDepth) {
+            if (d->ioQueue && !flush())
+                return false;
+            d->releaseIOQueue();
+            d->ioQueueDepth = depth;
+        }
+        return true;
+    }
+#endif
 
     return false;
 }
@@ -857,6 +981,10 @@ bool QFSFileEngine::supportsExtension(Extension extension) const
         return true;
     if (extension == UnMapExtension || extension == MapExtension)
         return true;
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    if (extension == IOQueueExtension)
+        return true;
+#endif
     return false;
 }
 
@@ -22,6 +22,7 @@
 #include <QtCore/private/qfilesystemmetadata_p.h>
 #include <qhash.h>
 
+#include <memory>
 #include <optional>
 
 #ifdef Q_OS_UNIX
@@ -30,6 +31,10 @@
 
 #ifndef QT_NO_FSFILEENGINE
 
+#if QT_CONFIG(async_io) && defined(Q_OS_UNIX)
+#  define QT_FSFILEENGINE_IOQUEUE
+#endif
+
 QT_BEGIN_NAMESPACE
 
 struct ProcessOpenModeResult
@@ -41,6 +46,9 @@ struct ProcessOpenModeResult
 Q_CORE_EXPORT ProcessOpenModeResult processOpenModeFlags(QIODevice::OpenMode mode);
 
 class QFSFileEnginePrivate;
+#ifdef QT_FSFILEENGINE_IOQUEUE
+class QFileIOQueue;
+#endif
 
 class Q_CORE_EXPORT QFSFileEngine : public QAbstractFileEngine
 {
@@ -198,6 +206,15 @@ public:
     mutable uint need_lstat : 1;
     mutable uint is_link : 1;
 
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    QFileIOQueue *activeIOQueue();
+    void releaseIOQueue();
+    void setErrorFromIOQueue();
+
+    std::unique_ptr<QFileIOQueue> ioQueue;
+    int ioQueueDepth = 0;
+#endif
+
 #if defined(Q_OS_WIN)
     bool doStat(QFileSystemMetaData::MetaDataFlags flags) const;
 #else
@@ -217,6 +234,7 @@ public:
     }
 protected:
     QFSFileEnginePrivate(QAbstractFileEngine *q);
+    ~QFSFileEnginePrivate() override;
 
     void init();
 
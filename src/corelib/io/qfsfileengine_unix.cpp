@@ -17,6 +17,9 @@
 #include "qdir.h"
 #include "qdatetime.h"
 #include "qvarlengtharray.h"
+#ifdef QT_FSFILEENGINE_IOQUEUE
+#include "qfileioqueue_p.h"
+#endif
 
 #include <sys/mman.h>
 #include <stdlib.h>
@@ -509,6 +512,13 @@ bool QFSFileEngine::setPermissions(uint perms)
 bool QFSFileEngine::setSize(qint64 size)
 {
     Q_D(QFSFileEngine);
+#ifdef QT_FSFILEENGINE_IOQUEUE
+    if (d->ioQueue) {
+        if (!flush())
+            return false;
+        d->ioQueue->discardReadAhead();
+    }
+#endif
     bool ret = false;
     if (d->fd != -1)
         ret = QT_FTRUNCATE(d->fd, size) == 0;
@@ -5,6 +5,7 @@
 #include "qiooperation_p.h"
 #include "qiooperation_p_p.h"
 
+#include <QtCore/private/qasyncfilesystem_p_p.h>
 #include <QtCore/private/qobject_p.h>
 #include <QtCore/private/qrandomaccessasyncfile_p_p.h>
 
@@ -75,6 +76,8 @@ QIOOperation::QIOOperation(QIOOperationPrivate &dd, QObject *parent)
 {
     if (auto file = qobject_cast<QRandomAccessAsyncFile*>(parent))
         d_func()->file = file;
+    else if (auto fileSystem = qobject_cast<QAsyncFileSystem *>(parent))
+        d_func()->fileSystem = fileSystem;
 }
 
 void QIOOperation::ensureCompleteOrCanceled()
@@ -86,6 +89,8 @@ void QIOOperation::ensureCompleteOrCanceled()
         if (d->file) {
             auto *filePriv = QRandomAccessAsyncFilePrivate::get(d->file);
             filePriv->cancelAndWait(this);
+        } else if (d->fileSystem) {
+            QAsyncFileSystemPrivate::get(d->fileSystem)->cancelAndWait(this);
         }
     }
 }
@@ -180,4 +185,21 @@ QIOVectoredWriteOperation::QIOVectoredWriteOperation(QIOOperationPrivate &dd, QO
     Q_ASSERT(dd.dataStorage->containsWriteSpans());
 }
 
+QIOStatOperation::~QIOStatOperation() = default;
+
+QFileSystemMetaData QIOStatOperation::metaData() const
+{
+    if (!isFinished())
+        return {};
+    Q_D(const QIOOperation);
+    return d->dataStorage->getMetaData();
+}
+
+QIOStatOperation::QIOStatOperation(QIOOperationPrivate &dd, QObject *parent)
+    : QIOOperation(dd, parent)
+{
+    Q_ASSERT(dd.type == QIOOperation::Type::Stat);
+    Q_ASSERT(dd.dataStorage->containsMetaData());
+}
+
 QT_END_NAMESPACE
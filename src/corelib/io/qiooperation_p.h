@@ -39,6 +39,11 @@ public:
         Flush,
         Open,
         Aborted,
+        Allocate,
+        Rename,
+        Remove,
+        MakeDirectory,
+        Stat,
     };
     Q_ENUM(Error)
 
@@ -49,6 +54,11 @@ public:
         Write,
         Flush,
         Open,
+        Allocate,
+        Rename,
+        Remove,
+        MakeDirectory,
+        Stat,
     };
     Q_ENUM(Type)
 
@@ -75,6 +85,7 @@ protected:
     friend class QRandomAccessAsyncFileBackend;
     friend class QRandomAccessAsyncFileNativeBackend;
     friend class QRandomAccessAsyncFileThreadPoolBackend;
+    friend class QAsyncFileSystemPrivate;
 };
 
 class Q_CORE_EXPORT QIOReadWriteOperationBase : public QIOOperation
@@ -94,6 +105,7 @@ protected:
     friend class QRandomAccessAsyncFileBackend;
     friend class QRandomAccessAsyncFileNativeBackend;
     friend class QRandomAccessAsyncFileThreadPoolBackend;
+    friend class QAsyncFileSystemPrivate;
 };
 
 class Q_CORE_EXPORT QIOReadOperation : public QIOReadWriteOperationBase
@@ -112,6 +124,7 @@ protected:
     friend class QRandomAccessAsyncFileBackend;
     friend class QRandomAccessAsyncFileNativeBackend;
     friend class QRandomAccessAsyncFileThreadPoolBackend;
+    friend class QAsyncFileSystemPrivate;
 };
 
 class Q_CORE_EXPORT QIOWriteOperation : public QIOReadWriteOperationBase
@@ -130,6 +143,7 @@ protected:
     friend class QRandomAccessAsyncFileBackend;
     friend class QRandomAccessAsyncFileNativeBackend;
     friend class QRandomAccessAsyncFileThreadPoolBackend;
+    friend class QAsyncFileSystemPrivate;
 };
 
 class Q_CORE_EXPORT QIOVectoredReadOperation : public QIOReadWriteOperationBase
@@ -148,6 +162,7 @@ protected:
     friend class QRandomAccessAsyncFileBackend;
     friend class QRandomAccessAsyncFileNativeBackend;
     friend class QRandomAccessAsyncFileThreadPoolBackend;
+    friend class QAsyncFileSystemPrivate;
 };
 
 class Q_CORE_EXPORT QIOVectoredWriteOperation : public QIOReadWriteOperationBase
@@ -166,6 +181,23 @@ protected:
     friend class QRandomAccessAsyncFileBackend;
     friend class QRandomAccessAsyncFileNativeBackend;
     friend class QRandomAccessAsyncFileThreadPoolBackend;
+    friend class QAsyncFileSystemPrivate;
+};
+
+class QFileSystemMetaData;
+class Q_CORE_EXPORT QIOStatOperation : public QIOOperation
+{
+public:
+    ~QIOStatOperation() override;
+
+    QFileSystemMetaData metaData() const;
+
+protected:
+    QIOStatOperation() = delete;
+    Q_DISABLE_COPY_MOVE(QIOStatOperation)
+    explicit QIOStatOperation(QIOOperationPrivate &dd, QObject *parent = nullptr);
+
+    friend class QAsyncFileSystemPrivate;
 };
 
 QT_END_NAMESPACE
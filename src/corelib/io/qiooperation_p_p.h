@@ -18,7 +18,9 @@
 
 #include "qiooperation_p.h"
 #include "qrandomaccessasyncfile_p.h"
+#include "qasyncfilesystem_p.h"
 
+#include <QtCore/private/qfilesystemmetadata_p.h>
 #include <QtCore/private/qobject_p.h>
 
 #include <QtCore/qspan.h>
@@ -61,6 +63,9 @@ public:
     explicit QIOOperationDataStorage(QByteArray &&a)
         : data(std::move(a))
     {}
+    explicit QIOOperationDataStorage(const QFileSystemMetaData &m)
+        : data(m)
+    {}
 
     bool isEmpty() const
     { return std::holds_alternative<std::monostate>(data); }
@@ -74,6 +79,9 @@ public:
     bool containsByteArray() const
     { return std::holds_alternative<QByteArray>(data); }
 
+    bool containsMetaData() const
+    { return std::holds_alternative<QFileSystemMetaData>(data); }
+
     ReadSpans &getReadSpans()
     {
         Q_ASSERT(containsReadSpans());
@@ -107,12 +115,23 @@ public:
         return *std::get_if<QByteArray>(&data);
     }
 
+    QFileSystemMetaData &getMetaData()
+    {
+        Q_ASSERT(containsMetaData());
+        return *std::get_if<QFileSystemMetaData>(&data);
+    }
+    const QFileSystemMetaData &getMetaData() const
+    {
+        Q_ASSERT(containsMetaData());
+        return *std::get_if<QFileSystemMetaData>(&data);
+    }
+
     // Potentially can be extended to return a QVariant::value<T>().
     template <typename T>
     T getValue() const = delete;
 
 private:
-    std::variant<std::monostate, ReadSpans, WriteSpans, QByteArray> data;
+    std::variant<std::monostate, ReadSpans, WriteSpans, QByteArray, QFileSystemMetaData> data;
 };
 
 template <>
@@ -169,9 +188,11 @@ public:
     void setError(QIOOperation::Error err);
 
     QPointer<QRandomAccessAsyncFile> file;
+    QPointer<QAsyncFileSystem> fileSystem;
 
     qint64 offset = 0;
     qint64 processed = 0;
+    qint64 length = 0; // for Allocate and ranged Flush operations
 
     QIOOperation::Error error = QIOOperation::Error::None;
     QIOOperation::Type type = QIOOperation::Type::Unknown;
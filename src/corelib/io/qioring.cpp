@@ -58,7 +58,9 @@ auto QIORing::queueRequestInternal(GenericRequestType &request) -> QueuedRequest
         submitRequests();
         return requestQueuedState;
     }
-    if (stagePending || unstagedRequests == 0)
+    // Requests that are held back (like an incomplete chain) still need a
+    // submitRequests() call:
+    if (stagePending || (unstagedRequests == 0 && !lastUnqueuedIterator))
         return requestQueuedState;
     stagePending = true;
     // We are not a QObject, but we always have the notifier, so use that for context:
@@ -71,7 +73,7 @@ bool QIORing::waitForRequest(RequestHandle handle, QDeadlineTimer deadline)
 {
     if (!handle || !addrItMap.contains(handle))
         return true; // : It was never there to begin with (so it is finished)
-    if (unstagedRequests)
+    if (unstagedRequests || lastUnqueuedIterator)
         submitRequests();
     completionReady(); // Try to process some pending completions
     while (!deadline.hasExpired() && addrItMap.contains(handle)) {
@@ -12,9 +12,14 @@ QT_REQUIRE_CONFIG(liburing);
 #include <QtCore/private/qfiledevice_p.h>
 
 #include <liburing.h>
+#include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/eventfd.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
+
+#include <limits>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -28,6 +33,9 @@ static_assert(alignof(iovec)
 
 static io_uring_op toUringOp(QIORing::Operation op);
 
+static constexpr QIORing::RequestFlags LinkFlags = QIORing::RequestFlag::Link
+        | QIORing::RequestFlag::HardLink;
+
 // From man write.2:
 // On Linux, write() (and similar system calls) will transfer at most 0x7ffff000 (2,147,479,552)
 // bytes, returning the number of bytes actually transferred. (This is true on both 32-bit and
@@ -126,6 +134,24 @@ bool QIORing::initializeIORing()
     cqIndexMask = reinterpret_cast<quint32 *>(cq + params.cq_off.ring_mask);
     completionQueueEntries = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
 
+    // Find out which of our operations the running kernel supports. Kernels
+    // without IORING_REGISTER_PROBE (before 5.6) only get the original set.
+    const size_t probeSize = sizeof(io_uring_probe) + IORING_OP_LAST * sizeof(io_uring_probe_op);
+    std::unique_ptr<char[]> probeStorage(new char[probeSize]());
+    auto *probe = reinterpret_cast<io_uring_probe *>(probeStorage.get());
+    const bool probed = io_uring_register(io_uringFd, IORING_REGISTER_PROBE, probe,
+                                          IORING_OP_LAST) >= 0;
+    for (size_t i = 0; i < size_t(Operation::NumOperations); ++i) {
+        const Operation op = Operation(i);
+        if (!probed) {
+            availableOperations[i] = op < Operation::FlushRange;
+            continue;
+        }
+        const io_uring_op opcode = toUringOp(op);
+        availableOperations[i] = opcode <= probe->last_op
+                && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED);
+    }
+
     eventDescriptor = eventfd(0, 0);
     io_uring_register(io_uringFd, IORING_REGISTER_EVENTFD, &eventDescriptor, 1);
 
@@ -139,8 +165,16 @@ QFileDevice::FileError QIORing::mapFileError(NativeResultType error,
                                              QFileDevice::FileError defaultValue)
 {
     Q_ASSERT(error < 0);
-    if (-error == ECANCELED)
+    switch (-error) {
+    case ECANCELED:
         return QFileDevice::AbortError;
+    case EACCES:
+    case EPERM:
+        return QFileDevice::PermissionsError;
+    case ENOSPC:
+    case EDQUOT:
+        return QFileDevice::ResourceError;
+    }
     return defaultValue;
 }
 
@@ -156,6 +190,18 @@ void QIORing::completionReady()
     if (tail == head)
         return;
 
+    // For the operations that report nothing but success or failure:
+    const auto finishRequest = [](auto &request, NativeResultType result,
+                                  QFileDevice::FileError defaultError) {
+        using ResultType = std::variant_alternative_t<1, decltype(request.result)>;
+        if (isResultFailure(result))
+            request.result.template emplace<QFileDevice::FileError>(
+                    mapFileError(result, defaultError));
+        else
+            request.result.template emplace<ResultType>();
+        invokeCallback(request);
+    };
+
     qCDebug(lcQIORing,
             "Status of completion queue, total entries: %u, tail: %u, head: %u, to process: %u",
             cqEntries, tail, head, (tail - head));
@@ -182,7 +228,8 @@ void QIORing::completionReady()
             } else {
                 auto &result = openRequest.result
                                        .template emplace<QIORingResult<Operation::Open>>();
-                result.fd = cqe->res;
+                // Opening into a fixed file slot returns 0 on success
+                result.fd = openRequest.fixedFileSlot >= 0 ? openRequest.fixedFileSlot : cqe->res;
             }
             invokeCallback(openRequest);
             break;
@@ -193,6 +240,12 @@ void QIORing::completionReady()
             if (cqe->res < 0) {
                 closeRequest.result.emplace<QFileDevice::FileError>(QFileDevice::OpenError);
             } else {
+                // Closing a fixed file emptied its slot, so it can be reused:
+                if (closeRequest.requestFlags & RequestFlag::FixedFile) {
+                    const size_t slot = size_t(closeRequest.fd);
+                    if (slot < fileSlotsInUse.size())
+                        fileSlotsInUse[slot] = false;
+                }
                 closeRequest.result.emplace<QIORingResult<Operation::Close>>();
             }
             invokeCallback(closeRequest);
@@ -267,6 +320,47 @@ void QIORing::completionReady()
             invokeCallback(statRequest);
             break;
         }
+        case Operation::FlushRange: {
+            auto flushRequest = request->takeRequestData<Operation::FlushRange>();
+            flushInProgress = false;
+            finishRequest(flushRequest, cqe->res, QFileDevice::WriteError);
+            break;
+        }
+        case Operation::Allocate: {
+            auto allocateRequest = request->takeRequestData<Operation::Allocate>();
+            finishRequest(allocateRequest, cqe->res, QFileDevice::ResizeError);
+            break;
+        }
+        case Operation::Rename: {
+            auto renameRequest = request->takeRequestData<Operation::Rename>();
+            finishRequest(renameRequest, cqe->res, QFileDevice::RenameError);
+            break;
+        }
+        case Operation::Unlink: {
+            auto unlinkRequest = request->takeRequestData<Operation::Unlink>();
+            finishRequest(unlinkRequest, cqe->res, QFileDevice::RemoveError);
+            break;
+        }
+        case Operation::MakeDirectory: {
+            auto mkdirRequest = request->takeRequestData<Operation::MakeDirectory>();
+            finishRequest(mkdirRequest, cqe->res, QFileDevice::OpenError);
+            break;
+        }
+        case Operation::StatPath: {
+            auto statRequest = request->takeRequestData<Operation::StatPath>();
+            if (cqe->res < 0) {
+                statRequest.result.emplace<QFileDevice::FileError>(
+                        mapFileError(cqe->res, QFileDevice::OpenError));
+            } else {
+                const struct statx *st = request->getExtra<struct statx>();
+                Q_ASSERT(st);
+                auto &res = statRequest.result.emplace<QIORingResult<Operation::StatPath>>();
+                res.metaData.fillFromStatxBuf(*st);
+                res.mask = st->stx_mask;
+            }
+            invokeCallback(statRequest);
+            break;
+        }
         case Operation::NumOperations:
             Q_UNREACHABLE_RETURN();
             break;
@@ -306,6 +400,12 @@ bool QIORing::supportsOperation(Operation op)
     case QtPrivate::Operation::Flush:
     case QtPrivate::Operation::Cancel:
     case QtPrivate::Operation::Stat:
+    case QtPrivate::Operation::FlushRange:
+    case QtPrivate::Operation::Allocate:
+    case QtPrivate::Operation::Rename:
+    case QtPrivate::Operation::Unlink:
+    case QtPrivate::Operation::MakeDirectory:
+    case QtPrivate::Operation::StatPath:
         return true;
     case QtPrivate::Operation::NumOperations:
         return false;
@@ -313,9 +413,185 @@ bool QIORing::supportsOperation(Operation op)
     return false; // May not always be unreachable!
 }
 
+/*!
+    \internal
+    Returns \c true if the running kernel can execute \a op. Operations that
+    were added to io_uring after the first release, such as
+    Operation::MakeDirectory, are not available on all the kernels that
+    support io_uring.
+*/
+bool QIORing::isAvailable(Operation op)
+{
+    return supportsOperation(op) && ensureInitialized() && availableOperations.test(size_t(op));
+}
+
+bool QIORing::ensureFileTable()
+{
+    if (fileTableState != TableState::Unregistered)
+        return fileTableState == TableState::Registered;
+    if (!ensureInitialized())
+        return false;
+    // Start with a sparse table, slots are filled in by allocateFileSlot() or
+    // by opening a file directly into them:
+    std::vector<int> fds(FixedFileSlots, -1);
+    const int ret = io_uring_register(io_uringFd, IORING_REGISTER_FILES, fds.data(),
+                                      FixedFileSlots);
+    if (ret < 0) {
+        qCDebug(lcQIORing) << "Registering the fixed file table failed:" << qt_error_string(-ret);
+        fileTableState = TableState::Unsupported;
+        return false;
+    }
+    fileSlotsInUse.assign(FixedFileSlots, false);
+    fileTableState = TableState::Registered;
+    return true;
+}
+
+/*!
+    \internal
+    Reserves a slot in the ring's table of fixed files and returns its index,
+    or -1 if there is no free slot or the kernel doesn't support fixed files.
+
+    If \a fd is not -1 it is installed in the slot. Otherwise the slot stays
+    empty, to be filled by an Open request with \c fixedFileSlot set.
+
+    Requests with RequestFlag::FixedFile set pass the slot index in place of
+    the file descriptor. This spares the kernel from looking up the file for
+    every request. Call releaseFileSlot() when done with the slot, or queue
+    a Close request with RequestFlag::FixedFile for it, which closes the
+    file and frees the slot once it completed successfully.
+*/
+qint32 QIORing::allocateFileSlot(qintptr fd)
+{
+    if (!ensureFileTable())
+        return -1;
+    const auto it = std::find(fileSlotsInUse.begin(), fileSlotsInUse.end(), false);
+    if (it == fileSlotsInUse.end())
+        return -1;
+    const qint32 slot = qint32(it - fileSlotsInUse.begin());
+    if (fd != -1) {
+        qint32 fds[] = { qint32(fd) };
+        io_uring_files_update update = {};
+        update.offset = quint32(slot);
+        update.fds = quint64(fds);
+        const int ret = io_uring_register(io_uringFd, IORING_REGISTER_FILES_UPDATE, &update, 1);
+        if (ret < 0) {
+            qCDebug(lcQIORing) << "Installing a fixed file failed:" << qt_error_string(-ret);
+            return -1;
+        }
+    }
+    *it = true;
+    return slot;
+}
+
+/*!
+    \internal
+    Releases \a slot, which was returned by allocateFileSlot(). A file
+    descriptor that is still installed in the slot is not closed, but the
+    ring drops its reference to it.
+*/
+void QIORing::releaseFileSlot(qint32 slot)
+{
+    if (slot < 0 || size_t(slot) >= fileSlotsInUse.size() || !fileSlotsInUse[size_t(slot)])
+        return;
+    qint32 fds[] = { -1 };
+    io_uring_files_update update = {};
+    update.offset = quint32(slot);
+    update.fds = quint64(fds);
+    io_uring_register(io_uringFd, IORING_REGISTER_FILES_UPDATE, &update, 1);
+    fileSlotsInUse[size_t(slot)] = false;
+}
+
+bool QIORing::ensureBufferTable()
+{
+    if (bufferTableState != TableState::Unregistered)
+        return bufferTableState == TableState::Registered;
+    if (!ensureInitialized())
+        return false;
+#ifdef IORING_RSRC_REGISTER_SPARSE
+    io_uring_rsrc_register reg = {};
+    reg.nr = FixedBufferSlots;
+    reg.flags = IORING_RSRC_REGISTER_SPARSE;
+    const int ret = io_uring_register(io_uringFd, IORING_REGISTER_BUFFERS2, &reg, sizeof(reg));
+#else
+    const int ret = -EINVAL;
+#endif
+    if (ret < 0) {
+        qCDebug(lcQIORing) << "Registering the buffer table failed:" << qt_error_string(-ret);
+        bufferTableState = TableState::Unsupported;
+        return false;
+    }
+    bufferSlotsInUse.assign(FixedBufferSlots, false);
+    bufferTableState = TableState::Registered;
+    return true;
+}
+
+/*!
+    \internal
+    Registers \a buffers with the kernel, which then keeps them mapped
+    instead of mapping them for every request. Returns the index of the
+    first buffer, the others follow consecutively, or -1 on failure.
+
+    Read and Write requests whose span lies inside a registered buffer can
+    pass its index in \c bufferIndex. The buffers must stay valid until
+    they are unregistered with unregisterBuffers().
+*/
+qint32 QIORing::registerBuffers(QSpan<const QSpan<std::byte>> buffers)
+{
+    if (buffers.empty() || !ensureBufferTable())
+        return -1;
+    const auto first = std::search_n(bufferSlotsInUse.begin(), bufferSlotsInUse.end(),
+                                     buffers.size(), false);
+    if (first == bufferSlotsInUse.end())
+        return -1;
+    const qint32 index = qint32(first - bufferSlotsInUse.begin());
+#ifdef IORING_RSRC_REGISTER_SPARSE
+    // We pretend that iovec and QSpans are the same, as for the vectored operations
+    io_uring_rsrc_update2 update = {};
+    update.offset = quint32(index);
+    update.data = quint64(buffers.data());
+    update.nr = quint32(buffers.size());
+    const int ret = io_uring_register(io_uringFd, IORING_REGISTER_BUFFERS_UPDATE, &update,
+                                      sizeof(update));
+    if (ret < 0) {
+        qCDebug(lcQIORing) << "Registering buffers failed:" << qt_error_string(-ret);
+        return -1;
+    }
+#endif
+    std::fill_n(first, buffers.size(), true);
+    return index;
+}
+
+/*!
+    \internal
+    Unregisters the \a count buffers starting at \a firstIndex, which was
+    returned by registerBuffers().
+*/
+void QIORing::unregisterBuffers(qint32 firstIndex, qsizetype count)
+{
+    if (firstIndex < 0 || count <= 0 || size_t(firstIndex + count) > bufferSlotsInUse.size())
+        return;
+#ifdef IORING_RSRC_REGISTER_SPARSE
+    const std::vector<iovec> empty(size_t(count), iovec{ nullptr, 0 });
+    io_uring_rsrc_update2 update = {};
+    update.offset = quint32(firstIndex);
+    update.data = quint64(empty.data());
+    update.nr = quint32(count);
+    io_uring_register(io_uringFd, IORING_REGISTER_BUFFERS_UPDATE, &update, sizeof(update));
+#endif
+    std::fill_n(bufferSlotsInUse.begin() + firstIndex, count, false);
+}
+
 void QIORing::submitRequests()
 {
     stagePending = false;
+    // A chain of linked requests is held back until its last request is
+    // queued. Requests are submitted when returning to the event loop or
+    // when waiting for one, so a chain that is still incomplete by then
+    // gets submitted as far as it goes:
+    if (lastUnqueuedIterator) {
+        QScopedValueRollback<bool> submitGuard(submitIncompleteChains, true);
+        prepareRequests();
+    }
     if (unstagedRequests == 0)
         return;
 
@@ -341,6 +617,13 @@ using DetectFd = decltype(std::declval<const T &>().fd);
 
 template <typename T>
 constexpr bool HasFdMember = qxp::is_detected_v<DetectFd, T>;
+
+template <typename T>
+using DetectRequestFlags = decltype(std::declval<const T &>().requestFlags);
+
+template <typename T>
+constexpr bool HasRequestFlagsMember =
+        qxp::is_detected_v<DetectRequestFlags, T>;
 } // namespace QtPrivate
 
 bool QIORing::verifyFd(QIORing::GenericRequestType &req)
@@ -348,12 +631,66 @@ bool QIORing::verifyFd(QIORing::GenericRequestType &req)
     bool result = true;
     invokeOnOp(req, [&](auto *request) {
         if constexpr (QtPrivate::HasFdMember<decltype(*request)>) {
-            result = request->fd > 0;
+            if (request->requestFlags & RequestFlag::FixedFile)
+                result = request->fd >= 0 && request->fd < FixedFileSlots;
+            else
+                result = request->fd > 0;
         }
     });
     return result;
 }
 
+// Returns the flags of \a req, without FixedFile for operations that don't
+// take a file descriptor.
+QIORing::RequestFlags QIORing::flagsOf(GenericRequestType &req)
+{
+    RequestFlags flags;
+    invokeOnOp(req, [&](auto *request) {
+        if constexpr (QtPrivate::HasRequestFlagsMember<decltype(*request)>) {
+            flags = request->requestFlags;
+            if constexpr (!QtPrivate::HasFdMember<decltype(*request)>)
+                flags &= ~QIORing::RequestFlags(QIORing::RequestFlag::FixedFile);
+        }
+    });
+    return flags;
+}
+
+// Returns the number of bytes \a req reads or writes, 0 for the other operations.
+qint64 QIORing::transferSize(GenericRequestType &req)
+{
+    qint64 size = 0;
+    invokeOnOp(req, [&](auto *request) {
+        using Request = std::remove_cv_t<std::remove_pointer_t<decltype(request)>>;
+        if constexpr (std::is_same_v<Request, QIORingRequest<Operation::Read>>) {
+            size = request->destination.size();
+        } else if constexpr (std::is_same_v<Request, QIORingRequest<Operation::Write>>) {
+            size = request->source.size();
+        } else if constexpr (std::is_same_v<Request, QIORingRequest<Operation::VectoredRead>>) {
+            for (const auto &span : request->destinations)
+                size += span.size();
+        } else if constexpr (std::is_same_v<Request, QIORingRequest<Operation::VectoredWrite>>) {
+            for (const auto &span : request->sources)
+                size += span.size();
+        }
+    });
+    return size;
+}
+
+/*!
+    \internal
+    Returns the number of requests in the chain of linked requests that
+    starts at \a it.
+*/
+qsizetype QIORing::linkChainLength(PendingRequestsIterator it) const
+{
+    qsizetype length = 1;
+    for (const auto end = pendingRequests.end(); it != end; ++it, ++length) {
+        if (!(flagsOf(*it) & LinkFlags) || std::next(it) == end)
+            break;
+    }
+    return length;
+}
+
 void QIORing::prepareRequests()
 {
     if (!lastUnqueuedIterator) {
@@ -373,30 +710,91 @@ void QIORing::prepareRequests()
     lastUnqueuedIterator.reset();
     const auto end = pendingRequests.end();
     bool anyQueued = false;
+    // Whether the previous entry links to the one we prepare next:
+    bool inLinkChain = false;
+    io_uring_sqe *previousEntry = nullptr;
     // Loop until we either:
     // 1. Run out of requests to prepare for submission (it == end),
     // 2. Have filled the submission queue (unstagedRequests == sqEntries) or,
     // 3. The number of staged requests + currently processing/potentially finished requests is
     //    enough to fill the completion queue (inFlightRequests == cqEntries).
-    while (!flushInProgress && unstagedRequests != sqEntries && inFlightRequests != cqEntries
-           && it != end) {
+    // A chain of linked requests, once started, is always queued in full; we
+    // made sure it fits before preparing its first entry.
+    while (it != end
+           && (inLinkChain
+               || (!flushInProgress && unstagedRequests != sqEntries
+                   && inFlightRequests != cqEntries))) {
+        if (!inLinkChain && (flagsOf(*it) & LinkFlags)) {
+            // A chain has to be submitted in one go, so wait until it fits
+            const qsizetype chainLength = linkChainLength(it);
+            if (!submitIncompleteChains
+                && (flagsOf(*std::next(it, chainLength - 1)) & LinkFlags)) {
+                qCDebug(lcQIORing, "Holding back a chain until its last request is queued");
+                break;
+            }
+            const bool tooLong = chainLength > qsizetype(sqEntries)
+                    || chainLength > qsizetype(cqEntries);
+            if (tooLong) {
+                qCWarning(lcQIORing, "A chain of %lld linked requests can never fit in the queue",
+                          qlonglong(chainLength));
+            }
+            // Each request of a chain is a single system call, so a read or
+            // write that would have to be split up can't be part of one:
+            const bool tooLarge = !tooLong
+                    && std::any_of(it, std::next(it, chainLength), [](auto &request) {
+                           return transferSize(request) > maxReadWriteLen();
+                       });
+            if (tooLarge) {
+                qCWarning(lcQIORing, "A linked read or write can transfer at most %lld bytes",
+                          qlonglong(maxReadWriteLen()));
+            }
+            if (tooLong || tooLarge) {
+                for (qsizetype i = 0; i < chainLength; ++i) {
+                    finishRequestWithError(*it, QFileDevice::ResourceError);
+                    addrItMap.remove(std::addressof(*it));
+                    it = pendingRequests.erase(it);
+                }
+                continue;
+            }
+            if (unstagedRequests + chainLength > sqEntries
+                || inFlightRequests + chainLength > cqEntries) {
+                qCDebug(lcQIORing, "Deferring a chain of %lld linked requests",
+                        qlonglong(chainLength));
+                break;
+            }
+        }
+
         const quint32 index = tail & *sqIndexMask;
         io_uring_sqe *sqe = &submissionQueueEntries[index];
         *sqe = {};
-        RequestPrepResult result = prepareRequest(sqe, *it);
+        RequestPrepResult result = prepareRequest(sqe, *it, inLinkChain);
 
         // QueueFull is unused on Linux:
         Q_ASSERT(result != RequestPrepResult::QueueFull);
         if (result == RequestPrepResult::Defer) {
+            // Only the first request of a chain can be deferred, the ones
+            // after it are already ordered by the chain. So we never leave a
+            // partially staged chain behind that links to whatever is queued
+            // next.
+            Q_ASSERT(!inLinkChain);
             qCDebug(lcQIORing) << "Request for" << it->operation()
                    << "had to be deferred, will not queue any more requests at the moment.";
             break;
         }
         if (result == RequestPrepResult::RequestCompleted) {
+            // This ends the chain early, the requests after it start a new one:
+            if (inLinkChain)
+                previousEntry->flags &= ~(IOSQE_IO_LINK | IOSQE_IO_HARDLINK);
+            inLinkChain = false;
             addrItMap.remove(std::addressof(*it));
             it = pendingRequests.erase(it); // Completed synchronously, either failure or success.
             continue;
         }
+        // Nothing to link to if this is the last request for now:
+        if (std::next(it) == end)
+            sqe->flags &= ~(IOSQE_IO_LINK | IOSQE_IO_HARDLINK);
+        inLinkChain = sqe->flags & (IOSQE_IO_LINK | IOSQE_IO_HARDLINK);
+        previousEntry = sqe;
         anyQueued = true;
         it->setQueued(true);
 
@@ -437,6 +835,18 @@ static io_uring_op toUringOp(QIORing::Operation op)
         return IORING_OP_ASYNC_CANCEL;
     case QIORing::Operation::Stat:
         return IORING_OP_STATX;
+    case QIORing::Operation::FlushRange:
+        return IORING_OP_FSYNC;
+    case QIORing::Operation::Allocate:
+        return IORING_OP_FALLOCATE;
+    case QIORing::Operation::Rename:
+        return IORING_OP_RENAMEAT;
+    case QIORing::Operation::Unlink:
+        return IORING_OP_UNLINKAT;
+    case QIORing::Operation::MakeDirectory:
+        return IORING_OP_MKDIRAT;
+    case QIORing::Operation::StatPath:
+        return IORING_OP_STATX;
     case QIORing::Operation::NumOperations:
         break;
     }
@@ -582,16 +992,33 @@ auto QIORing::getVectoredOpAddressAndSize(QIORing::GenericRequestType &request,
     return r;
 }
 
-auto QIORing::prepareRequest(io_uring_sqe *sqe, GenericRequestType &request) -> RequestPrepResult
+auto QIORing::prepareRequest(io_uring_sqe *sqe, GenericRequestType &request, bool inLinkChain)
+        -> RequestPrepResult
 {
     sqe->user_data = qint64(&request);
     sqe->opcode = toUringOp(request.operation());
 
+    if (!availableOperations.test(size_t(request.operation()))) {
+        finishRequestWithError(request, QFileDevice::UnspecifiedError);
+        return RequestPrepResult::RequestCompleted;
+    }
     if (!verifyFd(request)) {
         finishRequestWithError(request, QFileDevice::OpenError);
         return RequestPrepResult::RequestCompleted;
     }
 
+    const RequestFlags flags = flagsOf(request);
+    if (flags & RequestFlag::FixedFile)
+        sqe->flags |= IOSQE_FIXED_FILE;
+    if (flags & RequestFlag::HardLink)
+        sqe->flags |= IOSQE_IO_HARDLINK;
+    else if (flags & RequestFlag::Link)
+        sqe->flags |= IOSQE_IO_LINK;
+    // Linked requests are submitted as-is, we cannot split them or resubmit
+    // the remainder after a short read/write. Deferring one would break up
+    // its chain, so only requests that aren't preceded by a link can be:
+    const bool linked = inLinkChain || (flags & LinkFlags);
+
     switch (request.operation()) {
     case Operation::Open: {
         const QIORingRequest<Operation::Open>
@@ -601,16 +1028,31 @@ auto QIORing::prepareRequest(io_uring_sqe *sqe, GenericRequestType &request) ->
         sqe->open_flags = openModeToOpenFlags(openRequest->flags);
         auto &mode = sqe->len;
         mode = 0666; // With an explicit API we can use QtPrivate::toMode_t() for this
+        if (openRequest->fixedFileSlot >= 0) {
+            if (!ensureFileTable() || quint32(openRequest->fixedFileSlot) >= FixedFileSlots) {
+                finishRequestWithError(request, QFileDevice::ResourceError);
+                return RequestPrepResult::RequestCompleted;
+            }
+            sqe->file_index = quint32(openRequest->fixedFileSlot) + 1;
+        }
         break;
     }
     case Operation::Close: {
-        if (ongoingSplitOperations)
+        if (ongoingSplitOperations && !inLinkChain)
             return Defer;
         const QIORingRequest<Operation::Close>
                 *closeRequest = request.template requestData<Operation::Close>();
         sqe->fd = closeRequest->fd;
-        // Force all earlier entries in the sq to finish before this is processed:
-        sqe->flags |= IOSQE_IO_DRAIN;
+        if (closeRequest->requestFlags & RequestFlag::FixedFile) {
+            // Closing a fixed file takes the slot, not the descriptor:
+            sqe->flags &= ~IOSQE_FIXED_FILE;
+            sqe->fd = 0;
+            sqe->file_index = quint32(closeRequest->fd) + 1;
+        }
+        // Force all earlier entries in the sq to finish before this is processed,
+        // unless the chain already orders it:
+        if (!inLinkChain)
+            sqe->flags |= IOSQE_IO_DRAIN;
         break;
     }
     case Operation::Read: {
@@ -618,7 +1060,9 @@ auto QIORing::prepareRequest(io_uring_sqe *sqe, GenericRequestType &request) ->
                 *readRequest = request.template requestData<Operation::Read>();
         auto span = readRequest->destination;
         auto offset = readRequest->offset;
-        if (span.size() >= maxReadWriteLen()) {
+        // prepareRequests() fails linked requests that would have to be split:
+        Q_ASSERT(!linked || span.size() <= maxReadWriteLen());
+        if (!linked && span.size() >= maxReadWriteLen()) {
             qCDebug(lcQIORing) << "Requested Read of size" << span.size() << "has to be split";
             auto *extra = request.getOrInitializeExtra<QtPrivate::ReadWriteExtra>();
             if (extra->spanOffset == 0) // First time setup
@@ -628,6 +1072,10 @@ auto QIORing::prepareRequest(io_uring_sqe *sqe, GenericRequestType &request) ->
             offset += extra->totalProcessed;
         }
         prepareFileReadWrite(sqe, *readRequest, span.data(), offset, span.size());
+        if (readRequest->bufferIndex >= 0) {
+            sqe->opcode = IORING_OP_READ_FIXED;
+            sqe->buf_index = quint16(readRequest->bufferIndex);
+        }
         break;
     }
     case Operation::Write: {
@@ -635,7 +1083,9 @@ auto QIORing::prepareRequest(io_uring_sqe *sqe, GenericRequestType &request) ->
                 *writeRequest = request.template requestData<Operation::Write>();
         auto span = writeRequest->source;
         auto offset = writeRequest->offset;
-        if (span.size() >= maxReadWriteLen()) {
+        // prepareRequests() fails linked requests that would have to be split:
+        Q_ASSERT(!linked || span.size() <= maxReadWriteLen());
+        if (!linked && span.size() >= maxReadWriteLen()) {
             qCDebug(lcQIORing) << "Requested Write of size" << span.size() << "has to be split";
             auto *extra = request.getOrInitializeExtra<QtPrivate::ReadWriteExtra>();
             if (extra->spanOffset == 0) // First time setup
@@ -645,6 +1095,10 @@ auto QIORing::prepareRequest(io_uring_sqe *sqe, GenericRequestType &request) ->
             offset += extra->totalProcessed;
         }
         prepareFileReadWrite(sqe, *writeRequest, span.data(), offset, span.size());
+        if (writeRequest->bufferIndex >= 0) {
+            sqe->opcode = IORING_OP_WRITE_FIXED;
+            sqe->buf_index = quint16(writeRequest->bufferIndex);
+        }
         break;
     }
     case Operation::VectoredRead: {
@@ -670,13 +1124,14 @@ auto QIORing::prepareRequest(io_uring_sqe *sqe, GenericRequestType &request) ->
         break;
     }
     case Operation::Flush: {
-        if (ongoingSplitOperations)
+        if (ongoingSplitOperations && !inLinkChain)
             return Defer;
         const QIORingRequest<Operation::Flush>
                 *flushRequest = request.template requestData<Operation::Flush>();
         sqe->fd = qint32(flushRequest->fd);
         // Force all earlier entries in the sq to finish before this is processed:
-        sqe->flags |= IOSQE_IO_DRAIN;
+        if (!inLinkChain)
+            sqe->flags |= IOSQE_IO_DRAIN;
         flushInProgress = true;
         break;
     }
@@ -718,6 +1173,67 @@ auto QIORing::prepareRequest(io_uring_sqe *sqe, GenericRequestType &request) ->
         sqe->off = quint64(st);
         break;
     }
+    case Operation::FlushRange: {
+        if (ongoingSplitOperations && !inLinkChain)
+            return Defer;
+        const QIORingRequest<Operation::FlushRange>
+                *flushRequest = request.template requestData<Operation::FlushRange>();
+        prepareFileIOCommon(sqe, *flushRequest, flushRequest->offset);
+        // The range is limited to 32 bits, anything larger syncs to the end:
+        if (flushRequest->length > 0 && flushRequest->length <= std::numeric_limits<quint32>::max())
+            sqe->len = quint32(flushRequest->length);
+        if (flushRequest->dataOnly)
+            sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+        if (!inLinkChain)
+            sqe->flags |= IOSQE_IO_DRAIN;
+        flushInProgress = true;
+        break;
+    }
+    case Operation::Allocate: {
+        const QIORingRequest<Operation::Allocate>
+                *allocateRequest = request.template requestData<Operation::Allocate>();
+        prepareFileIOCommon(sqe, *allocateRequest, allocateRequest->offset);
+        sqe->addr = quint64(allocateRequest->length);
+        sqe->len = allocateRequest->keepSize ? FALLOC_FL_KEEP_SIZE : 0; // mode
+        break;
+    }
+    case Operation::Rename: {
+        const QIORingRequest<Operation::Rename>
+                *renameRequest = request.template requestData<Operation::Rename>();
+        sqe->fd = AT_FDCWD;
+        sqe->addr = reinterpret_cast<quint64>(renameRequest->oldPath.native().c_str());
+        sqe->len = quint32(AT_FDCWD); // newdirfd
+        sqe->addr2 = reinterpret_cast<quint64>(renameRequest->newPath.native().c_str());
+        sqe->rename_flags = renameRequest->noReplace ? RENAME_NOREPLACE : 0;
+        break;
+    }
+    case Operation::Unlink: {
+        const QIORingRequest<Operation::Unlink>
+                *unlinkRequest = request.template requestData<Operation::Unlink>();
+        sqe->fd = AT_FDCWD;
+        sqe->addr = reinterpret_cast<quint64>(unlinkRequest->path.native().c_str());
+        sqe->unlink_flags = unlinkRequest->directory ? AT_REMOVEDIR : 0;
+        break;
+    }
+    case Operation::MakeDirectory: {
+        const QIORingRequest<Operation::MakeDirectory>
+                *mkdirRequest = request.template requestData<Operation::MakeDirectory>();
+        sqe->fd = AT_FDCWD;
+        sqe->addr = reinterpret_cast<quint64>(mkdirRequest->path.native().c_str());
+        sqe->len = mkdirRequest->mode;
+        break;
+    }
+    case Operation::StatPath: {
+        const QIORingRequest<Operation::StatPath>
+                *statRequest = request.template requestData<Operation::StatPath>();
+        struct statx *st = request.getOrInitializeExtra<struct statx>();
+        sqe->fd = AT_FDCWD;
+        sqe->addr = reinterpret_cast<quint64>(statRequest->path.native().c_str());
+        sqe->statx_flags = AT_NO_AUTOMOUNT | (statRequest->followSymlinks ? 0 : AT_SYMLINK_NOFOLLOW);
+        sqe->len = statRequest->mask ? statRequest->mask : STATX_BASIC_STATS | STATX_BTIME;
+        sqe->off = quint64(st);
+        break;
+    }
     case Operation::NumOperations:
         Q_UNREACHABLE_RETURN(RequestPrepResult::RequestCompleted);
         break;
@@ -732,6 +1248,11 @@ void QIORing::GenericRequestType::cleanupExtra(Operation op, void *extra)
     case Operation::Close:
     case Operation::Cancel:
     case Operation::Flush:
+    case Operation::FlushRange:
+    case Operation::Allocate:
+    case Operation::Rename:
+    case Operation::Unlink:
+    case Operation::MakeDirectory:
     case Operation::NumOperations:
         break;
     case Operation::Read:
@@ -741,6 +1262,7 @@ void QIORing::GenericRequestType::cleanupExtra(Operation op, void *extra)
         delete static_cast<QtPrivate::ReadWriteExtra *>(extra);
         return;
     case Operation::Stat:
+    case Operation::StatPath:
         delete static_cast<struct statx *>(extra);
         return;
     }
@@ -24,6 +24,7 @@
 #include <QtCore/qfiledevice.h>
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qdeadlinetimer.h>
+#include <QtCore/private/qfilesystemmetadata_p.h>
 
 #ifdef Q_OS_LINUX
 #  include <QtCore/qsocketnotifier.h>
@@ -36,11 +37,13 @@ struct io_uring_cqe;
 #endif
 
 #include <algorithm>
+#include <bitset>
 #include <filesystem>
 #include <QtCore/qxpfunctional.h>
 #include <variant>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 /*
     This file defines an interface for the backend of QRandomAccessFile.
@@ -79,6 +82,12 @@ Q_NAMESPACE
     OP(Flush)                    \
     OP(Stat)                     \
     OP(Cancel)                   \
+    OP(FlushRange)               \
+    OP(Allocate)                 \
+    OP(Rename)                   \
+    OP(Unlink)                   \
+    OP(MakeDirectory)            \
+    OP(StatPath)                 \
     /**/
 #define DEFINE_ENTRY(OP) OP,
 
@@ -111,9 +120,26 @@ class QIORing final
 public:
     static constexpr quint32 DefaultSubmissionQueueSize = 128;
     static constexpr quint32 DefaultCompletionQueueSize = DefaultSubmissionQueueSize * 2;
+    static constexpr quint32 FixedFileSlots = 256;
+    static constexpr quint32 FixedBufferSlots = 256;
     using Operation = QtPrivate::Operation;
     using RequestHandle = RequestHandleTag *;
 
+    enum class RequestFlag : quint8 {
+        // 'fd' is a slot from allocateFileSlot(), not a file descriptor
+        FixedFile = 0x1,
+        // The next queued request only starts once this one succeeded,
+        // otherwise it fails with QFileDevice::AbortError. A chain is only
+        // submitted once its last request is queued, or, if it's incomplete,
+        // by submitRequests() and waitForRequest(). A chain with a
+        // read or write of more than a single system call can transfer
+        // (0x7ffff000 bytes) fails with QFileDevice::ResourceError.
+        Link = 0x2,
+        // Like Link, but the next request starts even if this one failed
+        HardLink = 0x4,
+    };
+    Q_DECLARE_FLAGS(RequestFlags, RequestFlag)
+
     Q_CORE_EXPORT
     explicit QIORing(quint32 submissionQueueSize = DefaultSubmissionQueueSize,
                      quint32 completionQueueSize = DefaultCompletionQueueSize);
@@ -127,6 +153,8 @@ public:
 
     Q_CORE_EXPORT
     static bool supportsOperation(Operation op);
+    Q_CORE_EXPORT
+    bool isAvailable(Operation op);
     template <Operation Op>
     QIORing::RequestHandle queueRequest(QIORingRequest<Op> &&request)
     {
@@ -145,6 +173,15 @@ public:
     quint32 submissionQueueSize() const noexcept { return sqEntries; }
     quint32 completionQueueSize() const noexcept { return cqEntries; }
 
+    Q_CORE_EXPORT
+    qint32 allocateFileSlot(qintptr fd = -1);
+    Q_CORE_EXPORT
+    void releaseFileSlot(qint32 slot);
+    Q_CORE_EXPORT
+    qint32 registerBuffers(QSpan<const QSpan<std::byte>> buffers);
+    Q_CORE_EXPORT
+    void unregisterBuffers(qint32 firstIndex, qsizetype count);
+
 private:
     std::list<GenericRequestType> pendingRequests;
     using PendingRequestsIterator = decltype(pendingRequests.begin());
@@ -158,6 +195,17 @@ private:
     bool preparingRequests = false;
     qsizetype ongoingSplitOperations = 0;
 
+    enum class TableState : quint8 {
+        Unregistered,
+        Registered,
+        Unsupported,
+    };
+    // Free slots of the fixed file and buffer tables are marked with 'false'
+    std::vector<bool> fileSlotsInUse;
+    std::vector<bool> bufferSlotsInUse;
+    TableState fileTableState = TableState::Unregistered;
+    TableState bufferTableState = TableState::Unregistered;
+
     Q_CORE_EXPORT
     bool initializeIORing();
 
@@ -217,11 +265,22 @@ private:
     // fixed, but since we support older kernels we implement this deferring
     // ourselves.
     bool flushInProgress = false;
+    // Whether prepareRequests() may stage a chain of linked requests whose
+    // last request still links to one that hasn't been queued yet.
+    bool submitIncompleteChains = false;
 
     int io_uringFd = -1;
     int eventDescriptor = -1;
+    // Operations the running kernel knows about, filled in by initializeIORing()
+    std::bitset<size_t(Operation::NumOperations)> availableOperations;
     [[nodiscard]]
-    RequestPrepResult prepareRequest(io_uring_sqe *sqe, GenericRequestType &request);
+    RequestPrepResult prepareRequest(io_uring_sqe *sqe, GenericRequestType &request,
+                                     bool inLinkChain);
+    qsizetype linkChainLength(PendingRequestsIterator it) const;
+    static RequestFlags flagsOf(GenericRequestType &req);
+    static qint64 transferSize(GenericRequestType &req);
+    bool ensureFileTable();
+    bool ensureBufferTable();
 
     template <typename SpanOfBytes>
     auto getVectoredOpAddressAndSize(QIORing::GenericRequestType &request,
@@ -287,6 +346,7 @@ struct QIORingRequestBase : Base
 {
     ExpectedResultType<Op> result; // To be filled in by the backend
     QtPrivate::SlotObjUniquePtr callback;
+    QIORing::RequestFlags requestFlags;
     template <typename Func>
     Q_ALWAYS_INLINE void setCallback(Func &&func)
     {
@@ -307,6 +367,9 @@ struct QIORingRequest<QtPrivate::Operation::Open> final
 {
     std::filesystem::path path;
     QFileDevice::OpenMode flags;
+    // If not -1, the file is opened directly into this slot from
+    // allocateFileSlot() and the result is the slot, not a file descriptor.
+    qint32 fixedFileSlot = -1;
 };
 template <>
 struct QIORingResult<QtPrivate::Operation::Close>
@@ -330,6 +393,8 @@ struct QIORingRequest<QtPrivate::Operation::Write> final
     : QIORingRequestBase<QtPrivate::Operation::Write>
 {
     QSpan<const std::byte> source;
+    // Index from registerBuffers() of the buffer that contains 'source', or -1
+    qint32 bufferIndex = -1;
 };
 template <>
 struct QIORingResult<QtPrivate::Operation::VectoredWrite> final
@@ -353,6 +418,8 @@ struct QIORingRequest<QtPrivate::Operation::Read> final
     : QIORingRequestBase<QtPrivate::Operation::Read>
 {
     QSpan<std::byte> destination;
+    // Index from registerBuffers() of the buffer that contains 'destination', or -1
+    qint32 bufferIndex = -1;
 };
 
 template <>
@@ -392,6 +459,82 @@ struct QIORingRequest<QtPrivate::Operation::Stat> final
     qintptr fd;
 };
 
+template <>
+struct QIORingResult<QtPrivate::Operation::FlushRange> final
+{
+};
+template <>
+struct QIORingRequest<QtPrivate::Operation::FlushRange> final
+    : QIORingRequestBase<QtPrivate::Operation::FlushRange>
+{
+    quint64 length = 0; // 0 means up to the end of the file
+    bool dataOnly = false; // like fdatasync()
+};
+
+template <>
+struct QIORingResult<QtPrivate::Operation::Allocate> final
+{
+};
+template <>
+struct QIORingRequest<QtPrivate::Operation::Allocate> final
+    : QIORingRequestBase<QtPrivate::Operation::Allocate>
+{
+    quint64 length = 0;
+    bool keepSize = false; // don't change the file size, like FALLOC_FL_KEEP_SIZE
+};
+
+template <>
+struct QIORingResult<QtPrivate::Operation::Rename> final
+{
+};
+template <>
+struct QIORingRequest<QtPrivate::Operation::Rename> final
+    : QIORingRequestBase<QtPrivate::Operation::Rename, QIORingRequestEmptyBase>
+{
+    std::filesystem::path oldPath;
+    std::filesystem::path newPath;
+    bool noReplace = false;
+};
+
+template <>
+struct QIORingResult<QtPrivate::Operation::Unlink> final
+{
+};
+template <>
+struct QIORingRequest<QtPrivate::Operation::Unlink> final
+    : QIORingRequestBase<QtPrivate::Operation::Unlink, QIORingRequestEmptyBase>
+{
+    std::filesystem::path path;
+    bool directory = false; // remove an empty directory instead of a file
+};
+
+template <>
+struct QIORingResult<QtPrivate::Operation::MakeDirectory> final
+{
+};
+template <>
+struct QIORingRequest<QtPrivate::Operation::MakeDirectory> final
+    : QIORingRequestBase<QtPrivate::Operation::MakeDirectory, QIORingRequestEmptyBase>
+{
+    std::filesystem::path path;
+    quint32 mode = 0777;
+};
+
+template <>
+struct QIORingResult<QtPrivate::Operation::StatPath> final
+{
+    QFileSystemMetaData metaData;
+    quint32 mask; // the statx fields that were filled in
+};
+template <>
+struct QIORingRequest<QtPrivate::Operation::StatPath> final
+    : QIORingRequestBase<QtPrivate::Operation::StatPath, QIORingRequestEmptyBase>
+{
+    std::filesystem::path path;
+    quint32 mask = 0; // statx mask, 0 for the basic fields
+    bool followSymlinks = true;
+};
+
 // This is not inheriting the QIORingRequestBase because it doesn't have a result,
 // whether it was successful or not is indicated by whether the operation
 // it was cancelling was successful or not.
@@ -611,6 +754,8 @@ struct ReadWriteExtra
 };
 } // namespace QtPrivate
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(QIORing::RequestFlags)
+
 QT_END_NAMESPACE
 
 #endif // IOPROCESSOR_P_H
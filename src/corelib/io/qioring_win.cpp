@@ -285,6 +285,14 @@ void QIORing::completionReady()
         case QtPrivate::Operation::Stat:
             Q_UNREACHABLE_RETURN(); // Completes synchronously
             break;
+        case Operation::FlushRange:
+        case Operation::Allocate:
+        case Operation::Rename:
+        case Operation::Unlink:
+        case Operation::MakeDirectory:
+        case Operation::StatPath:
+            Q_UNREACHABLE_RETURN(); // Not supported, fails in prepareRequest()
+            break;
         case Operation::NumOperations:
             Q_UNREACHABLE_RETURN();
             break;
@@ -369,12 +377,47 @@ bool QIORing::supportsOperation(Operation op)
     case QtPrivate::Operation::VectoredRead:
     case QtPrivate::Operation::VectoredWrite:
         return true;
+    case QtPrivate::Operation::FlushRange:
+    case QtPrivate::Operation::Allocate:
+    case QtPrivate::Operation::Rename:
+    case QtPrivate::Operation::Unlink:
+    case QtPrivate::Operation::MakeDirectory:
+    case QtPrivate::Operation::StatPath:
     case QtPrivate::Operation::NumOperations:
         return false;
     }
     return false; // Not unreachable, we could allow more for io_uring
 }
 
+bool QIORing::isAvailable(Operation op)
+{
+    return supportsOperation(op) && ensureInitialized();
+}
+
+// IoRing has registered files and buffers too, but we don't use them yet:
+qint32 QIORing::allocateFileSlot(qintptr fd)
+{
+    Q_UNUSED(fd);
+    return -1;
+}
+
+void QIORing::releaseFileSlot(qint32 slot)
+{
+    Q_UNUSED(slot);
+}
+
+qint32 QIORing::registerBuffers(QSpan<const QSpan<std::byte>> buffers)
+{
+    Q_UNUSED(buffers);
+    return -1;
+}
+
+void QIORing::unregisterBuffers(qint32 firstIndex, qsizetype count)
+{
+    Q_UNUSED(firstIndex);
+    Q_UNUSED(count);
+}
+
 void QIORing::submitRequests()
 {
     stagePending = false;
@@ -638,6 +681,14 @@ auto QIORing::prepareRequest(GenericRequestType &request) -> RequestPrepResult
                                                 quintptr(std::addressof(request)));
         break;
     }
+    case Operation::FlushRange:
+    case Operation::Allocate:
+    case Operation::Rename:
+    case Operation::Unlink:
+    case Operation::MakeDirectory:
+    case Operation::StatPath:
+        finishRequestWithError(request, QFileDevice::UnspecifiedError);
+        return RequestPrepResult::RequestCompleted;
     case Operation::NumOperations:
         Q_UNREACHABLE_RETURN(RequestPrepResult::RequestCompleted);
         break;
@@ -677,6 +728,12 @@ void QIORing::GenericRequestType::cleanupExtra(Operation op, void *extra)
     case QtPrivate::Operation::Flush:
     case QtPrivate::Operation::Stat:
     case QtPrivate::Operation::Cancel:
+    case QtPrivate::Operation::FlushRange:
+    case QtPrivate::Operation::Allocate:
+    case QtPrivate::Operation::Rename:
+    case QtPrivate::Operation::Unlink:
+    case QtPrivate::Operation::MakeDirectory:
+    case QtPrivate::Operation::StatPath:
     case QtPrivate::Operation::NumOperations:
         break;
     }
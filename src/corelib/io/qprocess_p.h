@@ -348,6 +348,11 @@ public:
     { return environment.d.constData(); }
 };
 
+#ifdef Q_OS_UNIX
+// whether children are started with vfork() semantics (also by QProcessBatch)
+bool globalUsingVfork() noexcept;
+#endif
+
 #endif // QT_CONFIG(process)
 
 QT_END_NAMESPACE
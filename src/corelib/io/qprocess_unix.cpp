@@ -668,7 +668,7 @@ extern "C" {
 __attribute__((weak)) pid_t __interceptor_vfork();
 }
 
-inline bool globalUsingVfork() noexcept
+bool globalUsingVfork() noexcept
 {
 #if defined(__SANITIZE_ADDRESS__) || __has_feature(address_sanitizer)
     // ASan writes to global memory, so we mustn't use vfork().
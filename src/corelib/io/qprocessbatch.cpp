@@ -0,0 +1,523 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:critical reason:execute-external-code
+
+#include "qprocessbatch_p.h"
+
+#include <QtCore/qthread.h>
+#include <QtCore/private/qglobal_p.h>
+
+#include <memory>
+#include <vector>
+
+#if QT_CONFIG(forkfd_pidfd)
+#include "qplatformdefs.h"
+#include <QtCore/qfile.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qscopeguard.h>
+#include <QtCore/qstandardpaths.h>
+#include <QtCore/qvarlengtharray.h>
+#include <QtCore/private/qcore_unix_p.h>
+#include <QtCore/private/qprocess_p.h>
+
+#include <fcntl.h>
+#include <forkfd.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+
+extern char **environ;
+#endif
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QProcessBatch
+    \inmodule QtCore
+    \since 6.12
+
+    \brief The QProcessBatch class runs many short-lived processes and
+    collects their exit status and output.
+
+    Tools that run thousands of compilers, linters or tests pay a lot for
+    a QProcess per child: each one has its own pipes, a pipe to report the
+    start-up, and socket notifiers for all of them. run() starts the
+    processes of a batch from a single loop instead, which waits for all
+    of them at once and needs no event loop.
+
+    On Linux, the processes are started the way QProcess starts its own:
+    with vfork() semantics through forkfd, which gets a pidfd from clone().
+    Each child needs that file descriptor, one pipe per captured channel,
+    and a pipe that reports failures to start, which is done with by the
+    time the parent resumes. Elsewhere, the batch is run with QProcess.
+
+    Starting a single process costs the same either way. What the batch
+    saves is the QProcess object, its notifiers and the event loop round
+    trips per child.
+
+    The standard input of the processes is the null device. Unix extras
+    like QProcess::setChildProcessModifier() are not supported.
+*/
+
+static qsizetype maximumConcurrency(int maxConcurrentProcesses)
+{
+    if (maxConcurrentProcesses > 0)
+        return maxConcurrentProcesses;
+    return qMax(QThread::idealThreadCount(), 1);
+}
+
+static void setTimedOut(QProcessBatch::Result &result)
+{
+    result.error = QProcess::Timedout;
+    result.errorString = QProcess::tr("Process operation timed out");
+}
+
+#if !QT_CONFIG(forkfd_pidfd)
+static void runWithQProcess(QSpan<const QProcessBatch::Job> jobs, qsizetype maxConcurrent,
+                            QDeadlineTimer deadline, QList<QProcessBatch::Result> &results)
+{
+    struct Running {
+        std::unique_ptr<QProcess> process;
+        qsizetype job;
+    };
+    std::vector<Running> running;
+    running.reserve(maxConcurrent);
+
+    const auto finish = [&](Running &entry) {
+        QProcess &process = *entry.process;
+        QProcessBatch::Result &result = results[entry.job];
+        const int msecs = deadline.isForever()
+                ? -1 : int(qMin(deadline.remainingTime(), qint64(INT_MAX)));
+        if (process.state() != QProcess::NotRunning && !process.waitForFinished(msecs)) {
+            process.kill();
+            process.waitForFinished(-1);
+            result.standardOutput = process.readAllStandardOutput();
+            result.standardError = process.readAllStandardError();
+            result.exitCode = process.exitCode();
+            result.exitStatus = QProcess::CrashExit;
+            setTimedOut(result);
+            return;
+        }
+        result.standardOutput = process.readAllStandardOutput();
+        result.standardError = process.readAllStandardError();
+        result.exitCode = process.exitCode();
+        result.exitStatus = process.exitStatus();
+        result.error = process.error();
+        if (result.error != QProcess::UnknownError)
+            result.errorString = process.errorString();
+    };
+
+    // Waiting for the oldest process first is good enough for processes
+    // that take about the same time; the others keep running meanwhile.
+    qsizetype next = 0;
+    qsizetype oldest = 0;
+    while (oldest < jobs.size()) {
+        while (next < jobs.size() && next - oldest < maxConcurrent && !deadline.hasExpired()) {
+            const QProcessBatch::Job &job = jobs[next];
+            auto process = std::make_unique<QProcess>();
+            process->setProcessChannelMode(job.channelMode);
+            process->setStandardInputFile(QProcess::nullDevice());
+            process->setWorkingDirectory(job.workingDirectory);
+            if (!job.environment.inheritsFromParent())
+                process->setProcessEnvironment(job.environment);
+            process->start(job.program, job.arguments);
+            results[next].processId = process->processId();
+            running.push_back({ std::move(process), next });
+            ++next;
+        }
+        if (running.empty()) {
+            // the deadline expired before the remaining ones could start
+            for ( ; oldest < jobs.size(); ++oldest)
+                setTimedOut(results[oldest]);
+            break;
+        }
+        finish(running.front());
+        running.erase(running.begin());
+        ++oldest;
+    }
+}
+
+#else // !QT_CONFIG(forkfd_pidfd)
+namespace {
+struct SpawnedProcess
+{
+    qsizetype job;
+    pid_t pid = -1;
+    int forkfd = -1;
+    int stdoutPipe = -1;
+    int stderrPipe = -1;
+};
+
+// The parts that are the same for many jobs of a batch
+struct SpawnCache
+{
+    QHash<QString, QByteArray> executables;
+    const QProcessEnvironment *environment = nullptr;
+    QByteArrayList environmentData;
+    std::vector<char *> envp;
+    int nullDevice = -1;
+    const bool usingVfork = globalUsingVfork();
+
+    ~SpawnCache()
+    {
+        if (nullDevice != -1)
+            qt_safe_close(nullDevice);
+    }
+
+    QByteArray executable(const QString &program);
+    char **environmentFor(const QProcessEnvironment &env);
+};
+
+// What startChild() needs, prepared by the parent
+struct ChildSetup
+{
+    char **argv;
+    char **envp;
+    const char *workingDirectory;
+    int standardInput;
+    int standardOutput;
+    int standardError;
+    int errorPipe;
+    sigset_t oldsigset;
+};
+
+// Sent by the child if it can't run the program. The function names are
+// literals, so the pointer means the same in the parent even after fork().
+struct ChildError
+{
+    int code;
+    const char *function;
+};
+static_assert(sizeof(ChildError) <= _POSIX_PIPE_BUF);
+}
+
+QByteArray SpawnCache::executable(const QString &program)
+{
+    auto it = executables.constFind(program);
+    if (it == executables.cend()) {
+        // like QProcess, search $PATH only for bare names; an empty result
+        // makes execve() fail with ENOENT
+        const QString path = program.contains(u'/')
+                ? program : QStandardPaths::findExecutable(program);
+        it = executables.insert(program, QFile::encodeName(path));
+    }
+    return *it;
+}
+
+char **SpawnCache::environmentFor(const QProcessEnvironment &env)
+{
+    if (env.inheritsFromParent())
+        return environ;
+    if (!environment || *environment != env) {
+        const QStringList variables = env.toStringList();
+        environmentData.clear();
+        environmentData.reserve(variables.size());
+        for (const QString &variable : variables)
+            environmentData.append(variable.toLocal8Bit());
+        envp.clear();
+        for (QByteArray &variable : environmentData)
+            envp.push_back(variable.data());
+        envp.push_back(nullptr);
+        environment = &env;
+    }
+    return envp.data();
+}
+
+static void closeFd(int &fd)
+{
+    if (fd != -1)
+        qt_safe_close(fd);
+    fd = -1;
+}
+
+// Reads what is available; closes \a fd at EOF.
+static void drainPipe(int &fd, QByteArray &buffer)
+{
+    char chunk[16384];
+    while (fd != -1) {
+        const qint64 n = qt_safe_read(fd, chunk, sizeof(chunk));
+        if (n > 0)
+            buffer.append(chunk, n);
+        else if (n == -1 && errno == EAGAIN)
+            return;
+        else
+            closeFd(fd);
+    }
+}
+
+static bool openCapturePipe(int fds[2])
+{
+    if (qt_safe_pipe(fds) != 0)
+        return false;
+    ::fcntl(fds[0], F_SETFL, ::fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+    return true;
+}
+
+// IMPORTANT: like QChildProcess::startProcess(), this runs in a vfork()
+// context, so it MUST NOT modify any non-local variable. All signals are
+// blocked; sigaction() is vfork-safe in the C libraries used on Linux (see
+// QtVforkSafe in qprocess_unix.cpp for the ones where it isn't).
+static int startChild(void *token) noexcept
+{
+    const ChildSetup *setup = static_cast<const ChildSetup *>(token);
+    const auto fail = [setup](const char *function) {
+        const ChildError error = { errno, function };
+        qt_safe_write(setup->errorPipe, &error, sizeof(error));
+        return -1;
+    };
+
+    // our ends of the pipes are close-on-exec, dup2() clears the flag on the
+    // copies
+    if (qt_safe_dup2(setup->standardInput, STDIN_FILENO, 0) == -1)
+        return fail("dup2");
+    if (setup->standardOutput != -1
+        && qt_safe_dup2(setup->standardOutput, STDOUT_FILENO, 0) == -1) {
+        return fail("dup2");
+    }
+    if (setup->standardError != -1
+        && qt_safe_dup2(setup->standardError, STDERR_FILENO, 0) == -1) {
+        return fail("dup2");
+    }
+    if (setup->workingDirectory && ::chdir(setup->workingDirectory) == -1)
+        return fail("chdir");
+
+    // reset the signal that Qt ignores and the mask the parent had
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = SIG_DFL;
+    ::sigaction(SIGPIPE, &sa, nullptr);
+    pthread_sigmask(SIG_SETMASK, &setup->oldsigset, nullptr);
+
+    qt_safe_execve(setup->argv[0], setup->argv, setup->envp);
+    return fail("execve");
+}
+
+static void reapProcess(SpawnedProcess &process, forkfd_info *info)
+{
+    int ret;
+    QT_EINTR_LOOP(ret, forkfd_wait(process.forkfd, info, nullptr));
+    QT_EINTR_LOOP(ret, forkfd_close(process.forkfd));
+    process.forkfd = -1;
+}
+
+// Returns 0 or the errno of the failure, with \a function set to what failed.
+static int spawnProcess(const QProcessBatch::Job &job, SpawnCache &cache,
+                        SpawnedProcess &process, const char **function)
+{
+    using M = QProcess::ProcessChannelMode;
+    const M mode = job.channelMode;
+    const bool captureStdout = mode != M::ForwardedChannels && mode != M::ForwardedOutputChannel;
+    const bool captureStderr = mode == M::SeparateChannels || mode == M::ForwardedOutputChannel;
+
+    if (cache.nullDevice == -1) {
+        cache.nullDevice = qt_safe_open("/dev/null", O_RDONLY);
+        if (cache.nullDevice == -1) {
+            *function = "open";
+            return errno;
+        }
+    }
+
+    int stdoutPipe[2] = { -1, -1 };
+    int stderrPipe[2] = { -1, -1 };
+    int errorPipe[2] = { -1, -1 };
+    auto closePipes = qScopeGuard([&] {
+        closeFd(stdoutPipe[0]);
+        closeFd(stdoutPipe[1]);
+        closeFd(stderrPipe[0]);
+        closeFd(stderrPipe[1]);
+        closeFd(errorPipe[0]);
+        closeFd(errorPipe[1]);
+    });
+    if ((captureStdout && !openCapturePipe(stdoutPipe))
+        || (captureStderr && !openCapturePipe(stderrPipe))
+        || qt_safe_pipe(errorPipe) != 0) {
+        *function = "pipe";
+        return errno;
+    }
+
+    QByteArray executable = cache.executable(job.program);
+    QVarLengthArray<QByteArray, 16> arguments;
+    arguments.reserve(job.arguments.size());
+    for (const QString &argument : job.arguments)
+        arguments.append(QFile::encodeName(argument));
+    QVarLengthArray<char *, 18> argv;
+    argv.append(executable.data());
+    for (QByteArray &argument : arguments)
+        argv.append(argument.data());
+    argv.append(nullptr);
+    const QByteArray workingDirectory = QFile::encodeName(job.workingDirectory);
+
+    ChildSetup setup = {};
+    setup.argv = argv.data();
+    setup.envp = cache.environmentFor(job.environment);
+    setup.workingDirectory = workingDirectory.isEmpty() ? nullptr : workingDirectory.constData();
+    setup.standardInput = cache.nullDevice;
+    setup.standardOutput = stdoutPipe[1];
+    setup.standardError = mode == M::MergedChannels ? stdoutPipe[1] : stderrPipe[1];
+    setup.errorPipe = errorPipe[1];
+
+    // As in QProcess: block the signals, so the user's handlers don't run in
+    // the child, and disable thread cancellation, as the child makes calls
+    // that are cancellation points.
+    sigset_t fullset;
+    sigfillset(&fullset);
+    pthread_sigmask(SIG_SETMASK, &fullset, &setup.oldsigset);
+    int oldstate;
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &oldstate);
+
+    const int ffdflags = FFD_CLOEXEC | (cache.usingVfork ? 0 : FFD_USE_FORK);
+    process.forkfd = ::vforkfd(ffdflags, &process.pid, &startChild, &setup);
+    const int forkError = errno;
+
+    pthread_setcancelstate(oldstate, nullptr);
+    pthread_sigmask(SIG_SETMASK, &setup.oldsigset, nullptr);
+    if (process.forkfd == -1) {
+        *function = "fork";
+        return forkError;
+    }
+
+    // Once the child has run execve() or exited, it has no copy of the write
+    // end left. With vfork() that has happened by now; after fork(), this
+    // waits for it.
+    closeFd(errorPipe[1]);
+    ChildError error;
+    if (qt_safe_read(errorPipe[0], &error, sizeof(error)) == qint64(sizeof(error))) {
+        forkfd_info info;
+        reapProcess(process, &info);
+        *function = error.function;
+        return error.code;
+    }
+
+    process.stdoutPipe = std::exchange(stdoutPipe[0], -1);
+    process.stderrPipe = std::exchange(stderrPipe[0], -1);
+    return 0;
+}
+
+static void finishProcess(SpawnedProcess &process, QProcessBatch::Result &result)
+{
+    forkfd_info info = {};
+    reapProcess(process, &info);
+
+    // like QProcess, report the signal as the exit code of crashed processes
+    result.exitCode = info.status;
+    if (info.code == CLD_EXITED) {
+        result.exitStatus = QProcess::NormalExit;
+    } else {
+        result.exitStatus = QProcess::CrashExit;
+        result.error = QProcess::Crashed;
+        result.errorString = QProcess::tr("Process crashed");
+    }
+}
+
+static void runWithForkfds(QSpan<const QProcessBatch::Job> jobs, qsizetype maxConcurrent,
+                          QDeadlineTimer deadline, QList<QProcessBatch::Result> &results)
+{
+    SpawnCache cache;
+    std::vector<SpawnedProcess> running;
+    running.reserve(maxConcurrent);
+    std::vector<pollfd> pfds;
+    pfds.reserve(3 * maxConcurrent);
+
+    // The child can't exit before its pipes have been written to, so once
+    // its forkfd is readable, what's left in them is all there will be (short
+    // of grandchildren that inherited them, which QProcess doesn't wait for
+    // either).
+    const auto finish = [&](SpawnedProcess &process) {
+        QProcessBatch::Result &result = results[process.job];
+        finishProcess(process, result);
+        drainPipe(process.stdoutPipe, result.standardOutput);
+        drainPipe(process.stderrPipe, result.standardError);
+        closeFd(process.stdoutPipe);
+        closeFd(process.stderrPipe);
+    };
+
+    qsizetype next = 0;
+    while (next < jobs.size() || !running.empty()) {
+        while (next < jobs.size() && qsizetype(running.size()) < maxConcurrent) {
+            SpawnedProcess process{ next };
+            QProcessBatch::Result &result = results[next];
+            const char *function = nullptr;
+            if (int error = spawnProcess(jobs[next], cache, process, &function)) {
+                result.error = QProcess::FailedToStart;
+                result.errorString = QProcess::tr("Child process set up failed: %1: %2")
+                        .arg(QLatin1StringView(function), qt_error_string(error));
+            } else {
+                result.processId = process.pid;
+                running.push_back(process);
+            }
+            ++next;
+        }
+        if (running.empty())
+            continue;
+
+        pfds.clear();
+        for (const SpawnedProcess &process : running) {
+            pfds.push_back(qt_make_pollfd(process.forkfd, POLLIN));
+            pfds.push_back(qt_make_pollfd(process.stdoutPipe, POLLIN));
+            pfds.push_back(qt_make_pollfd(process.stderrPipe, POLLIN));
+        }
+        const int ret = qt_safe_poll(pfds.data(), nfds_t(pfds.size()), deadline);
+        if (ret == 0 || (ret == -1 && errno != EINTR)) {
+            // Timed out (or can't wait): kill what's left, and don't start
+            // the rest. The pids can't have been reused, because we didn't
+            // reap them yet.
+            for (SpawnedProcess &process : running) {
+                ::kill(process.pid, SIGKILL);
+                finish(process);
+                setTimedOut(results[process.job]);
+            }
+            running.clear();
+            for ( ; next < jobs.size(); ++next)
+                setTimedOut(results[next]);
+            break;
+        }
+
+        // back to front, so that removing by swapping with the last one
+        // only moves entries we're done with
+        for (size_t i = running.size(); i-- > 0; ) {
+            SpawnedProcess &process = running[i];
+            QProcessBatch::Result &result = results[process.job];
+            const pollfd *p = &pfds[3 * i];
+            if (p[1].revents)
+                drainPipe(process.stdoutPipe, result.standardOutput);
+            if (p[2].revents)
+                drainPipe(process.stderrPipe, result.standardError);
+            if (!p[0].revents)
+                continue;
+            finish(process);
+            if (i != running.size() - 1)
+                process = running.back();
+            running.pop_back();
+        }
+    }
+}
+#endif // !QT_CONFIG(forkfd_pidfd)
+
+/*!
+    \internal
+
+    Runs the processes described by \a jobs, at most \a maxConcurrentProcesses
+    of them at the same time, and returns their results in the same order
+    as \a jobs. If \a maxConcurrentProcesses is 0, the ideal thread count is
+    used.
+
+    This function blocks until all processes have finished, or until \a
+    deadline expires. Then the processes still running are killed, and
+    they and the ones that didn't start yet have QProcess::Timedout as their
+    error.
+*/
+QList<QProcessBatch::Result> QProcessBatch::run(QSpan<const Job> jobs, int maxConcurrentProcesses,
+                                                QDeadlineTimer deadline)
+{
+    QList<Result> results(jobs.size());
+    const qsizetype maxConcurrent = maximumConcurrency(maxConcurrentProcesses);
+#if QT_CONFIG(forkfd_pidfd)
+    runWithForkfds(jobs, maxConcurrent, deadline, results);
+#else
+    runWithQProcess(jobs, maxConcurrent, deadline, results);
+#endif
+    return results;
+}
+
+QT_END_NAMESPACE
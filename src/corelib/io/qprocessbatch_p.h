@@ -0,0 +1,66 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:critical reason:execute-external-code
+
+#ifndef QPROCESSBATCH_P_H
+#define QPROCESSBATCH_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qprocess.h>
+
+QT_REQUIRE_CONFIG(process);
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qspan.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qstringlist.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QProcessBatch
+{
+public:
+    struct Job
+    {
+        QString program;
+        QStringList arguments;
+        QString workingDirectory;
+        QProcessEnvironment environment{QProcessEnvironment::InheritFromParent};
+        // SeparateChannels and MergedChannels capture the output, the
+        // forwarded modes don't capture what they forward
+        QProcess::ProcessChannelMode channelMode = QProcess::SeparateChannels;
+    };
+
+    struct Result
+    {
+        QByteArray standardOutput;
+        QByteArray standardError;
+        QString errorString;
+        qint64 processId = 0;
+        int exitCode = 0;
+        QProcess::ExitStatus exitStatus = QProcess::NormalExit;
+        QProcess::ProcessError error = QProcess::UnknownError;  // UnknownError if none
+    };
+
+    // Runs all of \a jobs, at most \a maxConcurrentProcesses at a time (the
+    // ideal thread count if 0), and returns their results in the same order.
+    // Processes still running at \a deadline are killed.
+    static QList<Result> run(QSpan<const Job> jobs, int maxConcurrentProcesses = 0,
+                             QDeadlineTimer deadline = QDeadlineTimer::Forever);
+};
+
+QT_END_NAMESPACE
+
+#endif // QPROCESSBATCH_P_H
@@ -12,6 +12,17 @@ QRandomAccessAsyncFileBackend::QRandomAccessAsyncFileBackend(QRandomAccessAsyncF
 {
 }
 QRandomAccessAsyncFileBackend::~QRandomAccessAsyncFileBackend() = default;
+
+bool QRandomAccessAsyncFileBackend::registerBuffers(QSpan<const QSpan<std::byte>> buffers)
+{
+    Q_UNUSED(buffers);
+    return false;
+}
+
+void QRandomAccessAsyncFileBackend::unregisterBuffers()
+{
+}
+
 QRandomAccessAsyncFilePrivate::QRandomAccessAsyncFilePrivate() = default;
 QRandomAccessAsyncFilePrivate::~QRandomAccessAsyncFilePrivate() = default;
 
@@ -81,6 +92,80 @@ QIOOperation *QRandomAccessAsyncFile::flush()
     return d->flush();
 }
 
+/*!
+    \internal
+    \overload
+
+    Flushes the data in the range of \a length bytes starting at \a offset
+    to the file. A \a length of 0 means up to the end of the file.
+
+    Backends that cannot flush a range flush the whole file instead.
+
+    \include qrandomaccessasyncfile.cpp returns-qiooperation
+*/
+QIOOperation *QRandomAccessAsyncFile::flush(qint64 offset, qint64 length)
+{
+    Q_D(QRandomAccessAsyncFile);
+    if (offset < 0 || length < 0) {
+        qWarning("QRandomAccessAsyncFile::flush(): negative offset or length, "
+                 "flushing the whole file");
+        return d->flush();
+    }
+    return d->flush(offset, length);
+}
+
+/*!
+    \internal
+
+    Allocates disk space for \a length bytes, starting from \a offset. If the
+    range extends past the end of the file, the file grows accordingly.
+
+    Subsequent writes into the range will not fail for lack of disk space.
+
+    \include qrandomaccessasyncfile.cpp returns-qiooperation
+*/
+QIOOperation *QRandomAccessAsyncFile::allocate(qint64 offset, qint64 length)
+{
+    Q_D(QRandomAccessAsyncFile);
+    if (length < 0) {
+        qWarning("Using a negative length in QRandomAccessAsyncFile::allocate() is incorrect. "
+                 "Resetting to zero!");
+        length = 0;
+    }
+    return d->allocate(offset, length);
+}
+
+/*!
+    \internal
+
+    Registers \a buffers with the backend, replacing any previously registered
+    buffers. Reads into and writes from memory that lies within one of the
+    registered buffers can then skip mapping the memory for each operation.
+
+    The buffers must remain valid until unregisterBuffers() is called or the
+    file is destroyed.
+
+    Returns \c true if the backend supports registered buffers and the
+    registration succeeded; otherwise returns \c false. Reads and writes work
+    the same either way.
+*/
+bool QRandomAccessAsyncFile::registerBuffers(QSpan<const QSpan<std::byte>> buffers)
+{
+    Q_D(QRandomAccessAsyncFile);
+    return d->registerBuffers(buffers);
+}
+
+/*!
+    \internal
+
+    Unregisters the buffers that were registered with registerBuffers().
+*/
+void QRandomAccessAsyncFile::unregisterBuffers()
+{
+    Q_D(QRandomAccessAsyncFile);
+    d->unregisterBuffers();
+}
+
 /*!
     \internal
 
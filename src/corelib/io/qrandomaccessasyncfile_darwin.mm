@@ -18,7 +18,8 @@ namespace {
 
 static bool isBarrierOperation(QIOOperation::Type type)
 {
-    return type == QIOOperation::Type::Flush || type == QIOOperation::Type::Open;
+    return type == QIOOperation::Type::Flush || type == QIOOperation::Type::Open
+            || type == QIOOperation::Type::Allocate;
 }
 
 } // anonymous namespace
@@ -157,6 +158,21 @@ QIOOperation *QRandomAccessAsyncFileNativeBackend::flush()
     return addOperation<QIOOperation>(QIOOperation::Type::Flush, 0);
 }
 
+QIOOperation *QRandomAccessAsyncFileNativeBackend::flush(qint64 offset, qint64 length)
+{
+    // fsync() has no range, so flush everything
+    Q_UNUSED(offset);
+    Q_UNUSED(length);
+    return flush();
+}
+
+QIOOperation *QRandomAccessAsyncFileNativeBackend::allocate(qint64 offset, qint64 length)
+{
+    auto *op = addOperation<QIOOperation>(QIOOperation::Type::Allocate, offset);
+    QIOOperationPrivate::get(op)->length = length;
+    return op;
+}
+
 QIOReadOperation *QRandomAccessAsyncFileNativeBackend::read(qint64 offset, qint64 maxSize)
 {
     QByteArray array(maxSize, Qt::Uninitialized);
@@ -306,11 +322,16 @@ void QRandomAccessAsyncFileNativeBackend::handleOperationComplete(const Operatio
             switch (type) {
             case QIOOperation::Type::Read:
             case QIOOperation::Type::Write:
+            case QIOOperation::Type::Allocate:
                 return QIOOperation::Error::IncorrectOffset;
             case QIOOperation::Type::Flush:
                 return QIOOperation::Error::Flush;
             case QIOOperation::Type::Open:
                 return QIOOperation::Error::Open;
+            case QIOOperation::Type::Rename:
+            case QIOOperation::Type::Remove:
+            case QIOOperation::Type::MakeDirectory:
+            case QIOOperation::Type::Stat:
             case QIOOperation::Type::Unknown:
                 Q_UNREACHABLE_RETURN(QIOOperation::Error::FileNotOpen);
             }
@@ -324,6 +345,12 @@ void QRandomAccessAsyncFileNativeBackend::handleOperationComplete(const Operatio
                 return QIOOperation::Error::Flush;
             case QIOOperation::Type::Open:
                 return QIOOperation::Error::Open;
+            case QIOOperation::Type::Allocate:
+                return QIOOperation::Error::Allocate;
+            case QIOOperation::Type::Rename:
+            case QIOOperation::Type::Remove:
+            case QIOOperation::Type::MakeDirectory:
+            case QIOOperation::Type::Stat:
             case QIOOperation::Type::Unknown:
                 Q_UNREACHABLE_RETURN(QIOOperation::Error::FileNotOpen);
             }
@@ -357,7 +384,8 @@ void QRandomAccessAsyncFileNativeBackend::handleOperationComplete(const Operatio
         }
         priv->operationComplete(convertError(opResult.error, priv->type));
         break;
-    case QIOOperation::Type::Flush: {
+    case QIOOperation::Type::Flush:
+    case QIOOperation::Type::Allocate: {
         const QIOOperation::Error error = convertError(opResult.error, priv->type);
         priv->operationComplete(error);
         break;
@@ -374,6 +402,10 @@ void QRandomAccessAsyncFileNativeBackend::handleOperationComplete(const Operatio
         priv->operationComplete(error);
         break;
     }
+    case QIOOperation::Type::Rename:
+    case QIOOperation::Type::Remove:
+    case QIOOperation::Type::MakeDirectory:
+    case QIOOperation::Type::Stat:
     case QIOOperation::Type::Unknown:
         Q_UNREACHABLE();
         break;
@@ -409,9 +441,16 @@ void QRandomAccessAsyncFileNativeBackend::startOperationsUntilBarrier()
             case QIOOperation::Type::Flush:
                 executeFlush(opInfo);
                 break;
+            case QIOOperation::Type::Allocate:
+                executeAllocate(opInfo);
+                break;
             case QIOOperation::Type::Open:
                 executeOpen(opInfo);
                 break;
+            case QIOOperation::Type::Rename:
+            case QIOOperation::Type::Remove:
+            case QIOOperation::Type::MakeDirectory:
+            case QIOOperation::Type::Stat:
             case QIOOperation::Type::Unknown:
                 Q_UNREACHABLE();
                 break;
@@ -503,6 +542,41 @@ void QRandomAccessAsyncFileNativeBackend::executeWrite(OperationInfo &opInfo)
 }
 
 void QRandomAccessAsyncFileNativeBackend::executeFlush(OperationInfo &opInfo)
+{
+    executeBarrierBlock(opInfo, ^(int fd) {
+        return fsync(fd) == 0 ? 0 : errno;
+    });
+}
+
+void QRandomAccessAsyncFileNativeBackend::executeAllocate(OperationInfo &opInfo)
+{
+    auto priv = QIOOperationPrivate::get(opInfo.operation);
+    const qint64 offset = priv->offset;
+    const qint64 length = priv->length;
+    executeBarrierBlock(opInfo, ^(int fd) {
+        if (offset < 0)
+            return EINVAL;
+        QT_STATBUF st;
+        if (QT_FSTAT(fd, &st) != 0)
+            return errno;
+        if (offset + length <= st.st_size)
+            return 0;
+        // Try a contiguous allocation past the end of the file first, then
+        // settle for any:
+        fstore_t store = { F_ALLOCATECONTIG | F_ALLOCATEALL, F_PEOFPOSMODE, 0,
+                           off_t(offset + length - st.st_size), 0 };
+        if (fcntl(fd, F_PREALLOCATE, &store) == -1) {
+            store.fst_flags = F_ALLOCATEALL;
+            if (fcntl(fd, F_PREALLOCATE, &store) == -1)
+                return errno;
+        }
+        // F_PREALLOCATE does not change the file size
+        return QT_FTRUNCATE(fd, offset + length) == 0 ? 0 : errno;
+    });
+}
+
+void QRandomAccessAsyncFileNativeBackend::executeBarrierBlock(OperationInfo &opInfo,
+                                                              int (^block)(int fd))
 {
     opInfo.channel = duplicateIoChannel(opInfo.opId);
     if (!opInfo.channel) {
@@ -510,13 +584,13 @@ void QRandomAccessAsyncFileNativeBackend::executeFlush(OperationInfo &opInfo)
         return;
     }
 
-    // flush() is a barrier operation, but dispatch_io_barrier does not work
-    // as documented with multiple channels :(
+    // Barrier operations have to wait for all others, but dispatch_io_barrier
+    // does not work as documented with multiple channels :(
     auto sharedThis = this;
     const int fd = m_fd;
     const OperationId opId = opInfo.opId;
     dispatch_io_barrier(opInfo.channel, ^{
-        const int err = fsync(fd);
+        const int err = block(fd);
 
         QMutexLocker locker(&sharedThis->m_mutex);
         sharedThis->m_runningOps.remove(opId);
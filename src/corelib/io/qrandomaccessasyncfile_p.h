@@ -37,6 +37,12 @@ public:
 
     [[nodiscard]] QIOOperation *open(const QString &filePath, QIODeviceBase::OpenMode mode);
     [[nodiscard]] QIOOperation *flush();
+    [[nodiscard]] QIOOperation *flush(qint64 offset, qint64 length);
+    [[nodiscard]] QIOOperation *allocate(qint64 offset, qint64 length);
+
+    // buffers that are read into or written from repeatedly
+    bool registerBuffers(QSpan<const QSpan<std::byte>> buffers);
+    void unregisterBuffers();
 
     // owning APIs: we are responsible for storing the data
     [[nodiscard]] QIOReadOperation *read(qint64 offset, qint64 maxSize);
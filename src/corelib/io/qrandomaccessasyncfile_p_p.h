@@ -29,6 +29,7 @@
 #include <QtCore/qfuturewatcher.h>
 #include <QtCore/qmutex.h>
 #include <QtCore/qqueue.h>
+#include <QtCore/qthreadpool.h>
 
 #endif // future && thread
 
@@ -65,6 +66,11 @@ public:
 
     [[nodiscard]] virtual QIOOperation *open(const QString &path, QIODeviceBase::OpenMode mode) = 0;
     [[nodiscard]] virtual QIOOperation *flush() = 0;
+    [[nodiscard]] virtual QIOOperation *flush(qint64 offset, qint64 length) = 0;
+    [[nodiscard]] virtual QIOOperation *allocate(qint64 offset, qint64 length) = 0;
+
+    virtual bool registerBuffers(QSpan<const QSpan<std::byte>> buffers);
+    virtual void unregisterBuffers();
 
     [[nodiscard]] virtual QIOReadOperation *read(qint64 offset, qint64 maxSize) = 0;
     [[nodiscard]] virtual QIOWriteOperation *write(qint64 offset, const QByteArray &data) = 0;
@@ -133,6 +139,27 @@ public:
         checkValid();
         return m_backend->flush();
     }
+    [[nodiscard]] QIOOperation *flush(qint64 offset, qint64 length)
+    {
+        checkValid();
+        return m_backend->flush(offset, length);
+    }
+    [[nodiscard]] QIOOperation *allocate(qint64 offset, qint64 length)
+    {
+        checkValid();
+        return m_backend->allocate(offset, length);
+    }
+
+    bool registerBuffers(QSpan<const QSpan<std::byte>> buffers)
+    {
+        checkValid();
+        return m_backend->registerBuffers(buffers);
+    }
+    void unregisterBuffers()
+    {
+        checkValid();
+        m_backend->unregisterBuffers();
+    }
 
     [[nodiscard]] QIOReadOperation *read(qint64 offset, qint64 maxSize)
     {
@@ -197,6 +224,8 @@ public:
 
     [[nodiscard]] QIOOperation *open(const QString &path, QIODeviceBase::OpenMode mode) override;
     [[nodiscard]] QIOOperation *flush() override;
+    [[nodiscard]] QIOOperation *flush(qint64 offset, qint64 length) override;
+    [[nodiscard]] QIOOperation *allocate(qint64 offset, qint64 length) override;
 
     [[nodiscard]] QIOReadOperation *read(qint64 offset, qint64 maxSize) override;
     [[nodiscard]] QIOWriteOperation *write(qint64 offset, const QByteArray &data) override;
@@ -212,14 +241,25 @@ public:
     [[nodiscard]] QIOVectoredWriteOperation *
     writeFrom(qint64 offset, QSpan<const QSpan<const std::byte>> buffers) override;
 
+#if defined(QT_RANDOMACCESSASYNCFILE_QIORING)
+    bool registerBuffers(QSpan<const QSpan<std::byte>> buffers) override;
+    void unregisterBuffers() override;
+#endif
+
 private:
 #if defined(QT_RANDOMACCESSASYNCFILE_QIORING)
     void queueCompletion(QIOOperationPrivate *priv, QIOOperation::Error error);
     void startReadIntoSingle(QIOOperation *op, const QSpan<std::byte> &to);
     void startWriteFromSingle(QIOOperation *op, const QSpan<const std::byte> &from);
+    template <typename Request>
+    void setRequestFile(Request &request) const;
+    qint32 registeredBufferIndex(const std::byte *data, qsizetype size) const;
     QIORing::RequestHandle cancel(QIORing::RequestHandle handle);
     QIORing *m_ioring = nullptr;
     qintptr m_fd = -1;
+    qint32 m_fileSlot = -1; // m_fd registered with the ring, if possible
+    qint32 m_firstBufferIndex = -1;
+    QList<QSpan<std::byte>> m_registeredBuffers;
     QList<QPointer<QIOOperation>> m_operations;
     QHash<QIOOperation *, QIORing::RequestHandle> m_opHandleMap;
 #endif
@@ -294,6 +334,8 @@ private:
     void executeRead(OperationInfo &opInfo);
     void executeWrite(OperationInfo &opInfo);
     void executeFlush(OperationInfo &opInfo);
+    void executeAllocate(OperationInfo &opInfo);
+    void executeBarrierBlock(OperationInfo &opInfo, int (^block)(int fd));
     void executeOpen(OperationInfo &opInfo);
 
     void readOneBuffer(OperationId opId, qsizetype bufferIdx, qint64 alreadyRead);
@@ -307,6 +349,55 @@ private:
 #endif // QIORing || macOS
 
 #if QT_CONFIG(future) && QT_CONFIG(thread)
+namespace QtPrivate {
+
+// We cannot use Q_GLOBAL_STATIC(QThreadPool, foo) because the Windows
+// implementation raises a qWarning in its destructor when used as a global
+// static, and this warning leads to a crash on Windows CI. Cannot reproduce
+// the crash locally, so cannot really fix the issue :(
+// This class should act like a global thread pool, but it'll have a sort of
+// ref counting, and will be created/destroyed by QRAAFP, QAsyncFileSystem and
+// QFileIOQueue instances.
+class SharedThreadPool
+{
+public:
+    void ref()
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_refCount == 0) {
+            Q_ASSERT(!m_pool);
+            m_pool = new QThreadPool;
+        }
+        ++m_refCount;
+    }
+
+    void deref()
+    {
+        QMutexLocker locker(&m_mutex);
+        Q_ASSERT(m_refCount);
+        if (--m_refCount == 0) {
+            delete m_pool;
+            m_pool = nullptr;
+        }
+    }
+
+    QThreadPool *operator()()
+    {
+        QMutexLocker locker(&m_mutex);
+        Q_ASSERT(m_refCount > 0);
+        return m_pool;
+    }
+
+private:
+    QBasicMutex m_mutex;
+    QThreadPool *m_pool = nullptr;
+    quint64 m_refCount = 0;
+};
+
+extern SharedThreadPool asyncFileThreadPool;
+
+} // namespace QtPrivate
+
 class QRandomAccessAsyncFileThreadPoolBackend : public QRandomAccessAsyncFileBackend
 {
     Q_DISABLE_COPY_MOVE(QRandomAccessAsyncFileThreadPoolBackend)
@@ -322,6 +413,8 @@ public:
 
     [[nodiscard]] QIOOperation *open(const QString &path, QIODeviceBase::OpenMode mode) override;
     [[nodiscard]] QIOOperation *flush() override;
+    [[nodiscard]] QIOOperation *flush(qint64 offset, qint64 length) override;
+    [[nodiscard]] QIOOperation *allocate(qint64 offset, qint64 length) override;
 
     [[nodiscard]] QIOReadOperation *read(qint64 offset, qint64 maxSize) override;
     [[nodiscard]] QIOWriteOperation *write(qint64 offset, const QByteArray &data) override;
@@ -355,6 +448,7 @@ private:
     void executeNextOperation();
     void processBufferAt(qsizetype idx);
     void processFlush();
+    void processAllocate();
     void processOpen();
     void operationComplete();
 };
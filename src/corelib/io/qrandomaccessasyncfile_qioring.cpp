@@ -13,6 +13,8 @@
 
 #include <QtCore/q26numeric.h>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 
 Q_STATIC_LOGGING_CATEGORY(lcQRandomAccessIORing, "qt.core.qrandomaccessasyncfile.ioring",
@@ -22,7 +24,11 @@ QRandomAccessAsyncFileNativeBackend::QRandomAccessAsyncFileNativeBackend(QRandom
     : QRandomAccessAsyncFileBackend(owner)
 {}
 
-QRandomAccessAsyncFileNativeBackend::~QRandomAccessAsyncFileNativeBackend() = default;
+QRandomAccessAsyncFileNativeBackend::~QRandomAccessAsyncFileNativeBackend()
+{
+    if (m_ioring)
+        unregisterBuffers();
+}
 
 bool QRandomAccessAsyncFileNativeBackend::init()
 {
@@ -51,6 +57,56 @@ void QRandomAccessAsyncFileNativeBackend::cancelAndWait(QIOOperation *op)
     }
 }
 
+template <typename Request>
+void QRandomAccessAsyncFileNativeBackend::setRequestFile(Request &request) const
+{
+    if (m_fileSlot >= 0) {
+        request.fd = m_fileSlot;
+        request.requestFlags |= QIORing::RequestFlag::FixedFile;
+    } else {
+        request.fd = m_fd;
+    }
+}
+
+qint32 QRandomAccessAsyncFileNativeBackend::registeredBufferIndex(const std::byte *data,
+                                                                  qsizetype size) const
+{
+    for (qsizetype i = 0; i < m_registeredBuffers.size(); ++i) {
+        const QSpan<std::byte> &buffer = m_registeredBuffers[i];
+        const std::byte *begin = buffer.data();
+        if (std::less_equal<>{}(begin, data)
+            && std::less_equal<>{}(data + size, begin + buffer.size())) {
+            return m_firstBufferIndex + qint32(i);
+        }
+    }
+    return -1;
+}
+
+bool QRandomAccessAsyncFileNativeBackend::registerBuffers(QSpan<const QSpan<std::byte>> buffers)
+{
+    unregisterBuffers();
+    const qint32 firstIndex = m_ioring->registerBuffers(buffers);
+    if (firstIndex < 0)
+        return false;
+    m_firstBufferIndex = firstIndex;
+    m_registeredBuffers.assign(buffers.begin(), buffers.end());
+    return true;
+}
+
+void QRandomAccessAsyncFileNativeBackend::unregisterBuffers()
+{
+    if (m_firstBufferIndex < 0)
+        return;
+    // In-flight operations may still refer to the buffers:
+    for (const auto &op : std::as_const(m_operations)) {
+        if (auto *opHandle = m_opHandleMap.value(op))
+            m_ioring->waitForRequest(opHandle);
+    }
+    m_ioring->unregisterBuffers(m_firstBufferIndex, m_registeredBuffers.size());
+    m_firstBufferIndex = -1;
+    m_registeredBuffers.clear();
+}
+
 void QRandomAccessAsyncFileNativeBackend::queueCompletion(QIOOperationPrivate *priv, QIOOperation::Error error)
 {
     // Remove the handle now in case the user cancels or deletes the io-operation
@@ -99,6 +155,9 @@ QIOOperation *QRandomAccessAsyncFileNativeBackend::open(const QString &path, QIO
             if (m_fileState == FileState::OpenPending) {
                 m_fileState = FileState::Opened;
                 m_fd = result->fd;
+                // Saves looking up the descriptor for every read and write,
+                // we fall back to m_fd if the ring runs out of slots:
+                m_fileSlot = m_ioring->allocateFileSlot(m_fd);
                 queueCompletion(priv, QIOOperation::Error::None);
             } else { // Something went wrong, we did not expect a callback:
                 // So we close the new handle:
@@ -134,13 +193,15 @@ void QRandomAccessAsyncFileNativeBackend::close()
         }
     }
 
-    QIORingRequest<QIORing::Operation::Close> closeRequest;
-    closeRequest.fd = m_fd;
-    tasksToAwait.append(m_ioring->queueRequest(std::move(closeRequest)));
-
     // Wait for completion:
     for (const QIORing::RequestHandle &handle : tasksToAwait)
         m_ioring->waitForRequest(handle);
+
+    if (m_fileSlot >= 0)
+        m_ioring->releaseFileSlot(std::exchange(m_fileSlot, -1));
+    QIORingRequest<QIORing::Operation::Close> closeRequest;
+    closeRequest.fd = m_fd;
+    m_ioring->waitForRequest(m_ioring->queueRequest(std::move(closeRequest)));
     m_fileState = FileState::Closed;
     m_fd = -1;
 }
@@ -175,7 +236,7 @@ QIOOperation *QRandomAccessAsyncFileNativeBackend::flush()
     m_operations.append(op);
 
     QIORingRequest<QIORing::Operation::Flush> flushRequest;
-    flushRequest.fd = m_fd;
+    setRequestFile(flushRequest);
     flushRequest.setCallback([this, op](const QIORingRequest<QIORing::Operation::Flush> &request) {
         auto *priv = QIOOperationPrivate::get(op);
         if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result)) {
@@ -195,11 +256,96 @@ QIOOperation *QRandomAccessAsyncFileNativeBackend::flush()
     return op;
 }
 
+QIOOperation *QRandomAccessAsyncFileNativeBackend::flush(qint64 offset, qint64 length)
+{
+    if (!m_ioring->isAvailable(QIORing::Operation::FlushRange))
+        return flush();
+
+    auto *dataStorage = new QtPrivate::QIOOperationDataStorage();
+
+    auto *priv = new QIOOperationPrivate(dataStorage);
+    priv->type = QIOOperation::Type::Flush;
+    priv->offset = offset;
+    priv->length = length;
+
+    auto *op = new QIOOperation(*priv, m_owner);
+    m_operations.append(op);
+
+    QIORingRequest<QIORing::Operation::FlushRange> flushRequest;
+    setRequestFile(flushRequest);
+    flushRequest.offset = quint64(offset);
+    flushRequest.length = quint64(length);
+    flushRequest.setCallback(
+            [this, op](const QIORingRequest<QIORing::Operation::FlushRange> &request) {
+                auto *priv = QIOOperationPrivate::get(op);
+                if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result)) {
+                    if (priv->error == QIOOperation::Error::Aborted
+                        || *err == QFileDevice::AbortError)
+                        queueCompletion(priv, QIOOperation::Error::Aborted);
+                    else if (*err == QFileDevice::OpenError)
+                        queueCompletion(priv, QIOOperation::Error::FileNotOpen);
+                    else
+                        queueCompletion(priv, QIOOperation::Error::Flush);
+                } else {
+                    queueCompletion(priv, QIOOperation::Error::None);
+                }
+                m_operations.removeOne(op);
+            });
+    m_opHandleMap.insert(priv->q_func(), m_ioring->queueRequest(std::move(flushRequest)));
+
+    return op;
+}
+
+QIOOperation *QRandomAccessAsyncFileNativeBackend::allocate(qint64 offset, qint64 length)
+{
+    auto *dataStorage = new QtPrivate::QIOOperationDataStorage();
+
+    auto *priv = new QIOOperationPrivate(dataStorage);
+    priv->type = QIOOperation::Type::Allocate;
+    priv->offset = offset;
+    priv->length = length;
+
+    auto *op = new QIOOperation(*priv, m_owner);
+    if (priv->offset < 0) { // The QIORing offset is unsigned, so error out now
+        queueCompletion(priv, QIOOperation::Error::IncorrectOffset);
+        return op;
+    }
+    if (!m_ioring->isAvailable(QIORing::Operation::Allocate)) {
+        queueCompletion(priv, QIOOperation::Error::Allocate);
+        return op;
+    }
+    m_operations.append(op);
+
+    QIORingRequest<QIORing::Operation::Allocate> allocateRequest;
+    setRequestFile(allocateRequest);
+    allocateRequest.offset = quint64(offset);
+    allocateRequest.length = quint64(length);
+    allocateRequest.setCallback(
+            [this, op](const QIORingRequest<QIORing::Operation::Allocate> &request) {
+                auto *priv = QIOOperationPrivate::get(op);
+                if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result)) {
+                    if (priv->error == QIOOperation::Error::Aborted
+                        || *err == QFileDevice::AbortError)
+                        queueCompletion(priv, QIOOperation::Error::Aborted);
+                    else if (*err == QFileDevice::OpenError)
+                        queueCompletion(priv, QIOOperation::Error::FileNotOpen);
+                    else
+                        queueCompletion(priv, QIOOperation::Error::Allocate);
+                } else {
+                    queueCompletion(priv, QIOOperation::Error::None);
+                }
+                m_operations.removeOne(op);
+            });
+    m_opHandleMap.insert(priv->q_func(), m_ioring->queueRequest(std::move(allocateRequest)));
+
+    return op;
+}
+
 void QRandomAccessAsyncFileNativeBackend::startReadIntoSingle(QIOOperation *op,
                                                         const QSpan<std::byte> &to)
 {
     QIORingRequest<QIORing::Operation::Read> readRequest;
-    readRequest.fd = m_fd;
+    setRequestFile(readRequest);
     auto *priv = QIOOperationPrivate::get(op);
     if (priv->offset < 0) { // The QIORing offset is unsigned, so error out now
         queueCompletion(priv, QIOOperation::Error::IncorrectOffset);
@@ -208,6 +354,7 @@ void QRandomAccessAsyncFileNativeBackend::startReadIntoSingle(QIOOperation *op,
     }
     readRequest.offset = priv->offset;
     readRequest.destination = to;
+    readRequest.bufferIndex = registeredBufferIndex(to.data(), to.size());
     readRequest.setCallback([this, op](const QIORingRequest<QIORing::Operation::Read> &request) {
         auto *priv = QIOOperationPrivate::get(op);
         if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result)) {
@@ -261,7 +408,7 @@ void QRandomAccessAsyncFileNativeBackend::startWriteFromSingle(QIOOperation *op,
                                                          const QSpan<const std::byte> &from)
 {
     QIORingRequest<QIORing::Operation::Write> writeRequest;
-    writeRequest.fd = m_fd;
+    setRequestFile(writeRequest);
     auto *priv = QIOOperationPrivate::get(op);
     if (priv->offset < 0) { // The QIORing offset is unsigned, so error out now
         queueCompletion(priv, QIOOperation::Error::IncorrectOffset);
@@ -270,6 +417,7 @@ void QRandomAccessAsyncFileNativeBackend::startWriteFromSingle(QIOOperation *op,
     }
     writeRequest.offset = priv->offset;
     writeRequest.source = from;
+    writeRequest.bufferIndex = registeredBufferIndex(from.data(), from.size());
     writeRequest.setCallback([this, op](const QIORingRequest<QIORing::Operation::Write> &request) {
         auto *priv = QIOOperationPrivate::get(op);
         if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result)) {
@@ -362,7 +510,7 @@ QRandomAccessAsyncFileNativeBackend::readInto(qint64 offset, QSpan<const QSpan<s
     m_operations.append(op);
 
     QIORingRequest<QIORing::Operation::VectoredRead> readRequest;
-    readRequest.fd = m_fd;
+    setRequestFile(readRequest);
     readRequest.offset = priv->offset;
     readRequest.destinations = dataStorage->getReadSpans();
     readRequest.setCallback([this,
@@ -414,7 +562,7 @@ QRandomAccessAsyncFileNativeBackend::writeFrom(qint64 offset, QSpan<const QSpan<
     m_operations.append(op);
 
     QIORingRequest<QIORing::Operation::VectoredWrite> writeRequest;
-    writeRequest.fd = m_fd;
+    setRequestFile(writeRequest);
     writeRequest.offset = priv->offset;
     writeRequest.sources = dataStorage->getWriteSpans();
     writeRequest.setCallback(
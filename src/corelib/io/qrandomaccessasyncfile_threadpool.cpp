@@ -11,68 +11,27 @@
 #include <QtCore/qthread.h>
 #include <QtCore/qthreadpool.h>
 
+#ifdef Q_OS_UNIX
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
 QT_REQUIRE_CONFIG(thread);
 QT_REQUIRE_CONFIG(future);
 
 QT_BEGIN_NAMESPACE
 
-namespace {
-
-// We cannot use Q_GLOBAL_STATIC(QThreadPool, foo) because the Windows
-// implementation raises a qWarning in its destructor when used as a global
-// static, and this warning leads to a crash on Windows CI. Cannot reproduce
-// the crash locally, so cannot really fix the issue :(
-// This class should act like a global thread pool, but it'll have a sort of
-// ref counting, and will be created/destroyed by QRAAFP instances.
-class SharedThreadPool
-{
-public:
-    void ref()
-    {
-        QMutexLocker locker(&m_mutex);
-        if (m_refCount == 0) {
-            Q_ASSERT(!m_pool);
-            m_pool = new QThreadPool;
-        }
-        ++m_refCount;
-    }
-
-    void deref()
-    {
-        QMutexLocker locker(&m_mutex);
-        Q_ASSERT(m_refCount);
-        if (--m_refCount == 0) {
-            delete m_pool;
-            m_pool = nullptr;
-        }
-    }
-
-    QThreadPool *operator()()
-    {
-        QMutexLocker locker(&m_mutex);
-        Q_ASSERT(m_refCount > 0);
-        return m_pool;
-    }
-
-private:
-    QBasicMutex m_mutex;
-    QThreadPool *m_pool = nullptr;
-    quint64 m_refCount = 0;
-};
-
-static SharedThreadPool asyncFileThreadPool;
-
-} // anonymous namespace
+Q_CONSTINIT QtPrivate::SharedThreadPool QtPrivate::asyncFileThreadPool;
 
 QRandomAccessAsyncFileThreadPoolBackend::QRandomAccessAsyncFileThreadPoolBackend(QRandomAccessAsyncFile *owner) :
     QRandomAccessAsyncFileBackend(owner)
 {
-    asyncFileThreadPool.ref();
+    QtPrivate::asyncFileThreadPool.ref();
 }
 
 QRandomAccessAsyncFileThreadPoolBackend::~QRandomAccessAsyncFileThreadPoolBackend()
 {
-    asyncFileThreadPool.deref();
+    QtPrivate::asyncFileThreadPool.deref();
 }
 
 bool QRandomAccessAsyncFileThreadPoolBackend::init()
@@ -170,6 +129,29 @@ QIOOperation *QRandomAccessAsyncFileThreadPoolBackend::flush()
     return op;
 }
 
+QIOOperation *QRandomAccessAsyncFileThreadPoolBackend::flush(qint64 offset, qint64 length)
+{
+    // QFSFileEngine cannot flush a range, so flush everything
+    Q_UNUSED(offset);
+    Q_UNUSED(length);
+    return flush();
+}
+
+QIOOperation *QRandomAccessAsyncFileThreadPoolBackend::allocate(qint64 offset, qint64 length)
+{
+    auto *dataStorage = new QtPrivate::QIOOperationDataStorage();
+
+    auto *priv = new QIOOperationPrivate(dataStorage);
+    priv->type = QIOOperation::Type::Allocate;
+    priv->offset = offset;
+    priv->length = length;
+
+    auto *op = new QIOOperation(*priv, m_owner);
+    m_operations.append(op);
+    executeNextOperation();
+    return op;
+}
+
 QIOReadOperation *QRandomAccessAsyncFileThreadPoolBackend::read(qint64 offset, qint64 maxSize)
 {
     QByteArray array;
@@ -338,9 +320,16 @@ void QRandomAccessAsyncFileThreadPoolBackend::executeNextOperation()
             case QIOOperation::Type::Flush:
                 processFlush();
                 break;
+            case QIOOperation::Type::Allocate:
+                processAllocate();
+                break;
             case QIOOperation::Type::Open:
                 processOpen();
                 break;
+            case QIOOperation::Type::Rename:
+            case QIOOperation::Type::Remove:
+            case QIOOperation::Type::MakeDirectory:
+            case QIOOperation::Type::Stat:
             case QIOOperation::Type::Unknown:
                 Q_ASSERT_X(false, "executeNextOperation", "Operation of type Unknown!");
                 // For release builds - directly complete the operation
@@ -386,7 +375,7 @@ void QRandomAccessAsyncFileThreadPoolBackend::processBufferAt(qsizetype idx)
         };
 
         QFuture<OperationResult> f =
-                QtFuture::makeReadyVoidFuture().then(asyncFileThreadPool(), op);
+                QtFuture::makeReadyVoidFuture().then(QtPrivate::asyncFileThreadPool(), op);
         m_watcher.setFuture(f);
     } else if (priv->type == QIOOperation::Type::Write) {
         qint64 size = -1;
@@ -413,7 +402,7 @@ void QRandomAccessAsyncFileThreadPoolBackend::processBufferAt(qsizetype idx)
         };
 
         QFuture<OperationResult> f =
-                QtFuture::makeReadyVoidFuture().then(asyncFileThreadPool(), op);
+                QtFuture::makeReadyVoidFuture().then(QtPrivate::asyncFileThreadPool(), op);
         m_watcher.setFuture(f);
     }
 }
@@ -439,7 +428,39 @@ void QRandomAccessAsyncFileThreadPoolBackend::processFlush()
     };
 
     QFuture<OperationResult> f =
-            QtFuture::makeReadyVoidFuture().then(asyncFileThreadPool(), op);
+            QtFuture::makeReadyVoidFuture().then(QtPrivate::asyncFileThreadPool(), op);
+    m_watcher.setFuture(f);
+}
+
+void QRandomAccessAsyncFileThreadPoolBackend::processAllocate()
+{
+    Q_ASSERT(!m_currentOperation.isNull());
+    auto *priv = QIOOperationPrivate::get(m_currentOperation.get());
+    Q_ASSERT(priv->dataStorage->isEmpty());
+
+    QBasicMutex *mutexPtr = &m_engineMutex;
+    auto op = [engine = m_engine.get(), mutexPtr, offset = priv->offset, length = priv->length] {
+        QMutexLocker locker(mutexPtr);
+        QRandomAccessAsyncFileThreadPoolBackend::OperationResult result{0, QIOOperation::Error::None};
+        if (!engine) {
+            result.error = QIOOperation::Error::FileNotOpen;
+        } else if (offset < 0) {
+            result.error = QIOOperation::Error::IncorrectOffset;
+        } else {
+#if defined(_POSIX_ADVISORY_INFO) && _POSIX_ADVISORY_INFO > 0
+            if (::posix_fallocate(engine->handle(), offset, length) != 0)
+                result.error = QIOOperation::Error::Allocate;
+#else
+            // No way to reserve the blocks, but we can at least grow the file
+            if (engine->size() < offset + length && !engine->setSize(offset + length))
+                result.error = QIOOperation::Error::Allocate;
+#endif
+        }
+        return result;
+    };
+
+    QFuture<OperationResult> f =
+            QtFuture::makeReadyVoidFuture().then(QtPrivate::asyncFileThreadPool(), op);
     m_watcher.setFuture(f);
 }
 
@@ -466,9 +487,9 @@ void QRandomAccessAsyncFileThreadPoolBackend::processOpen()
                 result.error = QIOOperation::Error::Open;
             return result;
         };
-        f = QtFuture::makeReadyVoidFuture().then(asyncFileThreadPool(), op);
+        f = QtFuture::makeReadyVoidFuture().then(QtPrivate::asyncFileThreadPool(), op);
     } else {
-        f = QtFuture::makeReadyVoidFuture().then(asyncFileThreadPool(), [] {
+        f = QtFuture::makeReadyVoidFuture().then(QtPrivate::asyncFileThreadPool(), [] {
             return QRandomAccessAsyncFileThreadPoolBackend::OperationResult{0, QIOOperation::Error::Open};
         });
     }
@@ -532,6 +553,7 @@ void QRandomAccessAsyncFileThreadPoolBackend::operationComplete()
             break;
         }
         case QIOOperation::Type::Flush:
+        case QIOOperation::Type::Allocate:
             priv->operationComplete(res.error);
             break;
         case QIOOperation::Type::Open:
@@ -547,6 +569,10 @@ void QRandomAccessAsyncFileThreadPoolBackend::operationComplete()
             }
             priv->operationComplete(res.error);
             break;
+        case QIOOperation::Type::Rename:
+        case QIOOperation::Type::Remove:
+        case QIOOperation::Type::MakeDirectory:
+        case QIOOperation::Type::Stat:
         case QIOOperation::Type::Unknown:
             priv->setError(QIOOperation::Error::Aborted);
             break;
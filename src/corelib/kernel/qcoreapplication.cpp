@@ -370,7 +370,9 @@ Q_CONSTINIT bool QCoreApplicationPrivate::is_app_closing = false;
 
 qsizetype qGlobalPostedEventsCount()
 {
-    const QPostEventList &l = QThreadData::current()->postEventList;
+    QPostEventList &l = QThreadData::current()->postEventList;
+    const auto locker = qt_scoped_lock(l.mutex);
+    l.takePendingEvents();
     return l.size() - l.startOffset;
 }
 
@@ -496,6 +498,7 @@ void QCoreApplicationPrivate::cleanupThreadData()
 
         // need to clear the state of the mainData, just in case a new QCoreApplication comes along.
         const auto locker = qt_scoped_lock(thisThreadData->postEventList.mutex);
+        thisThreadData->postEventList.takePendingEvents();
         for (const QPostEvent &pe : std::as_const(thisThreadData->postEventList)) {
             if (pe.event) {
                 pe.receiver->d_func()->postedEvents.fetchAndSubAcquire(1);
@@ -1597,6 +1600,52 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
     return locker;
 }
 
+/*!
+    \internal
+
+    Posts \a event to \a receiver without locking the post event list of
+    the receiver's thread. Returns \c false if the event needs to be posted
+    the regular way, because the receiver is being moved to another thread
+    or destroyed, or because too many events are pending already.
+
+    Only QEvent::MetaCall events at the default priority take this path,
+    as they are never compressed.
+*/
+bool QCoreApplicationPrivate::tryPostEventLockFree(QObject *receiver, QEvent *event)
+{
+    auto &threadData = QObjectPrivate::get(receiver)->threadData;
+    QThreadData *data = threadData.loadAcquire();
+    if (!data)
+        return false;
+
+    QPostEventList &list = data->postEventList;
+    if (!list.beginAddPendingEvent())
+        return false;
+    // if the object moved in the meantime, the new thread's mutex is needed
+    if (threadData.loadAcquire() != data) {
+        list.endAddPendingEvent();
+        return false;
+    }
+
+    event->m_posted = true;
+    receiver->d_func()->postedEvents.fetchAndAddRelease(1);
+    const bool added = list.tryAddPendingEvent(QPostEvent(receiver, event, Qt::NormalEventPriority));
+    list.endAddPendingEvent();
+    if (!added) {
+        // full, the regular path makes room
+        receiver->d_func()->postedEvents.fetchAndSubRelaxed(1);
+        event->m_posted = false;
+        return false;
+    }
+    // the event may have been delivered and deleted already
+    Q_TRACE(QCoreApplication_postEvent_event_posted, receiver, event, QEvent::MetaCall);
+
+    QAbstractEventDispatcher *dispatcher = data->eventDispatcher.loadAcquire();
+    if (dispatcher)
+        dispatcher->wakeUp();
+    return true;
+}
+
 /*!
     \since 4.3
 
@@ -1646,6 +1695,13 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    // queued calls at the default priority are neither compressed nor
+    // reordered, so they can skip the mutex
+    if (priority == Qt::NormalEventPriority && event->type() == QEvent::MetaCall
+        && QCoreApplicationPrivate::tryPostEventLockFree(receiver, event)) {
+        return;
+    }
+
     auto locker = QCoreApplicationPrivate::lockThreadPostEventList(receiver);
     if (!locker.threadData) {
         // posting during destruction? just delete the event to prevent a leak
@@ -1654,6 +1710,7 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
     }
 
     QThreadData *data = locker.threadData;
+    data->postEventList.takePendingEvents();
 
     QT_WARNING_PUSH
     QT_WARNING_DISABLE_DEPRECATED // compressEvent()
@@ -1774,6 +1831,7 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
     ++data->postEventList.recursion;
 
     auto locker = qt_unique_lock(data->postEventList.mutex);
+    data->postEventList.takePendingEvents();
 
     // by default, we assume that the event dispatcher can go to sleep after
     // processing all events. if any new events are posted while we send
@@ -1942,6 +2000,8 @@ void QCoreApplication::removePostedEvents(QObject *receiver, int eventType)
     if (receiver && !receiver->d_func()->postedEvents.loadAcquire())
         return;
 
+    data->postEventList.takePendingEvents();
+
     //we will collect all the posted events for the QObject
     //and we'll delete after the mutex was unlocked
     QVarLengthArray<QEvent*> events;
@@ -1998,6 +2058,7 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
     QThreadData *data = QThreadData::current();
 
     const auto locker = qt_scoped_lock(data->postEventList.mutex);
+    data->postEventList.takePendingEvents();
 
     if (data->postEventList.size() == 0) {
 #if defined(QT_DEBUG)
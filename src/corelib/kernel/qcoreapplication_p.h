@@ -120,6 +120,7 @@ public:
         void unlock() { locker.unlock(); }
     };
     static QPostEventListLocker lockThreadPostEventList(QObject *object);
+    static bool tryPostEventLockFree(QObject *receiver, QEvent *event);
 #endif // QT_NO_QOBJECT
 
     int &argc;
@@ -0,0 +1,506 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qplatformdefs.h"
+
+#include "qcoreapplication.h"
+#include "qsocketnotifier.h"
+#include "qthread.h"
+
+#include "qeventdispatcher_epoll_p.h"
+#include <private/qthread_p.h>
+#include <private/qcoreapplication_p.h>
+#include <private/qcore_unix_p.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <errno.h>
+#include <sys/epoll.h>
+
+using namespace std::chrono;
+using namespace std::chrono_literals;
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QEventDispatcherEpoll
+    \inmodule QtCore
+
+    An event dispatcher for Linux that keeps the socket notifiers in a
+    persistent epoll(7) interest set. Enabling or disabling a notifier costs
+    a single epoll_ctl() call and each iteration of the event loop only
+    visits the file descriptors that are ready, so the cost of a wake-up no
+    longer grows with the number of registered notifiers, as it does with
+    QEventDispatcherUNIX.
+
+    It is used instead of QEventDispatcherUNIX (and the GLib dispatcher) when
+    the \c QT_EVENT_DISPATCHER environment variable is set to \c epoll.
+*/
+
+static const char *socketType(QSocketNotifier::Type type)
+{
+    switch (type) {
+    case QSocketNotifier::Read:
+        return "Read";
+    case QSocketNotifier::Write:
+        return "Write";
+    case QSocketNotifier::Exception:
+        return "Exception";
+    }
+
+    Q_UNREACHABLE();
+}
+
+// The EPOLL* event bits have the same values as their POLL* counterparts on
+// Linux, which lets us share the notifier mapping with QEventDispatcherUNIX.
+static_assert(EPOLLIN == POLLIN && EPOLLOUT == POLLOUT && EPOLLPRI == POLLPRI
+              && EPOLLERR == POLLERR && EPOLLHUP == POLLHUP);
+
+static int qt_safe_epoll_wait(int epfd, epoll_event *events, int maxevents,
+                              QDeadlineTimer deadline)
+{
+    int ret;
+    if (deadline.isForever()) {
+        QT_EINTR_LOOP(ret, epoll_wait(epfd, events, maxevents, -1));
+        return ret;
+    }
+
+    // loop and recalculate the timeout as needed
+    do {
+        // epoll_wait() has millisecond granularity: round up, so that we
+        // never wake up before the next timer is due
+        const milliseconds remaining = std::min(ceil<milliseconds>(deadline.remainingTimeAsDuration()),
+                                                milliseconds(std::numeric_limits<int>::max()));
+        ret = epoll_wait(epfd, events, maxevents, int(remaining.count()));
+    } while (ret == -1 && errno == EINTR);
+    return ret;
+}
+
+QEventDispatcherEpollPrivate::QEventDispatcherEpollPrivate()
+{
+    if (Q_UNLIKELY(threadPipe.init() == false))
+        qFatal("QEventDispatcherEpollPrivate(): Cannot continue without a thread pipe");
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (Q_UNLIKELY(epollFd == -1))
+        qFatal("QEventDispatcherEpollPrivate(): Unable to create epoll instance: %s",
+               qPrintable(qt_error_string(errno)));
+
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = threadPipe.fds[0];
+    if (Q_UNLIKELY(epoll_ctl(epollFd, EPOLL_CTL_ADD, threadPipe.fds[0], &ev) == -1))
+        qFatal("QEventDispatcherEpollPrivate(): Unable to watch the thread pipe: %s",
+               qPrintable(qt_error_string(errno)));
+}
+
+QEventDispatcherEpollPrivate::~QEventDispatcherEpollPrivate()
+{
+    // cleanup timers
+    timerList.clearTimers();
+
+    if (epollFd != -1)
+        qt_safe_close(epollFd);
+}
+
+int QEventDispatcherEpollPrivate::activateTimers()
+{
+    return timerList.activateTimers();
+}
+
+/*
+    Brings the kernel's interest set for \a fd from \a oldEvents to
+    \a newEvents (both in POLL* bits; 0 meaning "not watched").
+*/
+void QEventDispatcherEpollPrivate::updateInterest(int fd, short oldEvents, short newEvents)
+{
+    if (oldEvents == newEvents)
+        return;
+
+    if (!newEvents) {
+        if (unpollableFds.remove(fd))
+            return;
+        // ENOENT and EBADF just mean the descriptor was closed before its
+        // notifiers were disabled, and the kernel has already forgotten it
+        if (epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr) == -1
+            && errno != ENOENT && errno != EBADF) {
+            qErrnoWarning("QEventDispatcherEpoll: epoll_ctl(EPOLL_CTL_DEL) failed for socket %d", fd);
+        }
+        return;
+    }
+
+    if (unpollableFds.contains(fd))
+        return;
+
+    epoll_event ev = {};
+    ev.events = quint32(newEvents);
+    ev.data.fd = fd;
+
+    int op = oldEvents ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    int ret = epoll_ctl(epollFd, op, fd, &ev);
+    if (ret == -1 && op == EPOLL_CTL_MOD && errno == ENOENT) {
+        // the descriptor was closed and its number reused without the
+        // notifiers being disabled in between
+        op = EPOLL_CTL_ADD;
+        ret = epoll_ctl(epollFd, op, fd, &ev);
+    } else if (ret == -1 && op == EPOLL_CTL_ADD && errno == EEXIST) {
+        op = EPOLL_CTL_MOD;
+        ret = epoll_ctl(epollFd, op, fd, &ev);
+    }
+    if (ret == 0)
+        return;
+
+    switch (errno) {
+    case EPERM:
+        // Regular files and directories cannot be watched by epoll, but
+        // poll() always reports them as readable and writable.
+        unpollableFds.insert(fd, POLLIN | POLLOUT);
+        break;
+    case EBADF:
+        unpollableFds.insert(fd, POLLNVAL);
+        break;
+    default:
+        qErrnoWarning("QEventDispatcherEpoll: epoll_ctl failed for socket %d", fd);
+        break;
+    }
+}
+
+/*
+    Appends the notifiers of \a fd matching \a revents to the pending list.
+    Within one iteration each descriptor is reported only once, so we only
+    need to check for duplicates among the first \a alreadyPending entries,
+    which are left over from a recursive event loop.
+*/
+void QEventDispatcherEpollPrivate::markPendingSocketNotifiers(int fd, short revents,
+                                                              qsizetype alreadyPending)
+{
+    auto it = socketNotifiers.constFind(fd);
+    if (it == socketNotifiers.cend())
+        return;
+
+    // copy, disabling a notifier below may erase the entry
+    const QSocketNotifierSetUNIX sn_set = it.value();
+
+    static const struct {
+        QSocketNotifier::Type type;
+        short flags;
+    } notifiers[] = {
+        { QSocketNotifier::Read,      POLLIN  | POLLHUP | POLLERR },
+        { QSocketNotifier::Write,     POLLOUT | POLLHUP | POLLERR },
+        { QSocketNotifier::Exception, POLLPRI | POLLHUP | POLLERR }
+    };
+
+    for (const auto &n : notifiers) {
+        QSocketNotifier *notifier = sn_set.notifiers[n.type];
+
+        if (!notifier)
+            continue;
+
+        if (revents & POLLNVAL) {
+            qWarning("QSocketNotifier: Invalid socket %d with type %s, disabling...",
+                     fd, socketType(n.type));
+            notifier->setEnabled(false);
+        }
+
+        if (revents & n.flags) {
+            const auto alreadyPendingEnd = pendingNotifiers.cbegin() + alreadyPending;
+            if (std::find(pendingNotifiers.cbegin(), alreadyPendingEnd, notifier) == alreadyPendingEnd)
+                pendingNotifiers.append(notifier);
+        }
+    }
+}
+
+int QEventDispatcherEpollPrivate::processReadyEvents(const epoll_event *events, int count)
+{
+    int nevents = 0;
+    const qsizetype alreadyPending = pendingNotifiers.size();
+
+    for (int i = 0; i < count; ++i) {
+        const int fd = events[i].data.fd;
+        if (fd == threadPipe.fds[0]) {
+            pollfd pfd = threadPipe.prepare();
+            pfd.revents = short(events[i].events);
+            nevents += threadPipe.check(pfd);
+        } else {
+            markPendingSocketNotifiers(fd, short(events[i].events), alreadyPending);
+        }
+    }
+
+    if (!unpollableFds.isEmpty()) {
+        // copy, disabling an invalid notifier modifies the hash
+        const auto unpollable = unpollableFds;
+        for (auto it = unpollable.cbegin(); it != unpollable.cend(); ++it)
+            markPendingSocketNotifiers(it.key(), it.value(), alreadyPending);
+    }
+
+    return nevents;
+}
+
+int QEventDispatcherEpollPrivate::activateSocketNotifiers()
+{
+    if (pendingNotifiers.isEmpty())
+        return 0;
+
+    int n_activated = 0;
+    QEvent event(QEvent::SockAct);
+
+    while (!pendingNotifiers.isEmpty()) {
+        QSocketNotifier *notifier = pendingNotifiers.takeFirst();
+        QCoreApplication::sendEvent(notifier, &event);
+        ++n_activated;
+    }
+
+    return n_activated;
+}
+
+QEventDispatcherEpoll::QEventDispatcherEpoll(QObject *parent)
+    : QAbstractEventDispatcherV2(*new QEventDispatcherEpollPrivate, parent)
+{ }
+
+QEventDispatcherEpoll::QEventDispatcherEpoll(QEventDispatcherEpollPrivate &dd, QObject *parent)
+    : QAbstractEventDispatcherV2(dd, parent)
+{ }
+
+QEventDispatcherEpoll::~QEventDispatcherEpoll()
+{ }
+
+/*!
+    \internal
+*/
+void QEventDispatcherEpoll::registerTimer(Qt::TimerId timerId, Duration interval, Qt::TimerType timerType, QObject *obj)
+{
+#ifndef QT_NO_DEBUG
+    if (qToUnderlying(timerId) < 1 || interval.count() < 0 || !obj) {
+        qWarning("QEventDispatcherEpoll::registerTimer: invalid arguments");
+        return;
+    } else if (obj->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherEpoll::registerTimer: timers cannot be started from another thread");
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    d->timerList.registerTimer(timerId, interval, timerType, obj);
+}
+
+/*!
+    \internal
+*/
+bool QEventDispatcherEpoll::unregisterTimer(Qt::TimerId timerId)
+{
+#ifndef QT_NO_DEBUG
+    if (qToUnderlying(timerId) < 1) {
+        qWarning("QEventDispatcherEpoll::unregisterTimer: invalid argument");
+        return false;
+    } else if (thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherEpoll::unregisterTimer: timers cannot be stopped from another thread");
+        return false;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    return d->timerList.unregisterTimer(timerId);
+}
+
+/*!
+    \internal
+*/
+bool QEventDispatcherEpoll::unregisterTimers(QObject *object)
+{
+#ifndef QT_NO_DEBUG
+    if (!object) {
+        qWarning("QEventDispatcherEpoll::unregisterTimers: invalid argument");
+        return false;
+    } else if (object->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherEpoll::unregisterTimers: timers cannot be stopped from another thread");
+        return false;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    return d->timerList.unregisterTimers(object);
+}
+
+QList<QEventDispatcherEpoll::TimerInfoV2>
+QEventDispatcherEpoll::timersForObject(QObject *object) const
+{
+    if (!object) {
+        qWarning("QEventDispatcherEpoll:registeredTimers: invalid argument");
+        return QList<TimerInfoV2>();
+    }
+
+    Q_D(const QEventDispatcherEpoll);
+    return d->timerList.registeredTimers(object);
+}
+
+void QEventDispatcherEpoll::registerSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    int sockfd = notifier->socket();
+    QSocketNotifier::Type type = notifier->type();
+#ifndef QT_NO_DEBUG
+    if (notifier->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QSocketNotifier: socket notifiers cannot be enabled from another thread");
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    QSocketNotifierSetUNIX &sn_set = d->socketNotifiers[sockfd];
+    const short oldEvents = sn_set.events();
+
+    if (sn_set.notifiers[type] && sn_set.notifiers[type] != notifier)
+        qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
+                 Q_FUNC_INFO, sockfd, socketType(type));
+
+    sn_set.notifiers[type] = notifier;
+    d->updateInterest(sockfd, oldEvents, sn_set.events());
+}
+
+void QEventDispatcherEpoll::unregisterSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    int sockfd = notifier->socket();
+    QSocketNotifier::Type type = notifier->type();
+#ifndef QT_NO_DEBUG
+    if (notifier->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QSocketNotifier: socket notifier (fd %d) cannot be disabled from another thread.\n"
+                "(Notifier's thread is %s(%p), event dispatcher's thread is %s(%p), current thread is %s(%p))",
+                sockfd,
+                notifier->thread() ? notifier->thread()->metaObject()->className() : "QThread", notifier->thread(),
+                thread() ? thread()->metaObject()->className() : "QThread", thread(),
+                QThread::currentThread() ? QThread::currentThread()->metaObject()->className() : "QThread", QThread::currentThread());
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+
+    d->pendingNotifiers.removeOne(notifier);
+
+    auto i = d->socketNotifiers.find(sockfd);
+    if (i == d->socketNotifiers.end())
+        return;
+
+    QSocketNotifierSetUNIX &sn_set = i.value();
+
+    if (sn_set.notifiers[type] == nullptr)
+        return;
+
+    if (sn_set.notifiers[type] != notifier) {
+        qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
+                 Q_FUNC_INFO, sockfd, socketType(type));
+        return;
+    }
+
+    const short oldEvents = sn_set.events();
+    sn_set.notifiers[type] = nullptr;
+    d->updateInterest(sockfd, oldEvents, sn_set.events());
+
+    if (sn_set.isEmpty())
+        d->socketNotifiers.erase(i);
+}
+
+bool QEventDispatcherEpoll::processEvents(QEventLoop::ProcessEventsFlags flags)
+{
+    Q_D(QEventDispatcherEpoll);
+    d->interrupt.storeRelaxed(0);
+
+    // we are awake, broadcast it
+    emit awake();
+
+    auto threadData = d->threadData.loadRelaxed();
+    QCoreApplicationPrivate::sendPostedEvents(nullptr, 0, threadData);
+
+    const bool include_timers = (flags & QEventLoop::X11ExcludeTimers) == 0;
+    const bool include_notifiers = (flags & QEventLoop::ExcludeSocketNotifiers) == 0;
+    const bool wait_for_events = (flags & QEventLoop::WaitForMoreEvents) != 0;
+
+    const bool canWait = (threadData->canWaitLocked()
+                          && !d->interrupt.loadRelaxed()
+                          && wait_for_events);
+
+    if (canWait)
+        emit aboutToBlock();
+
+    if (d->interrupt.loadRelaxed())
+        return false;
+
+    QDeadlineTimer deadline;
+    if (canWait && !(include_notifiers && !d->unpollableFds.isEmpty())) {
+        if (include_timers) {
+            std::optional<nanoseconds> remaining = d->timerList.timerWait();
+            deadline = remaining ? QDeadlineTimer{*remaining}
+                             : QDeadlineTimer(QDeadlineTimer::Forever);
+        } else {
+            deadline = QDeadlineTimer(QDeadlineTimer::Forever);
+        }
+    } else {
+        // Using the default-constructed `deadline`, which is already expired,
+        // makes us only collect what is ready right now. That includes the
+        // case of descriptors epoll can't watch, which poll() would report
+        // as ready immediately.
+    }
+
+    int nevents = 0;
+    int ret;
+    if (include_notifiers) {
+        epoll_event events[QEventDispatcherEpollPrivate::MaxEventsPerWait];
+        ret = qt_safe_epoll_wait(d->epollFd, events, QEventDispatcherEpollPrivate::MaxEventsPerWait,
+                                 deadline);
+        if (ret >= 0) {
+            nevents += d->processReadyEvents(events, ret);
+            nevents += d->activateSocketNotifiers();
+        }
+    } else {
+        // the notifiers stay in the interest set, so only wait for a wake-up
+        pollfd pfd = d->threadPipe.prepare();
+        ret = qt_safe_poll(&pfd, 1, deadline);
+        if (ret > 0)
+            nevents += d->threadPipe.check(pfd);
+    }
+
+    if (ret == -1) {
+        qErrnoWarning(include_notifiers ? "epoll_wait" : "qt_safe_poll");
+        if (QT_CONFIG(poll_exit_on_error))
+            abort();
+    }
+
+    if (include_timers)
+        nevents += d->activateTimers();
+
+    // return true if we handled events, false otherwise
+    return (nevents > 0);
+}
+
+auto QEventDispatcherEpoll::remainingTime(Qt::TimerId timerId) const -> Duration
+{
+#ifndef QT_NO_DEBUG
+    if (int(timerId) < 1) {
+        qWarning("QEventDispatcherEpoll::remainingTime: invalid argument");
+        return Duration::min();
+    }
+#endif
+
+    Q_D(const QEventDispatcherEpoll);
+    return d->timerList.remainingDuration(timerId);
+}
+
+void QEventDispatcherEpoll::wakeUp()
+{
+    Q_D(QEventDispatcherEpoll);
+    d->threadPipe.wakeUp();
+}
+
+void QEventDispatcherEpoll::interrupt()
+{
+    Q_D(QEventDispatcherEpoll);
+    d->interrupt.storeRelaxed(1);
+    wakeUp();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qeventdispatcher_epoll_p.cpp"
@@ -0,0 +1,295 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qeventpool_p.h"
+
+#include <QtCore/qmutex.h>
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QEventPool
+    \inmodule QtCore
+
+    QEventPool serves the allocations of short-lived objects that are
+    typically created on one thread and destroyed on another, such as the
+    events behind queued signal emissions. Classes opt in with the
+    Q_EVENT_POOL_ALLOCATED macro.
+
+    Every thread allocates from a pool of its own, which keeps a free list of
+    fixed-size blocks. A block always goes back to the pool it came from: the
+    owning thread puts it on its free list, while other threads push it onto
+    a lock-free list that the owner takes over in one go once its own free
+    list runs empty. In the common producer/consumer setup the blocks thus
+    cycle between the two threads without touching the heap.
+
+    A pool outlives its thread for as long as blocks allocated from it are in
+    use.
+*/
+
+struct QEventPool::Block
+{
+    Pool *owner;
+    Block *next;
+};
+static_assert(sizeof(QEventPool::Block) == QEventPool::BlockSize - QEventPool::MaxObjectSize);
+
+struct QEventPool::Pool
+{
+    // touched by the owning thread only
+    Block *freeList = nullptr;
+    int freeCount = 0;
+
+    // blocks returned by other threads
+    std::atomic<Block *> remoteFreeList = nullptr;
+    // one for the owning thread, one for each block that did not go back to
+    // the heap yet and one for each thread currently returning a block
+    std::atomic<qsizetype> ref = 1;
+    std::atomic<bool> ownerAlive = true;
+
+    // written by the owning thread only, read by counters()
+    std::atomic<quint64> allocations = 0;
+    std::atomic<quint64> heapAllocations = 0;
+
+    // the pools of running threads, protected by registryMutex
+    Pool *previousLive = nullptr;
+    Pool *nextLive = nullptr;
+
+    static QBasicMutex registryMutex;
+    static Pool *livePools;
+    static Counters retiredCounters;
+
+    static Pool *current();
+    Q_DECL_COLD_FUNCTION static Pool *create();
+    void retire();
+
+    void count(bool fromHeap)
+    {
+        allocations.store(allocations.load(std::memory_order_relaxed) + 1,
+                          std::memory_order_relaxed);
+        if (fromHeap) {
+            heapAllocations.store(heapAllocations.load(std::memory_order_relaxed) + 1,
+                                  std::memory_order_relaxed);
+        }
+    }
+
+    void deref(qsizetype count = 1)
+    {
+        if (ref.fetch_sub(count, std::memory_order_acq_rel) == count)
+            delete this;
+    }
+
+    Block *takeRemoteBlocks()
+    {
+        return remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    // Gives the blocks returned by other threads to the heap, once the owning
+    // thread is gone. Any number of threads may run this at the same time.
+    void releaseRemoteBlocks()
+    {
+        qsizetype count = 0;
+        for (Block *block = takeRemoteBlocks(); block; ++count) {
+            Block *next = block->next;
+            ::operator delete(block, BlockSize);
+            block = next;
+        }
+        if (count)
+            deref(count);
+    }
+
+    void pushRemote(Block *block)
+    {
+        // keeps the pool alive until we are done, even if another thread
+        // releases the block right after we pushed it
+        ref.fetch_add(1, std::memory_order_relaxed);
+        block->next = remoteFreeList.load(std::memory_order_relaxed);
+        while (!remoteFreeList.compare_exchange_weak(block->next, block, std::memory_order_seq_cst,
+                                                     std::memory_order_relaxed)) {
+        }
+        // if the owner exited in the meantime nobody else will pick the block up
+        if (!ownerAlive.load(std::memory_order_seq_cst))
+            releaseRemoteBlocks();
+        deref();
+    }
+};
+
+Q_CONSTINIT QBasicMutex QEventPool::Pool::registryMutex;
+Q_CONSTINIT QEventPool::Pool *QEventPool::Pool::livePools = nullptr;
+Q_CONSTINIT QEventPool::Counters QEventPool::Pool::retiredCounters;
+
+Q_CONSTINIT static thread_local QEventPool::Pool *currentPool = nullptr;
+Q_CONSTINIT static thread_local bool currentPoolRetired = false;
+
+namespace {
+struct PoolRetirer
+{
+    ~PoolRetirer()
+    {
+        currentPoolRetired = true;
+        if (QEventPool::Pool *pool = std::exchange(currentPool, nullptr))
+            pool->retire();
+    }
+};
+} // unnamed namespace
+
+/*!
+    \internal
+
+    Returns the pool of the calling thread, or \nullptr if the thread is
+    exiting and already gave up its pool.
+*/
+inline QEventPool::Pool *QEventPool::Pool::current()
+{
+    if (Q_LIKELY(currentPool) || currentPoolRetired)
+        return currentPool;
+    return create();
+}
+
+QEventPool::Pool *QEventPool::Pool::create()
+{
+    // the destructor of this object retires the pool when the thread exits
+    static thread_local PoolRetirer retirer;
+    Q_UNUSED(retirer);
+
+    Pool *pool = new Pool;
+    {
+        QMutexLocker locker(&registryMutex);
+        pool->nextLive = livePools;
+        if (livePools)
+            livePools->previousLive = pool;
+        livePools = pool;
+    }
+    currentPool = pool;
+    return pool;
+}
+
+/*!
+    \internal
+
+    Called when the owning thread exits. Frees the cached blocks and drops the
+    reference of the thread; blocks still in use keep the pool alive.
+*/
+void QEventPool::Pool::retire()
+{
+    {
+        QMutexLocker locker(&registryMutex);
+        if (previousLive)
+            previousLive->nextLive = nextLive;
+        else
+            livePools = nextLive;
+        if (nextLive)
+            nextLive->previousLive = previousLive;
+        retiredCounters.allocations += allocations.load(std::memory_order_relaxed);
+        retiredCounters.heapAllocations += heapAllocations.load(std::memory_order_relaxed);
+    }
+
+    qsizetype count = 0;
+    for (Block *block = std::exchange(freeList, nullptr); block; ++count) {
+        Block *next = block->next;
+        ::operator delete(block, BlockSize);
+        block = next;
+    }
+    freeCount = 0;
+
+    ownerAlive.store(false, std::memory_order_seq_cst);
+    releaseRemoteBlocks();
+    deref(count + 1);
+}
+
+/*!
+    \internal
+
+    Allocates \a size bytes. Small objects get a block from the pool of the
+    calling thread.
+*/
+void *QEventPool::allocate(size_t size)
+{
+    Pool *pool = Pool::current();
+    if (size > MaxObjectSize) {
+        if (pool)
+            pool->count(true);
+        return ::operator new(size);
+    }
+
+    Block *block = nullptr;
+    if (Q_LIKELY(pool)) {
+        block = pool->freeList;
+        if (!block) {
+            block = pool->takeRemoteBlocks();
+            for (Block *b = block; b; b = b->next)
+                ++pool->freeCount;
+        }
+        if (block) {
+            pool->freeList = block->next;
+            --pool->freeCount;
+            pool->count(false);
+            return block + 1;
+        }
+        pool->count(true);
+        pool->ref.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    block = static_cast<Block *>(::operator new(BlockSize));
+    block->owner = pool;
+    return block + 1;
+}
+
+/*!
+    \internal
+
+    Releases \a ptr, which was allocated by allocate() with the same \a size.
+*/
+void QEventPool::deallocate(void *ptr, size_t size) noexcept
+{
+    if (!ptr)
+        return;
+    if (size > MaxObjectSize) {
+        ::operator delete(ptr, size);
+        return;
+    }
+
+    Block *block = static_cast<Block *>(ptr) - 1;
+    Pool *owner = block->owner;
+    if (!owner) {
+        // allocated while the thread was exiting
+        ::operator delete(block, BlockSize);
+    } else if (owner == currentPool) {
+        if (owner->freeCount < MaxCachedBlocks) {
+            block->next = owner->freeList;
+            owner->freeList = block;
+            ++owner->freeCount;
+        } else {
+            ::operator delete(block, BlockSize);
+            owner->deref();
+        }
+    } else {
+        owner->pushRemote(block);
+    }
+}
+
+/*!
+    \internal
+
+    Returns the number of allocations made through the pool and how many of
+    them went to the heap, summed over all threads that ever used it. Meant
+    for benchmarks and diagnostics; the values of running threads are read
+    without synchronizing with them.
+*/
+QEventPool::Counters QEventPool::counters()
+{
+    QMutexLocker locker(&Pool::registryMutex);
+    Counters result = Pool::retiredCounters;
+    for (Pool *pool = Pool::livePools; pool; pool = pool->nextLive) {
+        result.allocations += pool->allocations.load(std::memory_order_relaxed);
+        result.heapAllocations += pool->heapAllocations.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,61 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QEVENTPOOL_P_H
+#define QEVENTPOOL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+
+#include <cstddef>
+
+QT_BEGIN_NAMESPACE
+
+class QEventPool
+{
+public:
+    // Objects up to this size are served from fixed-size blocks, the rest
+    // come straight from the heap.
+    static constexpr size_t BlockSize = 256;
+    static constexpr size_t MaxObjectSize = BlockSize - 2 * sizeof(void *);
+    // Upper bound of free blocks a thread keeps for reuse.
+    static constexpr int MaxCachedBlocks = 1024;
+
+    struct Counters
+    {
+        quint64 allocations = 0;        // objects allocated through the pool
+        quint64 heapAllocations = 0;    // of which had to go to the heap
+    };
+
+    Q_CORE_EXPORT static void *allocate(size_t size);
+    Q_CORE_EXPORT static void deallocate(void *ptr, size_t size) noexcept;
+
+    // summed over all threads, past and present
+    Q_CORE_EXPORT static Counters counters();
+
+    // defined in qeventpool.cpp
+    struct Pool;
+    struct Block;
+};
+
+// Gives a class, and all classes derived from it, a class-specific operator
+// new and delete using QEventPool. Requires a virtual destructor, so that
+// the sized operator delete gets the size of the most derived type.
+#define Q_EVENT_POOL_ALLOCATED \
+    static void *operator new(size_t size) { return QEventPool::allocate(size); } \
+    static void operator delete(void *ptr, size_t size) noexcept \
+    { QEventPool::deallocate(ptr, size); }
+
+QT_END_NAMESPACE
+
+#endif // QEVENTPOOL_P_H
@@ -683,6 +683,130 @@ inline bool QQueuedMetaCallEvent::typeFitsInPlace(const QMetaType type)
             q20::cmp_less_equal(type.alignOf(), alignof(ArgValueStorage)));
 }
 
+/*!
+    \internal
+
+    Constructs a QBatchedMetaCallEvent that invokes the slot once for each of
+    the \a batchSize argument arrays in \a argValues. The values are copied
+    using their meta-types, unless \a latch is set.
+ */
+QBatchedMetaCallEvent::QBatchedMetaCallEvent(ushort method_offset, ushort method_relative,
+                                             QObjectPrivate::StaticMetaCallFunction callFunction,
+                                             const QObject *sender, int signalId, int argCount,
+                                             const QtPrivate::QMetaTypeInterface * const *argTypes,
+                                             void **argValues, qsizetype batchSize, QLatch *latch)
+    : QMetaCallEvent(method_offset, method_relative, callFunction, sender, signalId, nullptr, latch),
+      batchSize_(batchSize)
+{
+    setArgs(argCount, argTypes, argValues, !latch);
+}
+
+/*!
+    \internal
+
+    Constructs a QBatchedMetaCallEvent that invokes the slot once for each of
+    the \a batchSize argument arrays in \a argValues. The values are copied
+    using their meta-types, unless \a latch is set.
+ */
+QBatchedMetaCallEvent::QBatchedMetaCallEvent(QtPrivate::QSlotObjectBase *slotObj,
+                                             const QObject *sender, int signalId, int argCount,
+                                             const QtPrivate::QMetaTypeInterface * const *argTypes,
+                                             void **argValues, qsizetype batchSize, QLatch *latch)
+    : QMetaCallEvent(slotObj, sender, signalId, nullptr, latch),
+      batchSize_(batchSize)
+{
+    setArgs(argCount, argTypes, argValues, !latch);
+}
+
+/*!
+    \internal
+ */
+QBatchedMetaCallEvent::~QBatchedMetaCallEvent()
+{
+    if (!ownsArgs_)
+        return;
+
+    const qsizetype pointerCount = batchSize_ * d.nargs_;
+    const QMetaType *types = reinterpret_cast<QMetaType *>(batchArgs_ + pointerCount);
+    for (qsizetype i = 0; i < batchSize_; ++i) {
+        void **args = batchArgs_ + i * d.nargs_;
+        for (int n = 1; n < d.nargs_; ++n)
+            types[n].destruct(args[n]);
+    }
+    qFreeAligned(values_);
+    free(batchArgs_);
+}
+
+/*!
+    \internal
+
+    Unlike QQueuedMetaCallEvent, which gives each value its own storage, all
+    copies are placed in one block holding a record per batch entry, so that
+    the number of allocations does not depend on the size of the batch.
+ */
+inline void QBatchedMetaCallEvent::setArgs(int argCount,
+                                           const QtPrivate::QMetaTypeInterface * const *argTypes,
+                                           void **argValues, bool copy)
+{
+    d.nargs_ = argCount;
+    if (!copy) {
+        batchArgs_ = argValues;
+        return;
+    }
+
+    // the argument pointers of every batch entry, followed by the argument types
+    const size_t pointerCount = size_t(batchSize_) * argCount;
+    void *const memory = calloc(1, pointerCount * sizeof(void *) + argCount * sizeof(QMetaType));
+    Q_CHECK_PTR(memory);
+    batchArgs_ = static_cast<void **>(memory);
+    ownsArgs_ = true;
+
+    QMetaType *types = reinterpret_cast<QMetaType *>(batchArgs_ + pointerCount);
+    QVarLengthArray<size_t, 16> offsets(argCount);
+    size_t recordSize = 0;
+    size_t recordAlignment = alignof(void *);
+    for (int n = 1; n < argCount; ++n) {
+        types[n] = QMetaType(argTypes[n]);
+        const size_t alignment = types[n].alignOf();
+        recordSize = (recordSize + alignment - 1) & ~(alignment - 1);
+        offsets[n] = recordSize;
+        recordSize += types[n].sizeOf();
+        recordAlignment = qMax(recordAlignment, alignment);
+    }
+    recordSize = (recordSize + recordAlignment - 1) & ~(recordAlignment - 1);
+
+    if (recordSize) {
+        values_ = qMallocAligned(recordSize * size_t(batchSize_), recordAlignment);
+        Q_CHECK_PTR(values_);
+    }
+
+    char *record = static_cast<char *>(values_);
+    for (qsizetype i = 0; i < batchSize_; ++i, record += recordSize) {
+        void **args = batchArgs_ + i * argCount;
+        void *const *values = argValues + i * argCount;
+        args[0] = nullptr; // no return value
+        for (int n = 1; n < argCount; ++n) {
+            args[n] = record + offsets[n];
+            types[n].construct(args[n], values[n]);
+        }
+    }
+}
+
+/*!
+    \internal
+ */
+void QBatchedMetaCallEvent::placeMetaCall(QObject *object)
+{
+    // a slot may delete the receiver, in which case the rest of the batch is dropped
+    QPointer<QObject> guard(batchSize_ > 1 ? object : nullptr);
+    for (qsizetype i = 0; i < batchSize_; ++i) {
+        if (i && !guard)
+            break;
+        d.args_ = batchArgs_ + i * d.nargs_;
+        QMetaCallEvent::placeMetaCall(object);
+    }
+}
+
 /*!
     \class QSignalBlocker
     \brief Exception-safe wrapper around QObject::blockSignals().
@@ -1755,6 +1879,10 @@ bool QObject::moveToThread(QThread *targetThread QT6_IMPL_NEW_OVERLOAD_TAIL)
 
     QOrderedMutexLocker locker(&currentData->postEventList.mutex,
                                &targetData->postEventList.mutex);
+    // the events posted to this object without the mutex need to be in the
+    // list to be moved, and no more may arrive until the move is complete
+    currentData->postEventList.blockPendingEvents();
+    targetData->postEventList.takePendingEvents();
 
     // keep currentData alive (since we've got it locked)
     currentData->ref();
@@ -1770,6 +1898,7 @@ bool QObject::moveToThread(QThread *targetThread QT6_IMPL_NEW_OVERLOAD_TAIL)
         bindingStatus = threadPrivate->addObjectWithPendingBindingStatusChange(this);
     }
     d_func()->setThreadData_helper(currentData, targetData, bindingStatus);
+    currentData->postEventList.unblockPendingEvents();
 
     locker.unlock();
 
@@ -4187,9 +4316,10 @@ private:
 /*!
     \internal
 
-    \a signal must be in the signal index range (see QObjectPrivate::signalIndex()).
+    Returns the zero-terminated argument type ids of the queued connection \a c
+    to \a signal, or \nullptr if its arguments cannot be queued.
 */
-static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connection *c, void **argv)
+static const int *queuedArgumentTypes(QObject *sender, int signal, QObjectPrivate::Connection *c)
 {
     const int *argumentTypes = c->argumentTypes.loadRelaxed();
     if (!argumentTypes) {
@@ -4204,10 +4334,31 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
         }
     }
     if (argumentTypes == &DIRECT_CONNECTION_ONLY) // cannot activate
+        return nullptr;
+    return argumentTypes;
+}
+
+/*!
+    \internal
+
+    Posts an event to the receiver of \a c that delivers the emission with
+    the arguments \a argv. If \a batchSize is larger than one, \a argv holds
+    that many argument arrays of \a argc entries each, and a single event
+    delivers all of them; single shot connections don't get batches.
+
+    \a signal must be in the signal index range (see QObjectPrivate::signalIndex()).
+*/
+static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connection *c, void **argv,
+                            int argc = 0, qsizetype batchSize = 1)
+{
+    Q_ASSERT(batchSize == 1 || !c->isSingleShot);
+    const int *argumentTypes = queuedArgumentTypes(sender, signal, c);
+    if (!argumentTypes)
         return;
     int nargs = 1; // include return type
     while (argumentTypes[nargs - 1])
         ++nargs;
+    Q_ASSERT(batchSize == 1 || nargs == argc);
 
     QMutexLocker locker(signalSlotLock(c->receiver.loadRelaxed()));
     QObject *receiver = c->receiver.loadRelaxed();
@@ -4226,11 +4377,21 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
         argTypes.emplace_back(QMetaType(argumentTypes[n - 1]).iface()); // convert type ids to QMetaTypeInterfaces
     }
 
-    auto ev = c->isSlotObject ?
-        std::make_unique<QQueuedMetaCallEvent>(c->slotObj,
-                                               sender, signal, nargs, argTypes.data(), argv) :
-        std::make_unique<QQueuedMetaCallEvent>(c->method_offset, c->method_relative, c->callFunction,
-                                               sender, signal, nargs, argTypes.data(), argv);
+    std::unique_ptr<QMetaCallEvent> ev;
+    if (batchSize > 1) {
+        ev = c->isSlotObject ?
+            std::make_unique<QBatchedMetaCallEvent>(c->slotObj, sender, signal, nargs,
+                                                    argTypes.data(), argv, batchSize) :
+            std::make_unique<QBatchedMetaCallEvent>(c->method_offset, c->method_relative,
+                                                    c->callFunction, sender, signal, nargs,
+                                                    argTypes.data(), argv, batchSize);
+    } else {
+        ev = c->isSlotObject ?
+            std::make_unique<QQueuedMetaCallEvent>(c->slotObj,
+                                                   sender, signal, nargs, argTypes.data(), argv) :
+            std::make_unique<QQueuedMetaCallEvent>(c->method_offset, c->method_relative, c->callFunction,
+                                                   sender, signal, nargs, argTypes.data(), argv);
+    }
 
     if (c->isSingleShot && !QObjectPrivate::removeConnection(c)) {
         return;
@@ -4246,43 +4407,19 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
     QCoreApplication::postEvent(receiver, ev.release());
 }
 
-template <bool callbacks_enabled>
-void doActivate(QObject *sender, int signal_index, void **argv)
-{
-    QObjectPrivate *sp = QObjectPrivate::get(sender);
-
-    if (sp->blockSig)
-        return;
-
-    Q_TRACE_SCOPE(QMetaObject_activate, sender, signal_index);
-
-    if (sp->isDeclarativeSignalConnected(signal_index)
-            && QAbstractDeclarativeData::signalEmitted) {
-        Q_TRACE_SCOPE(QMetaObject_activate_declarative_signal, sender, signal_index);
-        QAbstractDeclarativeData::signalEmitted(sp->declarativeData, sender,
-                                                signal_index, argv);
-    }
-
-    const QSignalSpyCallbackSet *signal_spy_set = callbacks_enabled ? qt_signal_spy_callback_set.loadAcquire() : nullptr;
-
-    void *empty_argv[] = { nullptr };
-    if (!argv)
-        argv = empty_argv;
-
-    if (!sp->maybeSignalConnected(signal_index)) {
-        // The possible declarative connection is done, and nothing else is connected
-        if (callbacks_enabled && signal_spy_set->signal_begin_callback != nullptr)
-            signal_spy_set->signal_begin_callback(sender, signal_index, argv);
-        if (callbacks_enabled && signal_spy_set->signal_end_callback != nullptr)
-            signal_spy_set->signal_end_callback(sender, signal_index);
-        return;
-    }
+/*!
+    \internal
 
-    if (callbacks_enabled && signal_spy_set->signal_begin_callback != nullptr)
-        signal_spy_set->signal_begin_callback(sender, signal_index, argv);
+    Calls \a activate for each connection of \a signal_index of \a sender
+    that existed when the emission started, passing the connection, its
+    receiver, and whether the receiver lives in the calling thread.
 
-    bool senderDeleted = false;
-    {
+    Returns \c true if \a sender was destroyed in the meantime.
+*/
+template <typename Activate>
+static inline bool forEachConnection(QObject *sender, int signal_index, Activate activate)
+{
+    QObjectPrivate *sp = QObjectPrivate::get(sender);
     Q_ASSERT(sp->connections.loadRelaxed());
     QObjectPrivate::ConnectionDataPointer connections(sp->connections.loadAcquire());
     QObjectPrivate::SignalVector *signalVector = connections->signalVector.loadRelaxed();
@@ -4322,94 +4459,178 @@ void doActivate(QObject *sender, int signal_index, void **argv)
                 receiverInSameThread = currentThreadId == td->threadId.loadRelaxed();
             }
 
+            activate(c, receiver, receiverInSameThread);
+        } while ((c = c->nextConnectionList.loadRelaxed()) != nullptr && c->id <= highestConnectionId);
 
-            // determine if this connection should be sent immediately or
-            // put into the event queue
-            if ((c->connectionType == Qt::AutoConnection && !receiverInSameThread)
-                || (c->connectionType == Qt::QueuedConnection)) {
-                queued_activate(sender, signal_index, c, argv);
-                continue;
+    } while (list != &signalVector->at(-1) &&
+        //start over for all signals;
+        ((list = &signalVector->at(-1)), true));
+
+    return connections->currentConnectionId.loadRelaxed() == 0;
+}
+
+/*!
+    \internal
+
+    Delivers an emission of \a signal_index of \a sender through the
+    connection \a c to \a receiver. With \a batched, \a argvs holds \a
+    batchSize argument arrays of \a argc entries each, see
+    QObject::emitBatch(); otherwise it is the argument array of a single
+    emission.
+*/
+template <bool callbacks_enabled, bool batched>
+static inline void activateConnection(QObject *sender, int signal_index,
+                                      QObjectPrivate::Connection *c, QObject *receiver,
+                                      bool receiverInSameThread, void **argvs,
+                                      [[maybe_unused]] int argc,
+                                      [[maybe_unused]] qsizetype batchSize,
+                                      const QSignalSpyCallbackSet *signal_spy_set)
+{
+    // a single shot connection only sees the first emission of a batch
+    qsizetype count = 1;
+    if constexpr (batched) {
+        if (!c->isSingleShot)
+            count = batchSize;
+    }
+
+    // determine if this connection should be sent immediately or
+    // put into the event queue
+    if ((c->connectionType == Qt::AutoConnection && !receiverInSameThread)
+        || (c->connectionType == Qt::QueuedConnection)) {
+        queued_activate(sender, signal_index, c, argvs, argc, count);
+        return;
 #if QT_CONFIG(thread)
-            } else if (c->connectionType == Qt::BlockingQueuedConnection) {
-                if (receiverInSameThread) {
-                    qWarning("Qt: Dead lock detected while activating a BlockingQueuedConnection: "
-                    "Sender is %s(%p), receiver is %s(%p)",
-                    sender->metaObject()->className(), sender,
-                    receiver->metaObject()->className(), receiver);
-                }
+    } else if (c->connectionType == Qt::BlockingQueuedConnection) {
+        if (receiverInSameThread) {
+            qWarning("Qt: Dead lock detected while activating a BlockingQueuedConnection: "
+            "Sender is %s(%p), receiver is %s(%p)",
+            sender->metaObject()->className(), sender,
+            receiver->metaObject()->className(), receiver);
+        }
 
-                if (c->isSingleShot && !QObjectPrivate::removeConnection(c))
-                    continue;
+        if (c->isSingleShot && !QObjectPrivate::removeConnection(c))
+            return;
 
-                QLatch latch(1);
-                {
-                    QMutexLocker locker(signalSlotLock(receiver));
-                    if (!c->isSingleShot && !c->receiver.loadAcquire())
-                        continue;
-                    QMetaCallEvent *ev = c->isSlotObject ?
-                        new QMetaCallEvent(c->slotObj, sender, signal_index, argv, &latch) :
-                        new QMetaCallEvent(c->method_offset, c->method_relative, c->callFunction,
-                                           sender, signal_index, argv, &latch);
-                    QCoreApplication::postEvent(receiver, ev);
-                }
-                latch.wait();
-                continue;
-#endif
+        QLatch latch(1);
+        {
+            QMutexLocker locker(signalSlotLock(receiver));
+            if (!c->isSingleShot && !c->receiver.loadAcquire())
+                return;
+            QMetaCallEvent *ev;
+            if (count > 1) {
+                ev = c->isSlotObject ?
+                    new QBatchedMetaCallEvent(c->slotObj, sender, signal_index,
+                                              argc, nullptr, argvs, count, &latch) :
+                    new QBatchedMetaCallEvent(c->method_offset, c->method_relative, c->callFunction,
+                                              sender, signal_index,
+                                              argc, nullptr, argvs, count, &latch);
+            } else {
+                ev = c->isSlotObject ?
+                    new QMetaCallEvent(c->slotObj, sender, signal_index, argvs, &latch) :
+                    new QMetaCallEvent(c->method_offset, c->method_relative, c->callFunction,
+                                       sender, signal_index, argvs, &latch);
             }
+            QCoreApplication::postEvent(receiver, ev);
+        }
+        latch.wait();
+        return;
+#endif
+    }
 
-            if (c->isSingleShot && !QObjectPrivate::removeConnection(c))
-                continue;
+    if (c->isSingleShot && !QObjectPrivate::removeConnection(c))
+        return;
 
-            QObjectPrivate::Sender senderData(
-                    receiverInSameThread ? receiver : nullptr, sender, signal_index,
-                    receiverInSameThread ? QObjectPrivate::get(receiver)->connections.loadAcquire() : nullptr);
+    QObjectPrivate::Sender senderData(
+            receiverInSameThread ? receiver : nullptr, sender, signal_index,
+            receiverInSameThread ? QObjectPrivate::get(receiver)->connections.loadAcquire() : nullptr);
 
-            if (c->isSlotObject) {
-                SlotObjectGuard obj{c->slotObj};
+    for (qsizetype i = 0; i < count; ++i) {
+        // stop as soon as a slot disconnected itself or deleted the receiver
+        if (i && !c->receiver.loadRelaxed())
+            break;
+        void **argv = argvs + i * argc;
 
-                {
-                    Q_TRACE_SCOPE(QMetaObject_activate_slot_functor, c->slotObj);
-                    obj->call(receiver, argv);
-                }
-            } else if (c->callFunction && c->method_offset <= receiver->metaObject()->methodOffset()) {
-                //we compare the vtable to make sure we are not in the destructor of the object.
-                const int method_relative = c->method_relative;
-                const auto callFunction = c->callFunction;
-                const int methodIndex = (Q_HAS_TRACEPOINTS || callbacks_enabled) ? c->method() : 0;
-                if (callbacks_enabled && signal_spy_set->slot_begin_callback != nullptr)
-                    signal_spy_set->slot_begin_callback(receiver, methodIndex, argv);
-
-                {
-                    Q_TRACE_SCOPE(QMetaObject_activate_slot, receiver, methodIndex);
-                    callFunction(receiver, QMetaObject::InvokeMetaMethod, method_relative, argv);
-                }
+        if (c->isSlotObject) {
+            SlotObjectGuard obj{c->slotObj};
 
-                if (callbacks_enabled && signal_spy_set->slot_end_callback != nullptr)
-                    signal_spy_set->slot_end_callback(receiver, methodIndex);
-            } else {
-                const int method = c->method_relative + c->method_offset;
+            {
+                Q_TRACE_SCOPE(QMetaObject_activate_slot_functor, c->slotObj);
+                obj->call(receiver, argv);
+            }
+        } else if (c->callFunction && c->method_offset <= receiver->metaObject()->methodOffset()) {
+            //we compare the vtable to make sure we are not in the destructor of the object.
+            const int method_relative = c->method_relative;
+            const auto callFunction = c->callFunction;
+            const int methodIndex = (Q_HAS_TRACEPOINTS || callbacks_enabled) ? c->method() : 0;
+            if (callbacks_enabled && signal_spy_set->slot_begin_callback != nullptr)
+                signal_spy_set->slot_begin_callback(receiver, methodIndex, argv);
+
+            {
+                Q_TRACE_SCOPE(QMetaObject_activate_slot, receiver, methodIndex);
+                callFunction(receiver, QMetaObject::InvokeMetaMethod, method_relative, argv);
+            }
 
-                if (callbacks_enabled && signal_spy_set->slot_begin_callback != nullptr) {
-                    signal_spy_set->slot_begin_callback(receiver, method, argv);
-                }
+            if (callbacks_enabled && signal_spy_set->slot_end_callback != nullptr)
+                signal_spy_set->slot_end_callback(receiver, methodIndex);
+        } else {
+            const int method = c->method_relative + c->method_offset;
 
-                {
-                    Q_TRACE_SCOPE(QMetaObject_activate_slot, receiver, method);
-                    QMetaObject::metacall(receiver, QMetaObject::InvokeMetaMethod, method, argv);
-                }
+            if (callbacks_enabled && signal_spy_set->slot_begin_callback != nullptr) {
+                signal_spy_set->slot_begin_callback(receiver, method, argv);
+            }
 
-                if (callbacks_enabled && signal_spy_set->slot_end_callback != nullptr)
-                    signal_spy_set->slot_end_callback(receiver, method);
+            {
+                Q_TRACE_SCOPE(QMetaObject_activate_slot, receiver, method);
+                QMetaObject::metacall(receiver, QMetaObject::InvokeMetaMethod, method, argv);
             }
-        } while ((c = c->nextConnectionList.loadRelaxed()) != nullptr && c->id <= highestConnectionId);
 
-    } while (list != &signalVector->at(-1) &&
-        //start over for all signals;
-        ((list = &signalVector->at(-1)), true));
+            if (callbacks_enabled && signal_spy_set->slot_end_callback != nullptr)
+                signal_spy_set->slot_end_callback(receiver, method);
+        }
+    }
+}
 
-        if (connections->currentConnectionId.loadRelaxed() == 0)
-            senderDeleted = true;
+template <bool callbacks_enabled>
+void doActivate(QObject *sender, int signal_index, void **argv)
+{
+    QObjectPrivate *sp = QObjectPrivate::get(sender);
+
+    if (sp->blockSig)
+        return;
+
+    Q_TRACE_SCOPE(QMetaObject_activate, sender, signal_index);
+
+    if (sp->isDeclarativeSignalConnected(signal_index)
+            && QAbstractDeclarativeData::signalEmitted) {
+        Q_TRACE_SCOPE(QMetaObject_activate_declarative_signal, sender, signal_index);
+        QAbstractDeclarativeData::signalEmitted(sp->declarativeData, sender,
+                                                signal_index, argv);
     }
+
+    const QSignalSpyCallbackSet *signal_spy_set = callbacks_enabled ? qt_signal_spy_callback_set.loadAcquire() : nullptr;
+
+    void *empty_argv[] = { nullptr };
+    if (!argv)
+        argv = empty_argv;
+
+    if (!sp->maybeSignalConnected(signal_index)) {
+        // The possible declarative connection is done, and nothing else is connected
+        if (callbacks_enabled && signal_spy_set->signal_begin_callback != nullptr)
+            signal_spy_set->signal_begin_callback(sender, signal_index, argv);
+        if (callbacks_enabled && signal_spy_set->signal_end_callback != nullptr)
+            signal_spy_set->signal_end_callback(sender, signal_index);
+        return;
+    }
+
+    if (callbacks_enabled && signal_spy_set->signal_begin_callback != nullptr)
+        signal_spy_set->signal_begin_callback(sender, signal_index, argv);
+
+    const bool senderDeleted = forEachConnection(sender, signal_index,
+            [&](QObjectPrivate::Connection *c, QObject *receiver, bool receiverInSameThread) {
+        activateConnection<callbacks_enabled, false>(sender, signal_index, c, receiver,
+                                                     receiverInSameThread, argv, 0, 1,
+                                                     signal_spy_set);
+    });
     if (!senderDeleted) {
         sp->connections.loadAcquire()->cleanOrphanedConnections(sender);
 
@@ -4418,6 +4639,32 @@ void doActivate(QObject *sender, int signal_index, void **argv)
     }
 }
 
+/*!
+    \internal
+
+    Emits \a signal_index once for each of the \a batchSize argument arrays in
+    \a argvs, each \a argc entries long. Unlike calling doActivate() in a
+    loop, the connection list is walked only once: a directly connected slot
+    is invoked for the whole batch before the next connection is looked at,
+    and a queued receiver gets a single event carrying the whole batch.
+
+    The caller takes care of signal spies and declarative connections, which
+    expect to see every emission on its own.
+*/
+static void doActivateBatch(QObject *sender, int signal_index, void **argvs, int argc,
+                            qsizetype batchSize)
+{
+    Q_TRACE_SCOPE(QMetaObject_activate, sender, signal_index);
+
+    const bool senderDeleted = forEachConnection(sender, signal_index,
+            [&](QObjectPrivate::Connection *c, QObject *receiver, bool receiverInSameThread) {
+        activateConnection<false, true>(sender, signal_index, c, receiver, receiverInSameThread,
+                                        argvs, argc, batchSize, nullptr);
+    });
+    if (!senderDeleted)
+        QObjectPrivate::get(sender)->connections.loadAcquire()->cleanOrphanedConnections(sender);
+}
+
 /*!
     \internal
  */
@@ -4457,6 +4704,93 @@ void QMetaObject::activate(QObject *sender, int signal_index, void **argv)
     activate(sender, mo, signal_index - mo->methodOffset(), argv);
 }
 
+/*!
+    \fn template <typename PointerToMemberFunction, typename... Args> void QObject::emitBatch(QObject *sender, PointerToMemberFunction signal, QSpan<const std::tuple<Args...>> batch)
+    \since 6.12
+    \threadsafe
+
+    Emits \a signal of \a sender once for each element of \a batch, using the
+    tuple elements as the signal's arguments.
+
+    This has the same effect as emitting the signal in a loop, but the
+    connections of the signal are only looked up once for the whole batch,
+    and each receiver reached through a queued connection gets a single event
+    carrying all the argument sets instead of one event per emission. This
+    makes a difference when a signal is emitted at a high rate, for instance
+    for each item of a data feed.
+
+    Each slot is invoked for all elements of \a batch, in order, before the
+    next connected slot is invoked. A slot connected with
+    Qt::SingleShotConnection is only invoked for the first element. If a slot
+    disconnects itself, or destroys the receiver, the rest of the batch is not
+    delivered to that slot.
+
+    Nothing is emitted if \a batch is empty or if the signals of \a sender are
+    blocked.
+
+    \code
+    QList<std::tuple<QString, double>> ticks = feed.takeTicks();
+    QObject::emitBatch(&quotes, &Quotes::priceChanged, ticks);
+    \endcode
+
+    \sa blockSignals()
+*/
+
+/*!
+    \internal
+
+    Resolves the \a signal pointer to member function and emits it for each
+    of the \a batchSize entries in \a batch. \a argumentsAt fills the argument
+    array for one entry; \a argumentCount is the number of signal arguments.
+*/
+void QObject::emitBatchImpl(QObject *sender, void **signal, const QMetaObject *senderMetaObject,
+                            int argumentCount, const void *batch, qsizetype batchSize,
+                            void (*argumentsAt)(const void *batch, qsizetype index, void **argv))
+{
+    if (!sender || batchSize <= 0)
+        return;
+
+    int signal_index = -1;
+    void *args[] = { &signal_index, signal };
+    for (; senderMetaObject && signal_index < 0; senderMetaObject = senderMetaObject->superClass()) {
+        senderMetaObject->static_metacall(QMetaObject::IndexOfMethod, 0, args);
+        if (signal_index >= 0 && signal_index < QMetaObjectPrivate::get(senderMetaObject)->signalCount)
+            break;
+    }
+    if (!senderMetaObject) {
+        qWarning("QObject::emitBatch: signal not found in %s", sender->metaObject()->className());
+        return;
+    }
+    signal_index += QMetaObjectPrivate::signalOffset(senderMetaObject);
+
+    QObjectPrivate *sp = QObjectPrivate::get(sender);
+    if (sp->blockSig)
+        return;
+
+    // signal spies and the declarative engine expect to see every emission on its own
+    const bool emitEach = qt_signal_spy_callback_set.loadRelaxed()
+            || (sp->isDeclarativeSignalConnected(signal_index) && QAbstractDeclarativeData::signalEmitted);
+    if (!emitEach && !sp->maybeSignalConnected(signal_index))
+        return;
+
+    const int argc = argumentCount + 1; // include return value
+    QVarLengthArray<void *, 64> argvs(batchSize * argc);
+    for (qsizetype i = 0; i < batchSize; ++i)
+        argumentsAt(batch, i, argvs.data() + i * argc);
+
+    if (Q_UNLIKELY(emitEach)) {
+        for (qsizetype i = 0; i < batchSize; ++i) {
+            if (qt_signal_spy_callback_set.loadRelaxed())
+                doActivate<true>(sender, signal_index, argvs.data() + i * argc);
+            else
+                doActivate<false>(sender, signal_index, argvs.data() + i * argc);
+        }
+        return;
+    }
+
+    doActivateBatch(sender, signal_index, argvs.data(), argc, batchSize);
+}
+
 /*!
     \internal
     Returns the signal index used in the internal connections->receivers vector.
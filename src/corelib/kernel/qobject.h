@@ -16,12 +16,15 @@
 #endif
 #include <QtCore/qscopedpointer.h>
 #include <QtCore/qmetatype.h>
+#include <QtCore/qspan.h>
 
 #include <QtCore/qobject_impl.h>
 #include <QtCore/qbindingstorage.h>
 #include <QtCore/qtcoreexports.h>
 
 #include <chrono>
+#include <tuple>
+#include <utility>
 
 QT_BEGIN_NAMESPACE
 
@@ -284,6 +287,25 @@ public:
 #endif // QT_NO_CONTEXTLESS_CONNECT
 #endif //Q_QDOC
 
+#ifdef Q_QDOC
+    template<typename PointerToMemberFunction, typename... Args>
+    static void emitBatch(QObject *sender, PointerToMemberFunction signal, QSpan<const std::tuple<Args...>> batch);
+#else
+    template <typename Func>
+    static void emitBatch(typename QtPrivate::FunctionPointer<Func>::Object *sender, Func signal,
+                          QSpan<const typename QtPrivate::SignalBatch<typename QtPrivate::FunctionPointer<Func>::Arguments>::Entry> batch)
+    {
+        typedef QtPrivate::FunctionPointer<Func> SignalType;
+        typedef QtPrivate::SignalBatch<typename SignalType::Arguments> Batch;
+
+        static_assert(QtPrivate::HasQ_OBJECT_Macro<typename SignalType::Object>::Value,
+                          "No Q_OBJECT in the class with the signal");
+
+        emitBatchImpl(sender, reinterpret_cast<void **>(&signal), &SignalType::Object::staticMetaObject,
+                      SignalType::ArgumentCount, batch.data(), batch.size(), &Batch::argumentsAt);
+    }
+#endif //Q_QDOC
+
     static bool disconnect(const QObject *sender, const char *signal,
                            const QObject *receiver, const char *member);
     static bool disconnect(const QObject *sender, const QMetaMethod &signal,
@@ -404,6 +426,10 @@ private:
     static bool disconnectImpl(const QObject *sender, void **signal, const QObject *receiver, void **slot,
                                const QMetaObject *senderMetaObject);
 
+    static void emitBatchImpl(QObject *sender, void **signal, const QMetaObject *senderMetaObject,
+                              int argumentCount, const void *batch, qsizetype batchSize,
+                              void (*argumentsAt)(const void *batch, qsizetype index, void **argv));
+
 };
 
 inline QMetaObject::Connection QObject::connect(const QObject *asender, const char *asignal,
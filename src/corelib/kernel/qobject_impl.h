@@ -35,6 +35,30 @@ namespace QtPrivate {
     { static const int *types() { return nullptr; } };
     template <typename... Args> struct ConnectionTypes<List<Args...>, true>
     { static const int *types() { static const int t[sizeof...(Args) + 1] = { (QtPrivate::QMetaTypeIdHelper<Args>::qt_metatype_id())..., 0 }; return t; } };
+
+    /*
+        SignalBatch<FunctionPointer<Signal>::Arguments>::Entry is the tuple type
+        holding the arguments of one emission in QObject::emitBatch(), and
+        argumentsAt() fills the argument array used by the activation code
+        with pointers into the entry at index in an array of such tuples.
+    */
+    template <typename ArgList> struct SignalBatch;
+    template <typename... Args> struct SignalBatch<List<Args...>>
+    {
+        using Entry = std::tuple<std::decay_t<Args>...>;
+
+        template <size_t... I>
+        static void fillArguments(const Entry &entry, void **argv, std::index_sequence<I...>)
+        {
+            ((argv[I + 1] = const_cast<void *>(static_cast<const void *>(std::addressof(std::get<I>(entry))))), ...);
+        }
+        static void argumentsAt(const void *batch, qsizetype index, void **argv)
+        {
+            argv[0] = nullptr; // no return value
+            fillArguments(static_cast<const Entry *>(batch)[index], argv,
+                          std::index_sequence_for<Args...>{});
+        }
+    };
 }
 
 
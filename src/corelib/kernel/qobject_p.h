@@ -26,6 +26,7 @@
 #include "QtCore/qproperty.h"
 #include <QtCore/qshareddata.h>
 #include "QtCore/private/qproperty_p.h"
+#include "QtCore/private/qeventpool_p.h"
 
 #include <string>
 
@@ -337,6 +338,9 @@ public:
     {}
     ~QAbstractMetaCallEvent();
 
+    // queued calls are created and destroyed at a high rate, often on different threads
+    Q_EVENT_POOL_ALLOCATED
+
     virtual void placeMetaCall(QObject *object) = 0;
 
     inline const QObject *sender() const { return sender_; }
@@ -417,6 +421,39 @@ private:
 };
 // The total QQueuedMetaCallEvent size is 224 bytes which is a 32-byte multiple, efficient for memory allocators.
 
+class Q_CORE_EXPORT QBatchedMetaCallEvent : public QMetaCallEvent
+{
+public:
+    // argValues holds batchSize consecutive argument arrays of argCount entries each.
+    // Without a latch (queued) the values are copied using argTypes, with a latch
+    // (blocking queued) they remain owned by the caller and argTypes is unused.
+    QBatchedMetaCallEvent(ushort method_offset, ushort method_relative,
+                          QObjectPrivate::StaticMetaCallFunction callFunction,
+                          const QObject *sender, int signalId,
+                          int argCount, const QtPrivate::QMetaTypeInterface * const *argTypes,
+                          void **argValues, qsizetype batchSize, QLatch *latch = nullptr);
+    QBatchedMetaCallEvent(QtPrivate::QSlotObjectBase *slotObj,
+                          const QObject *sender, int signalId,
+                          int argCount, const QtPrivate::QMetaTypeInterface * const *argTypes,
+                          void **argValues, qsizetype batchSize, QLatch *latch = nullptr);
+
+    ~QBatchedMetaCallEvent() override;
+
+    void placeMetaCall(QObject *object) override;
+
+    qsizetype batchSize() const { return batchSize_; }
+
+private:
+    inline void setArgs(int argCount, const QtPrivate::QMetaTypeInterface * const *argTypes,
+                        void **argValues, bool copy);
+
+    void **batchArgs_ = nullptr;
+    // copied argument values: one record per batch entry, allocated in a single block
+    void *values_ = nullptr;
+    qsizetype batchSize_;
+    bool ownsArgs_ = false;
+};
+
 struct QAbstractDynamicMetaObject;
 struct Q_CORE_EXPORT QDynamicMetaObjectData
 {
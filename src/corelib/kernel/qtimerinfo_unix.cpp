@@ -4,6 +4,7 @@
 
 #include <qelapsedtimer.h>
 #include <qcoreapplication.h>
+#include <qvarlengtharray.h>
 
 #include "private/qcore_unix_p.h"
 #include "private/qtimerinfo_unix_p.h"
@@ -37,7 +38,7 @@ steady_clock::time_point QTimerInfoList::updateCurrentTime() const
     Updates the currentTime member to the current time, and returns \c true if
     the first timer's timeout is in the future (after currentTime).
 
-    The list is sorted by timeout, thus it's enough to check the first timer only.
+    The heap is ordered by timeout, thus it's enough to check its root only.
 */
 bool QTimerInfoList::hasPendingTimers()
 {
@@ -46,16 +47,120 @@ bool QTimerInfoList::hasPendingTimers()
     return updateCurrentTime() < timers.at(0)->timeout;
 }
 
-static bool byTimeout(const QTimerInfo *a, const QTimerInfo *b)
-{ return a->timeout < b->timeout; };
+void QTimerInfoList::heapSiftUp(qsizetype i)
+{
+    QTimerInfo *t = timers.at(i);
+    while (i > 0) {
+        const qsizetype parent = heapParent(i);
+        QTimerInfo *p = timers.at(parent);
+        if (!isEarlier(t, p))
+            break;
+        timers[i] = p;
+        p->heapIndex = i;
+        i = parent;
+    }
+    timers[i] = t;
+    t->heapIndex = i;
+}
+
+void QTimerInfoList::heapSiftDown(qsizetype i)
+{
+    const qsizetype size = timers.size();
+    QTimerInfo *t = timers.at(i);
+    for (;;) {
+        const qsizetype first = heapFirstChild(i);
+        if (first >= size)
+            break;
+        const qsizetype last = std::min(first + HeapArity, size);
+        qsizetype earliest = first;
+        for (qsizetype c = first + 1; c < last; ++c) {
+            if (isEarlier(timers.at(c), timers.at(earliest)))
+                earliest = c;
+        }
+        QTimerInfo *child = timers.at(earliest);
+        if (!isEarlier(child, t))
+            break;
+        timers[i] = child;
+        child->heapIndex = i;
+        i = earliest;
+    }
+    timers[i] = t;
+    t->heapIndex = i;
+}
+
+void QTimerInfoList::heapRemove(QTimerInfo *t)
+{
+    const qsizetype i = t->heapIndex;
+    Q_ASSERT(i >= 0 && i < timers.size() && timers.at(i) == t);
+    QTimerInfo *last = timers.takeLast();
+    t->heapIndex = -1;
+    if (last == t)
+        return;
+
+    timers[i] = last;
+    last->heapIndex = i;
+    if (i > 0 && isEarlier(last, timers.at(heapParent(i))))
+        heapSiftUp(i);
+    else
+        heapSiftDown(i);
+}
+
+/*
+    Moves \a t to its new place after its timeout was pushed into the
+    future. Like an insertion, it goes after any timers with the same
+    timeout.
+*/
+void QTimerInfoList::heapReschedule(QTimerInfo *t)
+{
+    t->sequence = nextSequence++;
+    heapSiftDown(t->heapIndex);
+}
+
+/*
+    Restores the heap property after arbitrary timers were removed from it.
+*/
+void QTimerInfoList::heapRebuild()
+{
+    for (qsizetype i = 0; i < timers.size(); ++i)
+        timers.at(i)->heapIndex = i;
+    for (qsizetype i = heapParent(timers.size() - 1); i >= 0; --i)
+        heapSiftDown(i);
+}
+
+/*
+    Returns the number of timers whose timeout is not after \a now. Only the
+    part of the heap holding them needs to be visited.
+*/
+qsizetype QTimerInfoList::countExpiredTimers(steady_clock::time_point now) const
+{
+    if (timers.isEmpty() || now < timers.constFirst()->timeout)
+        return 0;
+
+    qsizetype count = 0;
+    QVarLengthArray<qsizetype, 64> pending = { 0 };
+    while (!pending.isEmpty()) {
+        const qsizetype i = pending.last();
+        pending.removeLast();
+        ++count;
+        const qsizetype first = heapFirstChild(i);
+        const qsizetype last = std::min(first + HeapArity, timers.size());
+        for (qsizetype c = first; c < last; ++c) {
+            if (!(now < timers.at(c)->timeout))
+                pending.append(c);
+        }
+    }
+    return count;
+}
 
 /*
   insert timer info into list
 */
 void QTimerInfoList::timerInsert(QTimerInfo *ti)
 {
-    timers.insert(std::upper_bound(timers.cbegin(), timers.cend(), ti, byTimeout),
-                  ti);
+    ti->sequence = nextSequence++;
+    timers.append(ti);
+    heapSiftUp(timers.size() - 1);
+    timersById.insert(ti->id, ti);
 }
 
 static constexpr milliseconds roundToMillisecond(nanoseconds val)
@@ -239,16 +344,34 @@ std::optional<QTimerInfoList::Duration> QTimerInfoList::timerWait()
 {
     steady_clock::time_point now = updateCurrentTime();
 
-    auto isWaiting = [](QTimerInfo *tinfo) { return !tinfo->activateRef; };
-    // Find first waiting timer not already active
-    auto it = std::find_if(timers.cbegin(), timers.cend(), isWaiting);
-    if (it == timers.cend())
-        return std::nullopt;
+    // Find first waiting timer not already active. Active timers are those
+    // being activated further up the stack, which is only ever a handful, so
+    // a best-first walk of the heap from the root ends quickly.
+    QVarLengthArray<qsizetype, 16> candidates;
+    if (!timers.isEmpty())
+        candidates.append(0);
+    while (!candidates.isEmpty()) {
+        auto earliest = std::min_element(candidates.begin(), candidates.end(),
+                                         [this](qsizetype a, qsizetype b) {
+            return isEarlier(timers.at(a), timers.at(b));
+        });
+        const qsizetype i = *earliest;
+        candidates.erase(earliest);
+
+        const QTimerInfo *t = timers.at(i);
+        if (!t->activateRef) {
+            Duration timeToWait = t->timeout - now;
+            if (timeToWait > 0ns)
+                return roundToMillisecond(timeToWait);
+            return 0ms;
+        }
 
-    Duration timeToWait = (*it)->timeout - now;
-    if (timeToWait > 0ns)
-        return roundToMillisecond(timeToWait);
-    return 0ms;
+        const qsizetype first = heapFirstChild(i);
+        const qsizetype last = std::min(first + HeapArity, timers.size());
+        for (qsizetype c = first; c < last; ++c)
+            candidates.append(c);
+    }
+    return std::nullopt;
 }
 
 /*
@@ -260,15 +383,14 @@ QTimerInfoList::Duration QTimerInfoList::remainingDuration(Qt::TimerId timerId)
 {
     const steady_clock::time_point now = updateCurrentTime();
 
-    auto it = findTimerById(timerId);
-    if (it == timers.cend()) {
+    const QTimerInfo *t = findTimerById(timerId);
+    if (!t) {
 #ifndef QT_NO_DEBUG
         qWarning("QTimerInfoList::timerRemainingTime: timer id %i not found", int(timerId));
 #endif
         return Duration::min();
     }
 
-    const QTimerInfo *t = *it;
     if (now < t->timeout) // time to wait
         return t->timeout - now;
     return 0ms;
@@ -319,18 +441,17 @@ void QTimerInfoList::registerTimer(Qt::TimerId timerId, QTimerInfoList::Duration
 
 bool QTimerInfoList::unregisterTimer(Qt::TimerId timerId)
 {
-    auto it = findTimerById(timerId);
-    if (it == timers.cend())
+    QTimerInfo *t = timersById.take(timerId);
+    if (!t)
         return false; // id not found
 
     // set timer inactive
-    QTimerInfo *t = *it;
     if (t == firstTimerInfo)
         firstTimerInfo = nullptr;
     if (t->activateRef)
         *(t->activateRef) = nullptr;
+    heapRemove(t);
     delete t;
-    timers.erase(it);
     return true;
 }
 
@@ -346,6 +467,7 @@ bool QTimerInfoList::unregisterTimers(QObject *object)
                     firstTimerInfo = nullptr;
                 if (t->activateRef)
                     *(t->activateRef) = nullptr;
+                timersById.remove(t->id);
                 delete t;
                 return true;
             }
@@ -354,16 +476,25 @@ bool QTimerInfoList::unregisterTimers(QObject *object)
     };
 
     qsizetype count = timers.removeIf(associatedWith(object));
+    if (count > 0)
+        heapRebuild();
     return count > 0;
 }
 
 auto QTimerInfoList::registeredTimers(QObject *object) const -> QList<TimerInfo>
 {
-    QList<TimerInfo> list;
+    QVarLengthArray<const QTimerInfo *, 16> matching;
     for (const auto &t : timers) {
         if (t->obj == object)
-            list.emplaceBack(TimerInfo{t->interval, t->id, t->timerType});
+            matching.append(t);
     }
+    // report them in the order they are going to fire
+    std::sort(matching.begin(), matching.end(), isEarlier);
+
+    QList<TimerInfo> list;
+    list.reserve(matching.size());
+    for (const QTimerInfo *t : std::as_const(matching))
+        list.emplaceBack(TimerInfo{t->interval, t->id, t->timerType});
     return list;
 }
 
@@ -380,10 +511,7 @@ int QTimerInfoList::activateTimers()
     const steady_clock::time_point now = updateCurrentTime();
     // qDebug() << "Thread" << QThread::currentThreadId() << "woken up at" << now;
     // Find out how many timer have expired
-    auto stillActive = [&now](const QTimerInfo *t) { return now < t->timeout; };
-    // Find first one still active (list is sorted by timeout)
-    auto it = std::find_if(timers.cbegin(), timers.cend(), stillActive);
-    auto maxCount = it - timers.cbegin();
+    auto maxCount = countExpiredTimers(now);
 
     int n_act = 0;
     //fire the timers.
@@ -407,13 +535,7 @@ int QTimerInfoList::activateTimers()
 
         // determine next timeout time
         calculateNextTimeout(currentTimerInfo, now);
-        if (timers.size() > 1) {
-            // Find where "currentTimerInfo" should be in the list so as
-            // to keep the list ordered by timeout
-            auto afterCurrentIt = timers.begin() + 1;
-            auto iter = std::upper_bound(afterCurrentIt, timers.end(), currentTimerInfo, byTimeout);
-            currentTimerInfo = *std::rotate(timers.begin(), afterCurrentIt, iter);
-        }
+        heapReschedule(currentTimerInfo);
 
         if (currentTimerInfo->interval > 0ms)
             n_act++;
@@ -18,6 +18,7 @@
 #include <QtCore/private/qglobal_p.h>
 
 #include "qabstracteventdispatcher.h"
+#include "qhash.h"
 
 #include <sys/time.h> // struct timespec
 #include <chrono>
@@ -40,6 +41,8 @@ struct QTimerInfo
     Qt::TimerType timerType; // - timer type
     QObject *obj = nullptr; // - object to receive event
     QTimerInfo **activateRef = nullptr; // - ref from activateTimers
+    qsizetype heapIndex = -1;   // - position in QTimerInfoList's heap
+    quint64 sequence = 0;       // - orders timers with equal timeouts
 };
 
 class Q_CORE_EXPORT QTimerInfoList
@@ -69,24 +72,45 @@ public:
     {
         qDeleteAll(timers);
         timers.clear();
+        timersById.clear();
     }
 
     bool isEmpty() const { return timers.empty(); }
 
     qsizetype size() const { return timers.size(); }
 
-    auto findTimerById(Qt::TimerId timerId) const
+    QTimerInfo *findTimerById(Qt::TimerId timerId) const
     {
-        auto matchesId = [timerId](const auto &t) { return t->id == timerId; };
-        return std::find_if(timers.cbegin(), timers.cend(), matchesId);
+        return timersById.value(timerId);
     }
 
 private:
     std::chrono::steady_clock::time_point updateCurrentTime() const;
 
+    // The timers are kept in a d-ary min-heap ordered by timeout (and
+    // insertion order, for equal timeouts). Each QTimerInfo knows its
+    // position in the heap, so that it can be removed or rescheduled in
+    // O(log n) after an O(1) lookup by id.
+    static constexpr qsizetype HeapArity = 4;
+    static constexpr qsizetype heapParent(qsizetype i) { return (i - 1) / HeapArity; }
+    static constexpr qsizetype heapFirstChild(qsizetype i) { return i * HeapArity + 1; }
+    static bool isEarlier(const QTimerInfo *a, const QTimerInfo *b)
+    {
+        return a->timeout < b->timeout
+                || (a->timeout == b->timeout && a->sequence < b->sequence);
+    }
+    void heapSiftUp(qsizetype i);
+    void heapSiftDown(qsizetype i);
+    void heapRemove(QTimerInfo *t);
+    void heapReschedule(QTimerInfo *t);
+    void heapRebuild();
+    qsizetype countExpiredTimers(std::chrono::steady_clock::time_point now) const;
+
     // state variables used by activateTimers()
     QTimerInfo *firstTimerInfo = nullptr;
     QList<QTimerInfo *> timers;
+    QHash<Qt::TimerId, QTimerInfo *> timersById;
+    quint64 nextSequence = 0;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,905 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:critical reason:data-parser
+
+#include "qcbordocumentview.h"
+
+#include "qcborarray.h"
+#include "qcbormap.h"
+#include "qdocumentview_p.h"
+
+#include <QtCore/qendian.h>
+#include <QtCore/qfloat16.h>
+#include <private/qstringconverter_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QCborDocumentView
+    \inmodule QtCore
+    \ingroup cbor
+    \ingroup shared
+    \ingroup qtserialization
+    \reentrant
+    \since 6.12
+
+    \brief The QCborDocumentView class provides read-only access to a CBOR
+    item without decoding it.
+
+    QCborValue::fromCbor() decodes every item and copies every string, which
+    is wasted work when only a few fields of a large document are read.
+    QCborDocumentView instead validates the data once and builds a compact
+    index of where each item is. Items are then accessed through
+    QCborValueView, which refers to the original bytes: numbers are decoded
+    during validation, and strings are only copied when they are read as
+    QString or QByteArray.
+
+    The data is held by a QByteArray, which is not copied, so a memory-mapped
+    file can be viewed by wrapping the mapping with QByteArray::fromRawData().
+    The mapping must then outlive the document view and all views obtained
+    from it.
+
+    The data must consist of exactly one CBOR item. Lookups by key are
+    linear in the number of pairs of the map; if a map has duplicate keys,
+    a lookup finds the last one.
+
+    \sa QCborValueView, QCborValue, QJsonDocumentView
+*/
+
+/*!
+    \class QCborValueView
+    \inmodule QtCore
+    \ingroup cbor
+    \ingroup qtserialization
+    \reentrant
+    \since 6.12
+
+    \brief The QCborValueView class refers to an item in a QCborDocumentView.
+
+    QCborValueView has an API similar to QCborValue, but maps and arrays are
+    accessed in place through operator[]() and iteration instead of through
+    QCborMap and QCborArray. Looking up a missing key or an index out of
+    range, or any lookup on an item that isn't a container, returns a view
+    for which isUndefined() is \c true, so lookups can be chained.
+
+    Tags are reported as such: the extended types that QCborValue recognizes,
+    like QCborValue::DateTime, are only created by toCborValue().
+
+    QCborValueView is a lightweight reference, like QStringView: it is only
+    valid as long as the QCborDocumentView it came from, or a copy of it,
+    exists.
+
+    \sa QCborDocumentView
+*/
+
+/*!
+    \class QCborValueView::const_iterator
+    \inmodule QtCore
+    \since 6.12
+
+    \brief The QCborValueView::const_iterator class iterates over the
+    contents of an array or map view.
+
+    Dereferencing the iterator returns the value; for maps, key() returns the
+    key.
+*/
+
+using Element = QDocumentViewPrivate::Element;
+using Kind = QDocumentViewPrivate::Kind;
+
+namespace {
+// same limit as QCborValue::fromCbor()
+constexpr int MaximumRecursionDepth = 1024;
+
+constexpr uchar BreakByte = 0xff;
+
+bool decodeHeader(const uchar *&p, const uchar *end, quint8 *major, quint8 *info, quint64 *value)
+{
+    if (p == end)
+        return false;
+    const uchar initial = *p++;
+    *major = initial >> 5;
+    *info = initial & 0x1f;
+    *value = *info;
+
+    qsizetype extra = 0;
+    switch (*info) {
+    case 24: extra = 1; break;
+    case 25: extra = 2; break;
+    case 26: extra = 4; break;
+    case 27: extra = 8; break;
+    }
+    if (end - p < extra)
+        return false;
+    switch (extra) {
+    case 1: *value = p[0]; break;
+    case 2: *value = qFromBigEndian<quint16>(p); break;
+    case 4: *value = qFromBigEndian<quint32>(p); break;
+    case 8: *value = qFromBigEndian<quint64>(p); break;
+    }
+    p += extra;
+    return true;
+}
+
+class CborIndexer
+{
+public:
+    explicit CborIndexer(QDocumentViewPrivate *d)
+        : begin(reinterpret_cast<const uchar *>(d->data.constData())),
+          p(begin), end(begin + d->data.size()), errorPosition(begin), builder(d)
+    {}
+
+    bool parse(QCborParserError *error);
+
+private:
+    bool parseItem(int depth);
+    bool parseString(Kind kind, quint8 major, quint8 info, quint64 length, const uchar *item);
+    bool parseContainer(Kind kind, quint8 info, quint64 count, int depth);
+    bool add(Kind kind, qint64 value = 0, quint64 offset = 0, quint8 flags = 0)
+    {
+        if (builder.add(kind, value, offset, flags) < 0)
+            return fail(QCborError::DataTooLarge);
+        return true;
+    }
+    bool fail(QCborError::Code code)
+    {
+        lastError = code;
+        return false;
+    }
+
+    const uchar *begin;
+    const uchar *p;
+    const uchar *end;
+    const uchar *errorPosition;
+    QCborError::Code lastError = QCborError::NoError;
+    QDocumentViewBuilder builder;
+};
+
+bool CborIndexer::parse(QCborParserError *error)
+{
+    bool ok = parseItem(0);
+    if (ok && p != end) {
+        errorPosition = p;
+        ok = fail(QCborError::GarbageAtEnd);
+    }
+    if (ok)
+        builder.finish();
+
+    if (error) {
+        error->error = { lastError };
+        error->offset = (ok ? p : errorPosition) - begin;
+    }
+    return ok;
+}
+
+bool CborIndexer::parseItem(int depth)
+{
+    const uchar *const item = p;
+    errorPosition = item;
+
+    quint8 major, info;
+    quint64 value;
+    if (!decodeHeader(p, end, &major, &info, &value))
+        return fail(QCborError::EndOfFile);
+    if (info >= 28 && info <= 30)
+        return fail(major == 7 ? QCborError::UnknownType : QCborError::IllegalNumber);
+    if (info == 31) {
+        if (major == 7)
+            return fail(QCborError::UnexpectedBreak);
+        if (major == 0 || major == 1 || major == 6)
+            return fail(QCborError::IllegalNumber);
+    }
+
+    switch (major) {
+    case 0:
+        // same conversion as QCborValue for integers that don't fit in qint64
+        if (qint64(value) < 0)
+            return add(QDocumentViewPrivate::Double, QDocumentViewPrivate::fromDouble(double(value)));
+        return add(QDocumentViewPrivate::Integer, qint64(value));
+
+    case 1:
+        if (qint64(value) < 0) {
+            return add(QDocumentViewPrivate::Double,
+                       QDocumentViewPrivate::fromDouble(-(double(value) + 1)));
+        }
+        return add(QDocumentViewPrivate::Integer, -1 - qint64(value));
+
+    case 2:
+        return parseString(QDocumentViewPrivate::ByteArray, major, info, value, item);
+    case 3:
+        return parseString(QDocumentViewPrivate::String, major, info, value, item);
+
+    case 4:
+        return parseContainer(QDocumentViewPrivate::Array, info, value, depth);
+    case 5:
+        return parseContainer(QDocumentViewPrivate::Map, info, value, depth);
+
+    case 6:
+        if (depth >= MaximumRecursionDepth)
+            return fail(QCborError::NestingTooDeep);
+        if (!add(QDocumentViewPrivate::Tag, qint64(value)) || !parseItem(depth + 1))
+            return false;
+        builder.detachLast();
+        return true;
+    }
+
+    switch (info) {
+    case 20:
+        return add(QDocumentViewPrivate::False);
+    case 21:
+        return add(QDocumentViewPrivate::True);
+    case 22:
+        return add(QDocumentViewPrivate::Null);
+    case 23:
+        return add(QDocumentViewPrivate::Undefined);
+    case 24:
+        if (value < 32)
+            return fail(QCborError::IllegalSimpleType);
+        return add(QDocumentViewPrivate::SimpleType, qint64(value));
+    case 25: {
+        const quint16 bits = quint16(value);
+        qfloat16 f;
+        memcpy(static_cast<void *>(&f), &bits, sizeof(f));
+        return add(QDocumentViewPrivate::Double, QDocumentViewPrivate::fromDouble(double(f)));
+    }
+    case 26: {
+        const quint32 bits = quint32(value);
+        float f;
+        memcpy(&f, &bits, sizeof(f));
+        return add(QDocumentViewPrivate::Double, QDocumentViewPrivate::fromDouble(double(f)));
+    }
+    case 27:
+        return add(QDocumentViewPrivate::Double, qint64(value));
+    }
+    return add(QDocumentViewPrivate::SimpleType, qint64(value));
+}
+
+bool CborIndexer::parseString(Kind kind, quint8 major, quint8 info, quint64 length,
+                              const uchar *item)
+{
+    const auto validate = [&](QByteArrayView chunk, quint8 *flags) {
+        if (kind != QDocumentViewPrivate::String)
+            return true;
+        const auto validation = QUtf8::isValidUtf8(chunk);
+        if (!validation.isValidUtf8)
+            return fail(QCborError::InvalidUtf8String);
+        if (!validation.isValidAscii)
+            *flags &= ~QDocumentViewPrivate::StringIsAscii;
+        return true;
+    };
+
+    quint8 flags = kind == QDocumentViewPrivate::String ? QDocumentViewPrivate::StringIsAscii : 0;
+    if (info != 31) {
+        if (length > quint64(end - p))
+            return fail(QCborError::EndOfFile);
+        const QByteArrayView contents(p, qsizetype(length));
+        if (!validate(contents, &flags))
+            return false;
+        const quint64 offset = p - begin;
+        p += length;
+        return add(kind, qint64(length), offset, flags);
+    }
+
+    // indefinite length: definite-length chunks of the same type, up to a break
+    flags |= QDocumentViewPrivate::StringIsChunked;
+    qint64 total = 0;
+    while (true) {
+        if (p == end)
+            return fail(QCborError::EndOfFile);
+        if (*p == BreakByte) {
+            ++p;
+            break;
+        }
+        errorPosition = p;
+        quint8 chunkMajor, chunkInfo;
+        quint64 chunkLength;
+        if (!decodeHeader(p, end, &chunkMajor, &chunkInfo, &chunkLength))
+            return fail(QCborError::EndOfFile);
+        if (chunkMajor != major)
+            return fail(QCborError::IllegalType);
+        if (chunkInfo >= 28)
+            return fail(QCborError::IllegalNumber);
+        if (chunkLength > quint64(end - p))
+            return fail(QCborError::EndOfFile);
+        if (!validate(QByteArrayView(p, qsizetype(chunkLength)), &flags))
+            return false;
+        p += chunkLength;
+        total += qint64(chunkLength);
+    }
+    return add(kind, total, quint64(item - begin), flags);
+}
+
+bool CborIndexer::parseContainer(Kind kind, quint8 info, quint64 count, int depth)
+{
+    if (depth >= MaximumRecursionDepth)
+        return fail(QCborError::NestingTooDeep);
+
+    const qsizetype index = builder.add(kind);
+    if (index < 0)
+        return fail(QCborError::DataTooLarge);
+    const qsizetype mark = builder.openContainer();
+    const int itemsPerEntry = kind == QDocumentViewPrivate::Map ? 2 : 1;
+
+    if (info == 31) {
+        while (true) {
+            if (p == end)
+                return fail(QCborError::EndOfFile);
+            if (*p == BreakByte) {
+                ++p;
+                break;
+            }
+            for (int i = 0; i < itemsPerEntry; ++i) {
+                if (i && p < end && *p == BreakByte) {
+                    errorPosition = p;
+                    return fail(QCborError::UnexpectedBreak);
+                }
+                if (!parseItem(depth + 1))
+                    return false;
+            }
+        }
+    } else {
+        // every item takes at least one byte
+        if (count > quint64(QDocumentViewPrivate::MaxElements) / itemsPerEntry)
+            return fail(QCborError::DataTooLarge);
+        if (count > quint64(end - p) / itemsPerEntry)
+            return fail(QCborError::EndOfFile);
+        for (quint64 i = 0; i < count * itemsPerEntry; ++i) {
+            if (!parseItem(depth + 1))
+                return false;
+        }
+    }
+
+    builder.closeContainer(index, mark);
+    return true;
+}
+
+// Concatenates the chunks of an indefinite-length string validated by CborIndexer
+QByteArray joinChunks(const QDocumentViewPrivate *d, const Element &e)
+{
+    QByteArray result;
+    result.reserve(e.value);
+    const uchar *p = reinterpret_cast<const uchar *>(d->data.constData()) + e.offset + 1;
+    const uchar *const end = reinterpret_cast<const uchar *>(d->data.constEnd());
+    while (*p != BreakByte) {
+        quint8 major, info;
+        quint64 length = 0;
+        decodeHeader(p, end, &major, &info, &length);
+        result.append(reinterpret_cast<const char *>(p), qsizetype(length));
+        p += length;
+    }
+    return result;
+}
+
+QString decodeString(const QDocumentViewPrivate *d, const Element &e)
+{
+    if (e.flags & QDocumentViewPrivate::StringIsChunked) {
+        const QByteArray utf8 = joinChunks(d, e);
+        if (e.flags & QDocumentViewPrivate::StringIsAscii)
+            return QString::fromLatin1(utf8);
+        return QString::fromUtf8(utf8);
+    }
+    if (e.flags & QDocumentViewPrivate::StringIsAscii)
+        return QString::fromLatin1(d->contents(e));
+    return QString::fromUtf8(d->contents(e));
+}
+
+bool keyEquals(const QDocumentViewPrivate *d, const Element &e, QAnyStringView key)
+{
+    if (e.kind != QDocumentViewPrivate::String)
+        return false;
+    if (e.flags & QDocumentViewPrivate::StringIsChunked)
+        return QAnyStringView::equal(decodeString(d, e), key);
+    const QByteArrayView bytes = d->contents(e);
+    if (e.flags & QDocumentViewPrivate::StringIsAscii)
+        return QAnyStringView::equal(QLatin1StringView(bytes), key);
+    return QAnyStringView::equal(QUtf8StringView(bytes), key);
+}
+
+template <typename Predicate>
+qsizetype findLastKey(const QDocumentViewPrivate *d, qsizetype index, Predicate matches)
+{
+    const Element &e = d->at(index);
+    if (e.kind != QDocumentViewPrivate::Map)
+        return -1;
+    const quint32 *entries = d->childrenBegin(e);
+    for (qsizetype i = qsizetype(e.value) - 2; i >= 0; i -= 2) {
+        if (matches(d->at(entries[i])))
+            return entries[i + 1];
+    }
+    return -1;
+}
+} // unnamed namespace
+
+/*!
+    Constructs a null document view.
+
+    \sa isNull()
+*/
+QCborDocumentView::QCborDocumentView() noexcept = default;
+
+/*!
+    Constructs a copy of \a other. The index is shared, not copied.
+*/
+QCborDocumentView::QCborDocumentView(const QCborDocumentView &other) noexcept = default;
+
+/*!
+    \fn QCborDocumentView::QCborDocumentView(QCborDocumentView &&other)
+
+    Move-constructs a document view from \a other.
+*/
+
+/*!
+    Destroys the document view. Value views obtained from it become invalid
+    if this was the last copy.
+*/
+QCborDocumentView::~QCborDocumentView() = default;
+
+/*!
+    Makes this document view a copy of \a other.
+*/
+QCborDocumentView &QCborDocumentView::operator=(const QCborDocumentView &other) noexcept = default;
+
+/*!
+    \fn QCborDocumentView &QCborDocumentView::operator=(QCborDocumentView &&other)
+
+    Move-assigns \a other to this document view.
+*/
+
+/*!
+    \fn void QCborDocumentView::swap(QCborDocumentView &other)
+    \memberswap{document view}
+*/
+
+/*!
+    Validates and indexes the CBOR item in \a cbor.
+
+    The data is validated like QCborValue::fromCbor() does, and must contain
+    exactly one item: unlike QCborValue::fromCbor(), trailing data is
+    reported as QCborError::GarbageAtEnd. If an error occurs, it is stored
+    with the offset of the offending item in \a error, if it is not
+    \c nullptr, and a null view is returned. On success, \a error receives
+    QCborError::NoError and the size of \a cbor.
+
+    The returned view keeps a reference to \a cbor: the contents are not
+    copied, even when \a cbor was created with QByteArray::fromRawData().
+
+    \sa QCborValue::fromCbor()
+*/
+QCborDocumentView QCborDocumentView::fromCbor(const QByteArray &cbor, QCborParserError *error)
+{
+    QExplicitlySharedDataPointer<QDocumentViewPrivate> d(new QDocumentViewPrivate);
+    d->data = cbor;
+    QCborDocumentView result;
+    if (CborIndexer(d.data()).parse(error))
+        result.d = std::move(d);
+    return result;
+}
+
+/*!
+    \fn bool QCborDocumentView::isNull() const
+
+    Returns \c true if this document view was default-constructed or its
+    data failed to validate.
+*/
+
+/*!
+    Returns the data this view refers to.
+*/
+QByteArray QCborDocumentView::data() const
+{
+    return d ? d->data : QByteArray();
+}
+
+/*!
+    Returns a view of the top-level item, or an undefined value view if this
+    document view is null.
+*/
+QCborValueView QCborDocumentView::value() const noexcept
+{
+    return d ? QCborValueView(d.data(), 0) : QCborValueView();
+}
+
+/*!
+    \fn bool QCborDocumentView::isArray() const
+
+    Returns \c true if the top-level item is an array.
+*/
+
+/*!
+    \fn bool QCborDocumentView::isMap() const
+
+    Returns \c true if the top-level item is a map.
+*/
+
+/*!
+    \fn QCborValueView QCborDocumentView::operator[](QAnyStringView key) const
+
+    Returns \c{value()[key]}.
+*/
+
+/*!
+    \fn QCborValueView QCborDocumentView::operator[](qint64 key) const
+
+    Returns \c{value()[key]}.
+*/
+
+/*!
+    \fn QCborValueView::QCborValueView()
+
+    Constructs an undefined value view.
+*/
+
+/*!
+    Returns the type of the item. Tags are reported as QCborValue::Tag and
+    simple types other than the booleans, null and undefined as
+    QCborValue::SimpleType plus their value, as QCborValue does.
+*/
+QCborValue::Type QCborValueView::type() const noexcept
+{
+    if (!d)
+        return QCborValue::Undefined;
+    const Element &e = d->at(index);
+    switch (e.kind) {
+    case QDocumentViewPrivate::Integer:
+        return QCborValue::Integer;
+    case QDocumentViewPrivate::Double:
+        return QCborValue::Double;
+    case QDocumentViewPrivate::String:
+        return QCborValue::String;
+    case QDocumentViewPrivate::ByteArray:
+        return QCborValue::ByteArray;
+    case QDocumentViewPrivate::Array:
+        return QCborValue::Array;
+    case QDocumentViewPrivate::Map:
+        return QCborValue::Map;
+    case QDocumentViewPrivate::Tag:
+        return QCborValue::Tag;
+    case QDocumentViewPrivate::SimpleType:
+        return QCborValue::Type(QCborValue::SimpleType + int(e.value));
+    case QDocumentViewPrivate::False:
+        return QCborValue::False;
+    case QDocumentViewPrivate::True:
+        return QCborValue::True;
+    case QDocumentViewPrivate::Null:
+        return QCborValue::Null;
+    }
+    return QCborValue::Undefined;
+}
+
+/*!
+    \fn bool QCborValueView::isInteger() const
+    \fn bool QCborValueView::isByteArray() const
+    \fn bool QCborValueView::isString() const
+    \fn bool QCborValueView::isArray() const
+    \fn bool QCborValueView::isMap() const
+    \fn bool QCborValueView::isTag() const
+    \fn bool QCborValueView::isFalse() const
+    \fn bool QCborValueView::isTrue() const
+    \fn bool QCborValueView::isBool() const
+    \fn bool QCborValueView::isNull() const
+    \fn bool QCborValueView::isUndefined() const
+    \fn bool QCborValueView::isDouble() const
+    \fn bool QCborValueView::isContainer() const
+
+    Returns \c true if the item has the type named by the function, as
+    QCborValue does.
+*/
+
+/*!
+    Returns \c true if the item is of any simple type, including the
+    booleans, null and undefined.
+*/
+bool QCborValueView::isSimpleType() const noexcept
+{
+    const QCborValue::Type t = type();
+    return d && t >= QCborValue::SimpleType && t < QCborValue::Double;
+}
+
+/*!
+    Returns the simple type of the item, or \a defaultValue if it isn't of a
+    simple type.
+*/
+QCborSimpleType QCborValueView::toSimpleType(QCborSimpleType defaultValue) const noexcept
+{
+    return isSimpleType() ? QCborSimpleType(type() - QCborValue::SimpleType) : defaultValue;
+}
+
+/*!
+    Returns the integer value of the item if it is an integer, or the double
+    value truncated to an integer if it is a double, or \a defaultValue
+    otherwise.
+
+    \sa QCborValue::toInteger()
+*/
+qint64 QCborValueView::toInteger(qint64 defaultValue) const noexcept
+{
+    if (d) {
+        const Element &e = d->at(index);
+        if (e.kind == QDocumentViewPrivate::Integer)
+            return e.value;
+        if (e.kind == QDocumentViewPrivate::Double)
+            return qint64(QDocumentViewPrivate::toDouble(e));
+    }
+    return defaultValue;
+}
+
+/*!
+    Returns the value of a boolean, or \a defaultValue for any other type.
+*/
+bool QCborValueView::toBool(bool defaultValue) const noexcept
+{
+    return isBool() ? isTrue() : defaultValue;
+}
+
+/*!
+    Returns the value of a double or integer item as a double, or
+    \a defaultValue otherwise.
+*/
+double QCborValueView::toDouble(double defaultValue) const noexcept
+{
+    if (d) {
+        const Element &e = d->at(index);
+        if (e.kind == QDocumentViewPrivate::Integer)
+            return double(e.value);
+        if (e.kind == QDocumentViewPrivate::Double)
+            return QDocumentViewPrivate::toDouble(e);
+    }
+    return defaultValue;
+}
+
+/*!
+    Returns the tag of a tagged item, or \a defaultValue otherwise.
+
+    \sa taggedValue()
+*/
+QCborTag QCborValueView::tag(QCborTag defaultValue) const noexcept
+{
+    return isTag() ? QCborTag(quint64(d->at(index).value)) : defaultValue;
+}
+
+/*!
+    Returns a view of the item a tag applies to, or an undefined view if
+    this isn't a tag.
+
+    \sa tag()
+*/
+QCborValueView QCborValueView::taggedValue() const noexcept
+{
+    return isTag() ? QCborValueView(d, index + 1) : QCborValueView();
+}
+
+/*!
+    Returns a copy of the contents of a byte array, or \a defaultValue for
+    any other type.
+
+    \sa toByteArrayView()
+*/
+QByteArray QCborValueView::toByteArray(const QByteArray &defaultValue) const
+{
+    if (!isByteArray())
+        return defaultValue;
+    const Element &e = d->at(index);
+    if (e.flags & QDocumentViewPrivate::StringIsChunked)
+        return joinChunks(d, e);
+    return d->contents(e).toByteArray();
+}
+
+/*!
+    Returns a view on the contents of a byte array in the data, without
+    copying them. If this isn't a byte array, or if the byte array was
+    encoded in chunks, a null view is returned and toByteArray() must be
+    used instead.
+
+    \sa toByteArray()
+*/
+QByteArrayView QCborValueView::toByteArrayView() const noexcept
+{
+    if (!isByteArray())
+        return {};
+    const Element &e = d->at(index);
+    if (e.flags & QDocumentViewPrivate::StringIsChunked)
+        return {};
+    return d->contents(e);
+}
+
+/*!
+    Returns the decoded value of a text string, or \a defaultValue for any
+    other type.
+
+    \sa toStringView()
+*/
+QString QCborValueView::toString(const QString &defaultValue) const
+{
+    if (!isString())
+        return defaultValue;
+    return decodeString(d, d->at(index));
+}
+
+/*!
+    Returns a view on the UTF-8 contents of a text string in the data,
+    without decoding or copying them. If this isn't a text string, or if the
+    string was encoded in chunks, a null view is returned and toString()
+    must be used instead.
+
+    \sa toString()
+*/
+QUtf8StringView QCborValueView::toStringView() const noexcept
+{
+    if (!isString())
+        return {};
+    const Element &e = d->at(index);
+    if (e.flags & QDocumentViewPrivate::StringIsChunked)
+        return {};
+    const QByteArrayView bytes = d->contents(e);
+    return QUtf8StringView(bytes.data(), bytes.size());
+}
+
+/*!
+    Returns the number of elements of an array or of pairs of a map, or 0
+    for any other type.
+*/
+qsizetype QCborValueView::size() const noexcept
+{
+    if (!d)
+        return 0;
+    const Element &e = d->at(index);
+    const qsizetype count = d->childCount(e);
+    return e.kind == QDocumentViewPrivate::Map ? count / 2 : count;
+}
+
+/*!
+    Returns \c true if this is a map with a text string key equal to \a key.
+*/
+bool QCborValueView::contains(QAnyStringView key) const
+{
+    return !(*this)[key].isUndefined();
+}
+
+/*!
+    \overload
+
+    Returns \c true if this is a map with an integer key equal to \a key.
+*/
+bool QCborValueView::contains(qint64 key) const noexcept
+{
+    return d && findLastKey(d, index, [key](const Element &e) {
+        return e.kind == QDocumentViewPrivate::Integer && e.value == key;
+    }) >= 0;
+}
+
+/*!
+    Returns a view of the value for the text string key \a key if this is a
+    map. If there is no such key, or this is not a map, an undefined view is
+    returned. If the map has several such keys, the last one is used.
+*/
+QCborValueView QCborValueView::operator[](QAnyStringView key) const
+{
+    if (!d)
+        return {};
+    const qsizetype found = findLastKey(d, index, [this, key](const Element &e) {
+        return keyEquals(d, e, key);
+    });
+    return found < 0 ? QCborValueView() : QCborValueView(d, found);
+}
+
+/*!
+    \overload
+
+    If this is an array, returns a view of the element at index \a key, or
+    an undefined view if it is out of range. If this is a map, returns a
+    view of the value for the integer key \a key, or an undefined view if
+    there is no such key. Returns an undefined view for any other type.
+*/
+QCborValueView QCborValueView::operator[](qint64 key) const noexcept
+{
+    if (!d)
+        return {};
+    const Element &e = d->at(index);
+    if (e.kind == QDocumentViewPrivate::Array) {
+        if (key < 0 || key >= e.value)
+            return {};
+        return QCborValueView(d, d->childrenBegin(e)[key]);
+    }
+    const qsizetype found = findLastKey(d, index, [key](const Element &k) {
+        return k.kind == QDocumentViewPrivate::Integer && k.value == key;
+    });
+    return found < 0 ? QCborValueView() : QCborValueView(d, found);
+}
+
+/*!
+    Returns an iterator to the first element of an array or pair of a map.
+    For any other type, the returned iterator equals end().
+*/
+QCborValueView::const_iterator QCborValueView::begin() const noexcept
+{
+    if (!d)
+        return {};
+    const Element &e = d->at(index);
+    const int stride = e.kind == QDocumentViewPrivate::Map ? 2 : 1;
+    return d->childCount(e) ? const_iterator(d, d->childrenBegin(e), stride) : const_iterator();
+}
+
+/*!
+    Returns an iterator past the last element of an array or pair of a map.
+*/
+QCborValueView::const_iterator QCborValueView::end() const noexcept
+{
+    if (!d)
+        return {};
+    const Element &e = d->at(index);
+    const int stride = e.kind == QDocumentViewPrivate::Map ? 2 : 1;
+    return d->childCount(e)
+            ? const_iterator(d, d->childrenBegin(e) + d->childCount(e), stride)
+            : const_iterator();
+}
+
+/*!
+    \fn QCborValueView::const_iterator QCborValueView::constBegin() const
+    \fn QCborValueView::const_iterator QCborValueView::constEnd() const
+
+    Same as begin() and end().
+*/
+
+/*!
+    Returns the key of the current pair when iterating over a map, or an
+    undefined view when iterating over an array.
+*/
+QCborValueView QCborValueView::const_iterator::key() const noexcept
+{
+    return stride == 2 ? QCborValueView(d, entry[0]) : QCborValueView();
+}
+
+/*!
+    Returns the current element of an array or value of a map pair.
+*/
+QCborValueView QCborValueView::const_iterator::value() const noexcept
+{
+    return QCborValueView(d, entry[stride - 1]);
+}
+
+/*!
+    Decodes the item, including the complete contents of arrays and maps,
+    into a QCborValue. Tags are converted to extended types where QCborValue
+    recognizes them.
+*/
+QCborValue QCborValueView::toCborValue() const
+{
+    if (!d)
+        return QCborValue();
+    const Element &e = d->at(index);
+    switch (e.kind) {
+    case QDocumentViewPrivate::Integer:
+        return QCborValue(qint64(e.value));
+    case QDocumentViewPrivate::Double:
+        return QCborValue(QDocumentViewPrivate::toDouble(e));
+    case QDocumentViewPrivate::String:
+        return QCborValue(toString());
+    case QDocumentViewPrivate::ByteArray:
+        return QCborValue(toByteArray());
+    case QDocumentViewPrivate::Array: {
+        QCborArray array;
+        for (QCborValueView element : *this)
+            array.append(element.toCborValue());
+        return array;
+    }
+    case QDocumentViewPrivate::Map: {
+        QCborMap map;
+        for (auto it = begin(); it != end(); ++it)
+            map.insert(it.key().toCborValue(), it.value().toCborValue());
+        return map;
+    }
+    case QDocumentViewPrivate::Tag:
+        return QCborValue(tag(), taggedValue().toCborValue());
+    case QDocumentViewPrivate::SimpleType:
+        return QCborValue(QCborSimpleType(e.value));
+    case QDocumentViewPrivate::False:
+        return QCborValue(false);
+    case QDocumentViewPrivate::True:
+        return QCborValue(true);
+    case QDocumentViewPrivate::Null:
+        return QCborValue(nullptr);
+    }
+    return QCborValue();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,142 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCBORDOCUMENTVIEW_H
+#define QCBORDOCUMENTVIEW_H
+
+#include <QtCore/qanystringview.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qcborvalue.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qutf8stringview.h>
+
+#include <iterator>
+
+QT_BEGIN_NAMESPACE
+
+class QDocumentViewPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR(QDocumentViewPrivate)
+
+class Q_CORE_EXPORT QCborValueView
+{
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = qsizetype;
+        using value_type = QCborValueView;
+        using pointer = void;
+        using reference = QCborValueView;
+
+        constexpr const_iterator() noexcept = default;
+
+        QCborValueView key() const noexcept;
+        QCborValueView value() const noexcept;
+        QCborValueView operator*() const noexcept { return value(); }
+
+        const_iterator &operator++() noexcept { entry += stride; return *this; }
+        const_iterator operator++(int) noexcept { const_iterator it = *this; ++*this; return it; }
+
+        friend bool operator==(const const_iterator &lhs, const const_iterator &rhs) noexcept
+        { return lhs.entry == rhs.entry; }
+        friend bool operator!=(const const_iterator &lhs, const const_iterator &rhs) noexcept
+        { return lhs.entry != rhs.entry; }
+
+    private:
+        friend class QCborValueView;
+        constexpr const_iterator(const QDocumentViewPrivate *d, const quint32 *entry, int stride) noexcept
+            : d(d), entry(entry), stride(stride) {}
+
+        const QDocumentViewPrivate *d = nullptr;
+        const quint32 *entry = nullptr;
+        int stride = 1;
+    };
+
+    constexpr QCborValueView() noexcept = default;
+
+    QCborValue::Type type() const noexcept;
+    bool isInteger() const noexcept     { return type() == QCborValue::Integer; }
+    bool isByteArray() const noexcept   { return type() == QCborValue::ByteArray; }
+    bool isString() const noexcept      { return type() == QCborValue::String; }
+    bool isArray() const noexcept       { return type() == QCborValue::Array; }
+    bool isMap() const noexcept         { return type() == QCborValue::Map; }
+    bool isTag() const noexcept         { return type() == QCborValue::Tag; }
+    bool isFalse() const noexcept       { return type() == QCborValue::False; }
+    bool isTrue() const noexcept        { return type() == QCborValue::True; }
+    bool isBool() const noexcept        { return isFalse() || isTrue(); }
+    bool isNull() const noexcept        { return type() == QCborValue::Null; }
+    bool isUndefined() const noexcept   { return type() == QCborValue::Undefined; }
+    bool isDouble() const noexcept      { return type() == QCborValue::Double; }
+    bool isContainer() const noexcept   { return isMap() || isArray(); }
+    bool isSimpleType() const noexcept;
+
+    QCborSimpleType toSimpleType(QCborSimpleType defaultValue = QCborSimpleType::Undefined) const noexcept;
+    qint64 toInteger(qint64 defaultValue = 0) const noexcept;
+    bool toBool(bool defaultValue = false) const noexcept;
+    double toDouble(double defaultValue = 0) const noexcept;
+    QCborTag tag(QCborTag defaultValue = QCborTag(-1)) const noexcept;
+    QCborValueView taggedValue() const noexcept;
+
+    QByteArray toByteArray(const QByteArray &defaultValue = {}) const;
+    QByteArrayView toByteArrayView() const noexcept;
+    QString toString(const QString &defaultValue = {}) const;
+    QUtf8StringView toStringView() const noexcept;
+
+    qsizetype size() const noexcept;
+    bool contains(QAnyStringView key) const;
+    bool contains(qint64 key) const noexcept;
+    QCborValueView operator[](QAnyStringView key) const;
+    QCborValueView operator[](qint64 key) const noexcept;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator constBegin() const noexcept { return begin(); }
+    const_iterator constEnd() const noexcept { return end(); }
+
+    QCborValue toCborValue() const;
+
+private:
+    friend class QCborDocumentView;
+    constexpr QCborValueView(const QDocumentViewPrivate *d, qsizetype index) noexcept
+        : d(d), index(index) {}
+
+    const QDocumentViewPrivate *d = nullptr;
+    qsizetype index = 0;
+};
+Q_DECLARE_TYPEINFO(QCborValueView, Q_PRIMITIVE_TYPE);
+
+class Q_CORE_EXPORT QCborDocumentView
+{
+public:
+    QCborDocumentView() noexcept;
+    QCborDocumentView(const QCborDocumentView &other) noexcept;
+    QCborDocumentView(QCborDocumentView &&other) noexcept = default;
+    ~QCborDocumentView();
+
+    QCborDocumentView &operator=(const QCborDocumentView &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QCborDocumentView)
+
+    void swap(QCborDocumentView &other) noexcept { d.swap(other.d); }
+
+    static QCborDocumentView fromCbor(const QByteArray &cbor, QCborParserError *error = nullptr);
+
+    bool isNull() const noexcept { return !d; }
+    QByteArray data() const;
+
+    QCborValueView value() const noexcept;
+    bool isArray() const noexcept { return value().isArray(); }
+    bool isMap() const noexcept { return value().isMap(); }
+
+    QCborValueView operator[](QAnyStringView key) const { return value()[key]; }
+    QCborValueView operator[](qint64 key) const noexcept { return value()[key]; }
+
+private:
+    QExplicitlySharedDataPointer<QDocumentViewPrivate> d;
+};
+
+Q_DECLARE_SHARED(QCborDocumentView)
+
+QT_END_NAMESPACE
+
+#endif // QCBORDOCUMENTVIEW_H
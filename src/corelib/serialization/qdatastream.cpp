@@ -14,6 +14,9 @@
 #include "qendian.h"
 
 #include <QtCore/q20memory.h>
+#ifndef QT_NO_QOBJECT
+#include <QtCore/private/qiodevice_p.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -766,6 +769,82 @@ qint64 QDataStream::readBlock(char *data, qint64 len)
     return readResult;
 }
 
+/*!
+    \internal
+
+    Returns \c true if elements of \a size bytes are stored in their
+    in-memory representation in the stream's format, so that arrays of them
+    can be transferred with readBulk() and writeBulk(). \a floatingPoint
+    tells whether the elements are \c float or \c double, which depend on
+    the floating point precision.
+*/
+bool QDataStream::canStreamInBulk(qsizetype size, bool floatingPoint) const noexcept
+{
+    if (floatingPoint) {
+        return version() < QDataStream::Qt_4_6
+                || (size == sizeof(float)) == (floatingPointPrecision() == SinglePrecision);
+    }
+    // 64-bit integers were stored as two 32-bit halves up to Qt 3.3
+    return size < 8 || version() >= 6;
+}
+
+static void swapElements(const void *source, qsizetype count, void *dest, qsizetype size)
+{
+    switch (size) {
+    case 2:
+        qbswap<2>(source, count, dest);
+        break;
+    case 4:
+        qbswap<4>(source, count, dest);
+        break;
+    case 8:
+        qbswap<8>(source, count, dest);
+        break;
+    default:
+        Q_UNREACHABLE();
+    }
+}
+
+/*!
+    \internal
+
+    Reads \a count elements of \a size bytes into \a data and converts them
+    to host byte order. When the device is a QBuffer, the elements are
+    byte-swapped straight out of its memory, which may be a memory-mapped
+    file wrapped with QByteArray::fromRawData(). Returns \c false and sets
+    the status if there isn't enough data.
+*/
+bool QDataStream::readBulk(void *data, qsizetype count, qsizetype size)
+{
+    CHECK_STREAM_PRECOND(false)
+    const qint64 len = qint64(count) * size;
+    const bool swap = !noswap && size > 1;
+
+#ifndef QT_NO_QOBJECT
+    if (swap && !(q_status != Ok && dev->isTransactionStarted())) {
+        QBuffer *buffer = qobject_cast<QBuffer *>(dev);
+        if (buffer && buffer->isReadable() && !buffer->isSequential()
+                && !buffer->isTextModeEnabled()
+                && static_cast<QIODevicePrivate *>(QObjectPrivate::get(buffer))->isBufferEmpty()) {
+            const QByteArray &bytes = buffer->data();
+            const qint64 pos = buffer->pos();
+            if (bytes.size() - pos >= len) {
+                swapElements(bytes.constData() + pos, count, data, size);
+                buffer->skip(len);
+                return true;
+            }
+            // let readBlock() consume what is there and report the error
+        }
+    }
+#endif
+
+    if (readBlock(static_cast<char *>(data), len) != len)
+        return false;
+    if (swap)
+        swapElements(data, count, data, size);
+    return true;
+}
+
 /*!
     \fn QDataStream &QDataStream::operator>>(std::nullptr_t &ptr)
     \since 5.9
@@ -1461,6 +1540,37 @@ qint64 QDataStream::writeRawData(const char *s, qint64 len)
     return ret;
 }
 
+/*!
+    \internal
+
+    Writes \a count elements of \a size bytes from \a data in the stream's
+    byte order: in one block if no swapping is needed, or else through a
+    fixed-size buffer. Returns \c false and sets the status on error.
+*/
+bool QDataStream::writeBulk(const void *data, qsizetype count, qsizetype size)
+{
+    CHECK_STREAM_WRITE_PRECOND(false)
+    if (noswap || size == 1) {
+        const qint64 len = qint64(count) * size;
+        return writeRawData(static_cast<const char *>(data), len) == len;
+    }
+
+    alignas(quint64) char chunk[16384];
+    const qsizetype chunkCount = sizeof(chunk) / size;
+    const char *source = static_cast<const char *>(data);
+    while (count > 0) {
+        const qsizetype n = qMin(count, chunkCount);
+        swapElements(source, n, chunk, size);
+        if (dev->write(chunk, n * size) != n * size) {
+            q_status = WriteFailed;
+            return false;
+        }
+        source += n * size;
+        count -= n;
+    }
+    return true;
+}
+
 /*!
     \since 4.1
 
@@ -248,6 +248,9 @@ private:
     int readBlock(char *data, int len);
 #endif
     qint64 readBlock(char *data, qint64 len);
+    bool canStreamInBulk(qsizetype size, bool floatingPoint) const noexcept;
+    bool readBulk(void *data, qsizetype count, qsizetype size);
+    bool writeBulk(const void *data, qsizetype count, qsizetype size);
     static inline qint64 readQSizeType(QDataStream &s);
     static inline bool writeQSizeType(QDataStream &s, qint64 value);
     static constexpr quint32 NullCode = 0xffffffffu;
@@ -298,6 +301,21 @@ private:
     QDataStream::Status oldStatus;
 };
 
+// Types whose stream format is their in-memory representation, possibly
+// byte-swapped, so that arrays of them can be transferred as one block
+template <typename T>
+constexpr bool IsBulkStreamable = std::disjunction_v<
+        std::is_same<T, char>, std::is_same<T, qint8>, std::is_same<T, quint8>,
+        std::is_same<T, qint16>, std::is_same<T, quint16>,
+        std::is_same<T, qint32>, std::is_same<T, quint32>,
+        std::is_same<T, qint64>, std::is_same<T, quint64>,
+        std::is_same<T, char16_t>, std::is_same<T, char32_t>,
+        std::is_same<T, float>, std::is_same<T, double>>;
+
+template <typename Container, typename T = typename Container::value_type>
+constexpr bool IsBulkStreamableContainer =
+        IsBulkStreamable<T> && std::is_same_v<Container, QList<T>>;
+
 template <typename Container>
 QDataStream &readArrayBasedContainer(QDataStream &s, Container &c)
 {
@@ -310,6 +328,15 @@ QDataStream &readArrayBasedContainer(QDataStream &s, Container &c)
         s.setStatus(QDataStream::SizeLimitExceeded);
         return s;
     }
+    if constexpr (IsBulkStreamableContainer<Container>) {
+        using T = typename Container::value_type;
+        if (s.canStreamInBulk(sizeof(T), std::is_floating_point_v<T>)) {
+            c.resizeForOverwrite(n);
+            if (!s.readBulk(c.data(), n, sizeof(T)))
+                c.clear();
+            return s;
+        }
+    }
     c.reserve(n);
     for (qsizetype i = 0; i < n; ++i) {
         typename Container::value_type t;
@@ -377,6 +404,13 @@ QDataStream &writeSequentialContainer(QDataStream &s, const Container &c)
 {
     if (!QDataStream::writeQSizeType(s, c.size()))
         return s;
+    if constexpr (IsBulkStreamableContainer<Container>) {
+        using T = typename Container::value_type;
+        if (s.canStreamInBulk(sizeof(T), std::is_floating_point_v<T>)) {
+            s.writeBulk(c.constData(), c.size(), sizeof(T));
+            return s;
+        }
+    }
     for (const typename Container::value_type &t : c)
         s << t;
 
@@ -0,0 +1,168 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:critical reason:data-parser
+
+#ifndef QDOCUMENTVIEW_P_H
+#define QDOCUMENTVIEW_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qshareddata.h>
+
+#include <cstring>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    The index shared by QJsonDocumentView and QCborDocumentView.
+
+    The document is stored as a flat list of elements in pre-order, so a
+    container is always followed by its contents and a tag by the tagged
+    value. The direct children of each container are listed contiguously in
+    the children array, which makes indexing an array O(1); for maps the
+    keys and values alternate. Strings are not copied: an element refers to
+    the encoded bytes in the data, and only strings that need unescaping or
+    chunk reassembly are decoded when they are read.
+*/
+class QDocumentViewPrivate : public QSharedData
+{
+public:
+    enum Kind : quint8 {
+        Integer,        // value: the integer
+        Double,         // value: the bits of the double
+        String,         // offset: first byte of the contents, value: size in bytes
+        ByteArray,      //   (or, with StringIsChunked, offset of the CBOR header)
+        Array,          // offset: first entry in children, value: number of entries
+        Map,            //   (two entries per pair: key, then value)
+        Tag,            // value: the tag; the tagged value is the next element
+        SimpleType,     // value: the simple type
+        False,
+        True,
+        Null,
+        Undefined,
+    };
+    enum Flag : quint8 {
+        StringIsAscii = 0x01,
+        StringIsEscaped = 0x02,     // JSON string with escape sequences
+        StringIsChunked = 0x04,     // CBOR indefinite-length string
+    };
+
+    struct Element
+    {
+        qint64 value;
+        quint64 offset : 48;
+        quint64 kind : 8;
+        quint64 flags : 8;
+    };
+    static_assert(sizeof(Element) == 2 * sizeof(qint64));
+
+    static constexpr qsizetype MaxElements = std::numeric_limits<quint32>::max();
+
+    QByteArray data;
+    QList<Element> elements;
+    QList<quint32> children;
+
+    const Element &at(qsizetype index) const { return elements.at(index); }
+
+    QByteArrayView contents(const Element &e) const
+    {
+        Q_ASSERT(!(e.flags & StringIsChunked));
+        return QByteArrayView(data.constData() + e.offset, e.value);
+    }
+
+    static double toDouble(const Element &e)
+    {
+        double d;
+        memcpy(&d, &e.value, sizeof(d));
+        return d;
+    }
+
+    static qint64 fromDouble(double d)
+    {
+        qint64 bits;
+        memcpy(&bits, &d, sizeof(bits));
+        return bits;
+    }
+
+    qsizetype childCount(const Element &e) const
+    {
+        return e.kind == Array || e.kind == Map ? qsizetype(e.value) : 0;
+    }
+
+    const quint32 *childrenBegin(const Element &e) const
+    {
+        return children.constData() + e.offset;
+    }
+};
+
+/*
+    Accumulates the children of the containers being indexed: each added
+    element is recorded as a child of the innermost open container, and
+    closing a container moves its children to the shared array in one block.
+*/
+class QDocumentViewBuilder
+{
+public:
+    using Element = QDocumentViewPrivate::Element;
+    using Kind = QDocumentViewPrivate::Kind;
+
+    explicit QDocumentViewBuilder(QDocumentViewPrivate *d) : d(d) {}
+
+    // Returns the index of the new element, or -1 if the index is full
+    qsizetype add(Kind kind, qint64 value = 0, quint64 offset = 0, quint8 flags = 0)
+    {
+        const qsizetype index = d->elements.size();
+        if (index >= QDocumentViewPrivate::MaxElements)
+            return -1;
+        Element e;
+        e.value = value;
+        e.offset = offset;
+        e.kind = kind;
+        e.flags = flags;
+        d->elements.append(e);
+        pending.append(quint32(index));
+        return index;
+    }
+
+    // Elements that are not direct children of a container (tagged values)
+    void detachLast() { pending.removeLast(); }
+
+    qsizetype openContainer() const { return pending.size(); }
+
+    void closeContainer(qsizetype index, qsizetype mark)
+    {
+        Element &e = d->elements[index];
+        e.offset = quint64(d->children.size());
+        e.value = pending.size() - mark;
+        for (qsizetype i = mark; i < pending.size(); ++i)
+            d->children.append(pending.at(i));
+        pending.resize(mark);
+    }
+
+    void finish()
+    {
+        d->elements.squeeze();
+        d->children.squeeze();
+    }
+
+private:
+    QDocumentViewPrivate *d;
+    QList<quint32> pending;
+};
+
+QT_END_NAMESPACE
+
+#endif // QDOCUMENTVIEW_P_H
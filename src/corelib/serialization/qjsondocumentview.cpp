@@ -0,0 +1,825 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:critical reason:data-parser
+
+#include "qjsondocumentview.h"
+
+#include "qjsonarray.h"
+#include "qjsonobject.h"
+#include "qjsonparseerror.h"
+#include "qdocumentview_p.h"
+#include "qjsonparser_p.h"
+
+#include <private/qstringconverter_p.h>
+
+QT_BEGIN_NAMESPACE
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QDocumentViewPrivate)
+
+/*!
+    \class QJsonDocumentView
+    \inmodule QtCore
+    \ingroup json
+    \ingroup shared
+    \ingroup qtserialization
+    \reentrant
+    \since 6.12
+
+    \brief The QJsonDocumentView class provides read-only access to a JSON
+    document without decoding it.
+
+    QJsonDocument::fromJson() decodes every value of a document and copies
+    every string, which is wasted work when only a few fields of a large
+    document are read. QJsonDocumentView instead validates the document once,
+    with the same rules and errors as QJsonDocument::fromJson(), and builds a
+    compact index of where each value is. Values are then accessed through
+    QJsonValueView, which refers to the original bytes: numbers are converted
+    during validation, and strings are only decoded when they are read.
+
+    The data is held by a QByteArray, which is not copied. To view a file
+    without reading it into memory, map it and wrap the mapping with
+    QByteArray::fromRawData():
+
+    \snippet code/src_corelib_serialization_qjsondocumentview.cpp 0
+
+    In that case the mapping must outlive the document view and all views
+    obtained from it.
+
+    Lookups by key are linear in the number of members of the object. If an
+    object has duplicate keys, a lookup finds the last one, as with
+    QJsonObject; iterating over the object visits all members in document
+    order.
+
+    \sa QJsonValueView, QJsonDocument, QCborDocumentView
+*/
+
+/*!
+    \class QJsonValueView
+    \inmodule QtCore
+    \ingroup json
+    \ingroup qtserialization
+    \reentrant
+    \since 6.12
+
+    \brief The QJsonValueView class refers to a value in a QJsonDocumentView.
+
+    QJsonValueView has an API similar to QJsonValue, but objects and arrays
+    are accessed in place through operator[]() and iteration instead of
+    through QJsonObject and QJsonArray. Looking up a missing key or an index
+    out of range, or any lookup on a value that isn't a container, returns a
+    view for which isUndefined() is \c true, so lookups can be chained.
+
+    QJsonValueView is a lightweight reference, like QStringView: it is only
+    valid as long as the QJsonDocumentView it came from, or a copy of it,
+    exists.
+
+    \sa QJsonDocumentView
+*/
+
+/*!
+    \class QJsonValueView::const_iterator
+    \inmodule QtCore
+    \since 6.12
+
+    \brief The QJsonValueView::const_iterator class iterates over the
+    contents of an array or object view.
+
+    Dereferencing the iterator returns the value; for objects, key() returns
+    the member's name as a string view.
+*/
+
+using namespace QtMiscUtils;
+using Element = QDocumentViewPrivate::Element;
+using Kind = QDocumentViewPrivate::Kind;
+
+namespace {
+// Indexes a JSON document. The structure and error reporting follow
+// QJsonPrivate::Parser exactly, so that errors and their offsets are the
+// same as QJsonDocument::fromJson()'s.
+class JsonIndexer
+{
+public:
+    explicit JsonIndexer(QDocumentViewPrivate *d)
+        : head(d->data.constData()), json(head), end(head + d->data.size()), builder(d)
+    {}
+
+    bool parse(QJsonParseError *error);
+
+private:
+    bool eatSpace()
+    {
+        json = QJsonPrivate::skipWhitespace(json, end);
+        return json < end;
+    }
+    char nextToken();
+    bool parseValue();
+    bool parseObject();
+    bool parseMember();
+    bool parseArray();
+    bool parseString();
+    bool parseNumber();
+    qsizetype add(Kind kind, qint64 value = 0, quint64 offset = 0, quint8 flags = 0)
+    {
+        const qsizetype index = builder.add(kind, value, offset, flags);
+        if (index < 0)
+            lastError = QJsonParseError::DocumentTooLarge;
+        return index;
+    }
+
+    const char *head;
+    const char *json;
+    const char *end;
+    int nestingLevel = 0;
+    QJsonParseError::ParseError lastError = QJsonParseError::NoError;
+    QDocumentViewBuilder builder;
+};
+
+char JsonIndexer::nextToken()
+{
+    if (!eatSpace())
+        return 0;
+    char token = *json++;
+    switch (token) {
+    case '[':
+    case '{':
+    case ':':
+    case ',':
+    case ']':
+    case '}':
+    case '"':
+        break;
+    default:
+        token = 0;
+        break;
+    }
+    return token;
+}
+
+bool JsonIndexer::parse(QJsonParseError *error)
+{
+    // eat UTF-8 byte order mark
+    if (end - json > 3 && uchar(json[0]) == 0xef && uchar(json[1]) == 0xbb
+            && uchar(json[2]) == 0xbf) {
+        json += 3;
+    }
+
+    bool ok = eatSpace();
+    if (!ok)
+        lastError = QJsonParseError::IllegalValue;
+    else
+        ok = parseValue();
+    if (ok) {
+        eatSpace();
+        if (json < end) {
+            lastError = QJsonParseError::GarbageAtEnd;
+            ok = false;
+        }
+    }
+    if (ok)
+        builder.finish();
+
+    if (error) {
+        using OffType = decltype(error->offset);
+        error->offset = ok ? 0 : OffType(json - head);
+        error->error = lastError;
+    }
+    return ok;
+}
+
+bool JsonIndexer::parseValue()
+{
+    const auto literal = [this](QLatin1StringView rest, Kind kind) {
+        if (end - json < rest.size()) {
+            lastError = QJsonParseError::IllegalValue;
+            return false;
+        }
+        for (char c : rest) {
+            if (*json++ != c) {
+                lastError = QJsonParseError::IllegalValue;
+                return false;
+            }
+        }
+        return add(kind) >= 0;
+    };
+
+    switch (*json++) {
+    case 'n':
+        return literal(QLatin1StringView("ull"), QDocumentViewPrivate::Null);
+    case 't':
+        return literal(QLatin1StringView("rue"), QDocumentViewPrivate::True);
+    case 'f':
+        return literal(QLatin1StringView("alse"), QDocumentViewPrivate::False);
+    case '"':
+        return parseString();
+    case '[':
+        return parseArray();
+    case '{':
+        return parseObject();
+    case ',':
+        // Essentially missing value, but after a colon, not after a comma
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    case '}':
+    case ']':
+        lastError = QJsonParseError::MissingObject;
+        return false;
+    default:
+        --json;
+        return parseNumber();
+    }
+}
+
+bool JsonIndexer::parseObject()
+{
+    if (++nestingLevel > QJsonPrivate::nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+    const qsizetype index = add(QDocumentViewPrivate::Map);
+    if (index < 0)
+        return false;
+    const qsizetype mark = builder.openContainer();
+
+    char token = nextToken();
+    while (token == '"') {
+        if (!parseMember())
+            return false;
+        token = nextToken();
+        if (token != ',')
+            break;
+        token = nextToken();
+        if (token == '}') {
+            lastError = QJsonParseError::MissingObject;
+            return false;
+        }
+    }
+
+    if (token != '}') {
+        lastError = QJsonParseError::UnterminatedObject;
+        return false;
+    }
+
+    --nestingLevel;
+    builder.closeContainer(index, mark);
+    return true;
+}
+
+bool JsonIndexer::parseMember()
+{
+    if (!parseString())
+        return false;
+    char token = nextToken();
+    if (token != ':') {
+        lastError = QJsonParseError::MissingNameSeparator;
+        return false;
+    }
+    if (!eatSpace()) {
+        lastError = QJsonParseError::UnterminatedObject;
+        return false;
+    }
+    return parseValue();
+}
+
+bool JsonIndexer::parseArray()
+{
+    if (++nestingLevel > QJsonPrivate::nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+    const qsizetype index = add(QDocumentViewPrivate::Array);
+    if (index < 0)
+        return false;
+    const qsizetype mark = builder.openContainer();
+
+    if (!eatSpace()) {
+        lastError = QJsonParseError::UnterminatedArray;
+        return false;
+    }
+    if (*json == ']') {
+        nextToken();
+    } else {
+        while (true) {
+            if (!eatSpace()) {
+                lastError = QJsonParseError::UnterminatedArray;
+                return false;
+            }
+            if (!parseValue())
+                return false;
+
+            char token = nextToken();
+            if (token == ']')
+                break;
+            if (token != ',') {
+                if (!eatSpace())
+                    lastError = QJsonParseError::UnterminatedArray;
+                else
+                    lastError = QJsonParseError::MissingValueSeparator;
+                return false;
+            }
+        }
+    }
+
+    --nestingLevel;
+    builder.closeContainer(index, mark);
+    return true;
+}
+
+bool JsonIndexer::parseString()
+{
+    const char *start = json;
+    quint8 flags = QDocumentViewPrivate::StringIsAscii;
+    while (json < end) {
+        json = QJsonPrivate::findQuoteBackslashOrNonAscii(json, end);
+        if (json == end || *json == '"')
+            break;
+        char32_t ch = 0;
+        if (*json == '\\') {
+            flags = QDocumentViewPrivate::StringIsEscaped;
+            if (!QJsonPrivate::scanEscapeSequence(json, end, &ch)) {
+                lastError = QJsonParseError::IllegalEscapeSequence;
+                return false;
+            }
+        } else {
+            flags &= ~QDocumentViewPrivate::StringIsAscii;
+            if (!QJsonPrivate::scanUtf8Char(json, end, &ch)) {
+                lastError = QJsonParseError::IllegalUTF8String;
+                return false;
+            }
+        }
+    }
+    ++json;
+    if (json > end) {
+        lastError = QJsonParseError::UnterminatedString;
+        return false;
+    }
+
+    return add(QDocumentViewPrivate::String, json - start - 1, start - head, flags) >= 0;
+}
+
+bool JsonIndexer::parseNumber()
+{
+    const char *start = json;
+
+    // same grammar as QJsonPrivate::Parser::parseNumber()
+    if (json < end && *json == '-')
+        ++json;
+    if (json < end && *json == '0') {
+        ++json;
+    } else {
+        while (json < end && isAsciiDigit(*json))
+            ++json;
+    }
+    if (json < end && *json == '.') {
+        ++json;
+        while (json < end && isAsciiDigit(*json))
+            ++json;
+    }
+    if (json < end && (*json == 'e' || *json == 'E')) {
+        ++json;
+        if (json < end && (*json == '-' || *json == '+'))
+            ++json;
+        while (json < end && isAsciiDigit(*json))
+            ++json;
+    }
+
+    qint64 n;
+    double d;
+    switch (QJsonPrivate::convertNumber(start, json, &n, &d)) {
+    case QJsonPrivate::NumberType::Invalid:
+        break;
+    case QJsonPrivate::NumberType::Integer:
+        return add(QDocumentViewPrivate::Integer, n) >= 0;
+    case QJsonPrivate::NumberType::Double:
+        return add(QDocumentViewPrivate::Double, QDocumentViewPrivate::fromDouble(d)) >= 0;
+    }
+
+    lastError = QJsonParseError::IllegalNumber;
+    return false;
+}
+
+QString decodeString(const QDocumentViewPrivate *d, const Element &e)
+{
+    const QByteArrayView bytes = d->contents(e);
+    if (e.flags & QDocumentViewPrivate::StringIsAscii)
+        return QString::fromLatin1(bytes);
+    if (!(e.flags & QDocumentViewPrivate::StringIsEscaped))
+        return QString::fromUtf8(bytes);
+
+    // already validated by JsonIndexer::parseString()
+    QString result;
+    result.reserve(bytes.size());
+    const char *json = bytes.begin();
+    const char *const end = bytes.end();
+    while (json < end) {
+        const char *ascii = json;
+        json = QJsonPrivate::findQuoteBackslashOrNonAscii(json, end);
+        result.append(QLatin1StringView(ascii, json - ascii));
+        if (json == end)
+            break;
+        char32_t ch = 0;
+        if (*json == '\\')
+            QJsonPrivate::scanEscapeSequence(json, end, &ch);
+        else
+            QJsonPrivate::scanUtf8Char(json, end, &ch);
+        result.append(QChar::fromUcs4(ch));
+    }
+    return result;
+}
+
+bool keyEquals(const QDocumentViewPrivate *d, const Element &e, QAnyStringView key)
+{
+    if (e.kind != QDocumentViewPrivate::String)
+        return false;
+    if (e.flags & QDocumentViewPrivate::StringIsEscaped)
+        return QAnyStringView::equal(decodeString(d, e), key);
+    const QByteArrayView bytes = d->contents(e);
+    if (e.flags & QDocumentViewPrivate::StringIsAscii)
+        return QAnyStringView::equal(QLatin1StringView(bytes), key);
+    return QAnyStringView::equal(QUtf8StringView(bytes), key);
+}
+} // unnamed namespace
+
+/*!
+    Constructs a null document view.
+
+    \sa isNull()
+*/
+QJsonDocumentView::QJsonDocumentView() noexcept = default;
+
+/*!
+    Constructs a copy of \a other. The index is shared, not copied.
+*/
+QJsonDocumentView::QJsonDocumentView(const QJsonDocumentView &other) noexcept = default;
+
+/*!
+    \fn QJsonDocumentView::QJsonDocumentView(QJsonDocumentView &&other)
+
+    Move-constructs a document view from \a other.
+*/
+
+/*!
+    Destroys the document view. Value views obtained from it become invalid
+    if this was the last copy.
+*/
+QJsonDocumentView::~QJsonDocumentView() = default;
+
+/*!
+    Makes this document view a copy of \a other.
+*/
+QJsonDocumentView &QJsonDocumentView::operator=(const QJsonDocumentView &other) noexcept = default;
+
+/*!
+    \fn QJsonDocumentView &QJsonDocumentView::operator=(QJsonDocumentView &&other)
+
+    Move-assigns \a other to this document view.
+*/
+
+/*!
+    \fn void QJsonDocumentView::swap(QJsonDocumentView &other)
+    \memberswap{document view}
+*/
+
+/*!
+    Validates and indexes the UTF-8 encoded JSON document in \a json.
+
+    The rules are those of QJsonDocument::fromJson(), and in case of an
+    error the same error and offset are reported in \a error, if it is not
+    \c nullptr, and a null view is returned. Unlike QJsonDocument, any value
+    can be at the top level.
+
+    The returned view keeps a reference to \a json: the contents are not
+    copied, even when \a json was created with QByteArray::fromRawData().
+
+    \sa QJsonDocument::fromJson()
+*/
+QJsonDocumentView QJsonDocumentView::fromJson(const QByteArray &json, QJsonParseError *error)
+{
+    QExplicitlySharedDataPointer<QDocumentViewPrivate> d(new QDocumentViewPrivate);
+    d->data = json;
+    QJsonDocumentView result;
+    if (JsonIndexer(d.data()).parse(error))
+        result.d = std::move(d);
+    return result;
+}
+
+/*!
+    \fn bool QJsonDocumentView::isNull() const
+
+    Returns \c true if this document view was default-constructed or its
+    document failed to validate.
+*/
+
+/*!
+    Returns the document data this view refers to.
+*/
+QByteArray QJsonDocumentView::data() const
+{
+    return d ? d->data : QByteArray();
+}
+
+/*!
+    Returns a view of the document's top-level value, or an undefined value
+    view if this document view is null.
+*/
+QJsonValueView QJsonDocumentView::value() const noexcept
+{
+    return d ? QJsonValueView(d.data(), 0) : QJsonValueView();
+}
+
+/*!
+    \fn bool QJsonDocumentView::isArray() const
+
+    Returns \c true if the top-level value is an array.
+*/
+
+/*!
+    \fn bool QJsonDocumentView::isObject() const
+
+    Returns \c true if the top-level value is an object.
+*/
+
+/*!
+    \fn QJsonValueView QJsonDocumentView::operator[](QAnyStringView key) const
+
+    Returns \c{value()[key]}.
+*/
+
+/*!
+    \fn QJsonValueView QJsonDocumentView::operator[](qsizetype i) const
+
+    Returns \c{value()[i]}.
+*/
+
+/*!
+    \fn QJsonValueView::QJsonValueView()
+
+    Constructs an undefined value view.
+*/
+
+/*!
+    Returns the type of the value.
+*/
+QJsonValue::Type QJsonValueView::type() const noexcept
+{
+    if (!d)
+        return QJsonValue::Undefined;
+    switch (d->at(index).kind) {
+    case QDocumentViewPrivate::Integer:
+    case QDocumentViewPrivate::Double:
+        return QJsonValue::Double;
+    case QDocumentViewPrivate::String:
+        return QJsonValue::String;
+    case QDocumentViewPrivate::Array:
+        return QJsonValue::Array;
+    case QDocumentViewPrivate::Map:
+        return QJsonValue::Object;
+    case QDocumentViewPrivate::False:
+    case QDocumentViewPrivate::True:
+        return QJsonValue::Bool;
+    case QDocumentViewPrivate::Null:
+        return QJsonValue::Null;
+    }
+    return QJsonValue::Undefined;
+}
+
+/*!
+    \fn bool QJsonValueView::isNull() const
+    \fn bool QJsonValueView::isBool() const
+    \fn bool QJsonValueView::isDouble() const
+    \fn bool QJsonValueView::isString() const
+    \fn bool QJsonValueView::isArray() const
+    \fn bool QJsonValueView::isObject() const
+    \fn bool QJsonValueView::isUndefined() const
+
+    Returns \c true if type() is the type named by the function.
+*/
+
+/*!
+    Returns \c true if the value is a number that is stored as a 64-bit
+    integer, as QJsonValue would store it.
+
+    \sa toInteger()
+*/
+bool QJsonValueView::isInteger() const noexcept
+{
+    return d && d->at(index).kind == QDocumentViewPrivate::Integer;
+}
+
+/*!
+    Returns the value of a boolean, or \a defaultValue for any other type.
+*/
+bool QJsonValueView::toBool(bool defaultValue) const noexcept
+{
+    if (d) {
+        switch (d->at(index).kind) {
+        case QDocumentViewPrivate::False:
+            return false;
+        case QDocumentViewPrivate::True:
+            return true;
+        }
+    }
+    return defaultValue;
+}
+
+/*!
+    Returns the value of a number if isInteger() is \c true, or
+    \a defaultValue otherwise.
+
+    \sa QJsonValue::toInteger()
+*/
+qint64 QJsonValueView::toInteger(qint64 defaultValue) const noexcept
+{
+    return isInteger() ? d->at(index).value : defaultValue;
+}
+
+/*!
+    Returns the value of a number as a double, or \a defaultValue if this is
+    not a number.
+*/
+double QJsonValueView::toDouble(double defaultValue) const noexcept
+{
+    if (d) {
+        const Element &e = d->at(index);
+        if (e.kind == QDocumentViewPrivate::Integer)
+            return double(e.value);
+        if (e.kind == QDocumentViewPrivate::Double)
+            return QDocumentViewPrivate::toDouble(e);
+    }
+    return defaultValue;
+}
+
+/*!
+    Returns the decoded value of a string, or \a defaultValue if this is not
+    a string.
+
+    \sa toStringView()
+*/
+QString QJsonValueView::toString(const QString &defaultValue) const
+{
+    if (!isString())
+        return defaultValue;
+    return decodeString(d, d->at(index));
+}
+
+/*!
+    Returns a view on the UTF-8 contents of a string in the document data,
+    without decoding or copying them. If this is not a string, or if the
+    string contains escape sequences and therefore needs decoding, a null
+    view is returned and toString() must be used instead.
+
+    \sa toString()
+*/
+QUtf8StringView QJsonValueView::toStringView() const noexcept
+{
+    if (!isString())
+        return {};
+    const Element &e = d->at(index);
+    if (e.flags & QDocumentViewPrivate::StringIsEscaped)
+        return {};
+    const QByteArrayView bytes = d->contents(e);
+    return QUtf8StringView(bytes.data(), bytes.size());
+}
+
+/*!
+    Returns the number of elements of an array or of members of an object,
+    or 0 for any other type.
+*/
+qsizetype QJsonValueView::size() const noexcept
+{
+    if (!d)
+        return 0;
+    const Element &e = d->at(index);
+    const qsizetype count = d->childCount(e);
+    return e.kind == QDocumentViewPrivate::Map ? count / 2 : count;
+}
+
+/*!
+    Returns \c true if this is an object with a member called \a key.
+*/
+bool QJsonValueView::contains(QAnyStringView key) const
+{
+    return !(*this)[key].isUndefined();
+}
+
+/*!
+    Returns a view of the value of the member called \a key if this is an
+    object. If there is no such member, or this is not an object, an
+    undefined view is returned. If the object has several members called
+    \a key, the last one is returned.
+*/
+QJsonValueView QJsonValueView::operator[](QAnyStringView key) const
+{
+    if (!d)
+        return {};
+    const Element &e = d->at(index);
+    if (e.kind != QDocumentViewPrivate::Map)
+        return {};
+    const quint32 *entries = d->childrenBegin(e);
+    for (qsizetype i = qsizetype(e.value) - 2; i >= 0; i -= 2) {
+        if (keyEquals(d, d->at(entries[i]), key))
+            return QJsonValueView(d, entries[i + 1]);
+    }
+    return {};
+}
+
+/*!
+    Returns a view of the element at index \a i if this is an array and
+    \a i is in range, or an undefined view otherwise.
+*/
+QJsonValueView QJsonValueView::operator[](qsizetype i) const noexcept
+{
+    if (!d)
+        return {};
+    const Element &e = d->at(index);
+    if (e.kind != QDocumentViewPrivate::Array || i < 0 || i >= e.value)
+        return {};
+    return QJsonValueView(d, d->childrenBegin(e)[i]);
+}
+
+/*!
+    Returns an iterator to the first element of an array or member of an
+    object. For any other type, the returned iterator equals end().
+*/
+QJsonValueView::const_iterator QJsonValueView::begin() const noexcept
+{
+    if (!d)
+        return {};
+    const Element &e = d->at(index);
+    const int stride = e.kind == QDocumentViewPrivate::Map ? 2 : 1;
+    return d->childCount(e) ? const_iterator(d, d->childrenBegin(e), stride) : const_iterator();
+}
+
+/*!
+    Returns an iterator past the last element of an array or member of an
+    object.
+*/
+QJsonValueView::const_iterator QJsonValueView::end() const noexcept
+{
+    if (!d)
+        return {};
+    const Element &e = d->at(index);
+    const int stride = e.kind == QDocumentViewPrivate::Map ? 2 : 1;
+    return d->childCount(e)
+            ? const_iterator(d, d->childrenBegin(e) + d->childCount(e), stride)
+            : const_iterator();
+}
+
+/*!
+    \fn QJsonValueView::const_iterator QJsonValueView::constBegin() const
+    \fn QJsonValueView::const_iterator QJsonValueView::constEnd() const
+
+    Same as begin() and end().
+*/
+
+/*!
+    Returns the member's name as a string view when iterating over an
+    object, or an undefined view when iterating over an array.
+*/
+QJsonValueView QJsonValueView::const_iterator::key() const noexcept
+{
+    return stride == 2 ? QJsonValueView(d, entry[0]) : QJsonValueView();
+}
+
+/*!
+    Returns the current element of an array or value of an object member.
+*/
+QJsonValueView QJsonValueView::const_iterator::value() const noexcept
+{
+    return QJsonValueView(d, entry[stride - 1]);
+}
+
+/*!
+    Decodes the value, including the complete contents of arrays and
+    objects, into a QJsonValue. The result is the same as QJsonDocument would
+    have produced for this part of the document.
+*/
+QJsonValue QJsonValueView::toJsonValue() const
+{
+    switch (type()) {
+    case QJsonValue::Null:
+        return QJsonValue(QJsonValue::Null);
+    case QJsonValue::Bool:
+        return toBool();
+    case QJsonValue::Double:
+        return isInteger() ? QJsonValue(toInteger()) : QJsonValue(toDouble());
+    case QJsonValue::String:
+        return toString();
+    case QJsonValue::Array: {
+        QJsonArray array;
+        for (QJsonValueView element : *this)
+            array.append(element.toJsonValue());
+        return array;
+    }
+    case QJsonValue::Object: {
+        QJsonObject object;
+        for (auto it = begin(); it != end(); ++it)
+            object.insert(it.key().toString(), it.value().toJsonValue());
+        return object;
+    }
+    case QJsonValue::Undefined:
+        break;
+    }
+    return QJsonValue(QJsonValue::Undefined);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,131 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QJSONDOCUMENTVIEW_H
+#define QJSONDOCUMENTVIEW_H
+
+#include <QtCore/qanystringview.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qjsonvalue.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qutf8stringview.h>
+
+#include <iterator>
+
+QT_BEGIN_NAMESPACE
+
+struct QJsonParseError;
+
+class QDocumentViewPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR(QDocumentViewPrivate)
+
+class Q_CORE_EXPORT QJsonValueView
+{
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = qsizetype;
+        using value_type = QJsonValueView;
+        using pointer = void;
+        using reference = QJsonValueView;
+
+        constexpr const_iterator() noexcept = default;
+
+        QJsonValueView key() const noexcept;
+        QJsonValueView value() const noexcept;
+        QJsonValueView operator*() const noexcept { return value(); }
+
+        const_iterator &operator++() noexcept { entry += stride; return *this; }
+        const_iterator operator++(int) noexcept { const_iterator it = *this; ++*this; return it; }
+
+        friend bool operator==(const const_iterator &lhs, const const_iterator &rhs) noexcept
+        { return lhs.entry == rhs.entry; }
+        friend bool operator!=(const const_iterator &lhs, const const_iterator &rhs) noexcept
+        { return lhs.entry != rhs.entry; }
+
+    private:
+        friend class QJsonValueView;
+        constexpr const_iterator(const QDocumentViewPrivate *d, const quint32 *entry, int stride) noexcept
+            : d(d), entry(entry), stride(stride) {}
+
+        const QDocumentViewPrivate *d = nullptr;
+        const quint32 *entry = nullptr;
+        int stride = 1;
+    };
+
+    constexpr QJsonValueView() noexcept = default;
+
+    QJsonValue::Type type() const noexcept;
+    bool isNull() const noexcept { return type() == QJsonValue::Null; }
+    bool isBool() const noexcept { return type() == QJsonValue::Bool; }
+    bool isDouble() const noexcept { return type() == QJsonValue::Double; }
+    bool isString() const noexcept { return type() == QJsonValue::String; }
+    bool isArray() const noexcept { return type() == QJsonValue::Array; }
+    bool isObject() const noexcept { return type() == QJsonValue::Object; }
+    bool isUndefined() const noexcept { return type() == QJsonValue::Undefined; }
+    bool isInteger() const noexcept;
+
+    bool toBool(bool defaultValue = false) const noexcept;
+    qint64 toInteger(qint64 defaultValue = 0) const noexcept;
+    double toDouble(double defaultValue = 0) const noexcept;
+    QString toString(const QString &defaultValue = {}) const;
+    QUtf8StringView toStringView() const noexcept;
+
+    qsizetype size() const noexcept;
+    bool contains(QAnyStringView key) const;
+    QJsonValueView operator[](QAnyStringView key) const;
+    QJsonValueView operator[](qsizetype i) const noexcept;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator constBegin() const noexcept { return begin(); }
+    const_iterator constEnd() const noexcept { return end(); }
+
+    QJsonValue toJsonValue() const;
+
+private:
+    friend class QJsonDocumentView;
+    constexpr QJsonValueView(const QDocumentViewPrivate *d, qsizetype index) noexcept
+        : d(d), index(index) {}
+
+    const QDocumentViewPrivate *d = nullptr;
+    qsizetype index = 0;
+};
+Q_DECLARE_TYPEINFO(QJsonValueView, Q_PRIMITIVE_TYPE);
+
+class Q_CORE_EXPORT QJsonDocumentView
+{
+public:
+    QJsonDocumentView() noexcept;
+    QJsonDocumentView(const QJsonDocumentView &other) noexcept;
+    QJsonDocumentView(QJsonDocumentView &&other) noexcept = default;
+    ~QJsonDocumentView();
+
+    QJsonDocumentView &operator=(const QJsonDocumentView &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QJsonDocumentView)
+
+    void swap(QJsonDocumentView &other) noexcept { d.swap(other.d); }
+
+    static QJsonDocumentView fromJson(const QByteArray &json, QJsonParseError *error = nullptr);
+
+    bool isNull() const noexcept { return !d; }
+    QByteArray data() const;
+
+    QJsonValueView value() const noexcept;
+    bool isArray() const noexcept { return value().isArray(); }
+    bool isObject() const noexcept { return value().isObject(); }
+
+    QJsonValueView operator[](QAnyStringView key) const { return value()[key]; }
+    QJsonValueView operator[](qsizetype i) const noexcept { return value()[i]; }
+
+private:
+    QExplicitlySharedDataPointer<QDocumentViewPrivate> d;
+};
+
+Q_DECLARE_SHARED(QJsonDocumentView)
+
+QT_END_NAMESPACE
+
+#endif // QJSONDOCUMENTVIEW_H
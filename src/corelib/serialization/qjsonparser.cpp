@@ -12,9 +12,10 @@
 #include "private/qstringconverter_p.h"
 #include "private/qcborvalue_p.h"
 #include "private/qnumeric_p.h"
+#include "private/qsimd_p.h"
 #include <private/qtools_p.h>
 
-static const int nestingLimit = 1024;
+#include <cfloat>
 
 QT_BEGIN_NAMESPACE
 
@@ -36,6 +37,7 @@ using namespace QtMiscUtils;
 #define JSONERR_DEEP_NEST   QT_TRANSLATE_NOOP("QJsonParseError", "too deeply nested document")
 #define JSONERR_DOC_LARGE   QT_TRANSLATE_NOOP("QJsonParseError", "too large document")
 #define JSONERR_GARBAGEEND  QT_TRANSLATE_NOOP("QJsonParseError", "garbage at the end of the document")
+#define JSONERR_PREMATURE   QT_TRANSLATE_NOOP("QJsonParseError", "premature end of document")
 
 /*!
     \class QJsonParseError
@@ -71,6 +73,9 @@ using namespace QtMiscUtils;
     \value DeepNesting              The JSON document is too deeply nested for the parser to parse it
     \value DocumentTooLarge         The JSON document is too large for the parser to parse it
     \value GarbageAtEnd             The parsed document contains additional garbage characters at the end
+    \value PrematureEndOfDocument   The input ended before the document was complete. Only reported
+                                    by QJsonStreamReader, which can resume once more data arrives
+                                    (since 6.12)
 
 */
 
@@ -146,6 +151,9 @@ QString QJsonParseError::errorString() const
     case GarbageAtEnd:
         sz = JSONERR_GARBAGEEND;
         break;
+    case PrematureEndOfDocument:
+        sz = JSONERR_PREMATURE;
+        break;
     }
 #ifndef QT_BOOTSTRAPPED
     return QCoreApplication::translate("QJsonParseError", sz);
@@ -154,6 +162,214 @@ QString QJsonParseError::errorString() const
 #endif
 }
 
+namespace QJsonPrivate {
+
+enum class Match { NonSpace, QuoteOrBackslash, QuoteBackslashOrNonAscii };
+
+static inline bool isJsonSpace(char c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+template <Match M> static inline bool matches(char c) noexcept
+{
+    if constexpr (M == Match::NonSpace)
+        return !isJsonSpace(c);
+    else if constexpr (M == Match::QuoteOrBackslash)
+        return c == '"' || c == '\\';
+    else
+        return c == '"' || c == '\\' || uchar(c) >= 0x80;
+}
+
+#if defined(__SSE2__)
+template <Match M> static inline uint matchMask(__m128i data) noexcept
+{
+    if constexpr (M == Match::NonSpace) {
+        const __m128i spaces = _mm_or_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8(' ')),
+                                            _mm_cmpeq_epi8(data, _mm_set1_epi8('\t')));
+        const __m128i newlines = _mm_or_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8('\n')),
+                                              _mm_cmpeq_epi8(data, _mm_set1_epi8('\r')));
+        return ~uint(_mm_movemask_epi8(_mm_or_si128(spaces, newlines))) & 0xffffu;
+    } else {
+        const __m128i special = _mm_or_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8('"')),
+                                             _mm_cmpeq_epi8(data, _mm_set1_epi8('\\')));
+        uint n = _mm_movemask_epi8(special);
+        if constexpr (M == Match::QuoteBackslashOrNonAscii)
+            n |= _mm_movemask_epi8(data);   // sign bit set for non-ASCII
+        return n;
+    }
+}
+
+#  ifdef __AVX2__
+template <Match M> static inline uint matchMask(__m256i data) noexcept
+{
+    if constexpr (M == Match::NonSpace) {
+        const __m256i spaces = _mm256_or_si256(_mm256_cmpeq_epi8(data, _mm256_set1_epi8(' ')),
+                                               _mm256_cmpeq_epi8(data, _mm256_set1_epi8('\t')));
+        const __m256i newlines = _mm256_or_si256(_mm256_cmpeq_epi8(data, _mm256_set1_epi8('\n')),
+                                                 _mm256_cmpeq_epi8(data, _mm256_set1_epi8('\r')));
+        return ~uint(_mm256_movemask_epi8(_mm256_or_si256(spaces, newlines)));
+    } else {
+        const __m256i special = _mm256_or_si256(_mm256_cmpeq_epi8(data, _mm256_set1_epi8('"')),
+                                                _mm256_cmpeq_epi8(data, _mm256_set1_epi8('\\')));
+        uint n = _mm256_movemask_epi8(special);
+        if constexpr (M == Match::QuoteBackslashOrNonAscii)
+            n |= _mm256_movemask_epi8(data);
+        return n;
+    }
+}
+#  endif
+
+template <Match M> static inline const char *simdFind(const char *p, const char *end) noexcept
+{
+#  ifdef __AVX2__
+    for ( ; end - p >= 32; p += 32) {
+        const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        if (uint n = matchMask<M>(data))
+            return p + qCountTrailingZeroBits(n);
+    }
+#  endif
+    for ( ; end - p >= 16; p += 16) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        if (uint n = matchMask<M>(data))
+            return p + qCountTrailingZeroBits(n);
+    }
+    return p;
+}
+#else
+template <Match M> static inline const char *simdFind(const char *p, const char *) noexcept
+{
+    return p;
+}
+#endif
+
+template <Match M> static inline const char *find(const char *p, const char *end) noexcept
+{
+    p = simdFind<M>(p, end);
+    while (p < end && !matches<M>(*p))
+        ++p;
+    return p;
+}
+
+const char *skipWhitespace(const char *json, const char *end) noexcept
+{
+    // tokens are usually separated by no or a single space, so check the
+    // first two characters before setting up the vector scan
+    if (json == end || !isJsonSpace(*json))
+        return json;
+    if (++json == end || !isJsonSpace(*json))
+        return json;
+    return find<Match::NonSpace>(json + 1, end);
+}
+
+const char *findQuoteOrBackslash(const char *json, const char *end) noexcept
+{
+    return find<Match::QuoteOrBackslash>(json, end);
+}
+
+const char *findQuoteBackslashOrNonAscii(const char *json, const char *end) noexcept
+{
+    return find<Match::QuoteBackslashOrNonAscii>(json, end);
+}
+
+// Powers of ten that are exactly representable as double
+static constexpr double exactPowersOf10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+    Converts the number in [begin, end), as delimited by the parser. Integers
+    of up to 18 digits and decimals whose significand fits in 53 bits with a
+    power of ten exponent of at most 22 are converted directly: both operands
+    of the final multiplication or division are then exact, so IEEE 754
+    guarantees a correctly rounded result. Everything else, including
+    malformed numbers, goes through QByteArray's conversions as before.
+*/
+NumberType convertNumber(const char *begin, const char *end, qint64 *integer, double *value)
+{
+    const char *p = begin;
+    const bool negative = p < end && *p == '-';
+    if (negative)
+        ++p;
+
+    quint64 significand = 0;
+    int digits = 0;         // significant digits in significand
+    int exponent = 0;
+    bool isInt = true;
+    bool fast = true;
+    const auto addDigit = [&](char c) {
+        if (digits == 0 && c == '0')
+            return;
+        if (++digits > 19)
+            fast = false;
+        else
+            significand = significand * 10 + uint(c - '0');
+    };
+
+    const char *digitsBegin = p;
+    for ( ; p < end && isAsciiDigit(*p); ++p)
+        addDigit(*p);
+    fast = fast && p != digitsBegin;
+    if (p < end && *p == '.') {
+        isInt = false;
+        digitsBegin = ++p;
+        for ( ; p < end && isAsciiDigit(*p); ++p, --exponent)
+            addDigit(*p);
+        fast = fast && p != digitsBegin;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        isInt = false;
+        ++p;
+        const bool negativeExponent = p < end && *p == '-';
+        if (p < end && (*p == '-' || *p == '+'))
+            ++p;
+        int e = 0;
+        digitsBegin = p;
+        for ( ; p < end && isAsciiDigit(*p) && p - digitsBegin < 4; ++p)
+            e = e * 10 + (*p - '0');
+        fast = fast && p != digitsBegin;
+        exponent += negativeExponent ? -e : e;
+    }
+    fast = fast && p == end;
+
+    if (fast && isInt && digits <= 18) {
+        *integer = negative ? -qint64(significand) : qint64(significand);
+        return NumberType::Integer;
+    }
+
+    double d;
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    if (fast && !isInt && significand <= (Q_UINT64_C(1) << 53)
+            && exponent >= -22 && exponent <= 22) {
+        d = double(significand);
+        d = exponent < 0 ? d / exactPowersOf10[-exponent] : d * exactPowersOf10[exponent];
+        if (negative)
+            d = -d;
+    } else
+#endif
+    {
+        const QByteArray number = QByteArray::fromRawData(begin, end - begin);
+        bool ok;
+        if (isInt) {
+            *integer = number.toLongLong(&ok);
+            if (ok)
+                return NumberType::Integer;
+        }
+
+        d = number.toDouble(&ok);
+        if (!ok)
+            return NumberType::Invalid;
+    }
+
+    if (convertDoubleTo(d, integer))
+        return NumberType::Integer;
+    *value = d;
+    return NumberType::Double;
+}
+
+} // namespace QJsonPrivate
+
 using namespace QJsonPrivate;
 
 class StashedContainer
@@ -240,16 +456,7 @@ void Parser::eatBOM()
 
 bool Parser::eatSpace()
 {
-    while (json < end) {
-        if (*json > Space)
-            break;
-        if (*json != Space &&
-            *json != Tab &&
-            *json != LineFeed &&
-            *json != Return)
-            break;
-        ++json;
-    }
+    json = skipWhitespace(json, end);
     return (json < end);
 }
 
@@ -650,7 +857,6 @@ QCborValue Parser::parseValue()
 QCborValue Parser::parseNumber()
 {
     const char *start = json;
-    bool isInt = true;
 
     // minus
     if (json < end && *json == '-')
@@ -667,15 +873,12 @@ QCborValue Parser::parseNumber()
     // frac = decimal-point 1*DIGIT
     if (json < end && *json == '.') {
         ++json;
-        while (json < end && isAsciiDigit(*json)) {
-            isInt = isInt && *json == '0';
+        while (json < end && isAsciiDigit(*json))
             ++json;
-        }
     }
 
     // exp = e [ minus / plus ] 1*DIGIT
     if (json < end && (*json == 'e' || *json == 'E')) {
-        isInt = false;
         ++json;
         if (json < end && (*json == '-' || *json == '+'))
             ++json;
@@ -683,28 +886,19 @@ QCborValue Parser::parseNumber()
             ++json;
     }
 
-    const QByteArray number = QByteArray::fromRawData(start, json - start);
-
-    if (isInt) {
-        bool ok;
-        qlonglong n = number.toLongLong(&ok);
-        if (ok) {
-            return QCborValue(n);
-        }
-    }
-
-    bool ok;
-    double d = number.toDouble(&ok);
-
-    if (!ok) {
-        lastError = QJsonParseError::IllegalNumber;
-        return QCborValue();
-    }
-
     qint64 n;
-    if (convertDoubleTo(d, &n))
+    double d;
+    switch (convertNumber(start, json, &n, &d)) {
+    case NumberType::Invalid:
+        break;
+    case NumberType::Integer:
         return QCborValue(n);
-    return QCborValue(d);
+    case NumberType::Double:
+        return QCborValue(d);
+    }
+
+    lastError = QJsonParseError::IllegalNumber;
+    return QCborValue();
 }
 
 /*
@@ -729,75 +923,6 @@ QCborValue Parser::parseNumber()
 
         unescaped = %x20-21 / %x23-5B / %x5D-10FFFF
  */
-static inline bool addHexDigit(char digit, char32_t *result)
-{
-    *result <<= 4;
-    const int h = fromHex(digit);
-    if (h != -1) {
-        *result |= h;
-        return true;
-    }
-
-    return false;
-}
-
-static inline bool scanEscapeSequence(const char *&json, const char *end, char32_t *ch)
-{
-    ++json;
-    if (json >= end)
-        return false;
-
-    uchar escaped = *json++;
-    switch (escaped) {
-    case '"':
-        *ch = '"'; break;
-    case '\\':
-        *ch = '\\'; break;
-    case '/':
-        *ch = '/'; break;
-    case 'b':
-        *ch = 0x8; break;
-    case 'f':
-        *ch = 0xc; break;
-    case 'n':
-        *ch = 0xa; break;
-    case 'r':
-        *ch = 0xd; break;
-    case 't':
-        *ch = 0x9; break;
-    case 'u': {
-        *ch = 0;
-        if (json > end - 4)
-            return false;
-        for (int i = 0; i < 4; ++i) {
-            if (!addHexDigit(*json, ch))
-                return false;
-            ++json;
-        }
-        return true;
-    }
-    default:
-        // this is not as strict as one could be, but allows for more Json files
-        // to be parsed correctly.
-        *ch = escaped;
-        return true;
-    }
-    return true;
-}
-
-static inline bool scanUtf8Char(const char *&json, const char *end, char32_t *result)
-{
-    auto usrc = reinterpret_cast<const qchar8_t*>(json);
-    const auto uend = reinterpret_cast<const qchar8_t*>(end);
-    constexpr char32_t Invalid = ~U'\0';
-    const char32_t ch = QUtf8Functions::nextUcs4FromUtf8(usrc, uend, Invalid);
-    if (ch == Invalid)
-        return false;
-    *result = ch;
-    json = reinterpret_cast<const char *>(usrc);
-    return true;
-}
-
 bool Parser::parseString()
 {
     const char *start = json;
@@ -808,6 +933,9 @@ bool Parser::parseString()
     bool isAscii = true;
     while (json < end) {
         char32_t ch = 0;
+        json = findQuoteBackslashOrNonAscii(json, end);
+        if (json == end)
+            break;
         if (*json == '"')
             break;
         if (*json == '\\') {
@@ -845,6 +973,11 @@ bool Parser::parseString()
     QString ucs4;
     while (json < end) {
         char32_t ch = 0;
+        const char *ascii = json;
+        json = findQuoteBackslashOrNonAscii(json, end);
+        ucs4.append(QLatin1StringView(ascii, json - ascii));
+        if (json == end)
+            break;
         if (*json == '"')
             break;
         else if (*json == '\\') {
@@ -18,6 +18,8 @@
 
 #include <QtCore/private/qglobal_p.h>
 #include <QtCore/private/qcborvalue_p.h>
+#include <QtCore/private/qstringconverter_p.h>
+#include <QtCore/private/qtools_p.h>
 #include <QtCore/qjsondocument.h>
 #include <QtCore/qutf8stringview.h>
 
@@ -25,6 +27,85 @@ QT_BEGIN_NAMESPACE
 
 namespace QJsonPrivate {
 
+static constexpr int nestingLimit = 1024;
+
+inline bool addHexDigit(char digit, char32_t *result)
+{
+    *result <<= 4;
+    const int h = QtMiscUtils::fromHex(digit);
+    if (h != -1) {
+        *result |= h;
+        return true;
+    }
+
+    return false;
+}
+
+inline bool scanEscapeSequence(const char *&json, const char *end, char32_t *ch)
+{
+    ++json;
+    if (json >= end)
+        return false;
+
+    uchar escaped = *json++;
+    switch (escaped) {
+    case '"':
+        *ch = '"'; break;
+    case '\\':
+        *ch = '\\'; break;
+    case '/':
+        *ch = '/'; break;
+    case 'b':
+        *ch = 0x8; break;
+    case 'f':
+        *ch = 0xc; break;
+    case 'n':
+        *ch = 0xa; break;
+    case 'r':
+        *ch = 0xd; break;
+    case 't':
+        *ch = 0x9; break;
+    case 'u': {
+        *ch = 0;
+        if (json > end - 4)
+            return false;
+        for (int i = 0; i < 4; ++i) {
+            if (!addHexDigit(*json, ch))
+                return false;
+            ++json;
+        }
+        return true;
+    }
+    default:
+        // this is not as strict as one could be, but allows for more Json files
+        // to be parsed correctly.
+        *ch = escaped;
+        return true;
+    }
+    return true;
+}
+
+inline bool scanUtf8Char(const char *&json, const char *end, char32_t *result)
+{
+    auto usrc = reinterpret_cast<const qchar8_t*>(json);
+    const auto uend = reinterpret_cast<const qchar8_t*>(end);
+    constexpr char32_t Invalid = ~U'\0';
+    const char32_t ch = QUtf8Functions::nextUcs4FromUtf8(usrc, uend, Invalid);
+    if (ch == Invalid)
+        return false;
+    *result = ch;
+    json = reinterpret_cast<const char *>(usrc);
+    return true;
+}
+
+// Vectorized scanners; each returns end if there's no match
+const char *skipWhitespace(const char *json, const char *end) noexcept;
+const char *findQuoteOrBackslash(const char *json, const char *end) noexcept;
+const char *findQuoteBackslashOrNonAscii(const char *json, const char *end) noexcept;
+
+enum class NumberType { Invalid, Integer, Double };
+NumberType convertNumber(const char *begin, const char *end, qint64 *integer, double *value);
+
 class Parser
 {
 public:
@@ -0,0 +1,1096 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:critical reason:data-parser
+
+#include "qjsonstreamreader.h"
+
+#include "qjsonarray.h"
+#include "qjsonobject.h"
+#include "qjsonparser_p.h"
+
+#include <QtCore/qiodevice.h>
+#include <QtCore/qvarlengtharray.h>
+#include <private/qstringconverter_p.h>
+#include <private/qtools_p.h>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QtMiscUtils;
+using namespace Qt::StringLiterals;
+
+/*!
+    \class QJsonStreamReader
+    \inmodule QtCore
+    \ingroup json
+    \ingroup qtserialization
+    \reentrant
+    \since 6.12
+
+    \brief The QJsonStreamReader class is a simple JSON pull parser, operating
+    on either a QByteArray or a QIODevice.
+
+    QJsonStreamReader decodes JSON text one token at a time, without building
+    a QJsonDocument in memory. It is meant for documents that are too large to
+    be held in memory as a whole, or that arrive in pieces, for instance from a
+    QNetworkReply. Its API follows QXmlStreamReader and QCborStreamReader.
+
+    The basic concept is to call readNext() repeatedly. Each call reads the
+    next token and returns its type, which is also available from
+    tokenType(). Scalar values can be read with toString(), toInteger(),
+    toDouble() and toBool(). Values inside an object carry their key, which is
+    returned by name().
+
+    \snippet code/src_corelib_serialization_qjsonstreamreader.cpp 0
+
+    skipCurrentValue() moves past an object or array without decoding it:
+    strings are not converted and numbers are not parsed, only the brackets
+    are matched. readValue() does the opposite and builds a QJsonValue from
+    the current value, including everything it contains. Mixing these lets an
+    application materialize only the parts of a document it is interested in.
+
+    \section1 Incremental parsing
+
+    If the reader runs out of data in the middle of a token, readNext()
+    returns \l Invalid and error() reports
+    QJsonParseError::PrematureEndOfDocument. This is not fatal: once more data
+    has been supplied with addData(), or is available from the device, calling
+    readNext() again resumes where the reader left off. The partial token is
+    not lost.
+
+    The reader can only tell that the document is complete at the end of the
+    input: a top-level number may still get more digits, and anything but
+    whitespace after the top-level value is an error. Until then, instead
+    of such a number or \l EndDocument, readNext() reports
+    QJsonParseError::PrematureEndOfDocument. The end of the input is known
+    when
+    \list
+    \li the data was passed to the constructor, and addData() was not called;
+    \li a random-access device, such as QFile or QBuffer, is at its end;
+    \li the device was closed;
+    \li setEndOfInput() was called.
+    \endlist
+    Data added with addData() and sequential devices, such as sockets, can
+    deliver more data at any time, so their end has to be marked with
+    setEndOfInput().
+
+    \section1 Limits
+
+    QJsonStreamReader enforces the same nesting limit as QJsonDocument, and
+    accepts the same syntax, including a leading UTF-8 byte order mark. Once
+    the top-level value has been read, the next call to readNext() returns
+    \l EndDocument at the end of the input, or fails with
+    QJsonParseError::GarbageAtEnd if anything but whitespace follows.
+
+    \sa QJsonStreamWriter, QJsonDocument, QCborStreamReader, QXmlStreamReader
+*/
+
+/*!
+    \enum QJsonStreamReader::TokenType
+
+    This enum specifies the type of token the reader has just read.
+
+    \value NoToken      The reader has not read anything yet.
+    \value Invalid      An error occurred. It is reported by error(). The
+                        reader can continue after a
+                        QJsonParseError::PrematureEndOfDocument error.
+    \value StartObject  The reader entered an object.
+    \value EndObject    The reader left an object.
+    \value StartArray   The reader entered an array.
+    \value EndArray     The reader left an array.
+    \value String       A string value. Its contents are returned by toString().
+    \value Number       A number. It is returned by toDouble(), or by toInteger()
+                        if isInteger() is \c true.
+    \value Bool         \c true or \c false. The value is returned by toBool().
+    \value Null         A \c null value.
+    \value EndDocument  The reader read the complete document.
+*/
+
+class QJsonStreamReaderPrivate
+{
+public:
+    enum State : quint8 {
+        ExpectDocument,
+        ExpectValueOrEndArray,      // after '['
+        ExpectKeyOrEndObject,       // after '{'
+        ExpectSeparator,            // after a value inside a container
+        ExpectEndOfDocument,        // after the top-level value
+    };
+    enum Result {
+        Token,
+        NeedData,
+        Failed
+    };
+
+    // Bytes requested from the device at a time
+    static constexpr qsizetype ReadChunkSize = 16 * 1024;
+
+    Result parseToken(QJsonStreamReader::TokenType *type);
+    Result parseValue(const char *p, QJsonStreamReader::TokenType *type);
+    Result parseString(const char *&p, QString *result);
+    Result parseNumber(const char *p, QJsonStreamReader::TokenType *type);
+    Result parseLiteral(const char *p, QLatin1StringView literal);
+    Result skip(QJsonStreamReader::TokenType *type);
+
+    Result token(const char *p, State newState)
+    {
+        pos = p - buffer.constData();
+        state = newState;
+        return Token;
+    }
+    Result fail(const char *p, QJsonParseError::ParseError code)
+    {
+        error = code;
+        errorOffset = bufferOffset + (p - buffer.constData());
+        return Failed;
+    }
+    State afterValue() const
+    {
+        return containers.isEmpty() ? ExpectEndOfDocument : ExpectSeparator;
+    }
+    const char *bufferEnd() const { return buffer.constData() + buffer.size(); }
+    bool isInputComplete() const;
+    bool fetchMore();
+    void compact();
+    void reset();
+
+    QIODevice *device = nullptr;
+    QByteArray buffer;
+    // no more data than what's in the buffer or the device
+    bool endOfInput = false;
+    qsizetype pos = 0;
+    qint64 bufferOffset = 0;
+
+    // Where a string that ran out of data starts, and how far it was scanned
+    qsizetype scanStart = -1;
+    qsizetype scanResume = 0;
+    bool scanEscaped = false;
+
+    // true for objects, false for arrays
+    QVarLengthArray<bool, 32> containers;
+    // The depth skipCurrentValue() returns to, or -1 when not skipping
+    qsizetype skipDepth = -1;
+    bool skipInString = false;
+    State state = ExpectDocument;
+
+    QJsonParseError::ParseError error = QJsonParseError::NoError;
+    qint64 errorOffset = -1;
+
+    QString name;
+    QString string;
+    double number = 0;
+    qint64 integer = 0;
+    bool isInteger = false;
+    bool boolean = false;
+};
+
+bool QJsonStreamReaderPrivate::isInputComplete() const
+{
+    if (!device)
+        return endOfInput;
+    if (!device->isOpen())
+        return true;
+    // a sequential device may only be waiting for the next packet
+    return (endOfInput || !device->isSequential()) && device->atEnd();
+}
+
+bool QJsonStreamReaderPrivate::fetchMore()
+{
+    if (!device || !device->isOpen())
+        return false;
+
+    compact();
+    const qsizetype oldSize = buffer.size();
+    const qsizetype chunk = qBound(ReadChunkSize, qsizetype(device->bytesAvailable()),
+                                   qsizetype(1024 * 1024));
+    buffer.resize(oldSize + chunk);
+    const qint64 n = device->read(buffer.data() + oldSize, chunk);
+    buffer.resize(oldSize + qMax(n, qint64(0)));
+    return n > 0;
+}
+
+void QJsonStreamReaderPrivate::compact()
+{
+    // Drop the data that was consumed, once it's worth a move
+    if (pos < ReadChunkSize || pos < buffer.size() / 2)
+        return;
+    buffer.remove(0, pos);
+    bufferOffset += pos;
+    if (scanStart >= 0) {
+        scanStart -= pos;
+        scanResume -= pos;
+    }
+    pos = 0;
+}
+
+void QJsonStreamReaderPrivate::reset()
+{
+    buffer.clear();
+    endOfInput = false;
+    pos = 0;
+    bufferOffset = 0;
+    scanStart = -1;
+    containers.clear();
+    skipDepth = -1;
+    skipInString = false;
+    state = ExpectDocument;
+    error = QJsonParseError::NoError;
+    errorOffset = -1;
+    name.clear();
+    string.clear();
+}
+
+/*
+    Reads one token starting at pos. Nothing is committed unless a complete
+    token was read, so a token that runs out of data is parsed again from its
+    start once more data is available. Only long strings remember how far they
+    got (scanStart/scanResume), so that they aren't scanned quadratically.
+*/
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::parseToken(QJsonStreamReader::TokenType *type)
+{
+    const char *p = buffer.constData() + pos;
+    const char *const end = bufferEnd();
+
+    if (state == ExpectDocument && bufferOffset + pos == 0 && p < end && uchar(*p) == 0xef) {
+        // UTF-8 byte order mark
+        if (end - p < 3)
+            return NeedData;
+        if (uchar(p[1]) == 0xbb && uchar(p[2]) == 0xbf)
+            p += 3;
+    }
+
+    p = QJsonPrivate::skipWhitespace(p, end);
+
+    if (state == ExpectEndOfDocument) {
+        if (p < end)
+            return fail(p, QJsonParseError::GarbageAtEnd);
+        if (!isInputComplete())
+            return NeedData;
+        *type = QJsonStreamReader::EndDocument;
+        return token(p, ExpectEndOfDocument);
+    }
+    if (p == end)
+        return NeedData;
+
+    switch (state) {
+    case ExpectDocument:
+        return parseValue(p, type);
+
+    case ExpectValueOrEndArray:
+        if (*p == ']') {
+            containers.removeLast();
+            *type = QJsonStreamReader::EndArray;
+            return token(p + 1, afterValue());
+        }
+        return parseValue(p, type);
+
+    case ExpectSeparator:
+        if (*p == (containers.last() ? '}' : ']')) {
+            *type = containers.last() ? QJsonStreamReader::EndObject : QJsonStreamReader::EndArray;
+            containers.removeLast();
+            return token(p + 1, afterValue());
+        }
+        if (*p != ',') {
+            return fail(p, containers.last() ? QJsonParseError::UnterminatedObject
+                                             : QJsonParseError::MissingValueSeparator);
+        }
+        ++p;
+        p = QJsonPrivate::skipWhitespace(p, end);
+        if (p == end)
+            return NeedData;
+        if (!containers.last())
+            return parseValue(p, type);
+        if (*p == '}')
+            return fail(p, QJsonParseError::MissingObject);
+        break;
+
+    case ExpectKeyOrEndObject:
+        if (*p == '}') {
+            containers.removeLast();
+            *type = QJsonStreamReader::EndObject;
+            return token(p + 1, afterValue());
+        }
+        break;
+
+    case ExpectEndOfDocument:
+        Q_UNREACHABLE_RETURN(Failed);
+    }
+
+    // member = string name-separator value
+    if (*p != '"')
+        return fail(p, QJsonParseError::UnterminatedObject);
+    if (Result r = parseString(p, &name); r != Token)
+        return r;
+    p = QJsonPrivate::skipWhitespace(p, end);
+    if (p == end)
+        return NeedData;
+    if (*p != ':')
+        return fail(p, QJsonParseError::MissingNameSeparator);
+    ++p;
+    p = QJsonPrivate::skipWhitespace(p, end);
+    if (p == end)
+        return NeedData;
+    return parseValue(p, type);
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::parseValue(const char *p, QJsonStreamReader::TokenType *type)
+{
+    switch (*p) {
+    case '{':
+    case '[':
+        if (containers.size() >= QJsonPrivate::nestingLimit)
+            return fail(p, QJsonParseError::DeepNesting);
+        containers.append(*p == '{');
+        *type = *p == '{' ? QJsonStreamReader::StartObject : QJsonStreamReader::StartArray;
+        return token(p + 1, *p == '{' ? ExpectKeyOrEndObject : ExpectValueOrEndArray);
+    case '"':
+        if (Result r = parseString(p, &string); r != Token)
+            return r;
+        *type = QJsonStreamReader::String;
+        return token(p, afterValue());
+    case 't':
+        boolean = true;
+        *type = QJsonStreamReader::Bool;
+        return parseLiteral(p, "true"_L1);
+    case 'f':
+        boolean = false;
+        *type = QJsonStreamReader::Bool;
+        return parseLiteral(p, "false"_L1);
+    case 'n':
+        *type = QJsonStreamReader::Null;
+        return parseLiteral(p, "null"_L1);
+    case ',':
+        // Essentially missing value, but after a colon, not after a comma
+        // like the other MissingObject errors.
+        return fail(p, QJsonParseError::IllegalValue);
+    case ']':
+    case '}':
+        return fail(p, QJsonParseError::MissingObject);
+    default:
+        return parseNumber(p, type);
+    }
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::parseLiteral(const char *p, QLatin1StringView literal)
+{
+    const qsizetype available = qMin(bufferEnd() - p, literal.size());
+    if (QLatin1StringView(p, available) != literal.first(available))
+        return fail(p, QJsonParseError::IllegalValue);
+    if (available < literal.size())
+        return NeedData;
+    return token(p + literal.size(), afterValue());
+}
+
+// Same grammar and conversions as QJsonPrivate::Parser::parseNumber()
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::parseNumber(const char *p, QJsonStreamReader::TokenType *type)
+{
+    const char *const start = p;
+    const char *const end = bufferEnd();
+
+    if (p < end && *p == '-')
+        ++p;
+    if (p < end && *p == '0') {
+        ++p;
+    } else {
+        while (p < end && isAsciiDigit(*p))
+            ++p;
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        while (p < end && isAsciiDigit(*p))
+            ++p;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        if (p < end && (*p == '-' || *p == '+'))
+            ++p;
+        while (p < end && isAsciiDigit(*p))
+            ++p;
+    }
+
+    // More digits may still be on their way
+    if (p == end && (!containers.isEmpty() || !isInputComplete()))
+        return NeedData;
+
+    switch (QJsonPrivate::convertNumber(start, p, &integer, &number)) {
+    case QJsonPrivate::NumberType::Invalid:
+        return fail(start, QJsonParseError::IllegalNumber);
+    case QJsonPrivate::NumberType::Integer:
+        isInteger = true;
+        break;
+    case QJsonPrivate::NumberType::Double:
+        isInteger = false;
+        break;
+    }
+    *type = QJsonStreamReader::Number;
+    return token(p, afterValue());
+}
+
+// Same escape and UTF-8 handling as QJsonPrivate::Parser::parseString()
+QJsonStreamReaderPrivate::Result QJsonStreamReaderPrivate::parseString(const char *&p,
+                                                                       QString *result)
+{
+    const char *const begin = buffer.constData();
+    const char *const end = bufferEnd();
+    const char *const start = p + 1;
+    const char *s = start;
+    bool escaped = false;
+    if (scanStart == start - begin) {
+        s = begin + scanResume;
+        escaped = scanEscaped;
+    }
+
+    // find the terminating quote first
+    while (true) {
+        s = QJsonPrivate::findQuoteOrBackslash(s, end);
+        if (s < end && *s == '"')
+            break;
+        if (end - s < 2) {
+            scanStart = start - begin;
+            scanResume = s - begin;
+            scanEscaped = escaped;
+            return NeedData;
+        }
+        escaped = true;
+        s += 2;
+    }
+    scanStart = -1;
+
+    if (!escaped) {
+        const QByteArrayView utf8(start, s - start);
+        const auto validation = QUtf8::isValidUtf8(utf8);
+        if (!validation.isValidUtf8)
+            return fail(start, QJsonParseError::IllegalUTF8String);
+        *result = validation.isValidAscii ? QString::fromLatin1(utf8) : QString::fromUtf8(utf8);
+        p = s + 1;
+        return Token;
+    }
+
+    QString decoded;
+    decoded.reserve(s - start);
+    const char *json = start;
+    while (json < s) {
+        char32_t ch = 0;
+        const char *const character = json;
+        if (*json == '\\') {
+            if (!QJsonPrivate::scanEscapeSequence(json, s, &ch))
+                return fail(character, QJsonParseError::IllegalEscapeSequence);
+        } else if (!QJsonPrivate::scanUtf8Char(json, s, &ch)) {
+            return fail(character, QJsonParseError::IllegalUTF8String);
+        }
+        decoded.append(QChar::fromUcs4(ch));
+    }
+    *result = std::move(decoded);
+    p = s + 1;
+    return Token;
+}
+
+/*
+    Continues skipping until the container depth drops back to skipDepth.
+    Unlike parseToken() this consumes the input as it goes, as no token is
+    reported until the end.
+*/
+QJsonStreamReaderPrivate::Result QJsonStreamReaderPrivate::skip(QJsonStreamReader::TokenType *type)
+{
+    const char *p = buffer.constData() + pos;
+    const char *const end = bufferEnd();
+
+    while (p < end) {
+        if (skipInString) {
+            p = QJsonPrivate::findQuoteOrBackslash(p, end);
+            if (p == end)
+                break;
+            if (*p == '\\') {
+                if (end - p < 2)
+                    break;
+                p += 2;
+                continue;
+            }
+            skipInString = false;
+            ++p;
+            continue;
+        }
+
+        switch (*p) {
+        case '"':
+            skipInString = true;
+            break;
+        case '{':
+        case '[':
+            if (containers.size() >= QJsonPrivate::nestingLimit)
+                return fail(p, QJsonParseError::DeepNesting);
+            containers.append(*p == '{');
+            break;
+        case '}':
+        case ']':
+            if (containers.last() != (*p == '}')) {
+                return fail(p, containers.last() ? QJsonParseError::UnterminatedObject
+                                                 : QJsonParseError::UnterminatedArray);
+            }
+            containers.removeLast();
+            if (containers.size() == skipDepth) {
+                *type = *p == '}' ? QJsonStreamReader::EndObject : QJsonStreamReader::EndArray;
+                skipDepth = -1;
+                return token(p + 1, afterValue());
+            }
+            break;
+        }
+        ++p;
+    }
+
+    pos = p - buffer.constData();
+    return NeedData;
+}
+
+/*!
+    Creates a QJsonStreamReader object with no source data. After
+    construction, QJsonStreamReader will report an error parsing.
+
+    You can add more data by calling addData() or by setting a different
+    source device using setDevice().
+
+    \sa addData(), setDevice()
+*/
+QJsonStreamReader::QJsonStreamReader()
+    : d(new QJsonStreamReaderPrivate)
+{
+}
+
+/*!
+    Creates a QJsonStreamReader object with \a len bytes of data starting at
+    \a data. The pointer must remain valid until QJsonStreamReader is
+    destroyed.
+
+    The data is taken to be the complete document, unless addData() is
+    called.
+*/
+QJsonStreamReader::QJsonStreamReader(const char *data, qsizetype len)
+    : QJsonStreamReader(QByteArray::fromRawData(data, len))
+{
+}
+
+/*!
+    Creates a QJsonStreamReader object that will parse the JSON text in
+    \a data. The data is shared, not copied.
+
+    The data is taken to be the complete document, unless addData() is
+    called.
+*/
+QJsonStreamReader::QJsonStreamReader(const QByteArray &data)
+    : d(new QJsonStreamReaderPrivate)
+{
+    d->buffer = data;
+    d->endOfInput = true;
+}
+
+/*!
+    Creates a QJsonStreamReader object that will read the JSON text from
+    \a device. The device must be open and must remain valid until
+    QJsonStreamReader is destroyed or another device is set.
+
+    \sa setDevice()
+*/
+QJsonStreamReader::QJsonStreamReader(QIODevice *device)
+    : d(new QJsonStreamReaderPrivate)
+{
+    d->device = device;
+}
+
+/*!
+    Destroys this QJsonStreamReader object and frees any associated resources.
+*/
+QJsonStreamReader::~QJsonStreamReader()
+    = default;
+
+/*!
+    Sets the source of data to \a device, resetting the decoder to its initial
+    state.
+
+    \sa device(), clear()
+*/
+void QJsonStreamReader::setDevice(QIODevice *device)
+{
+    d->reset();
+    d->device = device;
+    type_ = NoToken;
+}
+
+/*!
+    Returns the QIODevice that was set with either setDevice() or the
+    QJsonStreamReader constructor. If this object was reading from a
+    QByteArray, this function returns \nullptr instead.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamReader::device() const
+{
+    return d->device;
+}
+
+/*!
+    Adds \a data to the JSON text being read. This function can only be
+    called if the reader was constructed with a QByteArray or with no data;
+    calling it when reading from a QIODevice has no effect.
+
+    If the reader was waiting for more data, the next call to readNext()
+    continues with the token that was incomplete.
+
+    As more data may follow, the reader can't finish the document until
+    setEndOfInput() is called.
+
+    \sa readNext(), atEnd(), setEndOfInput()
+*/
+void QJsonStreamReader::addData(const QByteArray &data)
+{
+    if (d->device) {
+        qWarning("QJsonStreamReader: addData() with device()");
+        return;
+    }
+    d->endOfInput = false;
+    if (d->buffer.isEmpty() && d->pos == 0)
+        d->buffer = data;
+    else
+        d->buffer.append(data);
+}
+
+/*!
+    \overload
+
+    Adds \a len bytes of data starting at \a data. The data is copied.
+*/
+void QJsonStreamReader::addData(const char *data, qsizetype len)
+{
+    addData(QByteArray(data, len));
+}
+
+/*!
+    Tells the reader that no more data follows what was added with
+    addData(), or what the device() has available. This lets the reader
+    finish a number at the end of the document, and report \l EndDocument.
+
+    Call this once all data was added, or when a sequential device, such
+    as a socket, won't receive any more data. It is not needed for the data
+    passed to the constructor, or for random-access devices.
+
+    \sa addData(), readNext()
+*/
+void QJsonStreamReader::setEndOfInput()
+{
+    d->endOfInput = true;
+}
+
+/*!
+    Clears the decoder state and resets the input source data to an empty byte
+    array. After this function is called, QJsonStreamReader will be
+    indicating an error parsing.
+
+    Call addData() to add more data to be parsed.
+
+    \sa addData(), setDevice()
+*/
+void QJsonStreamReader::clear()
+{
+    setDevice(nullptr);
+}
+
+/*!
+    Returns \c true if the reader has read until the end of the JSON document,
+    or if an error() has occurred and reading has been aborted. Otherwise, it
+    returns \c false.
+
+    When atEnd() and hasError() return \c true and error() reports
+    QJsonParseError::PrematureEndOfDocument, the document has been
+    well-formed so far, but is not complete. The next chunk can be added with
+    addData() if the text is being read from a QByteArray, or the reader can
+    wait for more data to arrive on its device().
+
+    \sa hasError(), error(), readNext()
+*/
+bool QJsonStreamReader::atEnd() const
+{
+    return type_ == EndDocument || type_ == Invalid;
+}
+
+/*!
+    Returns \c true if an error has occurred, otherwise \c false.
+
+    \sa error(), errorString()
+*/
+bool QJsonStreamReader::hasError() const
+{
+    return d->error != QJsonParseError::NoError;
+}
+
+/*!
+    Returns the last error that occurred. Its offset is the position of the
+    offending character in the input; QJsonDocument::fromJson() usually
+    reports the position right after it.
+
+    \sa hasError(), errorString()
+*/
+QJsonParseError QJsonStreamReader::error() const
+{
+    QJsonParseError result;
+    result.error = d->error;
+    result.offset = decltype(result.offset)(d->errorOffset);
+    return result;
+}
+
+/*!
+    Returns a human-readable description of the last error that occurred.
+
+    \sa error()
+*/
+QString QJsonStreamReader::errorString() const
+{
+    return error().errorString();
+}
+
+/*!
+    Returns the offset in the input stream of the data that the reader will
+    read next. This is the position right after the current token.
+*/
+qint64 QJsonStreamReader::currentOffset() const
+{
+    return d->bufferOffset + d->pos;
+}
+
+/*!
+    Reads the next token and returns its type.
+
+    If the data ends in the middle of a token, this function returns
+    \l Invalid and error() reports QJsonParseError::PrematureEndOfDocument.
+    Calling it again after more data became available continues with the
+    same token. Any other error is final.
+
+    Once the whole document was read, this function keeps returning
+    \l EndDocument.
+
+    \sa tokenType(), readNextValue(), atEnd()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::readNext()
+{
+    if (d->error != QJsonParseError::NoError
+            && d->error != QJsonParseError::PrematureEndOfDocument) {
+        return Invalid;
+    }
+    if (type_ == EndDocument)
+        return EndDocument;
+    if (d->skipDepth >= 0) {
+        skipCurrentValue();
+        return tokenType();
+    }
+
+    d->compact();
+    d->error = QJsonParseError::NoError;
+    d->name.clear();
+    d->string.clear();
+    d->isInteger = false;
+
+    TokenType type = Invalid;
+    while (true) {
+        switch (d->parseToken(&type)) {
+        case QJsonStreamReaderPrivate::Token:
+            type_ = type;
+            return type;
+        case QJsonStreamReaderPrivate::Failed:
+            type_ = Invalid;
+            return Invalid;
+        case QJsonStreamReaderPrivate::NeedData:
+            if (d->fetchMore())
+                continue;
+            d->error = QJsonParseError::PrematureEndOfDocument;
+            d->errorOffset = d->bufferOffset + d->buffer.size();
+            type_ = Invalid;
+            return Invalid;
+        }
+    }
+}
+
+/*!
+    Reads the next token and returns \c true if it is a value: an object, an
+    array, or a scalar. Returns \c false if the token ends the current
+    container or the document, or if an error occurred.
+
+    This allows iterating over the contents of a container:
+
+    \snippet code/src_corelib_serialization_qjsonstreamreader.cpp 1
+
+    \sa readNext(), skipCurrentValue()
+*/
+bool QJsonStreamReader::readNextValue()
+{
+    switch (readNext()) {
+    case StartObject:
+    case StartArray:
+    case String:
+    case Number:
+    case Bool:
+    case Null:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*!
+    If the current token is \l StartObject or \l StartArray, skips to the end
+    of that container, so that the current token becomes the matching
+    \l EndObject or \l EndArray. The contents are not decoded; only the
+    brackets are matched and the strings are checked to be terminated.
+
+    For any other token, this function does nothing and returns \c true.
+
+    Returns \c false if an error occurred. If the error is
+    QJsonParseError::PrematureEndOfDocument, calling this function or
+    readNext() again once more data is available continues skipping.
+
+    \sa readValue(), readNextValue()
+*/
+bool QJsonStreamReader::skipCurrentValue()
+{
+    if (d->skipDepth < 0) {
+        if (type_ != StartObject && type_ != StartArray)
+            return true;
+        d->skipDepth = d->containers.size() - 1;
+        d->skipInString = false;
+    }
+
+    d->error = QJsonParseError::NoError;
+    while (true) {
+        d->compact();
+        TokenType type = Invalid;
+        switch (d->skip(&type)) {
+        case QJsonStreamReaderPrivate::Token:
+            d->name.clear();
+            d->string.clear();
+            type_ = type;
+            return true;
+        case QJsonStreamReaderPrivate::Failed:
+            d->skipDepth = -1;
+            type_ = Invalid;
+            return false;
+        case QJsonStreamReaderPrivate::NeedData:
+            if (d->fetchMore())
+                continue;
+            d->error = QJsonParseError::PrematureEndOfDocument;
+            d->errorOffset = d->bufferOffset + d->buffer.size();
+            type_ = Invalid;
+            return false;
+        }
+    }
+}
+
+/*!
+    Returns the current value as a QJsonValue. If the current token is
+    \l StartObject or \l StartArray, this reads the whole container, leaving
+    the reader on the matching \l EndObject or \l EndArray token.
+
+    Returns QJsonValue::Undefined if the current token is not a value, or if
+    an error occurred while reading the container. Unlike the other
+    functions, this one cannot resume after a
+    QJsonParseError::PrematureEndOfDocument error.
+
+    \sa skipCurrentValue(), QJsonDocument::fromJson()
+*/
+QJsonValue QJsonStreamReader::readValue()
+{
+    switch (tokenType()) {
+    case String:
+        return d->string;
+    case Number:
+        return d->isInteger ? QJsonValue(d->integer) : QJsonValue(d->number);
+    case Bool:
+        return d->boolean;
+    case Null:
+        return QJsonValue::Null;
+    case StartArray: {
+        QJsonArray array;
+        while (readNextValue())
+            array.append(readValue());
+        if (!isEndArray())
+            return QJsonValue::Undefined;
+        return array;
+    }
+    case StartObject: {
+        QJsonObject object;
+        while (readNextValue()) {
+            const QString key = d->name;
+            object.insert(key, readValue());
+        }
+        if (!isEndObject())
+            return QJsonValue::Undefined;
+        return object;
+    }
+    default:
+        return QJsonValue::Undefined;
+    }
+}
+
+/*!
+    \fn QJsonStreamReader::TokenType QJsonStreamReader::tokenType() const
+
+    Returns the type of the current token.
+
+    \sa readNext()
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isStartObject() const
+
+    Returns \c true if tokenType() equals \l StartObject; otherwise returns
+    \c false.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isEndObject() const
+
+    Returns \c true if tokenType() equals \l EndObject; otherwise returns
+    \c false.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isStartArray() const
+
+    Returns \c true if tokenType() equals \l StartArray; otherwise returns
+    \c false.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isEndArray() const
+
+    Returns \c true if tokenType() equals \l EndArray; otherwise returns
+    \c false.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isString() const
+
+    Returns \c true if tokenType() equals \l String; otherwise returns
+    \c false.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isNumber() const
+
+    Returns \c true if tokenType() equals \l Number; otherwise returns
+    \c false.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isBool() const
+
+    Returns \c true if tokenType() equals \l Bool; otherwise returns
+    \c false.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isNull() const
+
+    Returns \c true if tokenType() equals \l Null; otherwise returns
+    \c false.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isEndDocument() const
+
+    Returns \c true if tokenType() equals \l EndDocument; otherwise returns
+    \c false.
+*/
+
+/*!
+    Returns the number of objects and arrays that contain the current token.
+    This is 0 for the top-level value.
+
+    \sa parentContainerType()
+*/
+int QJsonStreamReader::containerDepth() const
+{
+    const qsizetype depth = d->containers.size();
+    return int(type_ == StartObject || type_ == StartArray ? depth - 1 : depth);
+}
+
+/*!
+    Returns QJsonValue::Object or QJsonValue::Array depending on the type of
+    the container that holds the current token, or QJsonValue::Null for the
+    top-level value.
+
+    \sa containerDepth()
+*/
+QJsonValue::Type QJsonStreamReader::parentContainerType() const
+{
+    const int depth = containerDepth();
+    if (depth == 0)
+        return QJsonValue::Null;
+    return d->containers[depth - 1] ? QJsonValue::Object : QJsonValue::Array;
+}
+
+/*!
+    Returns the key of the current value if it is part of an object, or a
+    null string otherwise.
+*/
+QString QJsonStreamReader::name() const
+{
+    return d->name;
+}
+
+/*!
+    Returns the contents of the current token if it is a \l String, or a null
+    string otherwise.
+*/
+QString QJsonStreamReader::toString() const
+{
+    return d->string;
+}
+
+/*!
+    Returns \c true if the current token is a \l Number that can be
+    represented as a 64-bit integer without losing precision, like
+    QJsonValue::isDouble() with an integer value.
+
+    \sa toInteger(), toDouble()
+*/
+bool QJsonStreamReader::isInteger() const
+{
+    return type_ == Number && d->isInteger;
+}
+
+/*!
+    Returns the current number as a 64-bit integer if isInteger() returns
+    \c true, or \a defaultValue otherwise.
+
+    \sa toDouble()
+*/
+qint64 QJsonStreamReader::toInteger(qint64 defaultValue) const
+{
+    return isInteger() ? d->integer : defaultValue;
+}
+
+/*!
+    Returns the current number as a double if the current token is a
+    \l Number, or \a defaultValue otherwise.
+
+    \sa toInteger()
+*/
+double QJsonStreamReader::toDouble(double defaultValue) const
+{
+    if (type_ != Number)
+        return defaultValue;
+    return d->isInteger ? double(d->integer) : d->number;
+}
+
+/*!
+    Returns the current value if the current token is a \l Bool, or
+    \a defaultValue otherwise.
+*/
+bool QJsonStreamReader::toBool(bool defaultValue) const
+{
+    return type_ == Bool ? d->boolean : defaultValue;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qjsonstreamreader.cpp"
@@ -0,0 +1,93 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:critical reason:data-parser
+
+#ifndef QJSONSTREAMREADER_H
+#define QJSONSTREAMREADER_H
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qjsonparseerror.h>
+#include <QtCore/qjsonvalue.h>
+#include <QtCore/qobjectdefs.h>
+#include <QtCore/qstring.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+class QJsonStreamReaderPrivate;
+class Q_CORE_EXPORT QJsonStreamReader
+{
+    Q_GADGET
+public:
+    enum TokenType : quint8 {
+        NoToken = 0,
+        Invalid,
+        StartObject,
+        EndObject,
+        StartArray,
+        EndArray,
+        String,
+        Number,
+        Bool,
+        Null,
+        EndDocument
+    };
+    Q_ENUM(TokenType)
+
+    QJsonStreamReader();
+    QJsonStreamReader(const char *data, qsizetype len);
+    explicit QJsonStreamReader(const QByteArray &data);
+    explicit QJsonStreamReader(QIODevice *device);
+    ~QJsonStreamReader();
+    Q_DISABLE_COPY(QJsonStreamReader)
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+    void addData(const QByteArray &data);
+    void addData(const char *data, qsizetype len);
+    void setEndOfInput();
+    void clear();
+
+    bool atEnd() const;
+    bool hasError() const;
+    QJsonParseError error() const;
+    QString errorString() const;
+    qint64 currentOffset() const;
+
+    TokenType readNext();
+    bool readNextValue();
+    bool skipCurrentValue();
+    QJsonValue readValue();
+
+    TokenType tokenType() const     { return TokenType(type_); }
+    bool isStartObject() const      { return tokenType() == StartObject; }
+    bool isEndObject() const        { return tokenType() == EndObject; }
+    bool isStartArray() const       { return tokenType() == StartArray; }
+    bool isEndArray() const         { return tokenType() == EndArray; }
+    bool isString() const           { return tokenType() == String; }
+    bool isNumber() const           { return tokenType() == Number; }
+    bool isBool() const             { return tokenType() == Bool; }
+    bool isNull() const             { return tokenType() == Null; }
+    bool isEndDocument() const      { return tokenType() == EndDocument; }
+
+    int containerDepth() const;
+    QJsonValue::Type parentContainerType() const;
+
+    QString name() const;
+    QString toString() const;
+    bool isInteger() const;
+    qint64 toInteger(qint64 defaultValue = 0) const;
+    double toDouble(double defaultValue = 0) const;
+    bool toBool(bool defaultValue = false) const;
+
+private:
+    std::unique_ptr<QJsonStreamReaderPrivate> d;
+    quint8 type_ = NoToken;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONSTREAMREADER_H
@@ -0,0 +1,481 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonstreamwriter.h"
+
+#include "qjsonvalue.h"
+#include "qjsonwriter_p.h"
+
+#include <QtCore/qcborvalue.h>
+#include <QtCore/qiodevice.h>
+#include <QtCore/qlocale.h>
+#include <QtCore/qvarlengtharray.h>
+#include <private/qnumeric_p.h>
+#include <private/qstringconverter_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QJsonStreamWriter
+    \inmodule QtCore
+    \ingroup json
+    \ingroup qtserialization
+    \reentrant
+    \since 6.12
+
+    \brief The QJsonStreamWriter class is a simple JSON encoder operating on a
+    one-way stream.
+
+    This class writes JSON text directly to a QIODevice or a QByteArray,
+    without building a QJsonDocument first. It is the counterpart of
+    QJsonStreamReader and follows the API of QCborStreamWriter.
+
+    Objects and arrays are opened with startObject() and startArray() and
+    closed with endObject() and endArray(). Inside an object, each value must
+    be preceded by its key, written with appendKey(). The append() overloads
+    write scalar values, and appendValue() writes a whole value
+    that was built in memory.
+
+    \snippet code/src_corelib_serialization_qjsonstreamwriter.cpp 0
+
+    By default the output is indented the way QJsonDocument::toJson() formats
+    it, so writing the same content produces the same text. Use setFormat() to
+    produce compact output instead.
+
+    When writing to a QIODevice, the output is buffered and written out in
+    blocks. Call flush() to write what is pending; the destructor does that as
+    well.
+
+    QJsonStreamWriter does not validate the structure it writes beyond
+    assertions in debug builds: the application is responsible for writing
+    exactly one top-level value, and for pairing keys with values.
+
+    \sa QJsonStreamReader, QJsonDocument, QCborStreamWriter
+*/
+
+class QJsonStreamWriterPrivate
+{
+public:
+    // Output is handed to the device in blocks of this size
+    static constexpr qsizetype FlushThreshold = 16 * 1024;
+
+    struct Container
+    {
+        bool isObject;
+        bool isEmpty;
+    };
+
+    QByteArray &output() { return device ? buffer : *data; }
+    void beforeValue();
+    void appendEscaped(QAnyStringView str);
+    void appendIndent(qsizetype depth)
+    {
+        if (!compact)
+            output().append(4 * depth, ' ');
+    }
+    void afterValue()
+    {
+        if (device && buffer.size() >= FlushThreshold)
+            flush();
+    }
+    void flush();
+
+    QIODevice *device = nullptr;
+    QByteArray *data = nullptr;
+    QByteArray buffer;
+    QVarLengthArray<Container, 16> containers;
+    bool compact = false;
+    bool keyWritten = false;
+    bool hasError = false;
+};
+
+void QJsonStreamWriterPrivate::beforeValue()
+{
+    if (containers.isEmpty())
+        return;
+
+    Container &container = containers.last();
+    if (container.isObject) {
+        Q_ASSERT_X(keyWritten, "QJsonStreamWriter", "value in an object without a key");
+        keyWritten = false;
+        return;
+    }
+
+    QByteArray &json = output();
+    if (!container.isEmpty)
+        json += compact ? "," : ",\n";
+    container.isEmpty = false;
+    appendIndent(containers.size());
+}
+
+void QJsonStreamWriterPrivate::appendEscaped(QAnyStringView str)
+{
+    QByteArray &json = output();
+    json += '"';
+    str.visit([&json](auto s) {
+        using View = decltype(s);
+        if constexpr (std::is_same_v<View, QStringView>) {
+            json += QJsonPrivate::Writer::escapedString(s);
+        } else if constexpr (std::is_same_v<View, QLatin1StringView>) {
+            if (!QtPrivate::isAscii(s)) {
+                json += QJsonPrivate::Writer::escapedString(QString(s));
+                return;
+            }
+        }
+
+        if constexpr (!std::is_same_v<View, QStringView>) {
+            // UTF-8 and US-ASCII: copy the runs that need no escaping as they are
+            static constexpr char hexDigits[] = "0123456789abcdef";
+            const char *p = s.data();
+            const char *const end = p + s.size();
+            while (p != end) {
+                const char *run = p;
+                while (p != end && uchar(*p) >= 0x20 && *p != '"' && *p != '\\')
+                    ++p;
+                json.append(run, p - run);
+                if (p == end)
+                    break;
+
+                const uchar c = uchar(*p++);
+                json += '\\';
+                switch (c) {
+                case '"':  json += '"'; break;
+                case '\\': json += '\\'; break;
+                case 0x8:  json += 'b'; break;
+                case 0xc:  json += 'f'; break;
+                case 0xa:  json += 'n'; break;
+                case 0xd:  json += 'r'; break;
+                case 0x9:  json += 't'; break;
+                default:
+                    json += "u00";
+                    json += hexDigits[c >> 4];
+                    json += hexDigits[c & 0xf];
+                }
+            }
+        }
+    });
+    json += '"';
+}
+
+void QJsonStreamWriterPrivate::flush()
+{
+    if (!device || buffer.isEmpty())
+        return;
+    if (device->write(buffer) != buffer.size())
+        hasError = true;
+    buffer.clear();
+}
+
+/*!
+    Creates a QJsonStreamWriter object that will write the JSON text to
+    \a device. The device must be open before the first value is written.
+    This constructor can be used with any QIODevice, including QBuffer.
+
+    \sa setDevice()
+*/
+QJsonStreamWriter::QJsonStreamWriter(QIODevice *device)
+    : d(new QJsonStreamWriterPrivate)
+{
+    d->device = device;
+}
+
+/*!
+    Creates a QJsonStreamWriter object that will append the JSON text to
+    \a data. The output is written directly, without buffering.
+*/
+QJsonStreamWriter::QJsonStreamWriter(QByteArray *data)
+    : d(new QJsonStreamWriterPrivate)
+{
+    d->data = data;
+}
+
+/*!
+    Destroys this QJsonStreamWriter object, writing any pending output to the
+    device first.
+*/
+QJsonStreamWriter::~QJsonStreamWriter()
+{
+    d->flush();
+}
+
+/*!
+    Replaces the device or byte array that this QJsonStreamWriter object is
+    writing to with \a device. Pending output is written to the previous
+    device first.
+
+    \sa device()
+*/
+void QJsonStreamWriter::setDevice(QIODevice *device)
+{
+    d->flush();
+    d->device = device;
+    d->data = nullptr;
+}
+
+/*!
+    Returns the QIODevice that this QJsonStreamWriter object is writing to,
+    or \nullptr if it is writing to a QByteArray.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamWriter::device() const
+{
+    return d->device;
+}
+
+/*!
+    Sets the output format to \a format. The default is
+    QJsonDocument::Indented. The format should only be changed before
+    anything was written.
+
+    \sa format()
+*/
+void QJsonStreamWriter::setFormat(QJsonDocument::JsonFormat format)
+{
+    d->compact = format == QJsonDocument::Compact;
+}
+
+/*!
+    Returns the output format.
+
+    \sa setFormat()
+*/
+QJsonDocument::JsonFormat QJsonStreamWriter::format() const
+{
+    return d->compact ? QJsonDocument::Compact : QJsonDocument::Indented;
+}
+
+/*!
+    Starts a JSON object. The object must be closed with endObject(). Inside
+    it, every value must be preceded by a call to appendKey().
+
+    \sa endObject(), startArray()
+*/
+void QJsonStreamWriter::startObject()
+{
+    d->beforeValue();
+    d->output() += d->compact ? "{" : "{\n";
+    d->containers.append({ true, true });
+}
+
+/*!
+    Ends the object started by startObject(). Returns \c true if an object
+    was open, \c false otherwise.
+
+    \sa startObject()
+*/
+bool QJsonStreamWriter::endObject()
+{
+    if (d->containers.isEmpty() || !d->containers.last().isObject)
+        return false;
+
+    const bool isEmpty = d->containers.last().isEmpty;
+    d->containers.removeLast();
+    QByteArray &json = d->output();
+    if (!d->compact && !isEmpty)
+        json += '\n';
+    d->appendIndent(d->containers.size());
+    json += d->compact || !d->containers.isEmpty() ? "}" : "}\n";
+    d->afterValue();
+    return true;
+}
+
+/*!
+    Starts a JSON array. The array must be closed with endArray().
+
+    \sa endArray(), startObject()
+*/
+void QJsonStreamWriter::startArray()
+{
+    d->beforeValue();
+    d->output() += d->compact ? "[" : "[\n";
+    d->containers.append({ false, true });
+}
+
+/*!
+    Ends the array started by startArray(). Returns \c true if an array was
+    open, \c false otherwise.
+
+    \sa startArray()
+*/
+bool QJsonStreamWriter::endArray()
+{
+    if (d->containers.isEmpty() || d->containers.last().isObject)
+        return false;
+
+    const bool isEmpty = d->containers.last().isEmpty;
+    d->containers.removeLast();
+    QByteArray &json = d->output();
+    if (!d->compact && !isEmpty)
+        json += '\n';
+    d->appendIndent(d->containers.size());
+    json += d->compact || !d->containers.isEmpty() ? "]" : "]\n";
+    d->afterValue();
+    return true;
+}
+
+/*!
+    Writes \a key as the key of the next value in the current object. It must
+    be followed by exactly one value.
+
+    \sa startObject()
+*/
+void QJsonStreamWriter::appendKey(QAnyStringView key)
+{
+    Q_ASSERT_X(!d->containers.isEmpty() && d->containers.last().isObject, "QJsonStreamWriter",
+               "appendKey() outside of an object");
+    Q_ASSERT_X(!d->keyWritten, "QJsonStreamWriter", "two keys without a value");
+
+    QJsonStreamWriterPrivate::Container &container = d->containers.last();
+    QByteArray &json = d->output();
+    if (!container.isEmpty)
+        json += d->compact ? "," : ",\n";
+    container.isEmpty = false;
+    d->appendIndent(d->containers.size());
+    d->appendEscaped(key);
+    json += d->compact ? ":" : ": ";
+    d->keyWritten = true;
+}
+
+/*!
+    Writes the string \a str. The text is escaped as needed, but otherwise
+    copied as it is: UTF-8 input is not validated.
+*/
+void QJsonStreamWriter::append(QAnyStringView str)
+{
+    d->beforeValue();
+    d->appendEscaped(str);
+    d->afterValue();
+}
+
+/*!
+    \fn void QJsonStreamWriter::append(const char *str)
+    \overload
+
+    Writes the UTF-8 string \a str.
+*/
+
+/*!
+    \fn void QJsonStreamWriter::append(const char16_t *str)
+    \overload
+
+    Writes the UTF-16 string \a str.
+*/
+
+/*!
+    \overload
+
+    Writes \c true or \c false, depending on \a b.
+*/
+void QJsonStreamWriter::append(bool b)
+{
+    d->beforeValue();
+    d->output() += b ? "true" : "false";
+    d->afterValue();
+}
+
+/*!
+    \fn void QJsonStreamWriter::append(int i)
+    \overload
+
+    Writes the integer \a i.
+*/
+
+/*!
+    \overload
+
+    Writes the integer \a i.
+*/
+void QJsonStreamWriter::append(qint64 i)
+{
+    d->beforeValue();
+    d->output() += QByteArray::number(i);
+    d->afterValue();
+}
+
+/*!
+    \overload
+
+    Writes the unsigned integer \a u. Note that QJsonValue and
+    QJsonStreamReader read integers above 2\sup{63} - 1 as doubles.
+*/
+void QJsonStreamWriter::append(quint64 u)
+{
+    d->beforeValue();
+    d->output() += QByteArray::number(u);
+    d->afterValue();
+}
+
+/*!
+    \overload
+
+    Writes the number \a d in the shortest form that reads back as the same
+    value. Infinities and NaN cannot be represented in JSON and are written
+    as \c null, like QJsonDocument::toJson() does.
+*/
+void QJsonStreamWriter::append(double d)
+{
+    this->d->beforeValue();
+    if (qt_is_finite(d))
+        this->d->output() += QByteArray::number(d, 'g', QLocale::FloatingPointShortest);
+    else
+        this->d->output() += "null";
+    this->d->afterValue();
+}
+
+/*!
+    \fn void QJsonStreamWriter::append(std::nullptr_t)
+    \overload
+
+    Writes \c null.
+
+    \sa appendNull()
+*/
+
+/*!
+    Writes \a value, including the contents of objects and arrays, formatted
+    like QJsonDocument::toJson() does at the current indentation. An
+    undefined value is written as \c null.
+*/
+void QJsonStreamWriter::appendValue(const QJsonValue &value)
+{
+    d->beforeValue();
+    QByteArray &json = d->output();
+    QJsonPrivate::Writer::valueToJson(QCborValue::fromJsonValue(value), json,
+                                      d->compact ? 0 : int(d->containers.size()), d->compact);
+    // valueToJson() terminates top-level containers with a newline
+    if (!d->compact && !d->containers.isEmpty() && (value.isObject() || value.isArray()))
+        json.chop(1);
+    d->afterValue();
+}
+
+/*!
+    Writes \c null.
+*/
+void QJsonStreamWriter::appendNull()
+{
+    d->beforeValue();
+    d->output() += "null";
+    d->afterValue();
+}
+
+/*!
+    Writes the pending output to the device. This does nothing when writing
+    to a QByteArray.
+
+    \sa hasError()
+*/
+void QJsonStreamWriter::flush()
+{
+    d->flush();
+}
+
+/*!
+    Returns \c true if writing to the device failed, \c false otherwise.
+*/
+bool QJsonStreamWriter::hasError() const
+{
+    return d->hasError;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,61 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QJSONSTREAMWRITER_H
+#define QJSONSTREAMWRITER_H
+
+#include <QtCore/qanystringview.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qjsondocument.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+class QJsonValue;
+
+class QJsonStreamWriterPrivate;
+class Q_CORE_EXPORT QJsonStreamWriter
+{
+public:
+    explicit QJsonStreamWriter(QIODevice *device);
+    explicit QJsonStreamWriter(QByteArray *data);
+    ~QJsonStreamWriter();
+    Q_DISABLE_COPY(QJsonStreamWriter)
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+
+    void setFormat(QJsonDocument::JsonFormat format);
+    QJsonDocument::JsonFormat format() const;
+
+    void startObject();
+    bool endObject();
+    void startArray();
+    bool endArray();
+
+    void appendKey(QAnyStringView key);
+
+    void append(QAnyStringView str);
+    void append(const char *str) { append(QAnyStringView(str)); }
+    void append(const char16_t *str) { append(QAnyStringView(str)); }
+    void append(bool b);
+    void append(int i) { append(qint64(i)); }
+    void append(qint64 i);
+    void append(quint64 u);
+    void append(double d);
+    void append(std::nullptr_t) { appendNull(); }
+    void appendNull();
+    void appendValue(const QJsonValue &value);
+
+    void flush();
+    bool hasError() const;
+
+private:
+    std::unique_ptr<QJsonStreamWriterPrivate> d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONSTREAMWRITER_H
@@ -23,7 +23,7 @@ static inline uchar hexdig(uint u)
     return (u < 0xa ? '0' + u : 'a' + u - 0xa);
 }
 
-static QByteArray escapedString(QStringView s)
+QByteArray Writer::escapedString(QStringView s)
 {
     // give it a minimum size to ensure the resize() below always adds enough space
     QByteArray ba(qMax(s.size(), 16), Qt::Uninitialized);
@@ -117,7 +117,7 @@ static void valueContentToJson(const QCborValue &v, QByteArray &json, int indent
     }
     case QCborValue::String:
         json += '"';
-        json += escapedString(v.toString());
+        json += Writer::escapedString(v.toString());
         json += '"';
         break;
     case QCborValue::Array:
@@ -175,7 +175,7 @@ static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json
         QCborValue e = o->valueAt(i);
         json += indentString;
         json += '"';
-        json += escapedString(o->valueAt(i).toString());
+        json += Writer::escapedString(o->valueAt(i).toString());
         json += compact ? "\":" : "\": ";
         valueContentToJson(o->valueAt(i + 1), json, indent, compact);
 
@@ -941,6 +941,44 @@ bool QXmlStreamReader::namespaceProcessing() const
     return d->namespaceProcessing;
 }
 
+/*!
+    \property QXmlStreamReader::arenaParsing
+    \since 6.12
+    \brief whether the reader keeps the data of the current token in a
+    reusable buffer only.
+
+    The strings reported for a token, such as name(), text() and the
+    attribute accessors, are views into a buffer of the reader that is
+    reused when readNext() is called. By default, the reader additionally
+    builds the list returned by attributes() for every StartElement, whose
+    strings keep the buffer they refer to alive. When the application holds
+    on to such a list, the reader has to allocate a new buffer for the next
+    token.
+
+    With arena parsing enabled, the reader only stores the attributes as
+    views that are invalidated by the next call to readNext(), and reads
+    the document without allocating memory per token once its buffers have
+    grown to the size of the largest token. Use attributeCount(),
+    attributeName(), attributeValue() and related functions to access the
+    attributes; attributes() is still available, but builds a new list
+    every time it is called.
+
+    By default, arena parsing is disabled.
+
+    \sa attributeCount(), attributeValue()
+*/
+void QXmlStreamReader::setArenaParsing(bool enable)
+{
+    Q_D(QXmlStreamReader);
+    d->arenaParsing = enable;
+}
+
+bool QXmlStreamReader::arenaParsing() const
+{
+    Q_D(const QXmlStreamReader);
+    return d->arenaParsing;
+}
+
 /*! Returns the reader's current token as string.
 
 \sa tokenType()
@@ -986,6 +1024,7 @@ QXmlStreamReaderPrivate::QXmlStreamReaderPrivate(QXmlStreamReader *q)
     state_stack = nullptr;
     reallocateStack();
     entityResolver = nullptr;
+    arenaParsing = false;
     init();
 #define ADD_PREDEFINED(n, v) \
     do { \
@@ -1021,6 +1060,8 @@ void QXmlStreamReaderPrivate::init()
     textBuffer.reserve(256);
     tagStack.clear();
     tagsDone = false;
+    attributeRefs.clear();
+    attributeRefs.reserve(16);
     attributes.clear();
     attributes.reserve(16);
     lineNumber = lastLineStart = characterOffset = 0;
@@ -1671,6 +1712,22 @@ void QXmlStreamReaderPrivate::putReplacementInAttributeValue(QStringView s)
     }
 }
 
+/*
+  Decodes \a data with \a decoder into the read buffer. The buffer's
+  capacity is reused from chunk to chunk, and the bytes go straight to the
+  codec (for UTF-8, the vectorized ASCII-aware one) without the temporary
+  string of QStringDecoder::decode(). Returns false if the decoder
+  encountered invalid input.
+*/
+bool QXmlStreamReaderPrivate::decodeInto(QStringDecoder &decoder, QByteArrayView data)
+{
+    readBuffer.resize(decoder.requiredSpace(data.size()));
+    QChar *begin = readBuffer.data();
+    QChar *end = decoder.appendToBuffer(begin, data);
+    readBuffer.truncate(end - begin);
+    return !decoder.hasError();
+}
+
 uint QXmlStreamReaderPrivate::getChar_helper()
 {
     constexpr qsizetype BUFFER_SIZE = 8192;
@@ -1694,9 +1751,9 @@ uint QXmlStreamReaderPrivate::getChar_helper()
             decoder = QStringDecoder(*encoding);
         }
 
-        readBuffer = decoder(QByteArrayView(rawReadBuffer).first(nbytesread));
+        const bool decoded = decodeInto(decoder, QByteArrayView(rawReadBuffer).first(nbytesread));
 
-        if (lockEncoding && decoder.hasError()) {
+        if (lockEncoding && !decoded) {
             readBuffer.clear();
             return false;
         }
@@ -1737,10 +1794,8 @@ uint QXmlStreamReaderPrivate::getChar_helper()
             if (!tryDecodeWithGlobalDecoder()) {
                 // try decoding with the previous chunk decoder
                 bool hasError = true;
-                if (chunkDecoder.isValid() && !chunkDecoder.hasError()) {
-                    readBuffer = chunkDecoder(QByteArrayView(rawReadBuffer).first(nbytesread));
-                    hasError = chunkDecoder.hasError();
-                }
+                if (chunkDecoder.isValid() && !chunkDecoder.hasError())
+                    hasError = !decodeInto(chunkDecoder, QByteArrayView(rawReadBuffer).first(nbytesread));
                 if (hasError) {
                     raiseWellFormedError(
                             QXmlStream::tr("Encountered incorrectly encoded content."));
@@ -1750,7 +1805,7 @@ uint QXmlStreamReaderPrivate::getChar_helper()
         } else {
             if (!isDecoderForEncoding(chunkDecoder, bufAndEnc.encoding))
                 chunkDecoder = QStringDecoder(bufAndEnc.encoding);
-            readBuffer = chunkDecoder(bufAndEnc.buffer);
+            decodeInto(chunkDecoder, bufAndEnc.buffer);
         }
     }
 
@@ -1830,31 +1885,33 @@ void QXmlStreamReaderPrivate::resolveTag()
 
     tagStack.top().namespaceDeclaration.namespaceUri = namespaceUri = namespaceForPrefix(prefix);
 
-    attributes.resize(n);
+    attributeRefs.clear();
+    attributeRefs.reserve(n);
 
     for (qsizetype i = 0; i < n; ++i) {
-        QXmlStreamAttribute &attribute = attributes[i];
+        AttributeRef &attribute = attributeRefs.rawPush();
         Attribute &attrib = attributeStack[i];
         XmlStringRef prefix(symPrefix(attrib.key));
-        XmlStringRef name(symString(attrib.key));
-        XmlStringRef qualifiedName(symName(attrib.key));
-        XmlStringRef value(symString(attrib.value));
+        attribute.name = symString(attrib.key);
+        attribute.qualifiedName = symName(attrib.key);
+        attribute.value = symString(attrib.value);
+        attribute.namespaceUri = XmlStringRef();
+        attribute.isDefault = false;
 
-        attribute.m_name = name;
-        attribute.m_qualifiedName = qualifiedName;
-        attribute.m_value = value;
-
-        if (!prefix.isEmpty()) {
-            XmlStringRef attributeNamespaceUri = namespaceForPrefix(prefix);
-            attribute.m_namespaceUri = XmlStringRef(attributeNamespaceUri);
-        }
+        if (!prefix.isEmpty())
+            attribute.namespaceUri = namespaceForPrefix(prefix);
 
         for (qsizetype j = 0; j < i; ++j) {
-            if (attributes[j].name() == attribute.name()
-                && attributes[j].namespaceUri() == attribute.namespaceUri()
-                && (namespaceProcessing || attributes[j].qualifiedName() == attribute.qualifiedName()))
+            const AttributeRef &other = attributeRefs.at(j);
+            if (other.name == attribute.name
+                && other.namespaceUri == attribute.namespaceUri
+                && (namespaceProcessing || other.qualifiedName == attribute.qualifiedName))
             {
-                raiseWellFormedError(QXmlStream::tr("Attribute '%1' redefined.").arg(attribute.qualifiedName()));
+                raiseWellFormedError(QXmlStream::tr("Attribute '%1' redefined.").arg(attribute.qualifiedName.view()));
+                if (!arenaParsing) {
+                    fillAttributes(attributes);
+                    attributes.resize(n);
+                }
                 return;
             }
         }
@@ -1874,17 +1931,37 @@ void QXmlStreamReaderPrivate::resolveTag()
 
 
 
-        QXmlStreamAttribute attribute;
-        attribute.m_name = dtdAttribute.attributeName;
-        attribute.m_qualifiedName = dtdAttribute.attributeQualifiedName;
-        attribute.m_value = dtdAttribute.defaultValue;
+        AttributeRef &attribute = attributeRefs.push();
+        attribute.name = dtdAttribute.attributeName;
+        attribute.qualifiedName = dtdAttribute.attributeQualifiedName;
+        attribute.value = dtdAttribute.defaultValue;
+        attribute.namespaceUri = XmlStringRef();
 
-        if (!dtdAttribute.attributePrefix.isEmpty()) {
-            XmlStringRef attributeNamespaceUri = namespaceForPrefix(dtdAttribute.attributePrefix);
-            attribute.m_namespaceUri = XmlStringRef(attributeNamespaceUri);
-        }
-        attribute.m_isDefault = true;
-        attributes.append(std::move(attribute));
+        if (!dtdAttribute.attributePrefix.isEmpty())
+            attribute.namespaceUri = namespaceForPrefix(dtdAttribute.attributePrefix);
+        attribute.isDefault = true;
+    }
+
+    if (!arenaParsing)
+        fillAttributes(attributes);
+}
+
+/*
+  Copies the current attribute references into \a list. The strings share
+  their data with the reader's buffers.
+ */
+void QXmlStreamReaderPrivate::fillAttributes(QXmlStreamAttributes &list) const
+{
+    const qsizetype n = attributeRefs.size();
+    list.resize(n);
+    for (qsizetype i = 0; i < n; ++i) {
+        const AttributeRef &ref = attributeRefs.at(i);
+        QXmlStreamAttribute &attribute = list[i];
+        attribute.m_name = ref.name;
+        attribute.m_namespaceUri = ref.namespaceUri;
+        attribute.m_qualifiedName = ref.qualifiedName;
+        attribute.m_value = ref.value;
+        attribute.m_isDefault = ref.isDefault;
     }
 }
 
@@ -2516,9 +2593,151 @@ QStringView QXmlStreamReader::prefix() const
 QXmlStreamAttributes QXmlStreamReader::attributes() const
 {
     Q_D(const QXmlStreamReader);
+    if (d->arenaParsing) {
+        QXmlStreamAttributes list;
+        d->fillAttributes(list);
+        return list;
+    }
     return d->attributes;
 }
 
+/*!
+  \since 6.12
+
+  Returns the number of attributes of a StartElement, including the
+  default attributes declared in the DTD.
+
+  Unlike attributes(), the attribute accessors of the reader never copy
+  the attribute data. The views they return are valid until the next
+  call to readNext().
+
+  \sa attributeName(), attributeValue(), arenaParsing
+ */
+qsizetype QXmlStreamReader::attributeCount() const
+{
+    Q_D(const QXmlStreamReader);
+    return d->attributeRefs.size();
+}
+
+/*!
+  \since 6.12
+
+  Returns the local name of the attribute at index \a i of the current
+  StartElement. \a i must be a valid index, that is,
+  0 <= \a i < attributeCount().
+
+  \sa QXmlStreamAttribute::name()
+ */
+QStringView QXmlStreamReader::attributeName(qsizetype i) const
+{
+    Q_D(const QXmlStreamReader);
+    Q_ASSERT(i >= 0 && i < d->attributeRefs.size());
+    return d->attributeRefs.at(i).name.view();
+}
+
+/*!
+  \since 6.12
+
+  Returns the resolved namespace URI of the attribute at index \a i of
+  the current StartElement, or an empty string view if the attribute has
+  no prefix. \a i must be a valid index.
+
+  \sa QXmlStreamAttribute::namespaceUri()
+ */
+QStringView QXmlStreamReader::attributeNamespaceUri(qsizetype i) const
+{
+    Q_D(const QXmlStreamReader);
+    Q_ASSERT(i >= 0 && i < d->attributeRefs.size());
+    return d->attributeRefs.at(i).namespaceUri.view();
+}
+
+/*!
+  \since 6.12
+
+  Returns the qualified name of the attribute at index \a i of the
+  current StartElement, as it appears in the XML data. \a i must be a
+  valid index.
+
+  \sa QXmlStreamAttribute::qualifiedName()
+ */
+QStringView QXmlStreamReader::attributeQualifiedName(qsizetype i) const
+{
+    Q_D(const QXmlStreamReader);
+    Q_ASSERT(i >= 0 && i < d->attributeRefs.size());
+    return d->attributeRefs.at(i).qualifiedName.view();
+}
+
+/*!
+  \since 6.12
+
+  Returns the value of the attribute at index \a i of the current
+  StartElement. \a i must be a valid index.
+
+  \sa QXmlStreamAttribute::value()
+ */
+QStringView QXmlStreamReader::attributeValue(qsizetype i) const
+{
+    Q_D(const QXmlStreamReader);
+    Q_ASSERT(i >= 0 && i < d->attributeRefs.size());
+    return d->attributeRefs.at(i).value.view();
+}
+
+/*!
+  \since 6.12
+
+  Returns \c true if the attribute at index \a i of the current
+  StartElement was not present in the XML data, but added from a default
+  value declared in the DTD. \a i must be a valid index.
+
+  \sa QXmlStreamAttribute::isDefault()
+ */
+bool QXmlStreamReader::isAttributeDefault(qsizetype i) const
+{
+    Q_D(const QXmlStreamReader);
+    Q_ASSERT(i >= 0 && i < d->attributeRefs.size());
+    return d->attributeRefs.at(i).isDefault;
+}
+
+/*!
+  \since 6.12
+  \overload
+
+  Returns the value of the attribute with the qualified name \a
+  qualifiedName of the current StartElement, or a null string view if
+  there is no such attribute.
+
+  \sa QXmlStreamAttributes::value()
+ */
+QStringView QXmlStreamReader::attributeValue(QAnyStringView qualifiedName) const noexcept
+{
+    Q_D(const QXmlStreamReader);
+    for (const auto &attribute : d->attributeRefs) {
+        if (attribute.qualifiedName.view() == qualifiedName)
+            return attribute.value.view();
+    }
+    return QStringView();
+}
+
+/*!
+  \since 6.12
+  \overload
+
+  Returns the value of the attribute \a name in the namespace described
+  with \a namespaceUri of the current StartElement, or a null string view
+  if there is no such attribute. The \a namespaceUri can be empty.
+
+  \sa QXmlStreamAttributes::value()
+ */
+QStringView QXmlStreamReader::attributeValue(QAnyStringView namespaceUri, QAnyStringView name) const noexcept
+{
+    Q_D(const QXmlStreamReader);
+    for (const auto &attribute : d->attributeRefs) {
+        if (attribute.name.view() == name && attribute.namespaceUri.view() == namespaceUri)
+            return attribute.value.view();
+    }
+    return QStringView();
+}
+
 #endif // feature xmlstreamreader
 
 /*!
@@ -166,6 +166,7 @@ bool QXmlStreamReaderPrivate::parse()
         qualifiedName.clear();
         namespaceUri.clear();
         publicNamespaceDeclarations.clear();
+        attributeRefs.clear();
         attributes.clear();
         if (isEmptyElement) {
             setType(QXmlStreamReader::EndElement);
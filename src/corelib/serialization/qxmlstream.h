@@ -232,6 +232,7 @@ public:
 class Q_CORE_EXPORT QXmlStreamReader
 {
     QDOC_PROPERTY(bool namespaceProcessing READ namespaceProcessing WRITE setNamespaceProcessing)
+    QDOC_PROPERTY(bool arenaParsing READ arenaParsing WRITE setArenaParsing)
 public:
     enum TokenType {
         NoToken = 0,
@@ -287,6 +288,9 @@ public:
     void setNamespaceProcessing(bool);
     bool namespaceProcessing() const;
 
+    void setArenaParsing(bool enable);
+    bool arenaParsing() const;
+
     inline bool isStartDocument() const { return tokenType() == StartDocument; }
     inline bool isEndDocument() const { return tokenType() == EndDocument; }
     inline bool isStartElement() const { return tokenType() == StartElement; }
@@ -309,6 +313,14 @@ public:
     qint64 characterOffset() const;
 
     QXmlStreamAttributes attributes() const;
+    qsizetype attributeCount() const;
+    QStringView attributeName(qsizetype i) const;
+    QStringView attributeNamespaceUri(qsizetype i) const;
+    QStringView attributeQualifiedName(qsizetype i) const;
+    QStringView attributeValue(qsizetype i) const;
+    bool isAttributeDefault(qsizetype i) const;
+    QStringView attributeValue(QAnyStringView qualifiedName) const noexcept;
+    QStringView attributeValue(QAnyStringView namespaceUri, QAnyStringView name) const noexcept;
 
     enum ReadElementTextBehaviour {
         ErrorOnUnexpectedElement,
@@ -341,7 +341,19 @@ public:
     void write(const char *);
 
 
+    // The attributes of the current StartElement as views into the text
+    // buffer; they are only copied into the public attributes list when
+    // arena parsing is disabled or when attributes() is called.
+    struct AttributeRef {
+        XmlStringRef name;
+        XmlStringRef namespaceUri;
+        XmlStringRef qualifiedName;
+        XmlStringRef value;
+        bool isDefault;
+    };
+    QXmlStreamSimpleStack<AttributeRef> attributeRefs;
     QXmlStreamAttributes attributes;
+    void fillAttributes(QXmlStreamAttributes &list) const;
     XmlStringRef namespaceForPrefix(QStringView prefix);
     void resolveTag();
     void resolvePublicNamespaces();
@@ -414,6 +426,7 @@ public:
     uint lockEncoding : 1;
     uint namespaceProcessing : 1;
     uint hasStandalone : 1; // TODO: expose in public API
+    uint arenaParsing : 1;
 
     int resumeReduction;
     void resume(int rule);
@@ -495,6 +508,7 @@ public:
     short token;
     uint token_char;
 
+    bool decodeInto(QStringDecoder &decoder, QByteArrayView data);
     uint filterCarriageReturn();
     inline uint getChar();
     inline uint peekChar();
@@ -0,0 +1,582 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:critical reason:data-parser
+
+#include "qmultistringmatcher.h"
+
+#include <QtCore/qglobalstatic.h>
+#include <QtCore/qhash.h>
+#include <QtCore/private/qtools_p.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QtMiscUtils;
+
+/*!
+    \class QMultiStringMatcher
+    \inmodule QtCore
+    \ingroup tools
+    \ingroup shared
+    \ingroup string-processing
+    \reentrant
+    \since 6.12
+
+    \brief The QMultiStringMatcher class searches a string for any of a set
+    of patterns in a single pass.
+
+    Searching a string for each of several patterns with QStringMatcher, or
+    with QString::indexOf(), takes one pass over the string per pattern.
+    QMultiStringMatcher compiles all patterns into one automaton (an
+    Aho-Corasick automaton), which finds the occurrences of all of them in a
+    single pass whose cost does not depend on the number of patterns. This is
+    useful, for example, to filter log lines or model rows by a list of
+    keywords:
+
+    \snippet code/src_corelib_text_qmultistringmatcher.cpp 0
+
+    match() returns the leftmost occurrence of any pattern, and matchAll()
+    returns all of them, including overlapping ones. Each Match holds the
+    position and length of the occurrence and the index of the pattern in
+    patterns(). If the same pattern is given more than once, occurrences are
+    reported for the first copy only. Empty patterns never match.
+
+    The haystack can be a QStringView or a QLatin1StringView, in which case
+    positions are in characters, or a QByteArrayView, which is taken to
+    contain UTF-8 and is searched for the UTF-8 encoding of the patterns; in
+    that case positions and lengths are in bytes.
+
+    With Qt::CaseInsensitive, characters are compared after simple case
+    folding, as with QStringMatcher. Byte arrays are only folded in the
+    US-ASCII range, as with QByteArray::compare().
+
+    Setting the patterns takes time and memory proportional to their total
+    length multiplied by the number of distinct characters in them. The
+    matcher is implicitly shared and is not modified by searching, so it can
+    be used from several threads at once.
+
+    \sa QStringMatcher, QByteArrayMatcher, QLatin1StringMatcher
+*/
+
+/*!
+    \class QMultiStringMatcher::Match
+    \inmodule QtCore
+    \since 6.12
+
+    \brief The QMultiStringMatcher::Match struct describes an occurrence of
+    one of the patterns of a QMultiStringMatcher.
+
+    A default-constructed Match, as returned when no pattern occurs, has a
+    position of -1.
+*/
+
+/*!
+    \variable QMultiStringMatcher::Match::position
+
+    The position of the occurrence in the haystack, or -1 if there is none.
+*/
+
+/*!
+    \variable QMultiStringMatcher::Match::length
+
+    The length of the occurrence. This is the length of the pattern, except
+    when searching a QByteArrayView, where it is the length of the pattern's
+    UTF-8 encoding.
+*/
+
+/*!
+    \variable QMultiStringMatcher::Match::patternIndex
+
+    The index of the pattern that occurs, in QMultiStringMatcher::patterns().
+*/
+
+/*!
+    \fn bool QMultiStringMatcher::Match::isValid() const
+
+    Returns \c true if this describes an occurrence, that is, if position is
+    not negative.
+*/
+
+namespace {
+// An Aho-Corasick automaton compiled to a DFA. Code units are first mapped
+// to classes, so that the transition table only has columns for the units
+// that occur in the patterns; all other units are class 0, which always
+// leads back to the root. With case folding, the class table maps each unit
+// to the class of its folded form, except for surrogates, which can only be
+// folded together with the other half of the pair.
+struct Automaton
+{
+    // The class of each code unit, in pages of 256 units. Page 0 of
+    // classes is all zeroes and shared by all pages without a pattern unit.
+    QList<qint32> classes;
+    qint32 pages[256] = {};
+    qint32 classCount = 1;
+
+    // Indexed by row (state * classCount) + class. Each entry is the row of
+    // the next state shifted left by one, with bit 0 set if a pattern ends
+    // in that state.
+    QList<qint32> transitions;
+    // For each state, the index of the longest pattern ending in it or -1,
+    // and the next state whose string is a suffix of this state's and in
+    // which a pattern ends, or -1.
+    QList<qint32> terminal;
+    QList<qint32> dictionaryLink;
+    // The length of each pattern in code units.
+    QList<qsizetype> lengths;
+    qsizetype maxLength = 0;
+
+    // Pairs of a code unit and its folded form, for the units that change
+    using Foldings = QList<std::pair<char16_t, char16_t>>;
+    void build(const QList<QList<char16_t>> &patterns, const Foldings &foldings);
+
+    qint32 classOf(char16_t c) const noexcept
+    { return classes.constData()[pages[c >> 8] + (c & 0xff)]; }
+
+    qint32 firstOutput(qint32 entry) const noexcept
+    {
+        const qint32 state = (entry >> 1) / classCount;
+        return terminal.at(state) >= 0 ? state : dictionaryLink.at(state);
+    }
+
+    // Runs the automaton from position i until it reaches a state in which
+    // a pattern ends or position end; returns the position after the last
+    // unit consumed.
+    template <typename Classify>
+    qsizetype advance(Classify classify, qsizetype i, qsizetype end, qint32 &entry) const noexcept
+    {
+        const qint32 *table = transitions.constData();
+        while (i < end) {
+            entry = table[(entry >> 1) + classify(i++)];
+            if (entry & 1)
+                break;
+        }
+        return i;
+    }
+
+    template <typename Classify>
+    QMultiStringMatcher::Match match(Classify classify, qsizetype from, qsizetype size) const noexcept;
+    template <typename Classify>
+    QList<QMultiStringMatcher::Match> matchAll(Classify classify, qsizetype from, qsizetype size) const;
+};
+} // unnamed namespace
+
+class QMultiStringMatcherPrivate : public QSharedData
+{
+public:
+    QMultiStringMatcherPrivate(const QStringList &patterns, Qt::CaseSensitivity cs);
+
+    QStringList patterns;
+    Qt::CaseSensitivity cs;
+    Automaton utf16;
+    Automaton utf8;
+};
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QMultiStringMatcherPrivate)
+
+void Automaton::build(const QList<QList<char16_t>> &patterns, const Foldings &foldings)
+{
+    QHash<char16_t, qint32> unitClass;
+    for (const QList<char16_t> &pattern : patterns) {
+        for (char16_t c : pattern) {
+            if (!unitClass.contains(c))
+                unitClass.insert(c, classCount++);
+        }
+    }
+
+    classes.resize(256);
+    const auto setClass = [this](char16_t c, qint32 cls) {
+        if (!pages[c >> 8]) {
+            pages[c >> 8] = qint32(classes.size());
+            classes.resize(classes.size() + 256);
+        }
+        classes[pages[c >> 8] + (c & 0xff)] = cls;
+    };
+    for (auto it = unitClass.cbegin(); it != unitClass.cend(); ++it)
+        setClass(it.key(), it.value());
+    for (const auto &[c, folded] : foldings) {
+        if (const qint32 cls = unitClass.value(folded))
+            setClass(c, cls);
+    }
+
+    // the trie
+    transitions.fill(-1, classCount);
+    terminal.append(-1);
+    qint32 stateCount = 1;
+    for (qsizetype i = 0; i < patterns.size(); ++i) {
+        const QList<char16_t> &pattern = patterns.at(i);
+        lengths.append(pattern.size());
+        if (pattern.isEmpty())
+            continue;
+        maxLength = qMax(maxLength, pattern.size());
+        qint32 state = 0;
+        for (char16_t c : pattern) {
+            const qsizetype at = qsizetype(state) * classCount + unitClass.value(c);
+            if (transitions.at(at) < 0) {
+                if (qint64(stateCount + 1) * classCount >= (1 << 30))
+                    qBadAlloc();
+                transitions[at] = stateCount++;
+                transitions.resize(transitions.size() + classCount, -1);
+                terminal.append(-1);
+            }
+            state = transitions.at(at);
+        }
+        if (terminal.at(state) < 0)
+            terminal[state] = qint32(i);
+    }
+
+    // Complete the transitions with those of the failure links, in
+    // breadth-first order so that the failure state's row is complete.
+    QList<qint32> failure(stateCount, 0);
+    dictionaryLink.fill(-1, stateCount);
+    QList<qint32> queue;
+    queue.reserve(stateCount);
+    for (qint32 c = 0; c < classCount; ++c) {
+        const qint32 next = transitions.at(c);
+        if (next < 0)
+            transitions[c] = 0;
+        else
+            queue.append(next);
+    }
+    for (qsizetype q = 0; q < queue.size(); ++q) {
+        const qint32 state = queue.at(q);
+        const qint32 fail = failure.at(state);
+        dictionaryLink[state] = terminal.at(fail) >= 0 ? fail : dictionaryLink.at(fail);
+        qint32 *row = transitions.data() + qsizetype(state) * classCount;
+        const qint32 *failRow = transitions.constData() + qsizetype(fail) * classCount;
+        for (qint32 c = 0; c < classCount; ++c) {
+            if (row[c] < 0) {
+                row[c] = failRow[c];
+            } else {
+                failure[row[c]] = failRow[c];
+                queue.append(row[c]);
+            }
+        }
+    }
+
+    for (qint32 &next : transitions) {
+        const bool output = terminal.at(next) >= 0 || dictionaryLink.at(next) >= 0;
+        next = (next * classCount) << 1 | qint32(output);
+    }
+}
+
+template <typename Classify>
+QMultiStringMatcher::Match
+Automaton::match(Classify classify, qsizetype from, qsizetype size) const noexcept
+{
+    QMultiStringMatcher::Match best;
+    qint32 entry = 0;
+    qsizetype i = from;
+    qsizetype end = size;
+    while (i < end) {
+        i = advance(classify, i, end, entry);
+        if (!(entry & 1))
+            break;
+        // The longest pattern ending here starts first. Once a pattern
+        // occurs, only those that end within maxLength of its start can
+        // start earlier or at the same position and be longer.
+        const qint32 pattern = terminal.at(firstOutput(entry));
+        const qsizetype length = lengths.at(pattern);
+        const qsizetype position = i - length;
+        if (!best.isValid() || position < best.position
+                || (position == best.position && length > best.length)) {
+            best = { position, length, pattern };
+            end = qMin(size, position + maxLength);
+        }
+    }
+    return best;
+}
+
+template <typename Classify>
+QList<QMultiStringMatcher::Match>
+Automaton::matchAll(Classify classify, qsizetype from, qsizetype size) const
+{
+    QList<QMultiStringMatcher::Match> result;
+    qint32 entry = 0;
+    qsizetype i = from;
+    while (i < size) {
+        i = advance(classify, i, size, entry);
+        if (!(entry & 1))
+            break;
+        for (qint32 state = firstOutput(entry); state >= 0; state = dictionaryLink.at(state)) {
+            const qint32 pattern = terminal.at(state);
+            const qsizetype length = lengths.at(pattern);
+            result.append({ i - length, length, pattern });
+        }
+    }
+    // matches are found in the order of their ends, longest first
+    std::sort(result.begin(), result.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.position < rhs.position
+                || (lhs.position == rhs.position && lhs.length < rhs.length);
+    });
+    return result;
+}
+
+// Folds the code unit at position i of str. Surrogates are folded together
+// with the other half of their pair; unpaired ones are left alone.
+static char16_t foldedSurrogate(const char16_t *str, qsizetype i, qsizetype size) noexcept
+{
+    const char16_t c = str[i];
+    if (QChar::isHighSurrogate(c) && i + 1 < size && QChar::isLowSurrogate(str[i + 1]))
+        return QChar::highSurrogate(QChar::toCaseFolded(QChar::surrogateToUcs4(c, str[i + 1])));
+    if (QChar::isLowSurrogate(c) && i > 0 && QChar::isHighSurrogate(str[i - 1]))
+        return QChar::lowSurrogate(QChar::toCaseFolded(QChar::surrogateToUcs4(str[i - 1], c)));
+    return c;
+}
+
+namespace {
+struct Utf16Foldings : Automaton::Foldings
+{
+    Utf16Foldings()
+    {
+        for (char32_t c = 0; c < 0x10000; ++c) {
+            const char16_t folded = QChar::toCaseFolded(char16_t(c));
+            if (folded != c && !QChar::isSurrogate(c))
+                append({ char16_t(c), folded });
+        }
+    }
+};
+
+struct Utf8Foldings : Automaton::Foldings
+{
+    Utf8Foldings()
+    {
+        for (char c = 'A'; c <= 'Z'; ++c)
+            append({ char16_t(c), char16_t(toAsciiLower(c)) });
+    }
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(Utf16Foldings, utf16Foldings)
+Q_GLOBAL_STATIC(Utf8Foldings, utf8Foldings)
+
+QMultiStringMatcherPrivate::QMultiStringMatcherPrivate(const QStringList &patterns,
+                                                       Qt::CaseSensitivity cs)
+    : patterns(patterns), cs(cs)
+{
+    QList<QList<char16_t>> units;
+    units.reserve(patterns.size());
+    for (const QString &pattern : patterns) {
+        const char16_t *str = QStringView(pattern).utf16();
+        QList<char16_t> folded(str, str + pattern.size());
+        if (cs == Qt::CaseInsensitive) {
+            for (qsizetype i = 0; i < folded.size(); ++i) {
+                folded[i] = QChar::isSurrogate(str[i]) ? foldedSurrogate(str, i, pattern.size())
+                                                       : QChar::toCaseFolded(str[i]);
+            }
+        }
+        units.append(std::move(folded));
+    }
+    utf16.build(units, cs == Qt::CaseInsensitive ? *utf16Foldings : Automaton::Foldings());
+
+    units.clear();
+    for (const QString &pattern : patterns) {
+        const QByteArray utf8 = pattern.toUtf8();
+        QList<char16_t> bytes;
+        bytes.reserve(utf8.size());
+        for (char c : utf8)
+            bytes.append(uchar(cs == Qt::CaseInsensitive ? toAsciiLower(c) : c));
+        units.append(std::move(bytes));
+    }
+    utf8.build(units, cs == Qt::CaseInsensitive ? *utf8Foldings : Automaton::Foldings());
+}
+
+/*!
+    Constructs a matcher without patterns, which never matches.
+*/
+QMultiStringMatcher::QMultiStringMatcher() noexcept = default;
+
+/*!
+    Constructs a matcher that searches for any of \a patterns, with the case
+    sensitivity \a cs.
+*/
+QMultiStringMatcher::QMultiStringMatcher(const QStringList &patterns, Qt::CaseSensitivity cs)
+    : d(new QMultiStringMatcherPrivate(patterns, cs))
+{
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QMultiStringMatcher::QMultiStringMatcher(const QMultiStringMatcher &other) noexcept = default;
+
+/*!
+    \fn QMultiStringMatcher::QMultiStringMatcher(QMultiStringMatcher &&other)
+
+    Move-constructs a matcher from \a other.
+*/
+
+/*!
+    Destroys the matcher.
+*/
+QMultiStringMatcher::~QMultiStringMatcher() = default;
+
+/*!
+    Assigns \a other to this matcher.
+*/
+QMultiStringMatcher &QMultiStringMatcher::operator=(const QMultiStringMatcher &other) noexcept = default;
+
+/*!
+    \fn QMultiStringMatcher &QMultiStringMatcher::operator=(QMultiStringMatcher &&other)
+
+    Move-assigns \a other to this matcher.
+*/
+
+/*!
+    \fn void QMultiStringMatcher::swap(QMultiStringMatcher &other)
+    \memberswap{matcher}
+*/
+
+/*!
+    Sets the patterns to search for to \a patterns.
+
+    \sa patterns(), setCaseSensitivity()
+*/
+void QMultiStringMatcher::setPatterns(const QStringList &patterns)
+{
+    d = new QMultiStringMatcherPrivate(patterns, caseSensitivity());
+}
+
+/*!
+    Returns the patterns that this matcher searches for.
+
+    \sa setPatterns()
+*/
+QStringList QMultiStringMatcher::patterns() const
+{
+    return d ? d->patterns : QStringList();
+}
+
+/*!
+    Sets the case sensitivity to \a cs.
+
+    \sa caseSensitivity(), setPatterns()
+*/
+void QMultiStringMatcher::setCaseSensitivity(Qt::CaseSensitivity cs)
+{
+    if (cs != caseSensitivity())
+        d = new QMultiStringMatcherPrivate(patterns(), cs);
+}
+
+/*!
+    Returns the case sensitivity of this matcher. The default is
+    Qt::CaseSensitive.
+
+    \sa setCaseSensitivity()
+*/
+Qt::CaseSensitivity QMultiStringMatcher::caseSensitivity() const noexcept
+{
+    return d ? d->cs : Qt::CaseSensitive;
+}
+
+/*!
+    Searches \a haystack, starting at position \a from, for the leftmost
+    occurrence of any of the patterns. If several patterns occur at that
+    position, the longest one is returned. Returns an invalid Match if no
+    pattern occurs.
+
+    \sa matchAll(), indexIn()
+*/
+QMultiStringMatcher::Match QMultiStringMatcher::match(QStringView haystack, qsizetype from) const noexcept
+{
+    if (!d || from < 0)
+        return {};
+    const Automaton &a = d->utf16;
+    const char16_t *str = haystack.utf16();
+    const qsizetype size = haystack.size();
+    if (d->cs == Qt::CaseSensitive)
+        return a.match([&](qsizetype i) { return a.classOf(str[i]); }, from, size);
+    return a.match([&](qsizetype i) {
+        const char16_t c = str[i];
+        return a.classOf(QChar::isSurrogate(c) ? foldedSurrogate(str, i, size) : c);
+    }, from, size);
+}
+
+/*!
+    \overload
+*/
+QMultiStringMatcher::Match QMultiStringMatcher::match(QLatin1StringView haystack, qsizetype from) const noexcept
+{
+    if (!d || from < 0)
+        return {};
+    const Automaton &a = d->utf16;
+    const uchar *str = reinterpret_cast<const uchar *>(haystack.data());
+    return a.match([&](qsizetype i) { return a.classOf(str[i]); }, from, haystack.size());
+}
+
+/*!
+    \overload
+
+    The haystack is searched for the UTF-8 encoding of the patterns, and the
+    position and length of the match are in bytes.
+*/
+QMultiStringMatcher::Match QMultiStringMatcher::match(QByteArrayView haystack, qsizetype from) const noexcept
+{
+    if (!d || from < 0)
+        return {};
+    const Automaton &a = d->utf8;
+    const uchar *str = reinterpret_cast<const uchar *>(haystack.data());
+    return a.match([&](qsizetype i) { return a.classOf(str[i]); }, from, haystack.size());
+}
+
+/*!
+    \fn qsizetype QMultiStringMatcher::indexIn(QStringView haystack, qsizetype from) const
+    \fn qsizetype QMultiStringMatcher::indexIn(QLatin1StringView haystack, qsizetype from) const
+    \fn qsizetype QMultiStringMatcher::indexIn(QByteArrayView haystack, qsizetype from) const
+
+    Returns the position of the leftmost occurrence of any of the patterns in
+    \a haystack, starting at position \a from, or -1 if none occurs.
+
+    \sa match()
+*/
+
+/*!
+    Returns all occurrences of the patterns in \a haystack, starting at
+    position \a from, including overlapping ones. The list is sorted by
+    position, and occurrences at the same position by length.
+
+    \sa match()
+*/
+QList<QMultiStringMatcher::Match> QMultiStringMatcher::matchAll(QStringView haystack, qsizetype from) const
+{
+    if (!d || from < 0)
+        return {};
+    const Automaton &a = d->utf16;
+    const char16_t *str = haystack.utf16();
+    const qsizetype size = haystack.size();
+    if (d->cs == Qt::CaseSensitive)
+        return a.matchAll([&](qsizetype i) { return a.classOf(str[i]); }, from, size);
+    return a.matchAll([&](qsizetype i) {
+        const char16_t c = str[i];
+        return a.classOf(QChar::isSurrogate(c) ? foldedSurrogate(str, i, size) : c);
+    }, from, size);
+}
+
+/*!
+    \overload
+*/
+QList<QMultiStringMatcher::Match> QMultiStringMatcher::matchAll(QLatin1StringView haystack, qsizetype from) const
+{
+    if (!d || from < 0)
+        return {};
+    const Automaton &a = d->utf16;
+    const uchar *str = reinterpret_cast<const uchar *>(haystack.data());
+    return a.matchAll([&](qsizetype i) { return a.classOf(str[i]); }, from, haystack.size());
+}
+
+/*!
+    \overload
+
+    The haystack is searched for the UTF-8 encoding of the patterns, and the
+    positions and lengths of the matches are in bytes.
+*/
+QList<QMultiStringMatcher::Match> QMultiStringMatcher::matchAll(QByteArrayView haystack, qsizetype from) const
+{
+    if (!d || from < 0)
+        return {};
+    const Automaton &a = d->utf8;
+    const uchar *str = reinterpret_cast<const uchar *>(haystack.data());
+    return a.matchAll([&](qsizetype i) { return a.classOf(str[i]); }, from, haystack.size());
+}
+
+QT_END_NAMESPACE
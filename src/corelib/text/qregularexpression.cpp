@@ -778,6 +778,17 @@ struct QRegularExpressionMatchPrivate : QSharedData
     bool isValid = false;
 };
 
+struct QCompiledRegularExpressionPrivate : QSharedData
+{
+    // Holds a reference to the private of the regular expression, and so
+    // keeps code alive and unchanged: setters detach before recompiling.
+    QRegularExpression regularExpression;
+    const pcre2_code_16 *code = nullptr;
+    QRegularExpression::MatchOptions matchOptions;
+    int pcreOptions = 0;
+    int capturingCount = 0;
+};
+
 struct QRegularExpressionMatchIteratorPrivate : QSharedData
 {
     QRegularExpressionMatchIteratorPrivate(const QRegularExpression &re,
@@ -969,6 +980,85 @@ static pcre2_jit_stack_16 *qtPcreCallback(void *)
     return jitStacks.get();
 }
 
+/*
+    The match data of each thread, reused by all matches in that thread so
+    that matching does not allocate, not even the heap frames of the
+    interpreter, which PCRE2 keeps in the match data. PCRE2 never shrinks
+    those frames; see trimThreadMatchData().
+*/
+namespace {
+struct PcreMatchDataFree
+{
+    void operator()(pcre2_match_data_16 *matchData) const
+    {
+        pcre2_match_data_free_16(matchData);
+    }
+};
+Q_CONSTINIT static thread_local std::unique_ptr<pcre2_match_data_16, PcreMatchDataFree> matchDatas;
+
+// A match context is not modified by matching, so a single one serves all
+// threads.
+struct PcreMatchContext
+{
+    PcreMatchContext()
+        : context(pcre2_match_context_create_16(nullptr))
+    {
+        Q_CHECK_PTR(context);
+        pcre2_jit_stack_assign_16(context, &qtPcreCallback, nullptr);
+    }
+    ~PcreMatchContext() { pcre2_match_context_free_16(context); }
+
+    pcre2_match_context_16 *const context;
+};
+Q_GLOBAL_STATIC(PcreMatchContext, pcreMatchContext)
+}
+
+/*!
+    \internal
+
+    Returns this thread's match data, with room for at least \a pairCount
+    pairs of offsets.
+*/
+static pcre2_match_data_16 *threadMatchData(int pairCount)
+{
+    pcre2_match_data_16 *matchData = matchDatas.get();
+    if (!matchData || pcre2_get_ovector_count_16(matchData) < uint(pairCount)) {
+        // start with room for a few capturing groups, to avoid reallocating
+        // for each pattern with one more than the previous
+        matchData = pcre2_match_data_create_16(uint(qMax(pairCount, 16)), nullptr);
+        Q_CHECK_PTR(matchData);
+        matchDatas.reset(matchData);
+    }
+    return matchData;
+}
+
+/*!
+    \internal
+
+    Frees this thread's match data if the last match grew its heap frames
+    beyond MaxKeptHeapFrames, so that a single deeply backtracking match
+    doesn't keep its memory for the lifetime of the thread. Must be called
+    once the results have been read from the match data.
+*/
+static void trimThreadMatchData()
+{
+    constexpr size_t MaxKeptHeapFrames = 64 * 1024;
+    pcre2_match_data_16 *matchData = matchDatas.get();
+    if (matchData && pcre2_get_match_data_heapframes_size_16(matchData) > MaxKeptHeapFrames)
+        matchDatas.reset();
+}
+
+/*!
+    \internal
+
+    Returns the shared match context, or \nullptr after it has been
+    destroyed at exit; PCRE2 then uses its default JIT stack.
+*/
+static pcre2_match_context_16 *sharedMatchContext()
+{
+    return pcreMatchContext.isDestroyed() ? nullptr : pcreMatchContext->context;
+}
+
 /*!
     \internal
 */
@@ -1145,9 +1235,8 @@ void QRegularExpressionPrivate::doMatch(QRegularExpressionMatchPrivate *priv,
         previousMatchWasEmpty = true;
     }
 
-    pcre2_match_context_16 *matchContext = pcre2_match_context_create_16(nullptr);
-    pcre2_jit_stack_assign_16(matchContext, &qtPcreCallback, nullptr);
-    pcre2_match_data_16 *matchData = pcre2_match_data_create_from_pattern_16(compiledPattern, nullptr);
+    pcre2_match_context_16 *matchContext = sharedMatchContext();
+    pcre2_match_data_16 *matchData = threadMatchData(capturingCount + 1);
 
     // PCRE does not accept a null pointer as subject string, even if
     // its length is zero. We however allow it in input: a QStringView
@@ -1261,8 +1350,7 @@ void QRegularExpressionPrivate::doMatch(QRegularExpressionMatchPrivate *priv,
         }
     }
 
-    pcre2_match_data_free_16(matchData);
-    pcre2_match_context_free_16(matchContext);
+    trimThreadMatchData();
 }
 
 /*!
@@ -2745,6 +2833,242 @@ QtPrivate::QRegularExpressionMatchIteratorRangeBasedForIterator begin(const QReg
   \internal
 */
 
+/*!
+    \class QCompiledRegularExpression
+    \inmodule QtCore
+    \reentrant
+    \since 6.12
+
+    \ingroup tools
+    \ingroup shared
+    \ingroup string-processing
+
+    \brief The QCompiledRegularExpression class holds a compiled regular
+    expression that can be matched from several threads without locking or
+    allocating.
+
+    QRegularExpression compiles its pattern on first use, and
+    QRegularExpression::match() checks whether that has happened under a
+    mutex and allocates a QRegularExpressionMatch for each match. That is
+    convenient, but it costs time when a pattern is matched against many
+    short subjects, for instance one log line or table cell at a time, and
+    the mutex is contended when several threads share the pattern.
+
+    QCompiledRegularExpression compiles the pattern once, when it is
+    constructed, and is not modified afterwards: copies share the compiled
+    pattern, and all threads can match with the same object at the same time.
+    match() and matchBatch() return the offsets of the captured substrings in
+    a buffer provided by the caller, and reuse per-thread PCRE2 match data
+    and JIT stacks, so matching does not allocate memory.
+
+    \snippet code/src_corelib_text_qregularexpression.cpp 37
+
+    The offsets are stored in pairs, the start and the end of each captured
+    substring, starting with the whole match (the implicit capturing group
+    0). A buffer with room for all of them has 2 * (captureCount() + 1)
+    entries; if it is smaller, only the first capturing groups are stored,
+    and it can be empty if only whether the subject matches is of interest.
+    Groups that did not capture anything, and entries past the last
+    capturing group, are set to -1.
+
+    Only normal matches are supported: for partial matches and global
+    matching, use QRegularExpression.
+
+    \sa QRegularExpression, QRegularExpressionMatch
+*/
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QCompiledRegularExpressionPrivate)
+
+/*!
+    Constructs an invalid compiled regular expression, which matches nothing.
+
+    \sa isValid()
+*/
+QCompiledRegularExpression::QCompiledRegularExpression() noexcept = default;
+
+/*!
+    Compiles the regular expression \a re, to be matched using the match
+    options \a matchOptions.
+
+    If \a re is not valid, a warning is printed and the resulting object is
+    not valid either.
+
+    \sa isValid(), QRegularExpression::optimize()
+*/
+QCompiledRegularExpression::QCompiledRegularExpression(const QRegularExpression &re,
+                                                       QRegularExpression::MatchOptions matchOptions)
+    : d(new QCompiledRegularExpressionPrivate)
+{
+    re.d.data()->compilePattern();
+    d->regularExpression = re;
+    d->matchOptions = matchOptions;
+    d->code = re.d->compiledPattern;
+    d->pcreOptions = convertToPcreOptions(matchOptions);
+    d->capturingCount = re.d->capturingCount;
+    if (Q_UNLIKELY(!d->code))
+        qtWarnAboutInvalidRegularExpression(re.pattern(), "QCompiledRegularExpression", "QCompiledRegularExpression");
+}
+
+/*!
+    Constructs a copy of \a other, which shares its compiled pattern.
+*/
+QCompiledRegularExpression::QCompiledRegularExpression(const QCompiledRegularExpression &other) noexcept = default;
+
+/*!
+    \fn QCompiledRegularExpression::QCompiledRegularExpression(QCompiledRegularExpression &&other)
+
+    Move-constructs a compiled regular expression from \a other.
+*/
+
+/*!
+    Destroys the compiled regular expression.
+*/
+QCompiledRegularExpression::~QCompiledRegularExpression() = default;
+
+/*!
+    Assigns \a other to this object.
+*/
+QCompiledRegularExpression &QCompiledRegularExpression::operator=(const QCompiledRegularExpression &other) noexcept = default;
+
+/*!
+    \fn QCompiledRegularExpression &QCompiledRegularExpression::operator=(QCompiledRegularExpression &&other)
+
+    Move-assigns \a other to this object.
+*/
+
+/*!
+    \fn void QCompiledRegularExpression::swap(QCompiledRegularExpression &other)
+    \memberswap{compiled regular expression}
+*/
+
+/*!
+    Returns \c true if the regular expression was valid and could be
+    compiled.
+
+    \sa QRegularExpression::isValid()
+*/
+bool QCompiledRegularExpression::isValid() const noexcept
+{
+    return d && d->code;
+}
+
+/*!
+    Returns the regular expression that was compiled.
+*/
+QRegularExpression QCompiledRegularExpression::regularExpression() const
+{
+    return d ? d->regularExpression : QRegularExpression();
+}
+
+/*!
+    Returns the match options that are used for matching.
+*/
+QRegularExpression::MatchOptions QCompiledRegularExpression::matchOptions() const noexcept
+{
+    return d ? d->matchOptions : QRegularExpression::NoMatchOption;
+}
+
+/*!
+    Returns the number of capturing groups of the regular expression, not
+    counting the whole match, or -1 if it is not valid.
+
+    \sa QRegularExpression::captureCount()
+*/
+int QCompiledRegularExpression::captureCount() const noexcept
+{
+    return isValid() ? d->capturingCount : -1;
+}
+
+/*!
+    \internal
+
+    Matches \a subject from \a offset with \a code, using \a matchData, and
+    stores the captured offsets in \a capturedOffsets.
+*/
+static bool matchCompiled(const QCompiledRegularExpressionPrivate *d,
+                          pcre2_match_data_16 *matchData, QStringView subject,
+                          qsizetype offset, QSpan<qsizetype> capturedOffsets)
+{
+    const qsizetype subjectLength = subject.size();
+    if (offset < 0)
+        offset += subjectLength;
+
+    int result = PCRE2_ERROR_NOMATCH;
+    if (offset >= 0 && offset <= subjectLength) {
+        // see doMatch() about null subjects
+        const char16_t dummySubject = 0;
+        const char16_t *subjectUtf16 = subject.utf16() ? subject.utf16() : &dummySubject;
+        result = safe_pcre2_match_16(d->code, reinterpret_cast<PCRE2_SPTR16>(subjectUtf16),
+                                     subjectLength, offset, d->pcreOptions,
+                                     matchData, sharedMatchContext());
+    }
+
+    qsizetype stored = 0;
+    if (result > 0) {
+        const PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_16(matchData);
+        stored = qMin(capturedOffsets.size(), qsizetype(result) * 2);
+        for (qsizetype i = 0; i < stored; ++i)
+            capturedOffsets[i] = qsizetype(ovector[i]);
+    }
+    std::fill(capturedOffsets.begin() + stored, capturedOffsets.end(), -1);
+    return result > 0;
+}
+
+/*!
+    Attempts to match the regular expression against \a subject, starting at
+    position \a offset inside the subject; if \a offset is negative, it
+    counts from the end of the subject. Returns \c true if it matches.
+
+    The offsets of the captured substrings are stored in \a capturedOffsets,
+    as described in the class documentation.
+
+    \sa matchBatch(), QRegularExpression::matchView()
+*/
+bool QCompiledRegularExpression::match(QStringView subject, QSpan<qsizetype> capturedOffsets,
+                                       qsizetype offset) const
+{
+    if (!isValid()) {
+        std::fill(capturedOffsets.begin(), capturedOffsets.end(), -1);
+        return false;
+    }
+    const bool matched = matchCompiled(d.data(), threadMatchData(d->capturingCount + 1),
+                                       subject, offset, capturedOffsets);
+    trimThreadMatchData();
+    return matched;
+}
+
+/*!
+    Attempts to match the regular expression against each of \a subjects,
+    and returns the number of subjects that match.
+
+    \a capturedOffsets is divided evenly between the subjects: the offsets
+    for subject \c i are stored, as described in the class documentation, in
+    the \c n entries starting at \c{i * n}, where \c n is the size of \a
+    capturedOffsets divided by the number of subjects.
+
+    \snippet code/src_corelib_text_qregularexpression.cpp 38
+
+    \sa match()
+*/
+qsizetype QCompiledRegularExpression::matchBatch(QSpan<const QStringView> subjects,
+                                                 QSpan<qsizetype> capturedOffsets) const
+{
+    const qsizetype stride = subjects.empty() ? 0 : capturedOffsets.size() / subjects.size();
+    if (!isValid()) {
+        std::fill(capturedOffsets.begin(), capturedOffsets.end(), -1);
+        return 0;
+    }
+
+    qsizetype matched = 0;
+    for (qsizetype i = 0; i < subjects.size(); ++i) {
+        // trimThreadMatchData() may free the match data between subjects
+        matched += matchCompiled(d.data(), threadMatchData(d->capturingCount + 1), subjects[i], 0,
+                                 capturedOffsets.subspan(i * stride, stride));
+        trimThreadMatchData();
+    }
+    return matched;
+}
+
 #ifndef QT_NO_DATASTREAM
 /*!
     \relates QRegularExpression
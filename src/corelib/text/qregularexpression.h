@@ -11,6 +11,7 @@
 #include <QtCore/qstring.h>
 #include <QtCore/qstringview.h>
 #include <QtCore/qshareddata.h>
+#include <QtCore/qspan.h>
 #include <QtCore/qvariant.h>
 
 #include <iterator>
@@ -168,6 +169,7 @@ private:
     Q_DECLARE_EQUALITY_COMPARABLE(QRegularExpression)
 
     friend struct QRegularExpressionPrivate;
+    friend class QCompiledRegularExpression;
     friend class QRegularExpressionMatch;
     friend struct QRegularExpressionMatchPrivate;
     friend class QRegularExpressionMatchIterator;
@@ -403,6 +405,41 @@ private:
 
 Q_DECLARE_SHARED(QRegularExpressionMatchIterator)
 
+struct QCompiledRegularExpressionPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QCompiledRegularExpressionPrivate, Q_CORE_EXPORT)
+
+class Q_CORE_EXPORT QCompiledRegularExpression
+{
+public:
+    QCompiledRegularExpression() noexcept;
+    explicit QCompiledRegularExpression(const QRegularExpression &re,
+                                        QRegularExpression::MatchOptions matchOptions
+                                                = QRegularExpression::NoMatchOption);
+    QCompiledRegularExpression(const QCompiledRegularExpression &other) noexcept;
+    QCompiledRegularExpression(QCompiledRegularExpression &&other) noexcept = default;
+    ~QCompiledRegularExpression();
+
+    QCompiledRegularExpression &operator=(const QCompiledRegularExpression &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QCompiledRegularExpression)
+
+    void swap(QCompiledRegularExpression &other) noexcept { d.swap(other.d); }
+
+    [[nodiscard]] bool isValid() const noexcept;
+    QRegularExpression regularExpression() const;
+    QRegularExpression::MatchOptions matchOptions() const noexcept;
+    int captureCount() const noexcept;
+
+    bool match(QStringView subject, QSpan<qsizetype> capturedOffsets = {},
+               qsizetype offset = 0) const;
+    qsizetype matchBatch(QSpan<const QStringView> subjects,
+                         QSpan<qsizetype> capturedOffsets = {}) const;
+
+private:
+    QExplicitlySharedDataPointer<QCompiledRegularExpressionPrivate> d;
+};
+
+Q_DECLARE_SHARED(QCompiledRegularExpression)
+
 QT_END_NAMESPACE
 
 #endif // QREGULAREXPRESSION_H
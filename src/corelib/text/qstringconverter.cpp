@@ -677,6 +677,390 @@ static void simdCompareAscii(const qchar8_t *&, const qchar8_t *, const char16_t
 }
 #endif
 
+// Multi-byte UTF-8 transcoding
+//
+// The functions below transcode the non-ASCII parts of the text one window
+// of 32 bytes (or 16 UTF-16 code units) at a time. For every
+// position in the window, the kernels compute in parallel what a sequence
+// starting there decodes or encodes to, then compact the results for the
+// positions that start a character with a byte shuffle. Windows containing
+// anything unusual (invalid or overlong sequences, surrogates in UTF-16) are
+// left to the scalar code, which handles the errors.
+//
+// This requires AVX2 (checked at runtime); the byte shuffle needs at least
+// SSSE3 and SSE2 alone is no faster than the scalar code. Other
+// architectures use the scalar code.
+#if defined(__SSE2__) && QT_COMPILER_SUPPORTS_HERE(AVX2)
+namespace {
+struct Utf8CompactionTable
+{
+    // for each 8-bit mask, the indices of the bytes (shuffle8) or of the
+    // 16-bit units (shuffle16) selected by the mask, and how many there are
+    uchar shuffle8[256][8];
+    uchar shuffle16[256][16];
+    uchar count[256];
+};
+
+constexpr Utf8CompactionTable makeUtf8CompactionTable()
+{
+    Utf8CompactionTable table = {};
+    for (uint mask = 0; mask < 256; ++mask) {
+        uint n = 0;
+        for (uint i = 0; i < 8; ++i) {
+            if (!(mask & (1U << i)))
+                continue;
+            table.shuffle8[mask][n] = uchar(i);
+            table.shuffle16[mask][2 * n] = uchar(2 * i);
+            table.shuffle16[mask][2 * n + 1] = uchar(2 * i + 1);
+            ++n;
+        }
+        table.count[mask] = uchar(n);
+    }
+    return table;
+}
+
+constexpr Utf8CompactionTable utf8CompactionTable = makeUtf8CompactionTable();
+} // unnamed namespace
+
+// Returns the number of continuation bytes at p, up to four. A window's
+// last sequence extends that many bytes past it; computing that from the
+// bytes themselves rather than from the window's classification keeps the
+// loop from waiting for the latter before loading the next window.
+static inline int utf8ContinuationBytes(const uchar *p)
+{
+    const quint32 nonContinuation = (qFromUnaligned<quint32>(p) & 0xc0c0c0c0U) ^ 0x80808080U;
+    return nonContinuation ? qCountTrailingZeroBits(nonContinuation) / 8 : 4;
+}
+
+// Checks that a window of Width bytes has no continuation bytes other than
+// those of its sequences, including at its start, and that its last
+// sequence extends exactly overhang bytes past it. The vector code has
+// already checked that each lead byte is followed by enough continuation
+// bytes.
+template <int Width> static inline bool
+utf8WindowIsValid(quint64 cont, quint64 lead2, quint64 lead3, quint64 lead4, int overhang)
+{
+    const quint64 expected = ((lead2 | lead3 | lead4) << 1) | ((lead3 | lead4) << 2) | (lead4 << 3);
+    return cont == (expected & ((Q_UINT64_C(1) << Width) - 1))
+            && (expected >> Width) == (1U << overhang) - 1;
+}
+
+// The low surrogate for a four-byte sequence starting at p
+static inline char16_t utf8LowSurrogate(const uchar *p)
+{
+    return 0xdc00 | ((p[2] & 0x0f) << 6) | (p[3] & 0x3f);
+}
+
+static inline __m256i QT_FUNCTION_TARGET(AVX2) mm256_set1_epu16(ushort v)
+{
+    return _mm256_set1_epi16(short(v));
+}
+
+static inline __m256i QT_FUNCTION_TARGET(AVX2) mm256_below_epi8(__m256i v, uchar c)
+{
+    // signed comparison: the continuation bytes 0x80-0xBF are the smallest
+    // values, followed by the lead bytes in ascending sequence length
+    return _mm256_cmpgt_epi8(_mm256_set1_epi8(char(c)), v);
+}
+
+static inline __m256i QT_FUNCTION_TARGET(AVX2) mm256_equal_epi8(__m256i v, uchar c)
+{
+    return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(char(c)));
+}
+
+// Stores the bytes selected by the 16-bit mask and advances dst past them.
+// Writes 16 bytes.
+static inline void QT_FUNCTION_TARGET(AVX2) mm_storeCompressed_epi8(uchar *&dst, __m128i bytes, uint mask)
+{
+    const uint mask0 = mask & 0xff;
+    const uint mask1 = (mask >> 8) & 0xff;
+    const __m128i shuffle0 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(utf8CompactionTable.shuffle8[mask0]));
+    const __m128i shuffle1 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(utf8CompactionTable.shuffle8[mask1]));
+    const __m128i shuffle = _mm_unpacklo_epi64(shuffle0, _mm_add_epi8(shuffle1, _mm_set1_epi8(8)));
+    const __m128i out = _mm_shuffle_epi8(bytes, shuffle);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), out);
+    dst += utf8CompactionTable.count[mask0];
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_srli_si128(out, 8));
+    dst += utf8CompactionTable.count[mask1];
+}
+
+// Computes the UTF-16 code unit for each of 16 positions: for lead bytes,
+// the character (or high surrogate) the sequence decodes to; for
+// continuation bytes, the low surrogate in case the byte is the second one
+// of a four-byte sequence.
+static inline __m256i QT_FUNCTION_TARGET(AVX2)
+mm256_decodeUtf8(__m128i v0, __m128i v1, __m128i v2, __m128i cont,
+                 __m128i lead2, __m128i lead3, __m128i lead4)
+{
+    const __m256i b0 = _mm256_cvtepu8_epi16(v0);
+    const __m256i t1 = _mm256_and_si256(_mm256_cvtepu8_epi16(v1), mm256_set1_epu16(0x3f));
+    const __m256i t2 = _mm256_and_si256(_mm256_cvtepu8_epi16(v2), mm256_set1_epu16(0x3f));
+
+    const __m256i c2 = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(b0, mm256_set1_epu16(0x1f)), 6), t1);
+    const __m256i c3 = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(b0, 12), _mm256_slli_epi16(t1, 6)), t2);
+    // bits 10-20 of the code point, offset to make the high surrogate
+    const __m256i c4 = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(b0, mm256_set1_epu16(0x07)), 8),
+                                                       _mm256_slli_epi16(t1, 2)), _mm256_srli_epi16(t2, 4));
+    const __m256i high = _mm256_add_epi16(c4, mm256_set1_epu16(0xd7c0));
+    const __m256i low = _mm256_or_si256(_mm256_or_si256(mm256_set1_epu16(0xdc00),
+                                                        _mm256_slli_epi16(_mm256_and_si256(t1, mm256_set1_epu16(0x0f)), 6)), t2);
+
+    __m256i unit = _mm256_blendv_epi8(b0, low, _mm256_cvtepi8_epi16(cont));
+    unit = _mm256_blendv_epi8(unit, high, _mm256_cvtepi8_epi16(lead4));
+    unit = _mm256_blendv_epi8(unit, c3, _mm256_cvtepi8_epi16(lead3));
+    return _mm256_blendv_epi8(unit, c2, _mm256_cvtepi8_epi16(lead2));
+}
+
+// Same as above, for windows with one- and two-byte sequences only
+static inline __m256i QT_FUNCTION_TARGET(AVX2)
+mm256_decodeUtf8TwoByte(__m128i v0, __m128i v1, __m128i lead2)
+{
+    const __m256i b0 = _mm256_cvtepu8_epi16(v0);
+    const __m256i t1 = _mm256_and_si256(_mm256_cvtepu8_epi16(v1), mm256_set1_epu16(0x3f));
+    const __m256i c2 = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(b0, mm256_set1_epu16(0x1f)), 6), t1);
+    return _mm256_blendv_epi8(b0, c2, _mm256_cvtepi8_epi16(lead2));
+}
+
+// Stores the code units selected by the mask and advances dst past them.
+// Writes 32 code units.
+static inline void QT_FUNCTION_TARGET(AVX2)
+mm256_storeCompressed_epi16(char16_t *&dst, const __m256i units[2], quint64 mask)
+{
+    for (int i = 0; i < 4; ++i) {
+        const uint m = (mask >> (8 * i)) & 0xff;
+        const __m128i in = (i & 1) ? _mm256_extracti128_si256(units[i / 2], 1)
+                                   : _mm256_castsi256_si128(units[i / 2]);
+        const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8CompactionTable.shuffle16[m]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(in, shuffle));
+        dst += utf8CompactionTable.count[m];
+    }
+}
+
+// Decodes (or with Output false, only validates) as many consecutive
+// windows as possible, stopping at the first window that is pure US-ASCII
+// (which simdDecodeAscii() handles better), that is not complete valid
+// UTF-8, or that might read past end. The last sequence may extend up to
+// three bytes past the window, and the byte after that is read too. Writes
+// at most one UTF-16 code unit per input byte consumed, plus up to eight
+// more that the next call overwrites.
+template <bool Output> static void QT_FUNCTION_TARGET(AVX2)
+simdDecodeMultiByte_avx2(char16_t *&dst, const uchar *&src, const uchar *end)
+{
+    constexpr int Width = 32;
+    auto part = [](__m256i v, int half) QT_FUNCTION_TARGET(AVX2) {
+        return half ? _mm256_extracti128_si256(v, 1) : _mm256_castsi256_si128(v);
+    };
+    while (end - src >= Width + 4) {
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 1));
+        const __m256i cont0 = mm256_below_epi8(v0, 0xc0);
+        const __m256i belowE0 = mm256_below_epi8(v0, 0xe0);
+        const __m256i lead2 = _mm256_andnot_si256(cont0, belowE0);
+        const __m256i cont1 = mm256_below_epi8(v1, 0xc0);
+        // overlong sequences: 0xC0 and 0xC1
+        __m256i bad = _mm256_andnot_si256(cont0, mm256_below_epi8(v0, 0xc2));
+        const quint64 cont = uint(_mm256_movemask_epi8(cont0));
+        const quint64 lead2Bits = uint(_mm256_movemask_epi8(lead2));
+        const int overhang = utf8ContinuationBytes(src + Width);
+
+        // bytes 0xE0-0xFF
+        const __m256i longLead = _mm256_cmpeq_epi8(_mm256_max_epu8(v0, _mm256_set1_epi8(char(0xe0))), v0);
+        if (!_mm256_movemask_epi8(longLead)) {
+            // only one- and two-byte sequences, the most common case for
+            // alphabetic scripts
+            bad = _mm256_or_si256(bad, _mm256_andnot_si256(cont1, lead2));
+            if (_mm256_movemask_epi8(bad) || !lead2Bits
+                    || !utf8WindowIsValid<Width>(cont, lead2Bits, 0, 0, overhang)) {
+                break;
+            }
+            if constexpr (Output) {
+                __m256i units[2];
+                for (int half = 0; half < 2; ++half)
+                    units[half] = mm256_decodeUtf8TwoByte(part(v0, half), part(v1, half), part(lead2, half));
+                mm256_storeCompressed_epi16(dst, units, ~cont);
+            }
+            src += Width + overhang;
+            continue;
+        }
+
+        const __m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 2));
+        const __m256i v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 3));
+        const __m256i belowF0 = mm256_below_epi8(v0, 0xf0);
+        const __m256i belowF5 = mm256_below_epi8(v0, 0xf5);
+        const __m256i lead3 = _mm256_andnot_si256(belowE0, belowF0);
+        const __m256i lead4 = _mm256_andnot_si256(belowF0, belowF5);
+        const __m256i lead34 = _mm256_or_si256(lead3, lead4);
+
+        // bytes 0xF5-0xFF and lead bytes without enough continuation bytes
+        bad = _mm256_or_si256(bad, _mm256_andnot_si256(belowF5, longLead));
+        bad = _mm256_or_si256(bad, _mm256_andnot_si256(cont1, _mm256_or_si256(lead2, lead34)));
+        bad = _mm256_or_si256(bad, _mm256_andnot_si256(mm256_below_epi8(v2, 0xc0), lead34));
+        bad = _mm256_or_si256(bad, _mm256_andnot_si256(mm256_below_epi8(v3, 0xc0), lead4));
+        // overlong sequences (0xE0 0x80-0x9F, 0xF0 0x80-0x8F), surrogates
+        // (0xED 0xA0-0xBF) and code points past U+10FFFF (0xF4 0x90-0xBF)
+        const __m256i belowA0 = mm256_below_epi8(v1, 0xa0);
+        const __m256i below90 = mm256_below_epi8(v1, 0x90);
+        bad = _mm256_or_si256(bad, _mm256_and_si256(mm256_equal_epi8(v0, 0xe0), belowA0));
+        bad = _mm256_or_si256(bad, _mm256_andnot_si256(belowA0, mm256_equal_epi8(v0, 0xed)));
+        bad = _mm256_or_si256(bad, _mm256_and_si256(mm256_equal_epi8(v0, 0xf0), below90));
+        bad = _mm256_or_si256(bad, _mm256_andnot_si256(below90, mm256_equal_epi8(v0, 0xf4)));
+        if (_mm256_movemask_epi8(bad))
+            break;
+
+        const quint64 lead3Bits = uint(_mm256_movemask_epi8(lead3));
+        const quint64 lead4Bits = uint(_mm256_movemask_epi8(lead4));
+        if (!utf8WindowIsValid<Width>(cont, lead2Bits, lead3Bits, lead4Bits, overhang))
+            break;
+
+        if constexpr (Output) {
+            __m256i units[2];
+            for (int half = 0; half < 2; ++half) {
+                units[half] = mm256_decodeUtf8(part(v0, half), part(v1, half), part(v2, half), part(cont0, half),
+                                               part(lead2, half), part(lead3, half), part(lead4, half));
+            }
+
+            // keep the units for the lead bytes and the low surrogates
+            const quint64 keep = (~cont & 0xffffffffU) | (lead4Bits << 1);
+            mm256_storeCompressed_epi16(dst, units, keep);
+            if (keep >> Width)
+                *dst++ = utf8LowSurrogate(src + Width - 1);
+        }
+        src += Width + overhang;
+    }
+}
+
+// Encodes as many consecutive windows as possible, stopping at the first
+// window that is pure US-ASCII or contains unpaired surrogates. A surrogate
+// pair may extend one code unit past the window. The output is written
+// eight bytes at a time, up to six bytes past the encoding of the window;
+// two code units past the window guarantee the room for that.
+static void QT_FUNCTION_TARGET(AVX2)
+simdEncodeMultiByte_avx2(uchar *&dst, const char16_t *&src, const char16_t *end)
+{
+    constexpr int Width = 16;
+    const __m256i zero = _mm256_setzero_si256();
+    while (end - src >= Width + 2) {
+        const __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        const __m256i ascii = _mm256_cmpeq_epi16(_mm256_and_si256(u, mm256_set1_epu16(0xff80)), zero);
+        if (uint(_mm256_movemask_epi8(ascii)) == 0xffffffffU)
+            break;
+        const __m256i top5 = _mm256_and_si256(u, mm256_set1_epu16(0xf800));
+        const __m256i upTo2 = _mm256_cmpeq_epi16(top5, zero);
+
+        // the (up to) three bytes of each encoded code unit
+        const __m256i last = _mm256_or_si256(mm256_set1_epu16(0x80), _mm256_and_si256(u, mm256_set1_epu16(0x3f)));
+        const __m256i lead2 = _mm256_or_si256(mm256_set1_epu16(0xc0), _mm256_srli_epi16(u, 6));
+        __m256i first = _mm256_blendv_epi8(lead2, u, ascii);
+        __m256i keepTwo = _mm256_or_si256(mm256_set1_epu16(0x00ff),
+                                          _mm256_andnot_si256(ascii, mm256_set1_epu16(0xff00)));
+        if (uint(_mm256_movemask_epi8(upTo2)) == 0xffffffffU) {
+            // no three-byte sequences: two bytes per code unit are enough
+            const __m256i firstTwo = _mm256_or_si256(first, _mm256_slli_epi16(last, 8));
+            const uint keep = _mm256_movemask_epi8(keepTwo);
+            mm_storeCompressed_epi8(dst, _mm256_castsi256_si128(firstTwo), keep & 0xffff);
+            mm_storeCompressed_epi8(dst, _mm256_extracti128_si256(firstTwo, 1), keep >> 16);
+            src += Width;
+            continue;
+        }
+
+        const __m256i middle = _mm256_or_si256(mm256_set1_epu16(0x80),
+                                               _mm256_and_si256(_mm256_srli_epi16(u, 6), mm256_set1_epu16(0x3f)));
+        const __m256i lead3 = _mm256_or_si256(mm256_set1_epu16(0xe0), _mm256_srli_epi16(u, 12));
+        first = _mm256_blendv_epi8(lead3, first, upTo2);
+        __m256i second = _mm256_blendv_epi8(middle, last, upTo2);
+        __m256i third = last;
+        __m256i upTo2Bytes = upTo2;
+
+        bool pairAtEnd = false;
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(top5, mm256_set1_epu16(0xd800)))) {
+            // Each high surrogate must be followed by a low one. The high
+            // surrogate encodes to the first three bytes of the four-byte
+            // sequence and the low one to the last.
+            const __m256i kind = _mm256_and_si256(u, mm256_set1_epu16(0xfc00));
+            const __m256i high = _mm256_cmpeq_epi16(kind, mm256_set1_epu16(0xd800));
+            const __m256i low = _mm256_cmpeq_epi16(kind, mm256_set1_epu16(0xdc00));
+            const uint highBits = _mm256_movemask_epi8(high);
+            const uint lowBits = _mm256_movemask_epi8(low);
+            if (lowBits != highBits << 2)
+                break;
+            if (highBits >> 30) {
+                if ((src[Width] & 0xfc00) != 0xdc00)
+                    break;
+                pairAtEnd = true;
+            }
+
+            const __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 1));
+            // bits 10-20 of the code point
+            const __m256i h = _mm256_sub_epi16(u, mm256_set1_epu16(0xd7c0));
+            const __m256i highFirst = _mm256_or_si256(mm256_set1_epu16(0xf0), _mm256_srli_epi16(h, 8));
+            const __m256i highSecond = _mm256_or_si256(mm256_set1_epu16(0x80),
+                                                       _mm256_and_si256(_mm256_srli_epi16(h, 2), mm256_set1_epu16(0x3f)));
+            const __m256i highThird = _mm256_or_si256(_mm256_or_si256(mm256_set1_epu16(0x80),
+                                                                      _mm256_slli_epi16(_mm256_and_si256(h, mm256_set1_epu16(0x03)), 4)),
+                                                      _mm256_and_si256(_mm256_srli_epi16(next, 6), mm256_set1_epu16(0x0f)));
+            first = _mm256_blendv_epi8(_mm256_blendv_epi8(first, last, low), highFirst, high);
+            second = _mm256_blendv_epi8(second, highSecond, high);
+            third = _mm256_blendv_epi8(third, highThird, high);
+            keepTwo = _mm256_andnot_si256(_mm256_and_si256(low, mm256_set1_epu16(0xff00)), keepTwo);
+            upTo2Bytes = _mm256_or_si256(upTo2Bytes, low);
+        }
+
+        const __m256i firstTwo = _mm256_or_si256(first, _mm256_slli_epi16(second, 8));
+        const __m256i keepThird = _mm256_andnot_si256(upTo2Bytes, mm256_set1_epu16(0x00ff));
+
+        // four bytes per code unit, the fourth of which is never used;
+        // unpacking works within each 128-bit lane, so bytesLo has the code
+        // units 0-3 and 8-11 and bytesHi has 4-7 and 12-15
+        const __m256i bytesLo = _mm256_unpacklo_epi16(firstTwo, third);
+        const __m256i bytesHi = _mm256_unpackhi_epi16(firstTwo, third);
+        const quint64 keepLo = uint(_mm256_movemask_epi8(_mm256_unpacklo_epi16(keepTwo, keepThird)));
+        const quint64 keepHi = uint(_mm256_movemask_epi8(_mm256_unpackhi_epi16(keepTwo, keepThird)));
+        const __m128i groups[4] = {
+            _mm256_castsi256_si128(bytesLo), _mm256_castsi256_si128(bytesHi),
+            _mm256_extracti128_si256(bytesLo, 1), _mm256_extracti128_si256(bytesHi, 1),
+        };
+        const quint64 keep = (keepLo & 0xffff) | (keepHi & 0xffff) << 16 | (keepLo >> 16) << 32
+                | (keepHi >> 16) << 48;
+        for (int i = 0; i < 4; ++i)
+            mm_storeCompressed_epi8(dst, groups[i], (keep >> (16 * i)) & 0xffff);
+        src += Width;
+        if (pairAtEnd)
+            *dst++ = 0x80 | (*src++ & 0x3f);
+    }
+}
+
+static void simdDecodeMultiByte(char16_t *&dst, const uchar *&src, const uchar *end)
+{
+    if (qCpuHasFeature(AVX2))
+        simdDecodeMultiByte_avx2<true>(dst, src, end);
+}
+
+static void simdValidateMultiByte(const uchar *&src, const uchar *end)
+{
+    char16_t *dummy = nullptr;
+    if (qCpuHasFeature(AVX2))
+        simdDecodeMultiByte_avx2<false>(dummy, src, end);
+}
+
+static void simdEncodeMultiByte(uchar *&dst, const char16_t *&src, const char16_t *end)
+{
+    if (qCpuHasFeature(AVX2))
+        simdEncodeMultiByte_avx2(dst, src, end);
+}
+#else
+static void simdDecodeMultiByte(char16_t *&, const uchar *&, const uchar *)
+{
+}
+
+static void simdValidateMultiByte(const uchar *&, const uchar *)
+{
+}
+
+static void simdEncodeMultiByte(uchar *&, const char16_t *&, const char16_t *)
+{
+}
+#endif
+
 enum { HeaderDone = 1 };
 
 template <typename OnErrorLambda> Q_ALWAYS_INLINE
@@ -693,6 +1077,11 @@ char *QUtf8::convertFromUnicode(char *out, QStringView in, OnErrorLambda &&onErr
         if (simdEncodeAscii(dst, nextAscii, src, end))
             break;
 
+        const char16_t *multiByteStart = src;
+        simdEncodeMultiByte(dst, src, end);
+        if (src != multiByteStart)
+            continue;
+
         do {
             char16_t u = *src++;
             int res = QUtf8Functions::toUtf8<QUtf8BaseTraits>(u, dst, src, end);
@@ -872,6 +1261,11 @@ QUtf8::convertToUnicode(char16_t *dst, QByteArrayView in, OnErrorLambda &&onErro
         if (simdDecodeAscii(dst, nextAscii, src, end))
             break;
 
+        const uchar *multiByteStart = src;
+        simdDecodeMultiByte(dst, src, end);
+        if (src != multiByteStart)
+            continue;
+
         do {
             uchar b = *src++;
             const qsizetype res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(b, dst, src, end);
@@ -1022,6 +1416,13 @@ QUtf8::ValidUtf8Result QUtf8::isValidUtf8(QByteArrayView in)
         if (src == end)
             break;
 
+        const uchar *multiByteStart = src;
+        simdValidateMultiByte(src, end);
+        if (src != multiByteStart) {
+            isValidAscii = false;
+            continue;
+        }
+
         do {
             uchar b = *src++;
             if ((b & 0x80) == 0)
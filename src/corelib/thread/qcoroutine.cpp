@@ -0,0 +1,267 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qcoroutine.h"
+
+#include <QtCore/qabstracteventdispatcher.h>
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/private/qobject_p.h>
+
+#include <new>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \headerfile <QtCoroutine>
+    \inmodule QtCore
+    \title Coroutine Support
+    \since 6.12
+    \ingroup thread
+
+    \brief The <QtCoroutine> header lets C++20 coroutines wait for futures,
+    signals and I/O devices.
+
+    With a compiler in C++20 mode, QFuture can be used as the return type of
+    a coroutine, and a coroutine can \c co_await a QFuture, a signal or the
+    readiness of a QIODevice:
+
+    \code
+    QFuture<QByteArray> fetch(QIODevice *device)
+    {
+        device->write("GET\n");
+        while (device->bytesToWrite() > 0)
+            co_await QtCoroutine::waitForBytesWritten(device);
+        if (!co_await QtCoroutine::waitForReadyRead(device))
+            co_return QByteArray();
+        co_return device->readAll();
+    }
+
+    QFuture<int> process(QIODevice *device)
+    {
+        const QByteArray reply = co_await fetch(device);
+        co_return reply.size();
+    }
+    \endcode
+
+    A QFuture coroutine starts running right away, and the returned future
+    finishes when the coroutine returns. An exception that leaves the
+    coroutine is stored in the future. Canceling the future, or awaiting a
+    future that gets canceled, destroys the coroutine the next time it would
+    be resumed, and finishes its future as canceled.
+
+    Any number of coroutines can await the same future, and the future can
+    have a \l{QFuture::then()}{continuation} at the same time.
+
+    After waiting, a coroutine continues in the event loop of the thread it
+    was suspended in, no matter which thread finished the future or emitted
+    the signal. If that thread has no event dispatcher, the coroutine
+    continues right away, in the thread that woke it up. The thread must
+    outlive any coroutine that waits in it.
+
+    Coroutine frames of QFuture coroutines are recycled per thread, so a
+    coroutine that is called over and over again doesn't need a heap
+    allocation for its frame.
+
+    The awaiters of signals and I/O devices can also be used in coroutines
+    of other return types. There, a canceled future that is awaited yields a
+    default-constructed value.
+*/
+
+/*!
+    \namespace QtCoroutine
+    \inmodule QtCore
+    \since 6.12
+
+    \brief The QtCoroutine namespace contains awaiters for C++20 coroutines.
+
+    \sa {Coroutine Support}
+*/
+
+/*!
+    \fn template <typename Sender, typename Signal> auto QtCoroutine::waitForSignal(const Sender *sender, Signal signal)
+
+    Returns an awaiter that suspends the coroutine until \a sender emits
+    \a signal.
+
+    For a signal without arguments, \c co_await yields \c true. Otherwise it
+    yields a \c std::optional holding the argument, or a \c std::tuple of the
+    arguments if the signal has more than one. If \a sender is destroyed
+    before it emits the signal, \c co_await yields \c false or an empty
+    optional.
+
+    Only the first emission is taken into account.
+
+    \sa QtFuture::connect()
+*/
+
+/*!
+    \fn auto QtCoroutine::waitForReadyRead(const QIODevice *device)
+
+    Returns an awaiter that suspends the coroutine until \a device has new
+    data to read. \c co_await yields \c true if data can be read, and
+    \c false if the device is or gets closed or destroyed, or reaches the end
+    of its read channel.
+
+    The coroutine isn't suspended if \a device already has data available.
+
+    \sa QIODevice::readyRead()
+*/
+
+/*!
+    \fn auto QtCoroutine::waitForBytesWritten(const QIODevice *device)
+
+    Returns an awaiter that suspends the coroutine until \a device wrote a
+    payload of data. \c co_await yields the number of bytes written, or -1
+    if the device isn't writable, or gets closed or destroyed.
+
+    The coroutine isn't suspended, and \c co_await yields 0, if \a device has
+    no pending data to write.
+
+    \sa QIODevice::bytesWritten()
+*/
+
+namespace {
+
+// Frames are served from per-thread free lists, one for each multiple of
+// Granularity bytes. A frame may be freed on another thread than the one it
+// was allocated on; it then goes to the cache of that thread.
+struct FrameCache
+{
+    static constexpr size_t Granularity = 64;
+    static constexpr size_t MaxCachedSize = 4096;
+    static constexpr size_t SizeClasses = MaxCachedSize / Granularity;
+    static constexpr int MaxCachedFrames = 16; // per size class
+
+    struct FreeFrame
+    {
+        FreeFrame *next;
+    };
+
+    FreeFrame *freeLists[SizeClasses] = {};
+    int freeCounts[SizeClasses] = {};
+
+    ~FrameCache();
+
+    static FrameCache *current();
+    static size_t sizeClass(size_t size) { return (size + Granularity - 1) / Granularity; }
+};
+
+Q_CONSTINIT static thread_local bool frameCacheDestroyed = false;
+
+FrameCache::~FrameCache()
+{
+    frameCacheDestroyed = true;
+    for (size_t i = 0; i < SizeClasses; ++i) {
+        for (FreeFrame *frame = freeLists[i]; frame;) {
+            FreeFrame *next = frame->next;
+            ::operator delete(frame, (i + 1) * Granularity);
+            frame = next;
+        }
+    }
+}
+
+// Returns nullptr while the thread is exiting.
+FrameCache *FrameCache::current()
+{
+    if (frameCacheDestroyed)
+        return nullptr;
+    static thread_local FrameCache cache;
+    return &cache;
+}
+
+class QCoroutineResumeEvent : public QAbstractMetaCallEvent
+{
+public:
+    QCoroutineResumeEvent(void *data, void (*resume)(void *))
+        : QAbstractMetaCallEvent(nullptr, -1), data(data), resume(resume)
+    {
+    }
+
+    void placeMetaCall(QObject *) override { resume(data); }
+
+private:
+    void *data;
+    void (*resume)(void *);
+};
+
+} // unnamed namespace
+
+namespace QtPrivate {
+
+/*!
+    \internal
+
+    Allocates a coroutine frame of \a size bytes, reusing a frame of the same
+    size class freed earlier on this thread if there is one.
+*/
+void *allocateCoroutineFrame(size_t size)
+{
+    const size_t sizeClass = FrameCache::sizeClass(size);
+    if (size > FrameCache::MaxCachedSize)
+        return ::operator new(size);
+
+    if (FrameCache *cache = FrameCache::current()) {
+        if (FrameCache::FreeFrame *frame = cache->freeLists[sizeClass - 1]) {
+            cache->freeLists[sizeClass - 1] = frame->next;
+            --cache->freeCounts[sizeClass - 1];
+            return frame;
+        }
+    }
+    return ::operator new(sizeClass * FrameCache::Granularity);
+}
+
+/*!
+    \internal
+
+    Releases \a frame, which was allocated by allocateCoroutineFrame() with
+    the same \a size.
+*/
+void deallocateCoroutineFrame(void *frame, size_t size) noexcept
+{
+    const size_t sizeClass = FrameCache::sizeClass(size);
+    if (size > FrameCache::MaxCachedSize) {
+        ::operator delete(frame, size);
+        return;
+    }
+
+    FrameCache *cache = FrameCache::current();
+    if (cache && cache->freeCounts[sizeClass - 1] < FrameCache::MaxCachedFrames) {
+        auto *freeFrame = static_cast<FrameCache::FreeFrame *>(frame);
+        freeFrame->next = cache->freeLists[sizeClass - 1];
+        cache->freeLists[sizeClass - 1] = freeFrame;
+        ++cache->freeCounts[sizeClass - 1];
+        return;
+    }
+    ::operator delete(frame, sizeClass * FrameCache::Granularity);
+}
+
+/*!
+    \internal
+
+    Returns the object through which a coroutine suspended in the current
+    thread gets resumed, or \nullptr if the thread has no event dispatcher.
+*/
+QObject *coroutineResumeContext()
+{
+    return QAbstractEventDispatcher::instance();
+}
+
+/*!
+    \internal
+
+    Calls \a resume with \a data from the event loop of the thread of
+    \a context, or right away if \a context is \nullptr. Can be called from
+    any thread.
+*/
+void postCoroutineResume(QObject *context, void *data, void (*resume)(void *data))
+{
+    if (!context) {
+        resume(data);
+        return;
+    }
+    QCoreApplication::postEvent(context, new QCoroutineResumeEvent(data, resume));
+}
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
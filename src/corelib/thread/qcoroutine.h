@@ -0,0 +1,414 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCOROUTINE_H
+#define QCOROUTINE_H
+
+#if 0
+#pragma qt_class(QtCoroutine)
+#endif
+
+#include <QtCore/qglobal.h>
+#include <QtCore/qfuture.h>
+#include <QtCore/qiodevice.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qpromise.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#if (defined(__cpp_impl_coroutine) && __has_include(<coroutine>)) || defined(Q_QDOC)
+#  include <coroutine>
+#  define QT_COROUTINES_SUPPORTED
+#endif
+
+QT_REQUIRE_CONFIG(future);
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+
+// These don't depend on the coroutine support of the compiler, so that
+// QtCore itself can be built in C++17 mode.
+Q_CORE_EXPORT void *allocateCoroutineFrame(size_t size);
+Q_CORE_EXPORT void deallocateCoroutineFrame(void *frame, size_t size) noexcept;
+
+Q_CORE_EXPORT QObject *coroutineResumeContext();
+Q_CORE_EXPORT void postCoroutineResume(QObject *context, void *data, void (*resume)(void *data));
+
+} // namespace QtPrivate
+
+#if defined(QT_COROUTINES_SUPPORTED)
+
+namespace QtPrivate {
+
+class CoroutinePromiseBase
+{
+public:
+    static void *operator new(size_t size) { return allocateCoroutineFrame(size); }
+    static void operator delete(void *frame, size_t size) noexcept
+    {
+        deallocateCoroutineFrame(frame, size);
+    }
+};
+
+template <typename T>
+class FutureCoroutinePromiseBase : public CoroutinePromiseBase
+{
+public:
+    FutureCoroutinePromiseBase() { m_promise.start(); }
+
+    QFuture<T> get_return_object() { return m_promise.future(); }
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept
+    {
+        m_promise.finish();
+        return {};
+    }
+
+    void unhandled_exception()
+    {
+#ifndef QT_NO_EXCEPTIONS
+        m_promise.setException(std::current_exception());
+#endif
+    }
+
+    bool isCanceled() const { return m_promise.isCanceled(); }
+
+protected:
+    QPromise<T> m_promise;
+};
+
+template <typename T>
+class FutureCoroutinePromise : public FutureCoroutinePromiseBase<T>
+{
+public:
+    template <typename U = T>
+    void return_value(U &&value) { this->m_promise.addResult(std::forward<U>(value)); }
+};
+
+template <>
+class FutureCoroutinePromise<void> : public FutureCoroutinePromiseBase<void>
+{
+public:
+    void return_void() { }
+};
+
+// Resumes a suspended coroutine, unless it is a QFuture coroutine whose
+// future got canceled in the meantime. Such a coroutine is destroyed
+// instead, which finishes its future as canceled.
+template <typename Promise>
+void resumeOrDestroyCoroutine(std::coroutine_handle<Promise> handle)
+{
+    if constexpr (std::is_base_of_v<CoroutinePromiseBase, Promise>) {
+        if (handle.promise().isCanceled()) {
+            handle.destroy();
+            return;
+        }
+    }
+    handle.resume();
+}
+
+template <typename Promise>
+void resumeCoroutineFrame(void *frame)
+{
+    resumeOrDestroyCoroutine(std::coroutine_handle<Promise>::from_address(frame));
+}
+
+template <typename T>
+class FutureAwaiter
+{
+public:
+    explicit FutureAwaiter(const QFuture<T> &future) : m_future(future) { }
+    Q_DISABLE_COPY_MOVE(FutureAwaiter)
+
+    bool await_ready() const { return m_future.isFinished(); }
+
+    template <typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        m_frame = handle.address();
+        // The coroutine continues on the thread that awaited, which can
+        // happen before addAwaitingCoroutine() returns, so don't call it on
+        // a member.
+        QFutureInterface<T> fi = m_future.d;
+        fi.addAwaitingCoroutine(coroutineResumeContext(), this, &resume<Promise>);
+    }
+
+    T await_resume()
+    {
+        m_future.d.waitForFinished(); // doesn't block, rethrows a stored exception
+        if constexpr (!std::is_void_v<T>) {
+            if constexpr (std::is_default_constructible_v<T>) {
+                // only reachable from coroutines that aren't QFuture coroutines
+                if (m_future.isCanceled() && m_future.resultCount() == 0)
+                    return T();
+            }
+            if constexpr (std::is_copy_constructible_v<T>)
+                return m_future.result();
+            else
+                return m_future.takeResult();
+        }
+    }
+
+private:
+    template <typename Promise>
+    static void resume(void *data)
+    {
+        auto *awaiter = static_cast<FutureAwaiter *>(data);
+        const auto handle = std::coroutine_handle<Promise>::from_address(awaiter->m_frame);
+        if constexpr (std::is_base_of_v<CoroutinePromiseBase, Promise>) {
+            // a canceled future cancels the coroutine that waits for it, as
+            // it does for a .then() continuation
+            const QFutureInterfaceBase &parent = awaiter->m_future.d;
+            if (parent.isCanceled() && !parent.hasException()) {
+                handle.destroy();
+                return;
+            }
+        }
+        resumeOrDestroyCoroutine(handle);
+    }
+
+    QFuture<T> m_future;
+    void *m_frame = nullptr;
+};
+
+// The state shared by an awaiter that waits for one of several signals and
+// the connections to those signals. The first signal to arrive resumes the
+// coroutine and disconnects the others.
+template <typename Result>
+class SignalAwaiterState
+{
+public:
+    Result result = {};
+
+    template <typename Promise>
+    void prepare(std::coroutine_handle<Promise> handle)
+    {
+        frame = handle.address();
+        resume = &resumeCoroutineFrame<Promise>;
+        context = coroutineResumeContext();
+    }
+
+    template <typename Sender, typename Signal, typename Function>
+    void connect(const Sender *sender, Signal signal, Function &&function)
+    {
+        // Queued to the event loop of the awaiting thread, or called right
+        // away if that thread has none.
+        const QObject *receiver = context ? context : sender;
+        const auto type = context ? Qt::QueuedConnection : Qt::DirectConnection;
+        const QMetaObject::Connection connection =
+                QObject::connect(sender, signal, receiver, std::forward<Function>(function),
+                                 Qt::ConnectionType(type | Qt::SingleShotConnection));
+
+        QMutexLocker locker(&mutex);
+        if (done.load(std::memory_order_acquire))
+            QObject::disconnect(connection);
+        else
+            connections.append(connection);
+    }
+
+    template <typename Function>
+    void connectDestroyed(const QObject *sender, Function &&function)
+    {
+        connect(sender, &QObject::destroyed, std::forward<Function>(function));
+    }
+
+    // Returns true if this is the first signal to arrive.
+    bool take()
+    {
+        if (done.exchange(true, std::memory_order_acq_rel))
+            return false;
+        QMutexLocker locker(&mutex);
+        for (const QMetaObject::Connection &connection : std::as_const(connections))
+            QObject::disconnect(connection);
+        connections.clear();
+        return true;
+    }
+
+    void finish(Result &&value)
+    {
+        if (!take())
+            return;
+        result = std::move(value);
+        resume(frame);
+    }
+
+private:
+    void *frame = nullptr;
+    void (*resume)(void *frame) = nullptr;
+    QObject *context = nullptr;
+    std::atomic<bool> done = false;
+    QBasicMutex mutex; // protects connections
+    QVarLengthArray<QMetaObject::Connection, 4> connections;
+};
+
+template <typename Result>
+class SignalAwaiterBase
+{
+public:
+    Q_DISABLE_COPY_MOVE(SignalAwaiterBase)
+
+    Result await_resume() { return std::move(m_state->result); }
+
+protected:
+    using State = SignalAwaiterState<Result>;
+
+    SignalAwaiterBase() : m_state(std::make_shared<State>()) { }
+    ~SignalAwaiterBase()
+    {
+        // in case the coroutine got destroyed while waiting
+        m_state->take();
+    }
+
+    // Note that without an event loop the first connection can resume the
+    // coroutine, and destroy the awaiter, before await_suspend() returns.
+    // await_suspend() thus only uses its own copy of m_state.
+    std::shared_ptr<State> m_state;
+};
+
+template <typename Sender, typename Signal>
+using SignalAwaiterResult = std::conditional_t<std::is_void_v<QtFuture::ArgsType<Signal>>, bool,
+                                               std::optional<QtFuture::ArgsType<Signal>>>;
+
+template <typename Sender, typename Signal>
+class SignalAwaiter : public SignalAwaiterBase<SignalAwaiterResult<Sender, Signal>>
+{
+    using Args = QtFuture::ArgsType<Signal>;
+    using Result = SignalAwaiterResult<Sender, Signal>;
+
+public:
+    SignalAwaiter(const Sender *sender, Signal signal) : m_sender(sender), m_signal(signal) { }
+
+    bool await_ready() const noexcept { return !m_sender; }
+
+    template <typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        const auto state = this->m_state;
+        const Sender *sender = m_sender;
+        state->prepare(handle);
+        state->connectDestroyed(sender, [state] { state->finish(Result()); });
+        if constexpr (std::is_void_v<Args>) {
+            state->connect(sender, m_signal, [state] { state->finish(true); });
+        } else if constexpr (QtPrivate::ArgResolver<Signal>::HasExtraArgs) {
+            state->connect(sender, m_signal, [state](auto... values) {
+                state->finish(Result(QtPrivate::createTuple(std::move(values)...)));
+            });
+        } else {
+            state->connect(sender, m_signal, [state](Args value) {
+                state->finish(Result(std::move(value)));
+            });
+        }
+    }
+
+private:
+    const Sender *m_sender;
+    Signal m_signal;
+};
+
+class ReadyReadAwaiter : public SignalAwaiterBase<bool>
+{
+public:
+    explicit ReadyReadAwaiter(const QIODevice *device) : m_device(device) { }
+
+    bool await_ready() const
+    {
+        if (!m_device || !m_device->isReadable() || m_device->bytesAvailable() > 0) {
+            m_state->result = m_device && m_device->bytesAvailable() > 0;
+            return true;
+        }
+        return false;
+    }
+
+    template <typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        const auto state = m_state;
+        const QIODevice *device = m_device;
+        state->prepare(handle);
+        state->connectDestroyed(device, [state] { state->finish(false); });
+        state->connect(device, &QIODevice::aboutToClose, [state] { state->finish(false); });
+        state->connect(device, &QIODevice::readChannelFinished, [state] { state->finish(false); });
+        state->connect(device, &QIODevice::readyRead, [state] { state->finish(true); });
+    }
+
+private:
+    const QIODevice *m_device;
+};
+
+class BytesWrittenAwaiter : public SignalAwaiterBase<qint64>
+{
+public:
+    explicit BytesWrittenAwaiter(const QIODevice *device) : m_device(device) { }
+
+    bool await_ready() const
+    {
+        if (!m_device || !m_device->isWritable()) {
+            m_state->result = -1;
+            return true;
+        }
+        return m_device->bytesToWrite() == 0;
+    }
+
+    template <typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        const auto state = m_state;
+        const QIODevice *device = m_device;
+        state->prepare(handle);
+        state->connectDestroyed(device, [state] { state->finish(-1); });
+        state->connect(device, &QIODevice::aboutToClose, [state] { state->finish(-1); });
+        state->connect(device, &QIODevice::bytesWritten,
+                       [state](qint64 bytes) { state->finish(qint64(bytes)); });
+    }
+
+private:
+    const QIODevice *m_device;
+};
+
+} // namespace QtPrivate
+
+template <typename T>
+auto operator co_await(const QFuture<T> &future)
+{
+    return QtPrivate::FutureAwaiter<T>(future);
+}
+
+namespace QtCoroutine {
+
+template <typename Sender, typename Signal,
+          typename = QtPrivate::EnableIfInvocable<Sender, Signal>>
+auto waitForSignal(const Sender *sender, Signal signal)
+{
+    return QtPrivate::SignalAwaiter<Sender, Signal>(sender, signal);
+}
+
+inline auto waitForReadyRead(const QIODevice *device)
+{
+    return QtPrivate::ReadyReadAwaiter(device);
+}
+
+inline auto waitForBytesWritten(const QIODevice *device)
+{
+    return QtPrivate::BytesWrittenAwaiter(device);
+}
+
+} // namespace QtCoroutine
+
+#endif // QT_COROUTINES_SUPPORTED
+
+QT_END_NAMESPACE
+
+#if defined(QT_COROUTINES_SUPPORTED)
+template <typename T, typename... Args>
+struct std::coroutine_traits<QT_PREPEND_NAMESPACE(QFuture)<T>, Args...>
+{
+    using promise_type = QT_PREPEND_NAMESPACE(QtPrivate::FutureCoroutinePromise)<T>;
+};
+#endif
+
+#endif // QCOROUTINE_H
@@ -297,6 +297,9 @@ private:
 
     friend struct QtPrivate::UnwrapHandler;
 
+    template<typename U>
+    friend class QtPrivate::FutureAwaiter;
+
     using QFuturePrivate =
             std::conditional_t<std::is_void_v<T>, QFutureInterfaceBase, QFutureInterface<T>>;
 
@@ -534,24 +534,20 @@ void CompactContinuation<Function, ResultType, ParentResultType>::create(F &&fun
     auto continuation = [func = std::forward<F>(func), fi, promise_ = QPromise(fi), pool,
                          launchAsync](const QFutureInterfaceBase &parentData) mutable {
         const auto parent = QFutureInterface<ParentResultType>(parentData).future();
-        CompactContinuation<Function, ResultType, ParentResultType> *continuationJob = nullptr;
         if (launchAsync) {
-            auto asyncJob = new CompactContinuation<Function, ResultType, ParentResultType>(
+            auto continuationJob = new CompactContinuation<Function, ResultType, ParentResultType>(
                     std::forward<Function>(func), parent, std::move(promise_), pool);
-            fi.setRunnable(asyncJob->runnable());
-            continuationJob = asyncJob;
+            fi.setRunnable(continuationJob->runnable());
+            // If continuation is successfully launched, it will be deleted
+            // from the QRunnable's lambda.
+            if (!continuationJob->execute())
+                delete continuationJob;
         } else {
-            continuationJob = new CompactContinuation<Function, ResultType, ParentResultType>(
+            // Synchronous continuation runs right here, on the thread that
+            // finished the parent, so it doesn't need to outlive this call.
+            CompactContinuation<Function, ResultType, ParentResultType> continuationJob(
                     std::forward<Function>(func), parent, std::move(promise_));
-        }
-
-        bool isLaunched = continuationJob->execute();
-        // If continuation is successfully launched, AsyncContinuation will be deleted
-        // from the QRunnable's lambda. Synchronous continuation will be
-        // executed immediately, so it's safe to always delete it here.
-        if (!(launchAsync && isLaunched)) {
-            delete continuationJob;
-            continuationJob = nullptr;
+            continuationJob.execute();
         }
     };
     f->d.setContinuation(ContinuationWrapper(std::move(continuation)), fi.d,
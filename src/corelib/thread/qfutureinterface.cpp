@@ -8,6 +8,7 @@
 
 #include <QtCore/qatomic.h>
 #include <QtCore/qcoreapplication.h>
+#include <QtCore/qcoroutine.h>
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qthread.h>
 #include <QtCore/qvarlengtharray.h>
@@ -99,16 +100,19 @@ static inline int switch_on(QAtomicInt &a, int which)
     return a.fetchAndOrRelaxed(which) | which;
 }
 
+// Switching off Running (or switching to Finished) needs release semantics:
+// waitForResult() and waitForFinished() check for it without locking m_mutex,
+// and rely on it to make the results reported before visible.
 static inline int switch_off(QAtomicInt &a, int which)
 {
-    return a.fetchAndAndRelaxed(~which) & ~which;
+    return a.fetchAndAndRelease(~which) & ~which;
 }
 
 static inline int switch_from_to(QAtomicInt &a, int from, int to)
 {
     const auto adjusted = [&](int old) { return (old & ~from) | to; };
     int value = a.loadRelaxed();
-    while (!a.testAndSetRelaxed(value, adjusted(value), value))
+    while (!a.testAndSetRelease(value, adjusted(value), value))
         qYieldCpu();
     return value;
 }
@@ -485,6 +489,10 @@ void QFutureInterfaceBase::waitForResult(int resultIndex)
     if (d->hasException)
         d->data.m_exceptionStore.rethrowException();
 
+    // Nothing changes any more once the future is done, no need to lock.
+    if (!(d->state.loadAcquire() & (Running | Pending)))
+        return;
+
     QMutexLocker lock(&d->m_mutex);
     if (!isRunningOrPending())
         return;
@@ -506,14 +514,10 @@ void QFutureInterfaceBase::waitForResult(int resultIndex)
 
 void QFutureInterfaceBase::waitForFinished()
 {
-    QMutexLocker lock(&d->m_mutex);
-    const bool alreadyFinished = isFinished();
-    lock.unlock();
-
-    if (!alreadyFinished) {
+    if (!(d->state.loadAcquire() & Finished)) {
         d->pool()->d_func()->stealAndRunRunnable(d->runnable);
 
-        lock.relock();
+        QMutexLocker lock(&d->m_mutex);
 
         while (!isFinished())
             d->waitCondition.wait(&d->m_mutex);
@@ -1009,9 +1013,35 @@ void QFutureInterfaceBase::cleanContinuation()
     d->continuationData = nullptr;
 }
 
+/*
+    Resumes the coroutine through QtPrivate::postCoroutineResume() once this
+    future is finished, or right away if it already is. This doesn't touch
+    the continuation, so several coroutines can await the same future, and
+    it can still get a .then() continuation.
+*/
+void QFutureInterfaceBase::addAwaitingCoroutine(QObject *context, void *data,
+                                                void (*resume)(void *data))
+{
+    QMutexLocker lock(&d->continuationMutex);
+    // runContinuation() takes the list after the future got finished
+    if (!isFinished()) {
+        d->awaitingCoroutines.append({ context, data, resume });
+        return;
+    }
+    lock.unlock();
+    QtPrivate::postCoroutineResume(context, data, resume);
+}
+
 void QFutureInterfaceBase::runContinuation() const
 {
     QMutexLocker lock(&d->continuationMutex);
+    if (!d->awaitingCoroutines.isEmpty()) {
+        const auto coroutines = std::exchange(d->awaitingCoroutines, {});
+        lock.unlock();
+        for (const auto &coroutine : coroutines)
+            QtPrivate::postCoroutineResume(coroutine.context, coroutine.data, coroutine.resume);
+        lock.relock();
+    }
     if (d->continuation && !d->continuationExecuted) {
         // If we run the next continuation, then this future is concluded, so
         // we wouldn't need to revisit it in the cancelChain()
@@ -44,6 +44,9 @@ class FailureHandler;
 
 struct UnwrapHandler;
 
+template<typename T>
+class FutureAwaiter;
+
 #if QT_CORE_REMOVED_SINCE(6, 10)
 void Q_CORE_EXPORT watchContinuationImpl(const QObject *context,
                                          QtPrivate::QSlotObjectBase *slotObj,
@@ -191,6 +194,9 @@ private:
 
     friend struct QtPrivate::UnwrapHandler;
 
+    template<typename T>
+    friend class QtPrivate::FutureAwaiter;
+
 #if QT_CORE_REMOVED_SINCE(6, 10)
     friend Q_CORE_EXPORT void QtPrivate::watchContinuationImpl(
             const QObject *context, QtPrivate::QSlotObjectBase *slotObj, QFutureInterfaceBase &fi);
@@ -219,6 +225,7 @@ protected:
                          const QVariant &continuationFuture, ContinuationType type);
     void cleanContinuation();
     void runContinuation() const;
+    void addAwaitingCoroutine(QObject *context, void *data, void (*resume)(void *data));
 
     void setLaunchAsync(bool value);
     bool launchAsync() const;
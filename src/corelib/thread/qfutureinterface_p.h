@@ -20,6 +20,7 @@
 #include <QtCore/qelapsedtimer.h>
 #include <QtCore/qcoreevent.h>
 #include <QtCore/qlist.h>
+#include <QtCore/qvarlengtharray.h>
 #include <QtCore/qwaitcondition.h>
 #include <QtCore/qrunnable.h>
 #include <QtCore/qthreadpool.h>
@@ -112,14 +113,44 @@ public:
         QAtomicInt m_refCountT;
     };
 
+    // Most futures are never waited on, so the QWaitCondition (and the
+    // allocation that comes with it) is only created by the first waiter.
+    // wait() must be called with m_mutex held.
+    class WaitCondition
+    {
+    public:
+        WaitCondition() = default;
+        ~WaitCondition() { delete m_condition.loadRelaxed(); }
+        Q_DISABLE_COPY_MOVE(WaitCondition)
+
+        void wait(QMutex *mutex)
+        {
+            QWaitCondition *condition = m_condition.loadRelaxed();
+            if (!condition) {
+                condition = new QWaitCondition;
+                m_condition.storeRelease(condition);
+            }
+            condition->wait(mutex);
+        }
+        void wakeAll()
+        {
+            // without a condition there is nobody to wake up
+            if (QWaitCondition *condition = m_condition.loadAcquire())
+                condition->wakeAll();
+        }
+
+    private:
+        QAtomicPointer<QWaitCondition> m_condition;
+    };
+
     // T: accessed from executing thread
     // Q: accessed from the waiting/querying thread
     mutable QMutex m_mutex;
     QBasicMutex continuationMutex;
     QList<QFutureCallOutInterface *> outputConnections;
     QElapsedTimer progressTime;
-    QWaitCondition waitCondition;
-    QWaitCondition pausedWaitCondition;
+    WaitCondition waitCondition;
+    WaitCondition pausedWaitCondition;
 
     union Data {
         QtPrivate::ResultStoreBase m_results;
@@ -146,6 +177,16 @@ public:
     // will reset back to nullptr when the parent future is done
     // (finished, canceled, failed etc)
     QFutureInterfaceBasePrivate *nonConcludedParent = nullptr;
+    // Coroutines suspended in co_await on this future. Unlike the
+    // continuation, there can be any number of them. Guarded by
+    // continuationMutex.
+    struct AwaitingCoroutine
+    {
+        QObject *context;
+        void *data;
+        void (*resume)(void *data);
+    };
+    QVarLengthArray<AwaitingCoroutine, 1> awaitingCoroutines;
 
     RefCount refCount = 1;
     QAtomicInt state; // reads and writes can happen unprotected, both must be atomic
@@ -167,6 +167,11 @@ bool ResultStoreBase::containsValidResultItem(int index) const
 
 void ResultStoreBase::syncPendingResults()
 {
+    // Don't let begin() detach (and allocate) the map for the common case of
+    // results that are reported in order.
+    if (pendingResults.isEmpty())
+        return;
+
     // check if we can insert any of the pending results:
     QMap<int, ResultItem>::iterator it = pendingResults.begin();
     while (it != pendingResults.end()) {
@@ -38,6 +38,111 @@ void QPostEventList::addEvent(const QPostEvent &ev)
     }
 }
 
+/*!
+    \internal
+
+    Registers the calling thread as a writer of pending events. Returns
+    \c false if adding pending events is blocked at the moment, in which
+    case the event must be added with the mutex locked. Otherwise,
+    endAddPendingEvent() must be called when done.
+*/
+bool QPostEventList::beginAddPendingEvent()
+{
+    // pairs with blockPendingEvents(): either it sees this writer and waits
+    // for it, or this writer sees the block
+    pendingEventWriters.fetch_add(1);
+    if (pendingEventsBlocked.load()) {
+        endAddPendingEvent();
+        return false;
+    }
+    return true;
+}
+
+/*!
+    \internal
+
+    Adds \a ev to the events that the next takePendingEvents() moves into
+    the list. Returns \c false if there is no room left, in which case
+    the event must be added with the mutex locked.
+
+    Must be called between beginAddPendingEvent() and endAddPendingEvent().
+*/
+bool QPostEventList::tryAddPendingEvent(const QPostEvent &ev)
+{
+    using Buffer = PendingEventBuffer;
+    Buffer *buffer = pendingEventBuffer.load(std::memory_order_acquire);
+    if (!buffer) {
+        auto newBuffer = std::make_unique<Buffer>();
+        if (pendingEventBuffer.compare_exchange_strong(buffer, newBuffer.get(),
+                                                       std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+            buffer = newBuffer.release();
+        }
+    }
+
+    quint64 position = buffer->enqueuePosition.load(std::memory_order_relaxed);
+    for (;;) {
+        Buffer::Slot &slot = buffer->ring[position & (Buffer::Capacity - 1)];
+        const qint64 lap = qint64(slot.sequence.load(std::memory_order_acquire) - position);
+        if (lap == 0) {
+            if (buffer->enqueuePosition.compare_exchange_weak(position, position + 1,
+                                                             std::memory_order_relaxed)) {
+                slot.event = ev;
+                slot.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (lap < 0) {
+            return false; // full
+        } else {
+            position = buffer->enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool QPostEventList::hasPendingEvents() const
+{
+    const PendingEventBuffer *buffer = pendingEventBuffer.load(std::memory_order_acquire);
+    return buffer
+        && buffer->enqueuePosition.load(std::memory_order_relaxed) != buffer->dequeuePosition;
+}
+
+/*!
+    \internal
+
+    Moves the events added without the mutex into the list, in the order
+    they were added. Must be called with the mutex locked.
+*/
+void QPostEventList::takePendingEvents()
+{
+    using Buffer = PendingEventBuffer;
+    Buffer *buffer = pendingEventBuffer.load(std::memory_order_acquire);
+    if (!buffer)
+        return;
+
+    // Stop at the events added so far, but include the ones that are still
+    // being filled in: a thread that added an event without the mutex and
+    // then locks it to post another one expects them to stay in order.
+    const quint64 end = buffer->enqueuePosition.load(std::memory_order_acquire);
+    while (buffer->dequeuePosition != end) {
+        const quint64 position = buffer->dequeuePosition;
+        Buffer::Slot &slot = buffer->ring[position & (Buffer::Capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            QThread::yieldCurrentThread();
+            continue;
+        }
+        addEvent(slot.event);
+        slot.sequence.store(position + Buffer::Capacity, std::memory_order_release);
+        ++buffer->dequeuePosition;
+    }
+}
+
+void QPostEventList::blockPendingEvents()
+{
+    pendingEventsBlocked.store(true);
+    while (pendingEventWriters.load() != 0)
+        QThread::yieldCurrentThread();
+    takePendingEvents();
+}
 
 /*
   QThreadData
@@ -73,6 +178,7 @@ QThreadData::~QThreadData()
 
 void QThreadData::clearEvents()
 {
+    postEventList.takePendingEvents();
     for (const auto &pe : std::as_const(postEventList)) {
         if (pe.event) {
             pe.receiver->d_func()->postedEvents.fetchAndSubRelaxed(1);
@@ -76,9 +76,53 @@ public:
     QMutex mutex;
 
     inline QPostEventList() : QList<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0) { }
+    inline ~QPostEventList() { delete pendingEventBuffer.load(std::memory_order_relaxed); }
 
     void addEvent(const QPostEvent &ev);
 
+    // Events posted without taking the mutex, see
+    // QCoreApplicationPrivate::tryPostEventLockFree(). Anyone holding the
+    // mutex must call takePendingEvents() before looking at the list, so
+    // that the events of each posting thread stay in order.
+    bool beginAddPendingEvent();
+    bool tryAddPendingEvent(const QPostEvent &ev);
+    void endAddPendingEvent()
+    { pendingEventWriters.fetch_sub(1, std::memory_order_release); }
+    bool hasPendingEvents() const; // requires the mutex
+    void takePendingEvents();
+    // makes beginAddPendingEvent() fail until unblocked, and waits for the
+    // writers already past it; requires the mutex
+    void blockPendingEvents();
+    void unblockPendingEvents()
+    { pendingEventsBlocked.store(false); }
+
+private:
+    // A bounded multi-producer queue (after Dmitry Vyukov's), where each
+    // slot's sequence number tells whether it is free or filled in for the
+    // current lap. Allocated when first used.
+    struct PendingEventBuffer
+    {
+        enum { Capacity = 1024 }; // must be a power of two
+        struct Slot
+        {
+            std::atomic<quint64> sequence;
+            QPostEvent event;
+        };
+
+        PendingEventBuffer()
+        {
+            for (quint64 i = 0; i < Capacity; ++i)
+                ring[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        alignas(64) std::atomic<quint64> enqueuePosition = 0;
+        alignas(64) quint64 dequeuePosition = 0; // guarded by the mutex
+        Slot ring[Capacity];
+    };
+    std::atomic<PendingEventBuffer *> pendingEventBuffer = nullptr;
+    std::atomic<int> pendingEventWriters = 0;
+    std::atomic<bool> pendingEventsBlocked = false;
+
 private:
     //hides because they do not keep that list sorted. addEvent must be used
     using QList<QPostEvent>::append;
@@ -356,7 +400,7 @@ public:
     bool canWaitLocked()
     {
         QMutexLocker locker(&postEventList.mutex);
-        return canWait;
+        return canWait && !postEventList.hasPendingEvents();
     }
 
     void clearEvents();
@@ -17,6 +17,9 @@
 #  include <private/qeventdispatcher_wasm_p.h>
 #else
 #  include <private/qeventdispatcher_unix_p.h>
+#  if QT_CONFIG(epoll)
+#    include <private/qeventdispatcher_epoll_p.h>
+#  endif
 #  if defined(Q_OS_DARWIN)
 #    include <private/qeventdispatcher_cf_p.h>
 #  elif !defined(QT_NO_GLIB)
@@ -316,6 +319,10 @@ typedef void *(*QtThreadCallback)(void *);
 QAbstractEventDispatcher *QThreadPrivate::createEventDispatcher(QThreadData *data)
 {
     Q_UNUSED(data);
+#if QT_CONFIG(epoll)
+    if (qgetenv("QT_EVENT_DISPATCHER") == "epoll")
+        return new QEventDispatcherEpoll;
+#endif
 #if defined(Q_OS_DARWIN)
     bool ok = false;
     int value = qEnvironmentVariableIntValue("QT_EVENT_DISPATCHER_CORE_FOUNDATION", &ok);
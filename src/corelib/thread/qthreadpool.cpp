@@ -8,6 +8,7 @@
 #include "qcoreapplication.h"
 
 #include <QtCore/qpointer.h>
+#include <QtCore/qvarlengtharray.h>
 
 #include <algorithm>
 #include <climits> // For INT_MAX
@@ -28,13 +29,21 @@ class QThreadPoolThread : public QThread
 public:
     QThreadPoolThread(QThreadPoolPrivate *manager);
     void run() override;
+    void runRunnable(QRunnable *r);
     void registerThreadInactive();
 
     QWaitCondition runnableReady;
     QThreadPoolPrivate *manager;
     QRunnable *runnable;
+    // tasks this thread started on its own pool, see tryEnqueueLocalTask()
+    QThreadPoolWorkDeque localTasks;
+    // position of localTasks in the published list, see publishWorkDeques()
+    std::atomic<qsizetype> workDequeIndex = 0;
 };
 
+// the pool thread running on the current thread, if any
+Q_CONSTINIT static thread_local QThreadPoolThread *currentPoolThread = nullptr;
+
 /*
     QThreadPool private class.
 */
@@ -54,6 +63,7 @@ QThreadPoolThread::QThreadPoolThread(QThreadPoolPrivate *manager)
 */
 void QThreadPoolThread::run()
 {
+    currentPoolThread = this;
     QMutexLocker locker(&manager->mutex);
     for(;;) {
         QRunnable *r = runnable;
@@ -61,37 +71,41 @@ void QThreadPoolThread::run()
 
         do {
             if (r) {
-                // If autoDelete() is false, r might already be deleted after run(), so check status now.
-                const bool del = r->autoDelete();
-
-                // run the task
                 locker.unlock();
-#ifndef QT_NO_EXCEPTIONS
-                try {
-#endif
-                    r->run();
-#ifndef QT_NO_EXCEPTIONS
-                } catch (...) {
-                    qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
-                             "This is not supported, exceptions thrown in worker threads must be\n"
-                             "caught before control returns to Qt Concurrent.");
-                    registerThreadInactive();
-                    throw;
-                }
-#endif
-
-                if (del)
-                    delete r;
+                runRunnable(r);
+                // continue with the tasks spawned by this and the other
+                // threads, as long as the queue has nothing more important
+                while ((r = manager->takeLocalTask(this)))
+                    runRunnable(r);
                 locker.relock();
             }
 
-            // if too many threads are active, stop working in this one
-            if (manager->tooManyThreadsActive())
-                break;
+            // tasks in the local deque keep this thread active, as nobody
+            // else is guaranteed to pick them up
+            if (!localTasks.isEmpty()) {
+                if (manager->queue.isEmpty()
+                    || manager->queue.constFirst()->priority() <= 0) {
+                    r = localTasks.pop();
+                    if (r)
+                        continue;
+                }
+            } else {
+                // if too many threads are active, stop working in this one
+                if (manager->tooManyThreadsActive())
+                    break;
+
+                if (manager->queue.isEmpty()) {
+                    // help the other threads with their deques, if any
+                    r = manager->stealLocalTask(this);
+                    if (r)
+                        continue;
+                    // all work is done, time to wait for more
+                    break;
+                }
+            }
 
-            // all work is done, time to wait for more
             if (manager->queue.isEmpty())
-                break;
+                continue; // the local deque was emptied by another thread
 
             QueuePage *page = manager->queue.constFirst();
             r = page->pop();
@@ -100,6 +114,7 @@ void QThreadPoolThread::run()
                 manager->queue.removeFirst();
                 delete page;
             }
+            manager->updateHints();
         } while (true);
 
         // this thread is about to be deleted, do not wait or expire
@@ -116,6 +131,18 @@ void QThreadPoolThread::run()
         }
         manager->waitingThreads.enqueue(this);
         registerThreadInactive();
+        // A thread that pushed a task to its deque while this one was still
+        // active didn't hand it over. Now that the hints tell that there's a
+        // spare thread, look again (tryEnqueueLocalTask() has the matching
+        // fence), so that no task is left behind while this one sleeps.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (QRunnable *stolen = manager->stealLocalTask(this)) {
+            manager->waitingThreads.removeOne(this);
+            ++manager->activeThreads;
+            manager->updateHints();
+            runnable = stolen;
+            continue;
+        }
         // wait for work, exiting after the expiry timeout is reached
         runnableReady.wait(locker.mutex(), QDeadlineTimer(manager->expiryTimeout));
         // this thread is about to be deleted, do not work or expire
@@ -128,13 +155,38 @@ void QThreadPoolThread::run()
             return;
         }
         ++manager->activeThreads;
+        manager->updateHints();
+    }
+}
+
+void QThreadPoolThread::runRunnable(QRunnable *r)
+{
+    // If autoDelete() is false, r might already be deleted after run(), so check status now.
+    const bool del = r->autoDelete();
+
+#ifndef QT_NO_EXCEPTIONS
+    try {
+#endif
+        r->run();
+#ifndef QT_NO_EXCEPTIONS
+    } catch (...) {
+        qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
+                 "This is not supported, exceptions thrown in worker threads must be\n"
+                 "caught before control returns to Qt Concurrent.");
+        registerThreadInactive();
+        throw;
     }
+#endif
+
+    if (del)
+        delete r;
 }
 
 void QThreadPoolThread::registerThreadInactive()
 {
     if (--manager->activeThreads == 0)
         manager->noActiveThreads.wakeAll();
+    manager->updateHints();
 }
 
 
@@ -144,6 +196,11 @@ void QThreadPoolThread::registerThreadInactive()
 QThreadPoolPrivate:: QThreadPoolPrivate()
 { }
 
+QThreadPoolPrivate::~QThreadPoolPrivate()
+{
+    delete workDeques.load(std::memory_order_relaxed);
+}
+
 bool QThreadPoolPrivate::tryStart(QRunnable *task)
 {
     Q_ASSERT(task != nullptr);
@@ -204,6 +261,150 @@ void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
     queue.insert(std::distance(queue.constBegin(), it), new QueuePage(runnable, priority));
 }
 
+/*!
+    \internal
+
+    Refreshes the copies of the queue and thread state that the lock-free
+    work-stealing paths read. Must be called with the mutex locked, after
+    changing either. Does nothing unless work stealing is enabled, as the
+    hints are only read then; setWorkStealingEnabled() refreshes them.
+*/
+void QThreadPoolPrivate::updateHints()
+{
+    if (!workStealing.loadRelaxed())
+        return;
+    highestQueuedPriority.storeRelaxed(queue.isEmpty() ? INT_MIN : queue.constFirst()->priority());
+    hasSpareThreads.storeRelaxed(!areAllThreadsActive());
+}
+
+/*!
+    \internal
+
+    Pushes \a task to the work-stealing deque of the calling thread, without
+    taking the mutex, if work stealing is enabled and the caller is one of
+    this pool's threads. If other threads could run the task right away,
+    the oldest local tasks are handed over to them.
+
+    Returns \c false if the task needs to be started the regular way.
+*/
+bool QThreadPoolPrivate::tryEnqueueLocalTask(QRunnable *task)
+{
+    if (!workStealing.loadRelaxed())
+        return false;
+    QThreadPoolThread *thread = currentPoolThread;
+    if (!thread || thread->manager != this)
+        return false;
+    if (!thread->localTasks.push(task))
+        return false; // full, use the shared queue
+
+    // pairs with the fence in QThreadPoolThread::run() before waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (hasSpareThreads.loadRelaxed()) {
+        QMutexLocker locker(&mutex);
+        while (!areAllThreadsActive()) {
+            QRunnable *r = thread->localTasks.steal();
+            if (!r)
+                break;
+            const bool started = tryStart(r);
+            Q_ASSERT(started);
+        }
+        updateHints();
+    }
+    return true;
+}
+
+/*!
+    \internal
+
+    Returns the next task for \a thread to run without taking the mutex:
+    the newest task in its own deque, or else the oldest one from another
+    thread's deque. Returns \nullptr if there is none, or if the shared queue
+    holds tasks of a higher priority.
+*/
+QRunnable *QThreadPoolPrivate::takeLocalTask(QThreadPoolThread *thread)
+{
+    if (highestQueuedPriority.loadRelaxed() > 0)
+        return nullptr;
+    if (QRunnable *r = thread->localTasks.pop())
+        return r;
+    return stealLocalTask(thread);
+}
+
+/*!
+    \internal
+
+    Returns the oldest task from another thread's deque, or \nullptr if
+    there is none. Doesn't need the mutex.
+*/
+QRunnable *QThreadPoolPrivate::stealLocalTask(QThreadPoolThread *thread)
+{
+    if (!workStealing.loadRelaxed())
+        return nullptr;
+
+    const WorkDequeList *deques = workDeques.load(std::memory_order_acquire);
+    if (!deques)
+        return nullptr;
+    // start with the next thread, so that the thieves spread out
+    const qsizetype count = deques->size();
+    const qsizetype index = thread->workDequeIndex.load(std::memory_order_relaxed);
+    for (qsizetype i = 1; i < count; ++i) {
+        QThreadPoolWorkDeque *victim = deques->at((index + i) % count);
+        if (QRunnable *r = victim->steal())
+            return r;
+    }
+    return nullptr;
+}
+
+/*!
+    \internal
+
+    Removes \a runnable from the deque of the calling thread, if the
+    calling thread belongs to this pool. This doesn't need the mutex, so
+    that a task can cheaply take and run a child task it is waiting for.
+*/
+bool QThreadPoolPrivate::tryTakeLocalTask(QRunnable *runnable)
+{
+    QThreadPoolThread *thread = currentPoolThread;
+    if (!thread || thread->manager != this || thread->localTasks.isEmpty())
+        return false;
+    return thread->localTasks.remove(runnable);
+}
+
+/*!
+    \internal
+
+    Removes \a runnable from the deque of any of the threads. Must be called
+    with the mutex locked, which keeps the threads from being deleted.
+*/
+bool QThreadPoolPrivate::tryTakeAnyLocalTask(QRunnable *runnable)
+{
+    for (QThreadPoolThread *thread : std::as_const(allThreads)) {
+        if (thread->localTasks.remove(runnable))
+            return true;
+    }
+    return false;
+}
+
+/*!
+    \internal
+
+    Removes the tasks from the deques of all threads, deleting the
+    auto-deleting ones. Helper for clear().
+*/
+void QThreadPoolPrivate::clearLocalTasks(QMutexLocker<QMutex> &locker)
+{
+    for (QThreadPoolThread *thread : std::as_const(allThreads)) {
+        while (!thread->localTasks.isEmpty()) {
+            QRunnable *r = thread->localTasks.steal();
+            if (r && r->autoDelete()) {
+                locker.unlock();
+                delete r;
+                locker.relock();
+            }
+        }
+    }
+}
+
 int QThreadPoolPrivate::activeThreadCount() const
 {
     return (allThreads.size()
@@ -256,10 +457,34 @@ void QThreadPoolPrivate::startThread(QRunnable *runnable)
     allThreads.insert(thread.get());
     ++activeThreads;
 
+    if (workStealing.loadRelaxed())
+        publishWorkDeques();
+
     thread->runnable = runnable;
     thread.release()->start(threadPriority);
 }
 
+/*!
+    \internal
+
+    Publishes the deques of all threads to stealLocalTask(), replacing the
+    list published before. Must be called with the mutex locked. A replaced
+    list may still be read by a thread looking for work, so it is only freed
+    by reset(), once those threads are gone. As threads are only deleted by
+    reset(), this keeps at most one list per thread started since.
+*/
+void QThreadPoolPrivate::publishWorkDeques()
+{
+    auto deques = std::make_unique<WorkDequeList>();
+    deques->reserve(allThreads.size());
+    for (QThreadPoolThread *thread : std::as_const(allThreads)) {
+        thread->workDequeIndex.store(deques->size(), std::memory_order_relaxed);
+        deques->append(&thread->localTasks);
+    }
+    if (const WorkDequeList *old = workDeques.exchange(deques.release(), std::memory_order_release))
+        retiredWorkDeques.emplace_back(old);
+}
+
 /*!
     \internal
 
@@ -273,6 +498,10 @@ void QThreadPoolPrivate::reset()
     auto allThreadsCopy = std::exchange(allThreads, {});
     expiredThreads.clear();
     waitingThreads.clear();
+    // the deque lists can only be read by the threads we are about to join
+    auto unusedWorkDeques = std::exchange(retiredWorkDeques, {});
+    unusedWorkDeques.emplace_back(workDeques.exchange(nullptr, std::memory_order_relaxed));
+    updateHints();
 
     mutex.unlock();
 
@@ -283,6 +512,7 @@ void QThreadPoolPrivate::reset()
         }
         delete thread;
     }
+    unusedWorkDeques.clear();
 
     mutex.lock();
 }
@@ -323,6 +553,8 @@ void QThreadPoolPrivate::clear()
         }
         delete page;
     }
+    clearLocalTasks(locker);
+    updateHints();
 }
 
 /*!
@@ -349,6 +581,9 @@ bool QThreadPool::tryTake(QRunnable *runnable)
     if (runnable == nullptr)
         return false;
 
+    if (d->tryTakeLocalTask(runnable))
+        return true;
+
     QMutexLocker locker(&d->mutex);
     for (QueuePage *page : std::as_const(d->queue)) {
         if (page->tryTake(runnable)) {
@@ -356,11 +591,13 @@ bool QThreadPool::tryTake(QRunnable *runnable)
                 d->queue.removeOne(page);
                 delete page;
             }
+            d->updateHints();
             return true;
         }
     }
 
-    return false;
+    // started from another pool thread, but not taken by any thread yet
+    return d->tryTakeAnyLocalTask(runnable);
 }
 
     /*!
@@ -497,10 +734,14 @@ void QThreadPool::start(QRunnable *runnable, int priority)
         return;
 
     Q_D(QThreadPool);
+    if (priority == 0 && d->tryEnqueueLocalTask(runnable))
+        return;
+
     QMutexLocker locker(&d->mutex);
 
     if (!d->tryStart(runnable))
         d->enqueueTask(runnable, priority);
+    d->updateHints();
 }
 
 /*!
@@ -543,8 +784,10 @@ bool QThreadPool::tryStart(QRunnable *runnable)
 
     Q_D(QThreadPool);
     QMutexLocker locker(&d->mutex);
-    if (d->tryStart(runnable))
+    if (d->tryStart(runnable)) {
+        d->updateHints();
         return true;
+    }
 
     return false;
 }
@@ -630,6 +873,7 @@ void QThreadPool::setMaxThreadCount(int maxThreadCount)
 
     d->requestedMaxThreadCount = maxThreadCount;
     d->tryToStartMoreThreads();
+    d->updateHints();
 }
 
 /*! \property QThreadPool::activeThreadCount
@@ -669,6 +913,7 @@ void QThreadPool::reserveThread()
     Q_D(QThreadPool);
     QMutexLocker locker(&d->mutex);
     ++d->reservedThreads;
+    d->updateHints();
 }
 
 /*! \property QThreadPool::stackSize
@@ -743,6 +988,7 @@ void QThreadPool::releaseThread()
     QMutexLocker locker(&d->mutex);
     --d->reservedThreads;
     d->tryToStartMoreThreads();
+    d->updateHints();
 }
 
 /*!
@@ -777,6 +1023,58 @@ QThread::QualityOfService QThreadPool::serviceLevel() const
     return d->serviceLevel;
 }
 
+/*!
+    \since 6.12
+
+    Sets whether this thread pool uses work stealing for runnables started
+    from within its own threads to \a enabled.
+
+    When work stealing is enabled, a runnable that is started with the
+    default priority from one of this pool's threads is not put on the
+    pool's shared queue. Instead, the thread keeps it in a queue of its own,
+    which it can access without locking, and runs the most recently started
+    runnables first once its current runnable finishes. Threads that run out
+    of work take the oldest runnables from the queues of the other threads.
+    This greatly reduces contention in programs that recursively split their
+    work into many small runnables, as is typical for divide and conquer
+    algorithms.
+
+    Runnables started with a non-zero priority, or from threads that do not
+    belong to this pool, always go through the shared queue, and runnables
+    with a higher priority than the default one are run before the
+    thread-local ones.
+
+    Work stealing is disabled by default.
+
+    \sa isWorkStealingEnabled(), start()
+*/
+void QThreadPool::setWorkStealingEnabled(bool enabled)
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    if (enabled == bool(d->workStealing.loadRelaxed()))
+        return;
+    d->workStealing.storeRelaxed(enabled);
+    if (enabled) {
+        // the threads started so far didn't publish their deques
+        d->publishWorkDeques();
+        d->updateHints();
+    }
+}
+
+/*!
+    \since 6.12
+
+    Returns \c true if work stealing is enabled for this thread pool.
+
+    \sa setWorkStealingEnabled()
+*/
+bool QThreadPool::isWorkStealingEnabled() const
+{
+    Q_D(const QThreadPool);
+    return d->workStealing.loadRelaxed();
+}
+
 /*!
     Releases a thread previously reserved with reserveThread() and uses it
     to run \a runnable.
@@ -811,6 +1109,7 @@ void QThreadPool::startOnReservedThread(QRunnable *runnable)
         // and something took the one minimum thread.
         d->enqueueTask(runnable, INT_MAX);
     }
+    d->updateHints();
 }
 
 /*!
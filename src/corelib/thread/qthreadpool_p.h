@@ -25,6 +25,11 @@
 #include "QtCore/qqueue.h"
 #include "private/qobject_p.h"
 
+#include <atomic>
+#include <climits>
+#include <memory>
+#include <vector>
+
 QT_BEGIN_NAMESPACE
 
 class QDeadlineTimer;
@@ -106,6 +111,126 @@ private:
     QRunnable *m_entries[MaxPageSize];
 };
 
+/*
+    A Chase-Lev work-stealing deque with a fixed capacity, as described in
+    "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al.).
+
+    Only the owning worker thread may push() and pop(), at the bottom end, so
+    it runs the tasks it spawned in LIFO order. Any other thread may steal()
+    from the top end, or remove() a task from anywhere in between.
+
+    Whoever gets a task out of the deque claims it by exchanging its entry
+    with \nullptr, so an entry that remove() took is skipped by pop() and
+    steal(), and a task is never handed out twice. push() only reuses an
+    entry after it was claimed.
+*/
+class QThreadPoolWorkDeque
+{
+public:
+    enum {
+        Capacity = 1024 // must be a power of two
+    };
+
+    // owner only; returns false if the deque is full
+    bool push(QRunnable *runnable) noexcept
+    {
+        const qint64 b = bottom.load(std::memory_order_relaxed);
+        const qint64 t = top.load(std::memory_order_acquire);
+        if (b - t >= Capacity)
+            return false;
+        std::atomic<QRunnable *> &entry = entries[b & (Capacity - 1)];
+        // a thief that moved top past this entry may not have claimed it yet
+        if (entry.load(std::memory_order_acquire))
+            return false;
+        entry.store(runnable, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // owner only
+    QRunnable *pop() noexcept
+    {
+        while (!isEmpty()) {
+            const qint64 b = bottom.load(std::memory_order_relaxed) - 1;
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            qint64 t = top.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            if (t == b) {
+                // last entry, race against the thieves for it
+                const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                             std::memory_order_relaxed);
+                bottom.store(b + 1, std::memory_order_relaxed);
+                if (!won)
+                    return nullptr;
+            }
+            if (QRunnable *runnable = claim(b))
+                return runnable;
+            // removed, try the next one
+        }
+        return nullptr;
+    }
+
+    // any thread; returns nullptr if empty or if another thread won the race
+    QRunnable *steal() noexcept
+    {
+        for (;;) {
+            qint64 t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const qint64 b = bottom.load(std::memory_order_acquire);
+            if (t >= b)
+                return nullptr;
+
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            if (QRunnable *runnable = claim(t))
+                return runnable;
+            // removed, try the next one
+        }
+    }
+
+    // any thread; returns true if \a runnable was in the deque and is now
+    // owned by the caller
+    bool remove(QRunnable *runnable) noexcept
+    {
+        const qint64 t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const qint64 b = bottom.load(std::memory_order_acquire);
+        for (qint64 i = b - 1; i >= t; --i) {
+            QRunnable *expected = runnable;
+            if (entries[i & (Capacity - 1)].compare_exchange_strong(expected, nullptr,
+                                                                  std::memory_order_acq_rel,
+                                                                  std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool isEmpty() const noexcept
+    {
+        return top.load(std::memory_order_relaxed) >= bottom.load(std::memory_order_relaxed);
+    }
+
+private:
+    QRunnable *claim(qint64 index) noexcept
+    {
+        return entries[index & (Capacity - 1)].exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    // keep the ends on separate cache lines, thieves only write to top
+    alignas(64) std::atomic<qint64> top = 0;
+    alignas(64) std::atomic<qint64> bottom = 0;
+    std::atomic<QRunnable *> entries[Capacity] = {};
+};
+
 class QThreadPoolThread;
 class Q_CORE_EXPORT QThreadPoolPrivate : public QObjectPrivate
 {
@@ -114,9 +239,11 @@ class Q_CORE_EXPORT QThreadPoolPrivate : public QObjectPrivate
 
 public:
     QThreadPoolPrivate();
+    ~QThreadPoolPrivate();
 
     bool tryStart(QRunnable *task);
     void enqueueTask(QRunnable *task, int priority = 0);
+    void updateHints();
     int activeThreadCount() const;
 
     void tryToStartMoreThreads();
@@ -132,6 +259,14 @@ public:
     void stealAndRunRunnable(QRunnable *runnable);
     void deletePageIfFinished(QueuePage *page);
 
+    void publishWorkDeques();
+    bool tryEnqueueLocalTask(QRunnable *task);
+    QRunnable *takeLocalTask(QThreadPoolThread *thread);
+    QRunnable *stealLocalTask(QThreadPoolThread *thread);
+    bool tryTakeLocalTask(QRunnable *runnable);
+    bool tryTakeAnyLocalTask(QRunnable *runnable);
+    void clearLocalTasks(QMutexLocker<QMutex> &locker);
+
     mutable QMutex mutex;
     QSet<QThreadPoolThread *> allThreads;
     QQueue<QThreadPoolThread *> waitingThreads;
@@ -147,6 +282,19 @@ public:
     uint stackSize = 0;
     QThread::Priority threadPriority = QThread::InheritPriority;
     QThread::QualityOfService serviceLevel = QThread::QualityOfService::Auto;
+
+    // Work stealing, see QThreadPool::setWorkStealingEnabled(). While it is
+    // enabled, the deques of all workers are published as an immutable
+    // list, so that idle workers can find them without taking the mutex.
+    // Replaced lists are kept until reset() joined the workers, as one may
+    // still be reading them.
+    using WorkDequeList = QList<QThreadPoolWorkDeque *>;
+    std::atomic<const WorkDequeList *> workDeques = nullptr;
+    std::vector<std::unique_ptr<const WorkDequeList>> retiredWorkDeques;
+    QAtomicInt workStealing = false;
+    // copies of state guarded by the mutex, for the lock-free paths
+    QAtomicInt highestQueuedPriority = INT_MIN;
+    QAtomicInt hasSpareThreads = false;
 };
 
 QT_END_NAMESPACE
@@ -20,6 +20,7 @@
 QT_BEGIN_NAMESPACE
 
 template <typename Key, typename T> class QCache;
+template <typename Key, typename T> class QFlatHash;
 template <typename Key, typename T> class QHash;
 template <typename Key, typename T> class QMap;
 template <typename Key, typename T> class QMultiHash;
@@ -28,6 +29,7 @@ template <typename Key, typename T> class QMultiMap;
 template <typename T1, typename T2>
 using QPair = std::pair<T1, T2>;
 #endif
+template <typename T> class QFlatSet;
 template <typename T> class QQueue;
 template <typename T> class QSet;
 template <typename T, std::size_t E = std::size_t(-1) /* = std::dynamic_extent*/> class QSpan;
@@ -0,0 +1,1277 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:significant reason:default
+
+#ifndef QFLATHASH_H
+#define QFLATHASH_H
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qcontainertools_impl.h>
+#include <QtCore/qendian.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qiterator.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qrefcount.h>
+#include <QtCore/qsimd.h>
+#include <QtCore/qttypetraits.h>
+
+#include <initializer_list>
+#include <new>
+
+class tst_QFlatHash; // for befriending
+
+QT_BEGIN_NAMESPACE
+
+namespace QFlatHashPrivate {
+
+// Every bucket has a control byte. Used buckets store the low 7 bits of the
+// key's hash; free buckets have the sign bit set.
+enum : uchar {
+    Empty = 0x80,
+    Deleted = 0xfe,
+};
+
+constexpr bool isFull(uchar ctrl) noexcept { return ctrl < 0x80; }
+constexpr size_t h1(size_t hash) noexcept { return hash >> 7; }
+constexpr uchar h2(size_t hash) noexcept { return uchar(hash & 0x7f); }
+
+// A set of buckets within a group; each bucket is represented by 2^Shift bits
+template <typename Int, int Shift>
+class BitMask
+{
+    Int mask;
+
+public:
+    explicit constexpr BitMask(Int m) noexcept : mask(m) {}
+    explicit constexpr operator bool() const noexcept { return mask != 0; }
+    uint lowestBitSet() const noexcept { return uint(qCountTrailingZeroBits(mask)) >> Shift; }
+
+    BitMask begin() const noexcept { return *this; }
+    BitMask end() const noexcept { return BitMask(0); }
+    uint operator*() const noexcept { return lowestBitSet(); }
+    BitMask &operator++() noexcept { mask &= mask - 1; return *this; }
+    friend bool operator!=(BitMask lhs, BitMask rhs) noexcept { return lhs.mask != rhs.mask; }
+};
+
+#if QT_COMPILER_USES(sse2)
+struct Group
+{
+    static constexpr size_t Width = 16;
+    using Mask = BitMask<uint, 0>;
+
+    __m128i ctrl;
+    explicit Group(const uchar *p) noexcept
+        : ctrl(_mm_load_si128(reinterpret_cast<const __m128i *>(p)))
+    {}
+
+    Mask match(uchar tag) const noexcept
+    { return Mask(uint(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(char(tag)), ctrl)))); }
+    Mask matchEmpty() const noexcept { return match(Empty); }
+    Mask matchFree() const noexcept { return Mask(uint(_mm_movemask_epi8(ctrl))); }
+    Mask matchFull() const noexcept { return Mask(uint(_mm_movemask_epi8(ctrl)) ^ 0xffffu); }
+};
+#elif QT_COMPILER_USES(neon) && defined(Q_PROCESSOR_ARM_64)
+struct Group
+{
+    static constexpr size_t Width = 16;
+    using Mask = BitMask<quint64, 2>;
+
+    uint8x16_t ctrl;
+    explicit Group(const uchar *p) noexcept : ctrl(vld1q_u8(p)) {}
+
+    static Mask toMask(uint8x16_t cmp) noexcept
+    {
+        // narrow each 0x00/0xff byte of the comparison to a nibble
+        const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+        return Mask(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0)
+                    & Q_UINT64_C(0x8888888888888888));
+    }
+    Mask match(uchar tag) const noexcept { return toMask(vceqq_u8(ctrl, vdupq_n_u8(tag))); }
+    Mask matchEmpty() const noexcept { return match(Empty); }
+    Mask matchFree() const noexcept { return toMask(vcltzq_s8(vreinterpretq_s8_u8(ctrl))); }
+    Mask matchFull() const noexcept { return toMask(vcgezq_s8(vreinterpretq_s8_u8(ctrl))); }
+};
+#else
+struct Group
+{
+    static constexpr size_t Width = 8;
+    using Mask = BitMask<quint64, 3>;
+    static constexpr quint64 Lsbs = Q_UINT64_C(0x0101010101010101);
+    static constexpr quint64 Msbs = Q_UINT64_C(0x8080808080808080);
+
+    quint64 ctrl;
+    explicit Group(const uchar *p) noexcept : ctrl(qFromLittleEndian<quint64>(p)) {}
+
+    Mask match(uchar tag) const noexcept
+    {
+        // This can report a false positive for a used bucket next to a real
+        // match; that is harmless, since the keys get compared anyway.
+        const quint64 x = ctrl ^ (Lsbs * tag);
+        return Mask((x - Lsbs) & ~x & Msbs);
+    }
+    Mask matchEmpty() const noexcept { return Mask(ctrl & ~(ctrl << 6) & Msbs); }
+    Mask matchFree() const noexcept { return Mask(ctrl & Msbs); }
+    Mask matchFull() const noexcept { return Mask(~ctrl & Msbs); }
+};
+#endif
+
+// QFlatHash uses a power of two number of buckets, of which at most 7/8 are
+// ever in use (by elements or tombstones).
+namespace GrowthPolicy {
+inline constexpr size_t MinBuckets = 16;
+static_assert(MinBuckets >= Group::Width);
+
+inline constexpr size_t capacityForBuckets(size_t numBuckets) noexcept
+{
+    return numBuckets - numBuckets / 8;
+}
+
+inline constexpr size_t bucketsForCapacity(size_t requestedCapacity) noexcept
+{
+    constexpr int SizeDigits = std::numeric_limits<size_t>::digits;
+    if (requestedCapacity <= capacityForBuckets(MinBuckets))
+        return MinBuckets;
+
+    // Smallest power of two that is at least requestedCapacity * 8 / 7
+    const size_t needed = requestedCapacity + (requestedCapacity + 6) / 7;
+    const int count = qCountLeadingZeroBits(needed - 1);
+    if (needed < requestedCapacity || count < 2)
+        return (std::numeric_limits<size_t>::max)();    // will cause std::bad_alloc
+    return size_t(1) << (SizeDigits - count);
+}
+} // namespace GrowthPolicy
+
+template <typename Node>
+struct iterator;
+
+template <typename Node>
+struct Data
+{
+    using Key = typename Node::KeyType;
+    using T = typename Node::ValueType;
+    using iterator = QFlatHashPrivate::iterator<Node>;
+
+    static constexpr size_t NotFound = (std::numeric_limits<size_t>::max)();
+    static constexpr size_t Alignment = (std::max)(alignof(Node), size_t(16));
+
+    QtPrivate::RefCount ref = {{1}};
+    size_t size = 0;
+    size_t numBuckets = 0;
+    size_t growthLeft = 0;
+    size_t seed = 0;
+    uchar *ctrl = nullptr;
+    Node *entries = nullptr;
+
+    static constexpr size_t maxNumBuckets() noexcept
+    {
+        return (std::numeric_limits<ptrdiff_t>::max)() / (sizeof(Node) + 1) / 2;
+    }
+
+    // The control bytes and the entries share one allocation. The control bytes
+    // come first, so that groups can be loaded with aligned loads.
+    static size_t entriesOffset(size_t nBuckets) noexcept
+    {
+        return (nBuckets + alignof(Node) - 1) & ~(alignof(Node) - 1);
+    }
+
+    void allocate(size_t nBuckets)
+    {
+        if (nBuckets > maxNumBuckets()) {
+            Q_CHECK_PTR(false);
+            Q_UNREACHABLE();    // no exceptions and no assertions -> no error reporting
+        }
+
+        const size_t offset = entriesOffset(nBuckets);
+        void *block = ::operator new(offset + nBuckets * sizeof(Node), std::align_val_t(Alignment));
+        ctrl = static_cast<uchar *>(block);
+        entries = reinterpret_cast<Node *>(ctrl + offset);
+        memset(ctrl, Empty, nBuckets);
+        numBuckets = nBuckets;
+        growthLeft = GrowthPolicy::capacityForBuckets(nBuckets);
+    }
+
+    static void deallocate(uchar *block) noexcept
+    {
+        ::operator delete(block, std::align_val_t(Alignment));
+    }
+
+    Data(size_t reserve = 0)
+    {
+        allocate(GrowthPolicy::bucketsForCapacity(reserve));
+        seed = QHashSeed::globalSeed();
+    }
+
+    Data(const Data &other) : seed(other.seed)
+    {
+        allocate(other.numBuckets);
+        // same layout, so copy the tombstones too and keep the buckets where they are
+        memcpy(ctrl, other.ctrl, numBuckets);
+        if constexpr (std::is_trivially_copyable_v<Node>) {
+            memcpy(static_cast<void *>(entries), other.entries, numBuckets * sizeof(Node));
+        } else {
+            for (size_t bucket = other.nextFull(0); bucket < numBuckets;
+                 bucket = other.nextFull(bucket + 1)) {
+                new (entries + bucket) Node(other.entries[bucket]);
+            }
+        }
+        size = other.size;
+        growthLeft = other.growthLeft;
+    }
+
+    Data(const Data &other, size_t reserved) : seed(other.seed)
+    {
+        allocate(GrowthPolicy::bucketsForCapacity((std::max)(other.size, reserved)));
+        for (size_t bucket = other.nextFull(0); bucket < other.numBuckets;
+             bucket = other.nextFull(bucket + 1)) {
+            const Node &n = other.entries[bucket];
+            new (entries + insertUnique(QHashPrivate::calculateHash(n.key, seed))) Node(n);
+        }
+    }
+
+    ~Data()
+    {
+        if constexpr (!std::is_trivially_destructible_v<Node>) {
+            for (size_t bucket = nextFull(0); bucket < numBuckets; bucket = nextFull(bucket + 1))
+                entries[bucket].~Node();
+        }
+        deallocate(ctrl);
+    }
+
+    static Data *detached(Data *d)
+    {
+        if (!d)
+            return new Data;
+        Data *dd = new Data(*d);
+        if (!d->ref.deref())
+            delete d;
+        return dd;
+    }
+    static Data *detached(Data *d, size_t size)
+    {
+        if (!d)
+            return new Data(size);
+        Data *dd = new Data(*d, size);
+        if (!d->ref.deref())
+            delete d;
+        return dd;
+    }
+
+    // Returns the first used bucket at or after \a bucket, or numBuckets
+    size_t nextFull(size_t bucket) const noexcept
+    {
+        while (bucket < numBuckets) {
+            const size_t base = bucket & ~(Group::Width - 1);
+            for (uint i : Group(ctrl + base).matchFull()) {
+                if (base + i >= bucket)
+                    return base + i;
+            }
+            bucket = base + Group::Width;
+        }
+        return numBuckets;
+    }
+
+    iterator detachedIterator(iterator other) const noexcept
+    {
+        return iterator{this, other.bucket};
+    }
+
+    iterator begin() const noexcept
+    {
+        const size_t bucket = size ? nextFull(0) : numBuckets;
+        if (bucket == numBuckets)
+            return iterator();
+        return iterator{this, bucket};
+    }
+
+    float loadFactor() const noexcept
+    {
+        return float(size) / numBuckets;
+    }
+    bool shouldGrow() const noexcept
+    {
+        return growthLeft == 0;
+    }
+
+    // Groups are probed in triangular order, which visits every group of a
+    // power of two sized table exactly once.
+    template <typename K>
+    size_t findBucketWithHash(const K &key, size_t hash) const noexcept
+    {
+        const uchar tag = h2(hash);
+        const size_t groupMask = numBuckets / Group::Width - 1;
+        size_t group = h1(hash) & groupMask;
+        for (size_t step = 1; ; ++step) {
+            const size_t base = group * Group::Width;
+            const Group g(ctrl + base);
+            for (uint i : g.match(tag)) {
+                if (qHashEquals(entries[base + i].key, key))
+                    return base + i;
+            }
+            if (g.matchEmpty())
+                return NotFound;
+            group = (group + step) & groupMask;
+        }
+    }
+
+    template <typename K>
+    size_t findBucket(const K &key) const noexcept
+    {
+        return findBucketWithHash(key, QHashPrivate::calculateHash(key, seed));
+    }
+
+    template <typename K>
+    Node *findNode(const K &key) const noexcept
+    {
+        const size_t bucket = findBucket(key);
+        return bucket == NotFound ? nullptr : entries + bucket;
+    }
+
+    size_t findFreeBucket(size_t hash) const noexcept
+    {
+        const size_t groupMask = numBuckets / Group::Width - 1;
+        size_t group = h1(hash) & groupMask;
+        for (size_t step = 1; ; ++step) {
+            const size_t base = group * Group::Width;
+            if (const auto free = Group(ctrl + base).matchFree())
+                return base + free.lowestBitSet();
+            group = (group + step) & groupMask;
+        }
+    }
+
+    // Claims a bucket for a key known not to be in the table, when there is
+    // known to be room for it. The caller constructs the node.
+    size_t insertUnique(size_t hash) noexcept
+    {
+        const size_t bucket = findFreeBucket(hash);
+        growthLeft -= ctrl[bucket] == Empty;
+        ctrl[bucket] = h2(hash);
+        ++size;
+        return bucket;
+    }
+
+    // Like insertUnique(), but grows or cleans up the table as needed
+    size_t prepareInsert(size_t hash)
+    {
+        if (Q_UNLIKELY(shouldGrow())) {
+            const size_t bucket = findFreeBucket(hash);
+            if (ctrl[bucket] == Deleted)
+                return insertUnique(hash);
+            // Mostly tombstones? Rehash at the same size to get rid of them.
+            const size_t capacity = GrowthPolicy::capacityForBuckets(numBuckets);
+            rehash(size < capacity * 3 / 4 ? numBuckets : numBuckets * 2);
+        }
+        return insertUnique(hash);
+    }
+
+    struct InsertionResult
+    {
+        size_t bucket;
+        bool initialized;
+    };
+
+    InsertionResult findOrInsert(const Key &key)
+    {
+        const size_t hash = QHashPrivate::calculateHash(key, seed);
+        const size_t bucket = findBucketWithHash(key, hash);
+        if (bucket != NotFound)
+            return { bucket, true };
+        return { prepareInsert(hash), false };
+    }
+
+    void rehash(size_t newNumBuckets)
+    {
+        uchar *oldCtrl = ctrl;
+        Node *oldEntries = entries;
+        const size_t oldNumBuckets = numBuckets;
+        const size_t oldSize = size;
+
+        allocate(newNumBuckets);
+        size = 0;
+        for (size_t bucket = 0; bucket < oldNumBuckets; ++bucket) {
+            if (!isFull(oldCtrl[bucket]))
+                continue;
+            Node &n = oldEntries[bucket];
+            Node *newNode = entries + insertUnique(QHashPrivate::calculateHash(n.key, seed));
+            if constexpr (QHashPrivate::isRelocatable_v<Node>) {
+                memcpy(static_cast<void *>(newNode), static_cast<const void *>(&n), sizeof(Node));
+            } else {
+                new (newNode) Node(std::move(n));
+                n.~Node();
+            }
+        }
+        Q_ASSERT(size == oldSize);
+        Q_UNUSED(oldSize);
+        deallocate(oldCtrl);
+    }
+
+    void erase(size_t bucket) noexcept(std::is_nothrow_destructible<Node>::value)
+    {
+        Q_ASSERT(isFull(ctrl[bucket]));
+        entries[bucket].~Node();
+        --size;
+
+        // If the group still has an empty bucket, no probe sequence ever went
+        // past it, so the bucket can become empty again instead of a tombstone.
+        const size_t base = bucket & ~(Group::Width - 1);
+        if (Group(ctrl + base).matchEmpty()) {
+            ctrl[bucket] = Empty;
+            ++growthLeft;
+        } else {
+            ctrl[bucket] = Deleted;
+        }
+    }
+};
+
+template <typename Node>
+struct iterator
+{
+    using Data = QFlatHashPrivate::Data<Node>;
+
+    const Data *d = nullptr;
+    size_t bucket = 0;
+
+    Node *node() const noexcept
+    {
+        Q_ASSERT(d && isFull(d->ctrl[bucket]));
+        return d->entries + bucket;
+    }
+    bool atEnd() const noexcept { return !d; }
+
+    iterator operator++() noexcept
+    {
+        bucket = d->nextFull(bucket + 1);
+        if (bucket == d->numBuckets) {
+            d = nullptr;
+            bucket = 0;
+        }
+        return *this;
+    }
+    bool operator==(iterator other) const noexcept
+    { return d == other.d && bucket == other.bucket; }
+    bool operator!=(iterator other) const noexcept
+    { return !(*this == other); }
+};
+
+} // namespace QFlatHashPrivate
+
+template <typename Key, typename T>
+class QFlatHash
+{
+    using Node = QHashPrivate::Node<Key, T>;
+    using Data = QFlatHashPrivate::Data<Node>;
+    friend class QFlatSet<Key>;
+    friend tst_QFlatHash;
+
+    Data *d = nullptr;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = T;
+    using size_type = qsizetype;
+    using difference_type = qsizetype;
+    using reference = T &;
+    using const_reference = const T &;
+
+    inline QFlatHash() noexcept = default;
+    inline QFlatHash(std::initializer_list<std::pair<Key, T>> list)
+        : d(new Data(list.size()))
+    {
+        for (const auto &e : list)
+            insert(e.first, e.second);
+    }
+    QFlatHash(const QFlatHash &other) noexcept
+        : d(other.d)
+    {
+        if (d)
+            d->ref.ref();
+    }
+    ~QFlatHash()
+    {
+        static_assert(std::is_nothrow_destructible_v<Key>, "Types with throwing destructors are not supported in Qt containers.");
+        static_assert(std::is_nothrow_destructible_v<T>, "Types with throwing destructors are not supported in Qt containers.");
+
+        if (d && !d->ref.deref())
+            delete d;
+    }
+
+    QFlatHash &operator=(const QFlatHash &other) noexcept(std::is_nothrow_destructible<Node>::value)
+    {
+        if (d != other.d) {
+            Data *o = other.d;
+            if (o)
+                o->ref.ref();
+            if (d && !d->ref.deref())
+                delete d;
+            d = o;
+        }
+        return *this;
+    }
+
+    QFlatHash(QFlatHash &&other) noexcept
+        : d(std::exchange(other.d, nullptr))
+    {
+    }
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_MOVE_AND_SWAP(QFlatHash)
+#ifdef Q_QDOC
+    template <typename InputIterator>
+    QFlatHash(InputIterator f, InputIterator l);
+#else
+    template <typename InputIterator, QtPrivate::IfAssociativeIteratorHasKeyAndValue<InputIterator> = true>
+    QFlatHash(InputIterator f, InputIterator l)
+        : QFlatHash()
+    {
+        QtPrivate::reserveIfForwardIterator(this, f, l);
+        for (; f != l; ++f)
+            insert(f.key(), f.value());
+    }
+
+    template <typename InputIterator, QtPrivate::IfAssociativeIteratorHasFirstAndSecond<InputIterator> = true>
+    QFlatHash(InputIterator f, InputIterator l)
+        : QFlatHash()
+    {
+        QtPrivate::reserveIfForwardIterator(this, f, l);
+        for (; f != l; ++f) {
+            auto &&e = *f;
+            using V = decltype(e);
+            insert(std::forward<V>(e).first, std::forward<V>(e).second);
+        }
+    }
+#endif
+    void swap(QFlatHash &other) noexcept { qt_ptr_swap(d, other.d); }
+
+    class const_iterator;
+
+#ifndef Q_QDOC
+private:
+    static bool compareIterators(const const_iterator &lhs, const const_iterator &rhs)
+    {
+        return lhs.i.node()->valuesEqual(rhs.i.node());
+    }
+
+    template <typename AKey = Key, typename AT = T,
+              QTypeTraits::compare_eq_result_container<QFlatHash, AKey, AT> = true>
+    friend bool comparesEqual(const QFlatHash &lhs, const QFlatHash &rhs) noexcept
+    {
+        if (lhs.d == rhs.d)
+            return true;
+        if (lhs.size() != rhs.size())
+            return false;
+
+        for (const_iterator it = rhs.begin(); it != rhs.end(); ++it) {
+            const_iterator i = lhs.find(it.key());
+            if (i == lhs.end() || !compareIterators(i, it))
+                return false;
+        }
+        // all values must be the same as size is the same
+        return true;
+    }
+    QT_DECLARE_EQUALITY_OPERATORS_HELPER(QFlatHash, QFlatHash, /* non-constexpr */, noexcept,
+                     template <typename AKey = Key, typename AT = T,
+                               QTypeTraits::compare_eq_result_container<QFlatHash, AKey, AT> = true>)
+public:
+#else
+    friend bool operator==(const QFlatHash &lhs, const QFlatHash &rhs) noexcept;
+    friend bool operator!=(const QFlatHash &lhs, const QFlatHash &rhs) noexcept;
+#endif // Q_QDOC
+
+    inline qsizetype size() const noexcept { return d ? qsizetype(d->size) : 0; }
+
+    [[nodiscard]]
+    inline bool isEmpty() const noexcept { return !d || d->size == 0; }
+
+    inline qsizetype capacity() const noexcept
+    { return d ? qsizetype(QFlatHashPrivate::GrowthPolicy::capacityForBuckets(d->numBuckets)) : 0; }
+    void reserve(qsizetype size)
+    {
+        // reserve(0) is used in squeeze()
+        if (size && (this->capacity() >= size))
+            return;
+        if (isDetached()) {
+            const size_t numBuckets = QFlatHashPrivate::GrowthPolicy::bucketsForCapacity(
+                        (std::max)(d->size, size_t(size)));
+            if (numBuckets != d->numBuckets || d->growthLeft + d->size
+                    != QFlatHashPrivate::GrowthPolicy::capacityForBuckets(d->numBuckets)) {
+                d->rehash(numBuckets);
+            }
+        } else {
+            d = Data::detached(d, size_t(size));
+        }
+    }
+    inline void squeeze()
+    {
+        if (capacity())
+            reserve(0);
+    }
+
+    inline void detach() { if (!d || d->ref.isShared()) d = Data::detached(d); }
+    inline bool isDetached() const noexcept { return d && !d->ref.isShared(); }
+    bool isSharedWith(const QFlatHash &other) const noexcept { return d == other.d; }
+
+    void clear() noexcept(std::is_nothrow_destructible<Node>::value)
+    {
+        if (d && !d->ref.deref())
+            delete d;
+        d = nullptr;
+    }
+
+    bool remove(const Key &key)
+    {
+        return removeImpl(key);
+    }
+private:
+    template <typename K> bool removeImpl(const K &key)
+    {
+        if (isEmpty()) // prevents detaching shared null
+            return false;
+        const size_t bucket = d->findBucket(key);
+        if (bucket == Data::NotFound)
+            return false;
+
+        detach(); // keeps the layout, so bucket stays valid
+        d->erase(bucket);
+        return true;
+    }
+
+public:
+    template <typename Predicate>
+    qsizetype removeIf(Predicate pred)
+    {
+        return QtPrivate::associative_erase_if(*this, pred);
+    }
+
+    T take(const Key &key)
+    {
+        return takeImpl(key);
+    }
+private:
+    template <typename K> T takeImpl(const K &key)
+    {
+        if (isEmpty()) // prevents detaching shared null
+            return T();
+        const size_t bucket = d->findBucket(key);
+        if (bucket == Data::NotFound)
+            return T();
+
+        detach();
+        T value = d->entries[bucket].takeValue();
+        d->erase(bucket);
+        return value;
+    }
+
+public:
+    bool contains(const Key &key) const noexcept
+    {
+        if (!d)
+            return false;
+        return d->findNode(key) != nullptr;
+    }
+    qsizetype count(const Key &key) const noexcept
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+private:
+    const Key *keyImpl(const T &value) const noexcept
+    {
+        for (const_iterator i = begin(); i != end(); ++i) {
+            if (i.value() == value)
+                return &i.key();
+        }
+        return nullptr;
+    }
+
+public:
+    Key key(const T &value) const noexcept
+    {
+        if (auto *k = keyImpl(value))
+            return *k;
+        else
+            return Key();
+    }
+    Key key(const T &value, const Key &defaultKey) const noexcept
+    {
+        if (auto *k = keyImpl(value))
+            return *k;
+        else
+            return defaultKey;
+    }
+
+private:
+    template <typename K>
+    T *valueImpl(const K &key) const noexcept
+    {
+        if (d) {
+            if (Node *n = d->findNode(key))
+                return &n->value;
+        }
+        return nullptr;
+    }
+public:
+    T value(const Key &key) const noexcept
+    {
+        if (T *v = valueImpl(key))
+            return *v;
+        else
+            return T();
+    }
+
+    T value(const Key &key, const T &defaultValue) const noexcept
+    {
+        if (T *v = valueImpl(key))
+            return *v;
+        else
+            return defaultValue;
+    }
+
+    T &operator[](const Key &key)
+    {
+        return *tryEmplace(key).iterator;
+    }
+
+    const T operator[](const Key &key) const noexcept
+    {
+        return value(key);
+    }
+
+    QList<Key> keys() const { return QList<Key>(keyBegin(), keyEnd()); }
+    QList<Key> keys(const T &value) const
+    {
+        QList<Key> res;
+        for (const_iterator i = begin(); i != end(); ++i) {
+            if (i.value() == value)
+                res.append(i.key());
+        }
+        return res;
+    }
+    QList<T> values() const { return QList<T>(begin(), end()); }
+
+    class iterator
+    {
+        using piter = typename QFlatHashPrivate::iterator<Node>;
+        friend class const_iterator;
+        friend class QFlatHash<Key, T>;
+        friend class QFlatSet<Key>;
+        piter i;
+        explicit inline iterator(piter it) noexcept : i(it) { }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef T *pointer;
+        typedef T &reference;
+
+        constexpr iterator() noexcept = default;
+
+        inline const Key &key() const noexcept { return i.node()->key; }
+        inline T &value() const noexcept { return i.node()->value; }
+        inline T &operator*() const noexcept { return i.node()->value; }
+        inline T *operator->() const noexcept { return &i.node()->value; }
+        inline bool operator==(const iterator &o) const noexcept { return i == o.i; }
+        inline bool operator!=(const iterator &o) const noexcept { return i != o.i; }
+
+        inline iterator &operator++() noexcept
+        {
+            ++i;
+            return *this;
+        }
+        inline iterator operator++(int) noexcept
+        {
+            iterator r = *this;
+            ++i;
+            return r;
+        }
+
+        inline bool operator==(const const_iterator &o) const noexcept { return i == o.i; }
+        inline bool operator!=(const const_iterator &o) const noexcept { return i != o.i; }
+    };
+    friend class iterator;
+
+    class const_iterator
+    {
+        using piter = typename QFlatHashPrivate::iterator<Node>;
+        friend class iterator;
+        friend class QFlatHash<Key, T>;
+        friend class QFlatSet<Key>;
+        piter i;
+        explicit inline const_iterator(piter it) : i(it) { }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        constexpr const_iterator() noexcept = default;
+        inline const_iterator(const iterator &o) noexcept : i(o.i) { }
+
+        inline const Key &key() const noexcept { return i.node()->key; }
+        inline const T &value() const noexcept { return i.node()->value; }
+        inline const T &operator*() const noexcept { return i.node()->value; }
+        inline const T *operator->() const noexcept { return &i.node()->value; }
+        inline bool operator==(const const_iterator &o) const noexcept { return i == o.i; }
+        inline bool operator!=(const const_iterator &o) const noexcept { return i != o.i; }
+
+        inline const_iterator &operator++() noexcept
+        {
+            ++i;
+            return *this;
+        }
+        inline const_iterator operator++(int) noexcept
+        {
+            const_iterator r = *this;
+            ++i;
+            return r;
+        }
+    };
+    friend class const_iterator;
+
+    class key_iterator
+    {
+        const_iterator i;
+
+    public:
+        typedef typename const_iterator::iterator_category iterator_category;
+        typedef qptrdiff difference_type;
+        typedef Key value_type;
+        typedef const Key *pointer;
+        typedef const Key &reference;
+
+        key_iterator() noexcept = default;
+        explicit key_iterator(const_iterator o) noexcept : i(o) { }
+
+        const Key &operator*() const noexcept { return i.key(); }
+        const Key *operator->() const noexcept { return &i.key(); }
+        bool operator==(key_iterator o) const noexcept { return i == o.i; }
+        bool operator!=(key_iterator o) const noexcept { return i != o.i; }
+
+        inline key_iterator &operator++() noexcept { ++i; return *this; }
+        inline key_iterator operator++(int) noexcept { return key_iterator(i++);}
+        const_iterator base() const noexcept { return i; }
+    };
+
+    typedef QKeyValueIterator<const Key&, const T&, const_iterator> const_key_value_iterator;
+    typedef QKeyValueIterator<const Key&, T&, iterator> key_value_iterator;
+
+    // STL style
+    inline iterator begin() { if (!d) return iterator(); detach(); return iterator(d->begin()); }
+    inline const_iterator begin() const noexcept { return d ? const_iterator(d->begin()): const_iterator(); }
+    inline const_iterator cbegin() const noexcept { return d ? const_iterator(d->begin()): const_iterator(); }
+    inline const_iterator constBegin() const noexcept { return d ? const_iterator(d->begin()): const_iterator(); }
+    inline iterator end() noexcept { return iterator(); }
+    inline const_iterator end() const noexcept { return const_iterator(); }
+    inline const_iterator cend() const noexcept { return const_iterator(); }
+    inline const_iterator constEnd() const noexcept { return const_iterator(); }
+    inline key_iterator keyBegin() const noexcept { return key_iterator(begin()); }
+    inline key_iterator keyEnd() const noexcept { return key_iterator(end()); }
+    inline key_value_iterator keyValueBegin() { return key_value_iterator(begin()); }
+    inline key_value_iterator keyValueEnd() { return key_value_iterator(end()); }
+    inline const_key_value_iterator keyValueBegin() const noexcept { return const_key_value_iterator(begin()); }
+    inline const_key_value_iterator constKeyValueBegin() const noexcept { return const_key_value_iterator(begin()); }
+    inline const_key_value_iterator keyValueEnd() const noexcept { return const_key_value_iterator(end()); }
+    inline const_key_value_iterator constKeyValueEnd() const noexcept { return const_key_value_iterator(end()); }
+    auto asKeyValueRange() & { return QtPrivate::QKeyValueRange<QFlatHash &>(*this); }
+    auto asKeyValueRange() const & { return QtPrivate::QKeyValueRange<const QFlatHash &>(*this); }
+    auto asKeyValueRange() && { return QtPrivate::QKeyValueRange<QFlatHash>(std::move(*this)); }
+    auto asKeyValueRange() const && { return QtPrivate::QKeyValueRange<QFlatHash>(std::move(*this)); }
+
+    struct TryEmplaceResult
+    {
+        QFlatHash::iterator iterator;
+        bool inserted;
+
+        TryEmplaceResult() = default;
+        // Generated SMFs are fine!
+        TryEmplaceResult(QFlatHash::iterator it, bool b)
+            : iterator(it), inserted(b)
+        {
+        }
+
+        // Implicit conversion _from_ the return-type of try_emplace:
+        Q_IMPLICIT TryEmplaceResult(const std::pair<key_value_iterator, bool> &p)
+            : iterator(p.first.base()), inserted(p.second)
+        {
+        }
+        // Implicit conversion _to_ the return-type of try_emplace:
+        Q_IMPLICIT operator std::pair<key_value_iterator, bool>()
+        {
+            return { key_value_iterator(iterator), inserted };
+        }
+    };
+
+    iterator erase(const_iterator it)
+    {
+        Q_ASSERT(it != constEnd());
+        detach();
+        // ensure a valid iterator across the detach:
+        iterator i = iterator{d->detachedIterator(it.i)};
+
+        // elements never move on erase, so just step past the erased bucket
+        d->erase(i.i.bucket);
+        ++i;
+        return i;
+    }
+
+    std::pair<iterator, iterator> equal_range(const Key &key)
+    {
+        return equal_range_impl(*this, key);
+    }
+    std::pair<const_iterator, const_iterator> equal_range(const Key &key) const noexcept
+    {
+        return equal_range_impl(*this, key);
+    }
+private:
+    template <typename Hash, typename K> static auto equal_range_impl(Hash &self, const K &key)
+    {
+        auto first = self.find(key);
+        auto second = first;
+        if (second != decltype(first){})
+            ++second;
+        return std::make_pair(first, second);
+    }
+
+    template <typename K> iterator findImpl(const K &key)
+    {
+        if (isEmpty()) // prevents detaching shared null
+            return end();
+        const size_t bucket = d->findBucket(key);
+        if (bucket == Data::NotFound)
+            return end();
+        detach();
+        return iterator({d, bucket});
+    }
+    template <typename K> const_iterator constFindImpl(const K &key) const noexcept
+    {
+        if (isEmpty())
+            return end();
+        const size_t bucket = d->findBucket(key);
+        if (bucket == Data::NotFound)
+            return end();
+        return const_iterator({d, bucket});
+    }
+
+public:
+    typedef iterator Iterator;
+    typedef const_iterator ConstIterator;
+    inline qsizetype count() const noexcept { return d ? qsizetype(d->size) : 0; }
+    iterator find(const Key &key)
+    {
+        return findImpl(key);
+    }
+    const_iterator find(const Key &key) const noexcept
+    {
+        return constFindImpl(key);
+    }
+    const_iterator constFind(const Key &key) const noexcept
+    {
+        return find(key);
+    }
+
+    iterator insert(const Key &key, const T &value)
+    {
+        return emplace(key, value);
+    }
+
+    iterator insert(const Key &key, T &&value)
+    {
+        return emplace(key, std::move(value));
+    }
+
+    iterator insert(Key &&key, const T &value)
+    {
+        return emplace(std::move(key), value);
+    }
+
+    iterator insert(Key &&key, T &&value)
+    {
+        return emplace(std::move(key), std::move(value));
+    }
+
+    void insert(const QFlatHash &hash)
+    {
+        if (d == hash.d || !hash.d)
+            return;
+        if (!d) {
+            *this = hash;
+            return;
+        }
+
+        detach();
+
+        for (auto it = hash.begin(); it != hash.end(); ++it)
+            emplace(it.key(), it.value());
+    }
+
+    template <typename ...Args>
+    iterator emplace(const Key &key, Args &&... args)
+    {
+        Key copy = key; // Needs to be explicit for MSVC 2019
+        return emplace(std::move(copy), std::forward<Args>(args)...);
+    }
+
+    template <typename ...Args>
+    iterator emplace(Key &&key, Args &&... args)
+    {
+        if (isDetached()) {
+            if (d->shouldGrow()) // Construct the value now so that no dangling references are used
+                return emplace_helper(std::move(key), T(std::forward<Args>(args)...));
+            return emplace_helper(std::move(key), std::forward<Args>(args)...);
+        }
+        // else: we must detach
+        const auto copy = *this; // keep 'args' alive across the detach/growth
+        detach();
+        return emplace_helper(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    TryEmplaceResult tryEmplace(const Key &key, Args &&...args)
+    {
+        return tryEmplace_impl(key, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    TryEmplaceResult tryEmplace(Key &&key, Args &&...args)
+    {
+        return tryEmplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    TryEmplaceResult tryInsert(const Key &key, const T &value)
+    {
+        return tryEmplace_impl(key, value);
+    }
+
+    template <typename... Args>
+    std::pair<key_value_iterator, bool> try_emplace(const Key &key, Args &&...args)
+    {
+        return tryEmplace_impl(key, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    std::pair<key_value_iterator, bool> try_emplace(Key &&key, Args &&...args)
+    {
+        return tryEmplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+private:
+    template <typename K, typename... Args>
+    TryEmplaceResult tryEmplace_impl(K &&key, Args &&...args)
+    {
+        if (!d)
+            detach();
+        QFlatHash detachGuard;
+
+        const size_t hash = QHashPrivate::calculateHash(key, d->seed);
+        size_t bucket = d->findBucketWithHash(key, hash);
+        const bool shouldInsert = bucket == Data::NotFound;
+
+        // Even if we don't insert we may have to detach because we are
+        // returning a non-const iterator. Detaching keeps the layout.
+        if (!isDetached()) {
+            detachGuard = *this;
+            d = Data::detached(d);
+        }
+        if (shouldInsert) {
+            using ConstructProxy = typename QHashPrivate::HeterogenousConstructProxy<Key, K>;
+            if constexpr (sizeof...(Args) > 0) {
+                if (d->shouldGrow() && !detachGuard.d) {
+                    // 'args' may refer to an element that growing would move
+                    T value(std::forward<Args>(args)...);
+                    bucket = d->prepareInsert(hash);
+                    Node::createInPlace(d->entries + bucket, ConstructProxy(std::forward<K>(key)),
+                                        std::move(value));
+                    return {iterator({d, bucket}), true};
+                }
+            }
+            bucket = d->prepareInsert(hash);
+            Node::createInPlace(d->entries + bucket, ConstructProxy(std::forward<K>(key)),
+                                std::forward<Args>(args)...);
+        }
+        return {iterator({d, bucket}), shouldInsert};
+    }
+public:
+    template <typename Value>
+    TryEmplaceResult insertOrAssign(const Key &key, Value &&value)
+    {
+        return insertOrAssign_impl(key, std::forward<Value>(value));
+    }
+    template <typename Value>
+    TryEmplaceResult insertOrAssign(Key &&key, Value &&value)
+    {
+        return insertOrAssign_impl(std::move(key), std::forward<Value>(value));
+    }
+    template <typename Value>
+    std::pair<key_value_iterator, bool> insert_or_assign(const Key &key, Value &&value)
+    {
+        return insertOrAssign_impl(key, std::forward<Value>(value));
+    }
+    template <typename Value>
+    std::pair<key_value_iterator, bool> insert_or_assign(Key &&key, Value &&value)
+    {
+        return insertOrAssign_impl(std::move(key), std::forward<Value>(value));
+    }
+
+private:
+    template <typename K, typename Value>
+    TryEmplaceResult insertOrAssign_impl(K &&key, Value &&value)
+    {
+        auto r = tryEmplace(std::forward<K>(key), std::forward<Value>(value));
+        if (!r.inserted)
+            *r.iterator = std::forward<Value>(value); // `value` is untouched if we get here
+        return r;
+    }
+
+public:
+
+    float load_factor() const noexcept { return d ? d->loadFactor() : 0; }
+    static float max_load_factor() noexcept { return 0.875; }
+    size_t bucket_count() const noexcept { return d ? d->numBuckets : 0; }
+    static size_t max_bucket_count() noexcept { return Data::maxNumBuckets(); }
+
+    [[nodiscard]]
+    inline bool empty() const noexcept { return isEmpty(); }
+
+private:
+    template <typename ...Args>
+    iterator emplace_helper(Key &&key, Args &&... args)
+    {
+        auto result = d->findOrInsert(key);
+        if (!result.initialized)
+            Node::createInPlace(d->entries + result.bucket, std::move(key), std::forward<Args>(args)...);
+        else
+            d->entries[result.bucket].emplaceValue(std::forward<Args>(args)...);
+        return iterator({d, result.bucket});
+    }
+
+    template <typename K>
+    using if_heterogeneously_searchable = QHashPrivate::if_heterogeneously_searchable_with<Key, K>;
+
+    template <typename K>
+    using if_key_constructible_from = std::enable_if_t<std::is_constructible_v<Key, K>, bool>;
+
+public:
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    bool remove(const K &key)
+    {
+        return removeImpl(key);
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    T take(const K &key)
+    {
+        return takeImpl(key);
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    bool contains(const K &key) const
+    {
+        return d ? d->findNode(key) != nullptr : false;
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    qsizetype count(const K &key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    T value(const K &key) const noexcept
+    {
+        if (auto *v = valueImpl(key))
+            return *v;
+        else
+            return T();
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    T value(const K &key, const T &defaultValue) const noexcept
+    {
+        if (auto *v = valueImpl(key))
+            return *v;
+        else
+            return defaultValue;
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true, if_key_constructible_from<K> = true>
+    T &operator[](const K &key)
+    {
+        return *tryEmplace(key).iterator;
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    const T operator[](const K &key) const noexcept
+    {
+        return value(key);
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    std::pair<iterator, iterator>
+    equal_range(const K &key)
+    {
+        return equal_range_impl(*this, key);
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    std::pair<const_iterator, const_iterator>
+    equal_range(const K &key) const noexcept
+    {
+        return equal_range_impl(*this, key);
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    iterator find(const K &key)
+    {
+        return findImpl(key);
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    const_iterator find(const K &key) const noexcept
+    {
+        return constFindImpl(key);
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    const_iterator constFind(const K &key) const noexcept
+    {
+        return find(key);
+    }
+    template <typename K, typename... Args, if_heterogeneously_searchable<K> = true, if_key_constructible_from<K> = true>
+    TryEmplaceResult tryEmplace(K &&key, Args &&...args)
+    {
+        return tryEmplace_impl(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+    template <typename K, if_heterogeneously_searchable<K> = true, if_key_constructible_from<K> = true>
+    TryEmplaceResult tryInsert(K &&key, const T &value)
+    {
+        return tryEmplace_impl(std::forward<K>(key), value);
+    }
+    template <typename K, typename... Args, if_heterogeneously_searchable<K> = true, if_key_constructible_from<K> = true>
+    std::pair<key_value_iterator, bool> try_emplace(K &&key, Args &&...args)
+    {
+        return tryEmplace_impl(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+    template <typename K, typename Value, if_heterogeneously_searchable<K> = true, if_key_constructible_from<K> = true>
+    TryEmplaceResult insertOrAssign(K &&key, Value &&value)
+    {
+        return insertOrAssign_impl(std::forward<K>(key), std::forward<Value>(value));
+    }
+    template <typename K, typename Value, if_heterogeneously_searchable<K> = true, if_key_constructible_from<K> = true>
+    std::pair<key_value_iterator, bool> insert_or_assign(K &&key, Value &&value)
+    {
+        return insertOrAssign_impl(std::forward<K>(key), std::forward<Value>(value));
+    }
+};
+
+Q_DECLARE_ASSOCIATIVE_FORWARD_ITERATOR(FlatHash)
+Q_DECLARE_MUTABLE_ASSOCIATIVE_FORWARD_ITERATOR(FlatHash)
+
+template <class Key, class T>
+size_t qHash(const QFlatHash<Key, T> &key, size_t seed = 0)
+    noexcept(noexcept(qHash(std::declval<Key&>())) && noexcept(qHash(std::declval<T&>())))
+{
+    const QtPrivate::QHashCombine combine(seed);
+    size_t hash = 0;
+    for (auto it = key.begin(), end = key.end(); it != end; ++it) {
+        size_t h = combine(seed, it.key());
+        // use + to keep the result independent of the ordering of the keys
+        hash += combine(h, it.value());
+    }
+    return hash;
+}
+
+template <typename Key, typename T, typename Predicate>
+qsizetype erase_if(QFlatHash<Key, T> &hash, Predicate pred)
+{
+    return QtPrivate::associative_erase_if(hash, pred);
+}
+
+QT_END_NAMESPACE
+
+#endif // QFLATHASH_H
@@ -0,0 +1,328 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+// Qt-Security score:significant reason:default
+
+#ifndef QFLATSET_H
+#define QFLATSET_H
+
+#include <QtCore/qflathash.h>
+#include <QtCore/qcontainertools_impl.h>
+#include <QtCore/qttypetraits.h>
+
+#include <initializer_list>
+#include <iterator>
+
+QT_BEGIN_NAMESPACE
+
+template <class T>
+class QFlatSet
+{
+    typedef QFlatHash<T, QHashDummyValue> Hash;
+
+public:
+    inline QFlatSet() noexcept {}
+    inline QFlatSet(std::initializer_list<T> list)
+        : QFlatSet(list.begin(), list.end()) {}
+    template <typename InputIterator, QtPrivate::IfIsInputIterator<InputIterator> = true>
+    inline QFlatSet(InputIterator first, InputIterator last)
+    {
+        QtPrivate::reserveIfForwardIterator(this, first, last);
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    // compiler-generated copy/move ctor/assignment operators are fine!
+    // compiler-generated destructor is fine!
+
+    inline void swap(QFlatSet<T> &other) noexcept { q_hash.swap(other.q_hash); }
+
+#ifndef Q_QDOC
+private:
+    template <typename U = T, QTypeTraits::compare_eq_result_container<QFlatSet, U> = true>
+    friend bool comparesEqual(const QFlatSet &lhs, const QFlatSet &rhs) noexcept
+    {
+        return lhs.q_hash == rhs.q_hash;
+    }
+    QT_DECLARE_EQUALITY_OPERATORS_HELPER(QFlatSet, QFlatSet, /* non-constexpr */, noexcept,
+            template <typename U = T, QTypeTraits::compare_eq_result_container<QFlatSet, U> = true>)
+public:
+#else
+    friend bool operator==(const QFlatSet &lhs, const QFlatSet &rhs) noexcept;
+    friend bool operator!=(const QFlatSet &lhs, const QFlatSet &rhs) noexcept;
+#endif
+
+    inline qsizetype size() const { return q_hash.size(); }
+
+    inline bool isEmpty() const { return q_hash.isEmpty(); }
+
+    inline qsizetype capacity() const { return q_hash.capacity(); }
+    inline void reserve(qsizetype size) { q_hash.reserve(size); }
+    inline void squeeze() { q_hash.squeeze(); }
+
+    inline void detach() { q_hash.detach(); }
+    inline bool isDetached() const { return q_hash.isDetached(); }
+    bool isSharedWith(const QFlatSet &other) const noexcept { return q_hash.isSharedWith(other.q_hash); }
+
+    inline void clear() { q_hash.clear(); }
+
+    bool remove(const T &value) { return q_hash.remove(value); }
+
+    template <typename Pred>
+    inline qsizetype removeIf(Pred predicate);
+
+    inline bool contains(const T &value) const { return q_hash.contains(value); }
+
+    bool contains(const QFlatSet<T> &set) const;
+
+    class const_iterator;
+
+    class iterator
+    {
+        typedef QFlatHash<T, QHashDummyValue> Hash;
+        typename Hash::iterator i;
+        friend class const_iterator;
+        friend class QFlatSet<T>;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        inline iterator() {}
+        inline iterator(typename Hash::iterator o) : i(o) {}
+        inline const T &operator*() const { return i.key(); }
+        inline const T *operator->() const { return &i.key(); }
+        inline bool operator==(const iterator &o) const { return i == o.i; }
+        inline bool operator!=(const iterator &o) const { return i != o.i; }
+        inline bool operator==(const const_iterator &o) const
+            { return i == o.i; }
+        inline bool operator!=(const const_iterator &o) const
+            { return i != o.i; }
+        inline iterator &operator++() { ++i; return *this; }
+        inline iterator operator++(int) { iterator r = *this; ++i; return r; }
+    };
+
+    class const_iterator
+    {
+        typedef QFlatHash<T, QHashDummyValue> Hash;
+        typename Hash::const_iterator i;
+        friend class iterator;
+        friend class QFlatSet<T>;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        inline const_iterator() {}
+        inline const_iterator(typename Hash::const_iterator o) : i(o) {}
+        inline const_iterator(const iterator &o)
+            : i(o.i) {}
+        inline const T &operator*() const { return i.key(); }
+        inline const T *operator->() const { return &i.key(); }
+        inline bool operator==(const const_iterator &o) const { return i == o.i; }
+        inline bool operator!=(const const_iterator &o) const { return i != o.i; }
+        inline const_iterator &operator++() { ++i; return *this; }
+        inline const_iterator operator++(int) { const_iterator r = *this; ++i; return r; }
+    };
+
+    // STL style
+    inline iterator begin() { return q_hash.begin(); }
+    inline const_iterator begin() const noexcept { return q_hash.begin(); }
+    inline const_iterator cbegin() const noexcept { return q_hash.begin(); }
+    inline const_iterator constBegin() const noexcept { return q_hash.constBegin(); }
+    inline iterator end() { return q_hash.end(); }
+    inline const_iterator end() const noexcept { return q_hash.end(); }
+    inline const_iterator cend() const noexcept { return q_hash.end(); }
+    inline const_iterator constEnd() const noexcept { return q_hash.constEnd(); }
+
+    iterator erase(const_iterator i)
+    {
+        Q_ASSERT(i != constEnd());
+        return q_hash.erase(i.i);
+    }
+
+    // more Qt
+    typedef iterator Iterator;
+    typedef const_iterator ConstIterator;
+    inline qsizetype count() const { return q_hash.size(); }
+    inline iterator insert(const T &value)
+        { return q_hash.tryEmplace(value).iterator; }
+    inline iterator insert(T &&value)
+        { return q_hash.tryEmplace(std::move(value)).iterator; }
+    iterator find(const T &value) { return q_hash.find(value); }
+    const_iterator find(const T &value) const { return q_hash.find(value); }
+    inline const_iterator constFind(const T &value) const { return find(value); }
+    QFlatSet<T> &unite(const QFlatSet<T> &other);
+    QFlatSet<T> &intersect(const QFlatSet<T> &other);
+    bool intersects(const QFlatSet<T> &other) const;
+    QFlatSet<T> &subtract(const QFlatSet<T> &other);
+
+    // STL compatibility
+    typedef T key_type;
+    typedef T value_type;
+    typedef value_type *pointer;
+    typedef const value_type *const_pointer;
+    typedef value_type &reference;
+    typedef const value_type &const_reference;
+    typedef qptrdiff difference_type;
+    typedef qsizetype size_type;
+
+    inline bool empty() const { return isEmpty(); }
+
+    iterator insert(const_iterator, const T &value) { return insert(value); }
+
+    // comfort
+    inline QFlatSet<T> &operator<<(const T &value) { insert(value); return *this; }
+    inline QFlatSet<T> &operator|=(const QFlatSet<T> &other) { unite(other); return *this; }
+    inline QFlatSet<T> &operator|=(const T &value) { insert(value); return *this; }
+    inline QFlatSet<T> &operator&=(const QFlatSet<T> &other) { intersect(other); return *this; }
+    inline QFlatSet<T> &operator+=(const QFlatSet<T> &other) { unite(other); return *this; }
+    inline QFlatSet<T> &operator+=(const T &value) { insert(value); return *this; }
+    inline QFlatSet<T> &operator-=(const QFlatSet<T> &other) { subtract(other); return *this; }
+    inline QFlatSet<T> &operator-=(const T &value) { remove(value); return *this; }
+
+    friend QFlatSet operator|(const QFlatSet &lhs, const QFlatSet &rhs) { return QFlatSet(lhs) |= rhs; }
+    friend QFlatSet operator|(QFlatSet &&lhs, const QFlatSet &rhs) { lhs |= rhs; return std::move(lhs); }
+
+    friend QFlatSet operator&(const QFlatSet &lhs, const QFlatSet &rhs) { return QFlatSet(lhs) &= rhs; }
+    friend QFlatSet operator&(QFlatSet &&lhs, const QFlatSet &rhs) { lhs &= rhs; return std::move(lhs); }
+
+    friend QFlatSet operator+(const QFlatSet &lhs, const QFlatSet &rhs) { return QFlatSet(lhs) += rhs; }
+    friend QFlatSet operator+(QFlatSet &&lhs, const QFlatSet &rhs) { lhs += rhs; return std::move(lhs); }
+
+    friend QFlatSet operator-(const QFlatSet &lhs, const QFlatSet &rhs) { return QFlatSet(lhs) -= rhs; }
+    friend QFlatSet operator-(QFlatSet &&lhs, const QFlatSet &rhs) { lhs -= rhs; return std::move(lhs); }
+
+    inline QList<T> values() const;
+
+private:
+    template <typename K>
+    using if_heterogeneously_searchable = QHashPrivate::if_heterogeneously_searchable_with<T, K>;
+
+public:
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    bool contains(const K &value) const { return q_hash.contains(value); }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    bool remove(const K &value) { return q_hash.remove(value); }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    iterator find(const K &value) { return q_hash.find(value); }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    const_iterator find(const K &value) const { return q_hash.find(value); }
+    template <typename K, if_heterogeneously_searchable<K> = true>
+    const_iterator constFind(const K &value) const { return find(value); }
+
+private:
+    Hash q_hash;
+};
+
+template <typename InputIterator,
+          typename ValueType = typename std::iterator_traits<InputIterator>::value_type,
+          QtPrivate::IfIsInputIterator<InputIterator> = true>
+QFlatSet(InputIterator, InputIterator) -> QFlatSet<ValueType>;
+
+template <typename T>
+size_t qHash(const QFlatSet<T> &key, size_t seed = 0)
+noexcept(noexcept(qHashRangeCommutative(key.begin(), key.end(), seed)))
+{
+    return qHashRangeCommutative(key.begin(), key.end(), seed);
+}
+
+// inline function implementations
+
+template <class T>
+template <typename Pred>
+Q_INLINE_TEMPLATE qsizetype QFlatSet<T>::removeIf(Pred predicate)
+{
+    qsizetype result = 0;
+    auto it = cbegin();
+    while (it != cend()) {
+        if (predicate(*it)) {
+            ++result;
+            it = erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return result;
+}
+
+template <class T>
+Q_INLINE_TEMPLATE QFlatSet<T> &QFlatSet<T>::unite(const QFlatSet<T> &other)
+{
+    if (!q_hash.isSharedWith(other.q_hash)) {
+        q_hash.reserve(size() + other.size());
+        for (const T &e : other)
+            insert(e);
+    }
+    return *this;
+}
+
+template <class T>
+Q_INLINE_TEMPLATE QFlatSet<T> &QFlatSet<T>::intersect(const QFlatSet<T> &other)
+{
+    if (q_hash.isSharedWith(other.q_hash)) {
+        // nothing to do
+    } else if (isEmpty() || other.isEmpty()) {
+        // any set intersected with the empty set is the empty set
+        clear();
+    } else {
+        removeIf([&other] (const T &e) { return !other.contains(e); });
+    }
+    return *this;
+}
+
+template <class T>
+Q_INLINE_TEMPLATE bool QFlatSet<T>::intersects(const QFlatSet<T> &other) const
+{
+    const bool otherIsBigger = other.size() > size();
+    const QFlatSet &smallestSet = otherIsBigger ? *this : other;
+    const QFlatSet &biggestSet = otherIsBigger ? other : *this;
+    for (const T &e : smallestSet) {
+        if (biggestSet.contains(e))
+            return true;
+    }
+    return false;
+}
+
+template <class T>
+Q_INLINE_TEMPLATE QFlatSet<T> &QFlatSet<T>::subtract(const QFlatSet<T> &other)
+{
+    if (q_hash.isSharedWith(other.q_hash)) {
+        clear();
+    } else {
+        for (const auto &e : other)
+            remove(e);
+    }
+    return *this;
+}
+
+template <class T>
+Q_INLINE_TEMPLATE bool QFlatSet<T>::contains(const QFlatSet<T> &other) const
+{
+    for (const T &e : other) {
+        if (!contains(e))
+            return false;
+    }
+    return true;
+}
+
+template <typename T>
+QList<T> QFlatSet<T>::values() const
+{
+    return QList<T>(begin(), end());
+}
+
+template <typename T, typename Predicate>
+qsizetype erase_if(QFlatSet<T> &set, Predicate pred)
+{
+    return set.removeIf(pred);
+}
+
+QT_END_NAMESPACE
+
+#endif // QFLATSET_H
@@ -0,0 +1,344 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+#include <qtconcurrentalgorithm.h>
+#include <qexception.h>
+
+#include <QFuture>
+#include <QRandomGenerator>
+#include <QSpan>
+#include <QString>
+#include <QTest>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using namespace QtConcurrent;
+
+class tst_QtConcurrentAlgorithm : public QObject
+{
+    Q_OBJECT
+private slots:
+    void sort_data();
+    void sort();
+    void sortCustomCompare();
+    void sortContainers();
+    void sortNotDefaultConstructible();
+    void sortCancel();
+    void inclusiveScan_data();
+    void inclusiveScan();
+    void exclusiveScan_data();
+    void exclusiveScan();
+    void scanNotCommutative();
+    void transformReduce_data();
+    void transformReduce();
+    void transformReduceTemporary();
+    void progress();
+#ifndef QT_NO_EXCEPTIONS
+    void exceptions();
+#endif
+};
+
+static QList<int> randomList(qsizetype size)
+{
+    QList<int> list(size);
+    QRandomGenerator random(size);
+    for (int &value : list)
+        value = int(random.bounded(1000));
+    return list;
+}
+
+static void addRows()
+{
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<int>("size");
+
+    // The number of threads decides the number of merge rounds of the sort,
+    // and whether the result needs to be moved back from the buffer.
+    for (int threads : { 1, 2, 3, 4, 5, 8 }) {
+        for (int size : { 0, 1, 2, 1000, 5000, 100000 }) {
+            QTest::addRow("threads:%d size:%d", threads, size) << threads << size;
+        }
+    }
+}
+
+void tst_QtConcurrentAlgorithm::sort_data()
+{
+    addRows();
+}
+
+void tst_QtConcurrentAlgorithm::sort()
+{
+    QFETCH(int, threads);
+    QFETCH(int, size);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    QList<int> list = randomList(size);
+    QList<int> expected = list;
+    std::sort(expected.begin(), expected.end());
+
+    QFuture<void> future = QtConcurrent::sort(&pool, list);
+    future.waitForFinished();
+    QVERIFY(!future.isCanceled());
+    QCOMPARE(list, expected);
+
+    // already sorted
+    QtConcurrent::blockingSort(&pool, list);
+    QCOMPARE(list, expected);
+}
+
+void tst_QtConcurrentAlgorithm::sortCustomCompare()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+
+    QList<int> list = randomList(20000);
+    QList<int> expected = list;
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+
+    QtConcurrent::blockingSort(&pool, list, std::greater<>());
+    QCOMPARE(list, expected);
+
+    QList<QString> strings;
+    for (int value : randomList(10000))
+        strings.append(QString::number(value));
+    QList<QString> expectedStrings = strings;
+    const auto byLength = [](const QString &lhs, const QString &rhs) {
+        return lhs.size() < rhs.size() || (lhs.size() == rhs.size() && lhs < rhs);
+    };
+    std::sort(expectedStrings.begin(), expectedStrings.end(), byLength);
+    QtConcurrent::blockingSort(&pool, strings.begin(), strings.end(), byLength);
+    QCOMPARE(strings, expectedStrings);
+}
+
+void tst_QtConcurrentAlgorithm::sortContainers()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+
+    const QList<int> list = randomList(30000);
+    QList<int> expected = list;
+    std::sort(expected.begin(), expected.end());
+
+    {
+        std::vector<int> vector(list.begin(), list.end());
+        QtConcurrent::sort(&pool, vector).waitForFinished();
+        QVERIFY(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+    {
+        std::vector<int> vector(list.begin(), list.end());
+        QtConcurrent::sort(&pool, QSpan<int>(vector)).waitForFinished();
+        QVERIFY(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+    {
+        std::vector<int> vector(list.begin(), list.end());
+        QtConcurrent::blockingSort(&pool, vector.data(), vector.data() + vector.size());
+        QVERIFY(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+    {
+        QList<int> copy = list;
+        QtConcurrent::blockingSort(copy);
+        QCOMPARE(copy, expected);
+    }
+}
+
+struct NotDefaultConstructible
+{
+    explicit NotDefaultConstructible(int value) : value(value) { }
+    int value;
+    friend bool operator<(const NotDefaultConstructible &lhs, const NotDefaultConstructible &rhs)
+    {
+        return lhs.value < rhs.value;
+    }
+};
+
+void tst_QtConcurrentAlgorithm::sortNotDefaultConstructible()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(5);
+
+    const QList<int> list = randomList(30000);
+    std::vector<NotDefaultConstructible> vector;
+    for (int value : list)
+        vector.emplace_back(value);
+
+    QtConcurrent::blockingSort(&pool, vector);
+    QVERIFY(std::is_sorted(vector.begin(), vector.end()));
+    QCOMPARE(qsizetype(vector.size()), list.size());
+}
+
+void tst_QtConcurrentAlgorithm::sortCancel()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(3);
+
+    QList<int> list = randomList(200000);
+    QList<int> expected = list;
+    std::sort(expected.begin(), expected.end());
+
+    QFuture<void> future = QtConcurrent::sort(&pool, list);
+    future.cancel();
+    future.waitForFinished();
+    pool.waitForDone();
+
+    // Whatever step the sort stopped after, no items got lost.
+    std::sort(list.begin(), list.end());
+    QCOMPARE(list, expected);
+}
+
+void tst_QtConcurrentAlgorithm::inclusiveScan_data()
+{
+    addRows();
+}
+
+void tst_QtConcurrentAlgorithm::inclusiveScan()
+{
+    QFETCH(int, threads);
+    QFETCH(int, size);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    const QList<int> list = randomList(size);
+    std::vector<qint64> input(list.begin(), list.end());
+    std::vector<qint64> expected(input.size());
+    std::inclusive_scan(input.begin(), input.end(), expected.begin());
+
+    std::vector<qint64> output(input.size());
+    QtConcurrent::inclusiveScan(&pool, input.cbegin(), input.cend(), output.begin())
+            .waitForFinished();
+    QCOMPARE(output, expected);
+
+    // in place
+    QtConcurrent::blockingInclusiveScan(&pool, input);
+    QCOMPARE(input, expected);
+}
+
+void tst_QtConcurrentAlgorithm::exclusiveScan_data()
+{
+    addRows();
+}
+
+void tst_QtConcurrentAlgorithm::exclusiveScan()
+{
+    QFETCH(int, threads);
+    QFETCH(int, size);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    const QList<int> list = randomList(size);
+    std::vector<qint64> input(list.begin(), list.end());
+    std::vector<qint64> expected(input.size());
+    std::exclusive_scan(input.begin(), input.end(), expected.begin(), qint64(42));
+
+    std::vector<qint64> output(input.size());
+    QtConcurrent::exclusiveScan(&pool, input.cbegin(), input.cend(), output.begin(), qint64(42))
+            .waitForFinished();
+    QCOMPARE(output, expected);
+
+    // in place
+    QtConcurrent::blockingExclusiveScan(&pool, QSpan<qint64>(input), qint64(42));
+    QCOMPARE(input, expected);
+}
+
+void tst_QtConcurrentAlgorithm::scanNotCommutative()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+
+    QList<QString> strings;
+    for (int i = 0; i < 10000; ++i)
+        strings.append(QString(QChar(u'a' + i % 26)));
+
+    QList<QString> expected(strings.size());
+    std::inclusive_scan(strings.begin(), strings.end(), expected.begin(), std::plus<>());
+    QList<QString> inclusive = strings;
+    QtConcurrent::blockingInclusiveScan(&pool, inclusive);
+    QCOMPARE(inclusive, expected);
+
+    std::exclusive_scan(strings.begin(), strings.end(), expected.begin(), QStringLiteral(">"),
+                        std::plus<>());
+    QList<QString> exclusive = strings;
+    QtConcurrent::blockingExclusiveScan(&pool, exclusive, QStringLiteral(">"));
+    QCOMPARE(exclusive, expected);
+}
+
+void tst_QtConcurrentAlgorithm::transformReduce_data()
+{
+    addRows();
+}
+
+void tst_QtConcurrentAlgorithm::transformReduce()
+{
+    QFETCH(int, threads);
+    QFETCH(int, size);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    const QList<int> list = randomList(size);
+    const auto square = [](int value) { return qint64(value) * value; };
+    const qint64 expected = std::transform_reduce(list.begin(), list.end(), qint64(7),
+                                                  std::plus<>(), square);
+
+    QFuture<qint64> future =
+            QtConcurrent::transformReduce(&pool, list, qint64(7), std::plus<>(), square);
+    QCOMPARE(future.result(), expected);
+    QCOMPARE(QtConcurrent::blockingTransformReduce(&pool, list.cbegin(), list.cend(), qint64(7),
+                                                   std::plus<>(), square),
+             expected);
+}
+
+void tst_QtConcurrentAlgorithm::transformReduceTemporary()
+{
+    // The sequence must be kept alive by the algorithm.
+    const auto size = [](const QString &string) { return string.size(); };
+    QFuture<qsizetype> future = QtConcurrent::transformReduce(
+            QList<QString>(50000, QStringLiteral("abc")), qsizetype(0), std::plus<>(), size);
+    QCOMPARE(future.result(), 150000);
+
+    QCOMPARE(QtConcurrent::blockingTransformReduce(std::vector<QString>(10, QStringLiteral("ab")),
+                                                   qsizetype(1), std::plus<>(), size),
+             21);
+}
+
+void tst_QtConcurrentAlgorithm::progress()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+
+    QList<int> list = randomList(100000);
+    QFuture<void> future = QtConcurrent::sort(&pool, list);
+    future.waitForFinished();
+    QVERIFY(future.progressMaximum() > 0);
+    QCOMPARE(future.progressValue(), future.progressMaximum());
+}
+
+#ifndef QT_NO_EXCEPTIONS
+void tst_QtConcurrentAlgorithm::exceptions()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+
+    QList<int> list = randomList(50000);
+    bool caught = false;
+    try {
+        QtConcurrent::blockingSort(&pool, list, [](int lhs, int rhs) {
+            if (lhs == 500)
+                throw QException();
+            return lhs < rhs;
+        });
+    } catch (const QException &) {
+        caught = true;
+    }
+    QVERIFY(caught);
+    pool.waitForDone();
+}
+#endif
+
+QTEST_MAIN(tst_QtConcurrentAlgorithm)
+#include "tst_qtconcurrentalgorithm.moc"
@@ -8,8 +8,11 @@
 #include <QMutex>
 #include <QTest>
 #include <QSet>
+#include <QSpan>
 #include <QRandomGenerator>
 
+#include <numeric>
+
 #include "../testhelper_functions.h"
 
 class tst_QtConcurrentMap : public QObject
@@ -45,6 +48,7 @@ private slots:
     void stlContainersLambda();
     void qFutureAssignmentLeak();
     void stressTest();
+    void orderedReduceLargeInput();
     void persistentResultTest();
 public slots:
     void throttling();
@@ -2212,6 +2216,44 @@ void tst_QtConcurrentMap::stressTest()
     }
 }
 
+static void appendReduce(QList<int> &result, const int &value)
+{
+    result.append(value);
+}
+
+void tst_QtConcurrentMap::orderedReduceLargeInput()
+{
+    // Large enough for many chunks per thread, so that chunks finish out of order.
+    const int count = 100000;
+    std::vector<int> vector(count);
+    std::iota(vector.begin(), vector.end(), 0);
+    const QList<int> expected(vector.begin(), vector.end());
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+
+    for (int i = 0; i < 10; ++i) {
+        QCOMPARE(QtConcurrent::blockingMappedReduced<QList<int>>(&pool, vector, echo, appendReduce,
+                                                                 OrderedReduce),
+                 expected);
+        QCOMPARE(QtConcurrent::blockingMappedReduced<QList<int>>(&pool, expected, echo, appendReduce,
+                                                                 OrderedReduce),
+                 expected);
+        QCOMPARE(QtConcurrent::blockingMappedReduced<QList<int>>(&pool, QSpan<const int>(vector),
+                                                                 echo, appendReduce, OrderedReduce),
+                 expected);
+        QCOMPARE(QtConcurrent::blockingMappedReduced<QList<int>>(&pool, expected.cbegin(),
+                                                                 expected.cend(), echo,
+                                                                 appendReduce, OrderedReduce),
+                 expected);
+
+        QList<int> unordered = QtConcurrent::blockingMappedReduced<QList<int>>(
+                &pool, vector, echo, appendReduce, UnorderedReduce);
+        std::sort(unordered.begin(), unordered.end());
+        QCOMPARE(unordered, expected);
+    }
+}
+
 struct LockedCounter
 {
     LockedCounter(QMutex *mutex, QAtomicInt *ai)
@@ -0,0 +1,204 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/private/qasyncfilesystem_p.h>
+#include <QtCore/private/qfilesystemmetadata_p.h>
+
+#include <QtCore/qfile.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qtemporarydir.h>
+
+#include <QtTest/qtest.h>
+
+using namespace Qt::StringLiterals;
+
+class tst_QAsyncFileSystem : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void mkdirAndRmdir();
+    void renameAndRemove();
+    void stat();
+    void readFile();
+    void readFileErrors();
+    void deleteWhileInProgress();
+
+private:
+    bool createFile(const QString &fileName, QByteArrayView contents);
+
+    QTemporaryDir m_dir;
+};
+
+void tst_QAsyncFileSystem::initTestCase()
+{
+    QVERIFY2(m_dir.isValid(), qPrintable(m_dir.errorString()));
+}
+
+bool tst_QAsyncFileSystem::createFile(const QString &fileName, QByteArrayView contents)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+    return file.write(contents.data(), contents.size()) == contents.size();
+}
+
+void tst_QAsyncFileSystem::mkdirAndRmdir()
+{
+    QAsyncFileSystem fs;
+    const QString dirName = m_dir.filePath(u"subdir"_s);
+
+    QIOOperation *op = fs.mkdir(dirName);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::None);
+    QCOMPARE_EQ(op->type(), QIOOperation::Type::MakeDirectory);
+    QVERIFY(QFileInfo(dirName).isDir());
+
+    // Already exists
+    op = fs.mkdir(dirName);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::MakeDirectory);
+
+    op = fs.rmdir(dirName);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::None);
+    QCOMPARE_EQ(op->type(), QIOOperation::Type::Remove);
+    QVERIFY(!QFileInfo::exists(dirName));
+
+    // Does not exist anymore
+    op = fs.rmdir(dirName);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::Remove);
+}
+
+void tst_QAsyncFileSystem::renameAndRemove()
+{
+    QAsyncFileSystem fs;
+    const QString source = m_dir.filePath(u"source.txt"_s);
+    const QString target = m_dir.filePath(u"target.txt"_s);
+    QVERIFY(createFile(source, "data"));
+
+    QIOOperation *op = fs.rename(source, target);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::None);
+    QCOMPARE_EQ(op->type(), QIOOperation::Type::Rename);
+    QVERIFY(!QFileInfo::exists(source));
+    QVERIFY(QFileInfo::exists(target));
+
+    // Like QFile::rename(), an existing target is not replaced
+    QVERIFY(createFile(source, "other"));
+    op = fs.rename(source, target);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::Rename);
+    QVERIFY(QFileInfo::exists(source));
+
+    for (const QString &fileName : { source, target }) {
+        op = fs.remove(fileName);
+        QTRY_COMPARE(op->isFinished(), true);
+        QCOMPARE_EQ(op->error(), QIOOperation::Error::None);
+        QVERIFY(!QFileInfo::exists(fileName));
+    }
+
+    op = fs.remove(source);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::Remove);
+}
+
+void tst_QAsyncFileSystem::stat()
+{
+    QAsyncFileSystem fs;
+    const QString fileName = m_dir.filePath(u"stat.txt"_s);
+    const QByteArray contents = "lorem ipsum dolor sit amet"_ba;
+    QVERIFY(createFile(fileName, contents));
+
+    QIOStatOperation *op = fs.stat(fileName);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::None);
+    QCOMPARE_EQ(op->type(), QIOOperation::Type::Stat);
+    QFileSystemMetaData metaData = op->metaData();
+    QVERIFY(metaData.exists());
+    QVERIFY(metaData.isFile());
+    QCOMPARE_EQ(metaData.size(), contents.size());
+
+    op = fs.stat(m_dir.path());
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::None);
+    metaData = op->metaData();
+    QVERIFY(metaData.isDirectory());
+
+    op = fs.stat(m_dir.filePath(u"nonexistent"_s));
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::Stat);
+}
+
+void tst_QAsyncFileSystem::readFile()
+{
+    QAsyncFileSystem fs;
+    const QString fileName = m_dir.filePath(u"read.txt"_s);
+    const QByteArray contents = "lorem ipsum dolor sit amet"_ba;
+    QVERIFY(createFile(fileName, contents));
+
+    // Whole file
+    QIOReadOperation *op = fs.readFile(fileName, 1024);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::None);
+    QCOMPARE_EQ(op->numBytesProcessed(), contents.size());
+    QCOMPARE_EQ(op->data(), contents);
+
+    // Only a part
+    op = fs.readFile(fileName, 5);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::None);
+    QCOMPARE_EQ(op->numBytesProcessed(), 5);
+    QCOMPARE_EQ(op->data(), contents.first(5));
+
+    // Many at once
+    QList<QIOReadOperation *> ops;
+    for (int i = 0; i < 100; ++i)
+        ops.append(fs.readFile(fileName, 1024));
+    for (QIOReadOperation *readOp : std::as_const(ops)) {
+        QTRY_COMPARE(readOp->isFinished(), true);
+        QCOMPARE_EQ(readOp->error(), QIOOperation::Error::None);
+        QCOMPARE_EQ(readOp->data(), contents);
+    }
+}
+
+void tst_QAsyncFileSystem::readFileErrors()
+{
+    QAsyncFileSystem fs;
+
+    QIOReadOperation *op = fs.readFile(m_dir.filePath(u"nonexistent"_s), 1024);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::Open);
+    QCOMPARE_EQ(op->numBytesProcessed(), 0);
+
+    QTest::ignoreMessage(QtWarningMsg,
+                         "Using a negative maxSize in QAsyncFileSystem::readFile() is incorrect. "
+                         "Resetting to zero!");
+    op = fs.readFile(m_dir.filePath(u"nonexistent"_s), -1);
+    QTRY_COMPARE(op->isFinished(), true);
+    QCOMPARE_EQ(op->error(), QIOOperation::Error::Open);
+}
+
+void tst_QAsyncFileSystem::deleteWhileInProgress()
+{
+    const QString fileName = m_dir.filePath(u"inprogress.txt"_s);
+    QVERIFY(createFile(fileName, QByteArray(1024 * 1024, 'a')));
+
+    // Deleting the file system object, or the operations, while they are
+    // still in progress must not crash.
+    {
+        QAsyncFileSystem fs;
+        for (int i = 0; i < 10; ++i) {
+            QIOOperation *op = fs.readFile(fileName, 1024 * 1024);
+            if (i % 2)
+                delete op;
+            (void)fs.stat(fileName);
+        }
+    }
+}
+
+QTEST_MAIN(tst_QAsyncFileSystem)
+
+#include "tst_qasyncfilesystem.moc"
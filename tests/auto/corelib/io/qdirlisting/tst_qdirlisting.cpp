@@ -8,8 +8,11 @@
 #include <qdirlisting.h>
 #include <qfileinfo.h>
 #include <qstringlist.h>
+#include <qthreadpool.h>
 #include <QSet>
 #include <QString>
+#include <QScopeGuard>
+#include <QSemaphore>
 
 #include <QtCore/private/qdir_p.h>
 #include <QtCore/private/qfsfileengine_p.h>
@@ -99,6 +102,15 @@ private slots:
     void withStdAlgorithms();
     void debugStreamOperator_data();
     void debugStreamOperator();
+
+    void parallel_data() { iterateRelativeDirectory_data(); }
+    void parallel();
+    void parallelLargeTree();
+    void parallelStopLinkLoop();
+    void parallelWithoutPoolThreads();
+    void largeDirectory();
+    void prefetchMetaData_data();
+    void prefetchMetaData();
 private:
     QSharedPointer<QTemporaryDir> m_dataDir;
 };
@@ -943,6 +955,209 @@ void tst_QDirListing::withStdAlgorithms()
 #endif
 }
 
+void tst_QDirListing::parallel()
+{
+    QFETCH(QString, dirName);
+    QFETCH(QDirListing::IteratorFlags, flags);
+    QFETCH(QStringList, nameFilters);
+
+    auto listEntries = [&](QDirListing::IteratorFlags flags) {
+        QStringList list;
+        for (const auto &dirEntry : QDirListing(dirName, nameFilters, flags))
+            list.emplace_back(dirEntry.filePath());
+        list.sort();
+        return list;
+    };
+
+    // Whatever the flags, a parallel listing lists the same entries, only
+    // maybe in a different order:
+    const QStringList expected = listEntries(flags);
+    QCOMPARE_EQ(listEntries(flags | ItFlag::Parallel), expected);
+    QCOMPARE_EQ(listEntries(flags | ItFlag::Parallel | ItFlag::PrefetchMetaData), expected);
+    QCOMPARE_EQ(listEntries(flags | ItFlag::PrefetchMetaData), expected);
+}
+
+void tst_QDirListing::parallelLargeTree()
+{
+    QTemporaryDir tempDir;
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+
+    // Wide and deep enough for the entries not to fit in the queue between the
+    // listing threads and this one
+    QSet<QString> expected;
+    for (int i = 0; i < 20; ++i) {
+        QString dirPath = tempDir.path();
+        for (int depth = 0; depth < 5; ++depth) {
+            dirPath += u"/dir"_s + QString::number(i * 5 + depth);
+            QVERIFY(QDir().mkdir(dirPath));
+            expected.insert(dirPath);
+            for (int j = 0; j < 200; ++j) {
+                const QString filePath = dirPath + u"/file"_s + QString::number(j);
+                QVERIFY(createFile(filePath));
+                expected.insert(filePath);
+            }
+        }
+    }
+
+    constexpr auto flags = ItFlag::Recursive | ItFlag::Parallel | ItFlag::PrefetchMetaData;
+    const QDirListing dirList(tempDir.path(), flags);
+
+    QSet<QString> actual;
+    for (const auto &dirEntry : dirList) {
+        QVERIFY2(!actual.contains(dirEntry.filePath()), qPrintable(dirEntry.filePath()));
+        actual.insert(dirEntry.filePath());
+        if (dirEntry.isFile())
+            QCOMPARE_EQ(dirEntry.size(), 0);
+    }
+    QCOMPARE_EQ(actual, expected);
+
+    // Starting over, and stopping half-way, while the listing threads may
+    // still be waiting for us to take more entries
+    int count = 0;
+    for (auto it = dirList.begin(); it != dirList.end() && count < 1000; ++it)
+        ++count;
+    QCOMPARE_EQ(count, 1000);
+
+    // Destroying a listing while it's in progress
+    {
+        QDirListing inProgress(tempDir.path(), flags);
+        auto it = inProgress.begin();
+        QVERIFY(it != inProgress.end());
+    }
+}
+
+void tst_QDirListing::parallelStopLinkLoop()
+{
+#ifdef Q_NO_SYMLINKS
+    QSKIP("Symbolic links are not supported on this platform");
+#else
+    QTemporaryDir tempDir;
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+    const QString dirPath = tempDir.filePath(u"dir"_s);
+    QVERIFY(QDir().mkdir(dirPath));
+    QVERIFY(QFile::link(tempDir.path(), dirPath + u"/up.lnk"_s));
+    QVERIFY(QFile::link(dirPath, dirPath + u"/self.lnk"_s));
+
+    constexpr auto flags = ItFlag::Recursive | ItFlag::FollowDirSymlinks | ItFlag::Parallel;
+    int count = 0;
+    for (const auto &dirEntry : QDirListing(tempDir.path(), flags)) {
+        Q_UNUSED(dirEntry);
+        QCOMPARE_LT(++count, 200);
+    }
+    QCOMPARE_GT(count, 0);
+#endif
+}
+
+void tst_QDirListing::parallelWithoutPoolThreads()
+{
+    QTemporaryDir tempDir;
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+    QSet<QString> expected;
+    QString dirPath = tempDir.path();
+    for (int depth = 0; depth < 3; ++depth) {
+        dirPath += u"/dir"_s;
+        QVERIFY(QDir().mkdir(dirPath));
+        expected.insert(dirPath);
+        QVERIFY(createFile(dirPath + u"/file"_s));
+        expected.insert(dirPath + u"/file"_s);
+    }
+
+    // Keep all pool threads busy, so the iterating thread has to list the
+    // directories itself
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int maxThreadCount = pool->maxThreadCount();
+    pool->setMaxThreadCount(1);
+    QSemaphore started;
+    QSemaphore finish;
+    pool->start([&] { started.release(); finish.acquire(); });
+    started.acquire();
+    const auto cleanup = qScopeGuard([&] {
+        finish.release();
+        pool->waitForDone();
+        pool->setMaxThreadCount(maxThreadCount);
+    });
+
+    QSet<QString> actual;
+    for (const auto &dirEntry : QDirListing(tempDir.path(), ItFlag::Recursive | ItFlag::Parallel))
+        actual.insert(dirEntry.filePath());
+    QCOMPARE_EQ(actual, expected);
+}
+
+void tst_QDirListing::largeDirectory()
+{
+    QTemporaryDir tempDir;
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+
+    // Long names, so that the native iterator has to grow the buffer it reads
+    // the entries into up to its maximum, and then refill it a few times
+    QSet<QString> expected;
+    const QString prefix = tempDir.path() + u'/' + QString(200, u'x');
+    for (int i = 0; i < 15000; ++i) {
+        const QString filePath = prefix + QString::number(i);
+        QVERIFY(createFile(filePath));
+        expected.insert(filePath);
+    }
+
+    for (auto flags : { ItFlag::Default, ItFlag::PrefetchMetaData }) {
+        QSet<QString> actual;
+        for (const auto &dirEntry : QDirListing(tempDir.path(), flags)) {
+            QVERIFY2(!actual.contains(dirEntry.filePath()), qPrintable(dirEntry.filePath()));
+            actual.insert(dirEntry.filePath());
+        }
+        QCOMPARE_EQ(actual.size(), expected.size());
+        QCOMPARE_EQ(actual, expected);
+    }
+}
+
+void tst_QDirListing::prefetchMetaData_data()
+{
+    QTest::addColumn<QDirListing::IteratorFlags>("flags");
+    QTest::newRow("lazy") << QDirListing::IteratorFlags(ItFlag::Recursive);
+    QTest::newRow("prefetch") << (ItFlag::Recursive | ItFlag::PrefetchMetaData);
+    QTest::newRow("parallel") << (ItFlag::Recursive | ItFlag::Parallel);
+    QTest::newRow("parallel-prefetch")
+            << (ItFlag::Recursive | ItFlag::Parallel | ItFlag::PrefetchMetaData);
+}
+
+void tst_QDirListing::prefetchMetaData()
+{
+    QFETCH(QDirListing::IteratorFlags, flags);
+
+    QTemporaryDir tempDir;
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+    const QString subDir = tempDir.filePath(u"sub"_s);
+    QVERIFY(QDir().mkdir(subDir));
+    for (int i = 0; i < 20; ++i) {
+        QFile file(subDir + u"/file"_s + QString::number(i));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QCOMPARE_EQ(file.write(QByteArray(i * 100, 'q')), i * 100);
+    }
+#ifndef Q_NO_SYMLINKS
+    QVERIFY(QFile::link(subDir + u"/file10"_s, tempDir.filePath(u"file.lnk"_s)));
+    QVERIFY(QFile::link(subDir, tempDir.filePath(u"dir.lnk"_s)));
+    QVERIFY(QFile::link(tempDir.filePath(u"missing"_s), tempDir.filePath(u"broken.lnk"_s)));
+#endif
+
+    // The metadata that was fetched while listing has to be the same as
+    // the metadata looked up later
+    int count = 0;
+    for (const auto &dirEntry : QDirListing(tempDir.path(), flags | ItFlag::IncludeBrokenSymlinks)) {
+        const QFileInfo info(dirEntry.filePath());
+        QCOMPARE_EQ(dirEntry.isFile(), info.isFile());
+        QCOMPARE_EQ(dirEntry.isDir(), info.isDir());
+        QCOMPARE_EQ(dirEntry.isSymLink(), info.isSymLink());
+        QCOMPARE_EQ(dirEntry.exists(), info.exists());
+        QCOMPARE_EQ(dirEntry.size(), info.size());
+        QCOMPARE_EQ(dirEntry.lastModified(QTimeZone::UTC), info.lastModified(QTimeZone::UTC));
+        ++count;
+    }
+#ifndef Q_NO_SYMLINKS
+    QCOMPARE_EQ(count, 1 + 20 + 3);
+#else
+    QCOMPARE_EQ(count, 1 + 20);
+#endif
+}
+
 void tst_QDirListing::debugStreamOperator_data()
 {
     QTest::addColumn<QDirListing::IteratorFlags>("flags");
@@ -276,6 +276,13 @@ private slots:
     void resize_data();
     void resize();
 
+    void ioQueueDepth();
+    void ioQueueRead_data();
+    void ioQueueRead();
+    void ioQueueWrite_data();
+    void ioQueueWrite();
+    void ioQueueReadWrite();
+
     void objectConstructors();
 
     void caseSensitivity();
@@ -3850,6 +3857,193 @@ void tst_QFile::resize()
     QCOMPARE(QFileInfo(filename).size(), qint64(4));
 }
 
+static QByteArray ioQueueTestData(qsizetype size)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    QRandomGenerator rng(size);
+    for (char &c : data)
+        c = char(rng.generate());
+    return data;
+}
+
+void tst_QFile::ioQueueDepth()
+{
+    QFile file(u"ioqueue.bin"_s);
+    QCOMPARE(file.ioQueueDepth(), 0);
+    file.setIOQueueDepth(8);
+    QCOMPARE(file.ioQueueDepth(), 8);
+    file.setIOQueueDepth(-1);
+    QCOMPARE(file.ioQueueDepth(), 0);
+
+    // setting the depth on an open file takes effect right away
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    QVERIFY(file.write("abc") == 3);
+    file.setIOQueueDepth(4);
+    QVERIFY(file.write("def") == 3);
+    file.setIOQueueDepth(0);
+    QVERIFY(file.write("ghi") == 3);
+    file.close();
+    QCOMPARE(file.ioQueueDepth(), 0);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QCOMPARE(file.readAll(), "abcdefghi");
+}
+
+void tst_QFile::ioQueueRead_data()
+{
+    QTest::addColumn<int>("depth");
+    QTest::addColumn<int>("blockSize");
+    QTest::addColumn<bool>("unbuffered");
+
+    for (int depth : { 1, 4, 64 }) {
+        for (int blockSize : { 1, 4096, 100000 }) {
+            for (bool unbuffered : { false, true }) {
+                QTest::addRow("depth%d-block%d%s", depth, blockSize,
+                              unbuffered ? "-unbuffered" : "")
+                        << depth << blockSize << unbuffered;
+            }
+        }
+    }
+}
+
+void tst_QFile::ioQueueRead()
+{
+    QFETCH(int, depth);
+    QFETCH(int, blockSize);
+    QFETCH(bool, unbuffered);
+
+    const QByteArray expected = ioQueueTestData(1024 * 1024 + 123);
+    {
+        QFile file(u"ioqueue.bin"_s);
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        QCOMPARE(file.write(expected), expected.size());
+    }
+
+    QFile file(u"ioqueue.bin"_s);
+    file.setIOQueueDepth(depth);
+    QIODevice::OpenMode mode = QIODevice::ReadOnly;
+    if (unbuffered)
+        mode |= QIODevice::Unbuffered;
+    QVERIFY(file.open(mode));
+
+    QByteArray contents;
+    while (!file.atEnd()) {
+        const QByteArray block = file.read(blockSize);
+        QVERIFY(!block.isEmpty());
+        contents += block;
+    }
+    QCOMPARE(contents.size(), expected.size());
+    QVERIFY(contents == expected);
+    QCOMPARE(file.read(blockSize), QByteArray());
+
+    // random access keeps working
+    for (qint64 pos : { 500000, 10, 1024 * 1024, 500001, 0 }) {
+        QVERIFY(file.seek(pos));
+        QCOMPARE(file.pos(), pos);
+        QCOMPARE(file.read(blockSize), expected.mid(pos, blockSize));
+    }
+
+    // data appended by someone else is seen after reaching the end
+    QVERIFY(file.seek(expected.size()));
+    QVERIFY(file.atEnd());
+    {
+        QFile appender(u"ioqueue.bin"_s);
+        QVERIFY(appender.open(QIODevice::Append));
+        QCOMPARE(appender.write("tail"), 4);
+    }
+    QCOMPARE(file.readAll(), "tail");
+}
+
+void tst_QFile::ioQueueWrite_data()
+{
+    QTest::addColumn<int>("depth");
+    QTest::addColumn<int>("blockSize");
+
+    for (int depth : { 1, 4, 64 }) {
+        for (int blockSize : { 1, 4096, 100000 })
+            QTest::addRow("depth%d-block%d", depth, blockSize) << depth << blockSize;
+    }
+}
+
+void tst_QFile::ioQueueWrite()
+{
+    QFETCH(int, depth);
+    QFETCH(int, blockSize);
+
+    QByteArray expected = ioQueueTestData(1024 * 1024 + 4567);
+    QFile file(u"ioqueue.bin"_s);
+    file.setIOQueueDepth(depth);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    for (qsizetype pos = 0; pos < expected.size(); pos += blockSize) {
+        const QByteArrayView block = QByteArrayView(expected).sliced(pos).first(
+                qMin<qsizetype>(blockSize, expected.size() - pos));
+        QCOMPARE(file.write(block.data(), block.size()), block.size());
+    }
+    QCOMPARE(file.pos(), expected.size());
+    QCOMPARE(file.size(), expected.size());
+
+    // overwrite a range in the middle, then extend the file
+    const QByteArray patch(70000, 'x');
+    QVERIFY(file.seek(100000));
+    QCOMPARE(file.write(patch), patch.size());
+    expected.replace(100000, patch.size(), patch);
+    QVERIFY(file.seek(expected.size()));
+    QCOMPARE(file.write("end"), 3);
+    expected += "end";
+    QVERIFY(file.flush());
+    QCOMPARE(QFileInfo(file.fileName()).size(), expected.size());
+    file.close();
+    QCOMPARE(file.error(), QFile::NoError);
+
+    QFile check(u"ioqueue.bin"_s);
+    QVERIFY(check.open(QIODevice::ReadOnly));
+    QVERIFY(check.readAll() == expected);
+}
+
+void tst_QFile::ioQueueReadWrite()
+{
+    QByteArray expected = ioQueueTestData(512 * 1024);
+    {
+        QFile file(u"ioqueue.bin"_s);
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        QCOMPARE(file.write(expected), expected.size());
+    }
+
+    QFile file(u"ioqueue.bin"_s);
+    file.setIOQueueDepth(8);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QCOMPARE(file.read(1000), expected.first(1000));
+
+    // a write in the middle of the read-ahead window replaces the data
+    // that was already fetched
+    const QByteArray patch(3000, 'y');
+    QCOMPARE(file.write(patch), patch.size());
+    expected.replace(1000, patch.size(), patch);
+    QCOMPARE(file.read(200000), expected.mid(4000, 200000));
+
+    QVERIFY(file.seek(2000));
+    QCOMPARE(file.read(10), expected.mid(2000, 10));
+
+    QVERIFY(file.resize(300000));
+    expected.truncate(300000);
+    QVERIFY(file.seek(299990));
+    QCOMPARE(file.readAll(), expected.last(10));
+    QVERIFY(file.seek(0));
+    QVERIFY(file.readAll() == expected);
+
+#ifdef Q_OS_UNIX
+    // closing moves the file descriptor to the logical position
+    const int fd = QT_OPEN("ioqueue.bin", O_RDONLY);
+    QVERIFY(fd != -1);
+    auto closeFd = qScopeGuard([fd] { QT_CLOSE(fd); });
+    QFile fromFd;
+    fromFd.setIOQueueDepth(4);
+    QVERIFY(fromFd.open(fd, QIODevice::ReadOnly | QIODevice::Unbuffered, QFile::DontCloseHandle));
+    QCOMPARE(fromFd.read(100), expected.first(100));
+    fromFd.close();
+    QCOMPARE(QT_LSEEK(fd, 0, SEEK_CUR), 100);
+#endif
+}
+
 void tst_QFile::objectConstructors()
 {
     QObject ob;
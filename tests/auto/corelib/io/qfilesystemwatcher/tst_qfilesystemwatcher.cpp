@@ -12,6 +12,7 @@
 #include <QMap>
 #include <QString>
 #include <QDir>
+#include <QScopeGuard>
 #include <QSignalSpy>
 #include <QTimer>
 #include <QTemporaryFile>
@@ -87,6 +88,14 @@ private slots:
 #if defined(Q_OS_WIN)
     void watchDirectoryAttributeChanges();
 #endif
+#if defined(Q_OS_LINUX)
+    void recursiveWatch();
+    void recursiveWatchNewDirectories();
+    void recursiveWatchBatchesChanges();
+    void removeRecursivePath();
+#else
+    void recursiveWatchUnsupported();
+#endif
 
 private:
     QString m_tempDirPattern;
@@ -864,5 +873,181 @@ void tst_QFileSystemWatcher::watchDirectoryAttributeChanges()
 }
 #endif
 
+#if defined(Q_OS_LINUX)
+static bool createFile(const QString &fileName, const QByteArray &contents = "data")
+{
+    QFile file(fileName);
+    return file.open(QIODevice::WriteOnly) && file.write(contents) == contents.size();
+}
+
+void tst_QFileSystemWatcher::recursiveWatch()
+{
+    QTemporaryDir temporaryDirectory(m_tempDirPattern);
+    QVERIFY2(temporaryDirectory.isValid(), qPrintable(temporaryDirectory.errorString()));
+    const QString root = temporaryDirectory.path();
+    QVERIFY(QDir(root).mkpath("a/b/c"));
+
+    QFileSystemWatcher watcher;
+    watcher.setDebounceInterval(0ms);
+    QVERIFY(watcher.addRecursivePath(root));
+    QCOMPARE(watcher.recursiveDirectories(), QStringList(root));
+    QVERIFY(watcher.directories().isEmpty());
+    // already watched
+    QCOMPARE(watcher.addRecursivePaths({ root }), QStringList(root));
+    // not a directory
+    const QString file = root + "/file";
+    QVERIFY(createFile(file));
+    QCOMPARE(watcher.addRecursivePaths({ file }), QStringList(file));
+
+    QSignalSpy pathsSpy(&watcher, &QFileSystemWatcher::pathsChanged);
+    QSignalSpy directorySpy(&watcher, &QFileSystemWatcher::directoryChanged);
+    // let the watcher finish scanning the tree
+    QCoreApplication::processEvents();
+
+    const auto reported = [&](const QString &path) {
+        for (const QList<QVariant> &arguments : std::as_const(pathsSpy)) {
+            if (arguments.at(0).toStringList().contains(path))
+                return true;
+        }
+        return false;
+    };
+
+    const QString nested = root + "/a/b/c/nested";
+    QVERIFY(createFile(nested));
+    QTRY_VERIFY(reported(nested));
+    QTRY_VERIFY(directorySpy.contains(QVariantList{ root + "/a/b/c" }));
+
+    // appended to, without being created or truncated
+    pathsSpy.clear();
+    {
+        QFile appended(nested);
+        QVERIFY(appended.open(QIODevice::ReadWrite));
+        QVERIFY(appended.seek(appended.size()));
+        QCOMPARE(appended.write("more"), 4);
+    }
+    QTRY_VERIFY(reported(nested));
+}
+
+void tst_QFileSystemWatcher::recursiveWatchNewDirectories()
+{
+    QTemporaryDir temporaryDirectory(m_tempDirPattern);
+    QVERIFY2(temporaryDirectory.isValid(), qPrintable(temporaryDirectory.errorString()));
+    const QString root = temporaryDirectory.path();
+
+    QFileSystemWatcher watcher;
+    watcher.setDebounceInterval(0ms);
+    QVERIFY(watcher.addRecursivePath(root));
+    QCoreApplication::processEvents();
+
+    QStringList changed;
+    connect(&watcher, &QFileSystemWatcher::pathsChanged, this, [&](const QStringList &paths) {
+        changed += paths;
+    });
+
+    // created right after its directory, possibly before that one is watched
+    QVERIFY(QDir(root).mkpath("x/y"));
+    QVERIFY(createFile(root + "/x/y/early"));
+    QTRY_VERIFY(changed.contains(root + "/x/y/early"));
+
+    // and later on
+    QVERIFY(createFile(root + "/x/y/late"));
+    QTRY_VERIFY(changed.contains(root + "/x/y/late"));
+
+    // directories moved away are not reported anymore
+    QVERIFY(QDir(root).rename("x", "../" + QFileInfo(root).fileName() + "-moved"));
+    const QString moved = root + "-moved";
+    auto cleanup = qScopeGuard([&] { QDir(moved).removeRecursively(); });
+    QTRY_VERIFY(changed.contains(root + "/x"));
+    changed.clear();
+    QVERIFY(createFile(moved + "/y/elsewhere"));
+    QVERIFY(createFile(root + "/here"));
+    QTRY_VERIFY(changed.contains(root + "/here"));
+    for (const QString &path : std::as_const(changed))
+        QVERIFY2(!path.contains("elsewhere"), qPrintable(path));
+}
+
+void tst_QFileSystemWatcher::recursiveWatchBatchesChanges()
+{
+    QTemporaryDir temporaryDirectory(m_tempDirPattern);
+    QVERIFY2(temporaryDirectory.isValid(), qPrintable(temporaryDirectory.errorString()));
+    const QString root = temporaryDirectory.path();
+
+    QFileSystemWatcher watcher;
+    QCOMPARE(watcher.debounceInterval(), 100ms);
+    watcher.setDebounceInterval(500ms);
+    QCOMPARE(watcher.debounceInterval(), 500ms);
+    QVERIFY(watcher.addRecursivePath(root));
+    QCoreApplication::processEvents();
+
+    QSignalSpy pathsSpy(&watcher, &QFileSystemWatcher::pathsChanged);
+    QStringList expected;
+    for (int i = 0; i < 20; ++i) {
+        const QString fileName = root + u"/file" + QString::number(i);
+        QVERIFY(createFile(fileName));
+        QVERIFY(createFile(fileName, "more data"));
+        expected.append(fileName);
+    }
+    expected.sort();
+
+    QTRY_VERIFY(!pathsSpy.isEmpty());
+    // anything not reported yet comes within the next interval
+    QTest::qWait(600ms);
+    QStringList reported;
+    for (const QList<QVariant> &arguments : std::as_const(pathsSpy)) {
+        const QStringList paths = arguments.at(0).toStringList();
+        QVERIFY(std::is_sorted(paths.cbegin(), paths.cend()));
+        reported += paths;
+    }
+    QVERIFY2(pathsSpy.size() <= 2, QByteArray::number(pathsSpy.size()));
+    reported.removeDuplicates();
+    reported.sort();
+    QCOMPARE(reported, expected);
+}
+
+void tst_QFileSystemWatcher::removeRecursivePath()
+{
+    QTemporaryDir temporaryDirectory(m_tempDirPattern);
+    QVERIFY2(temporaryDirectory.isValid(), qPrintable(temporaryDirectory.errorString()));
+    const QString root = temporaryDirectory.path();
+    QVERIFY(QDir(root).mkpath("sub"));
+
+    QFileSystemWatcher watcher;
+    watcher.setDebounceInterval(0ms);
+    QVERIFY(watcher.addRecursivePath(root));
+    QCoreApplication::processEvents();
+    QVERIFY(!watcher.removeRecursivePath(root + "/sub"));
+    QVERIFY(watcher.removeRecursivePath(root));
+    QVERIFY(watcher.recursiveDirectories().isEmpty());
+    QVERIFY(!watcher.removeRecursivePath(root));
+
+    QSignalSpy pathsSpy(&watcher, &QFileSystemWatcher::pathsChanged);
+    QVERIFY(createFile(root + "/sub/file"));
+    QTest::qWait(100ms);
+    QVERIFY(pathsSpy.isEmpty());
+
+    // removing the root itself ends the watch
+    QVERIFY(watcher.addRecursivePath(root));
+    QCoreApplication::processEvents();
+    QVERIFY(temporaryDirectory.remove());
+    QTRY_VERIFY(watcher.recursiveDirectories().isEmpty());
+}
+#else
+void tst_QFileSystemWatcher::recursiveWatchUnsupported()
+{
+    QTemporaryDir temporaryDirectory(m_tempDirPattern);
+    QVERIFY2(temporaryDirectory.isValid(), qPrintable(temporaryDirectory.errorString()));
+    const QString root = temporaryDirectory.path();
+
+    QFileSystemWatcher watcher;
+    const char message[] =
+            "QFileSystemWatcher::addRecursivePaths: recursive watches are not supported on this platform";
+    QTest::ignoreMessage(QtWarningMsg, message);
+    QVERIFY(!watcher.addRecursivePath(root));
+    QTest::ignoreMessage(QtWarningMsg, message);
+    QCOMPARE(watcher.addRecursivePaths({ root }), QStringList(root));
+    QVERIFY(watcher.recursiveDirectories().isEmpty());
+}
+#endif
+
 QTEST_MAIN(tst_QFileSystemWatcher)
 #include "tst_qfilesystemwatcher.moc"
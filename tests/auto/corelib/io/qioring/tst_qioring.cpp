@@ -7,6 +7,10 @@
 
 #include <QtCore/private/qioring_p.h>
 
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qscopeguard.h>
+#include <QtCore/qtemporarydir.h>
+
 #ifdef Q_OS_WIN
 #include <QtCore/qt_windows.h>
 #include <io.h>
@@ -36,6 +40,11 @@ private slots:
     void tenGiBReadWriteVectored();
     void cancel();
     void cancelFullQueue();
+    void fileSystemOperations();
+    void allocateAndFlushRange();
+    void linkedOpenReadClose();
+    void oversizedLinkedRead();
+    void registeredBuffers();
 
     // This test should be last!
     void fireAndForget();
@@ -650,6 +659,292 @@ void tst_QIORing::cancelFullQueue()
     QVERIFY(ring.waitForRequest(writeHandleToCancel));
 }
 
+void tst_QIORing::fileSystemOperations()
+{
+    QIORing ring;
+    QVERIFY(ring.ensureInitialized());
+    for (auto op : { QIORing::Operation::MakeDirectory, QIORing::Operation::Rename,
+                     QIORing::Operation::Unlink, QIORing::Operation::StatPath }) {
+        if (!ring.isAvailable(op))
+            QSKIP("The file system operations are not available on this system");
+    }
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString subdir = dir.filePath("subdir");
+    const QString renamed = dir.filePath("renamed");
+
+    // Returns the error, or NoError on success
+    auto run = [&ring](auto &&request) {
+        using Request = std::remove_reference_t<decltype(request)>;
+        QFileDevice::FileError error = QFileDevice::UnspecifiedError;
+        request.setCallback([&error](const Request &request) {
+            if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result))
+                error = *err;
+            else
+                error = QFileDevice::NoError;
+        });
+        QVERIFY(ring.waitForRequest(ring.queueRequest(std::move(request))));
+        return error;
+    };
+
+    QIORingRequest<QIORing::Operation::MakeDirectory> mkdirRequest;
+    mkdirRequest.path = QtPrivate::toFilesystemPath(subdir);
+    QCOMPARE(run(std::move(mkdirRequest)), QFileDevice::NoError);
+    QVERIFY(QFileInfo(subdir).isDir());
+
+    QIORingRequest<QIORing::Operation::StatPath> statRequest;
+    statRequest.path = QtPrivate::toFilesystemPath(subdir);
+    QFileSystemMetaData metaData;
+    statRequest.setCallback(
+            [&metaData](const QIORingRequest<QIORing::Operation::StatPath> &request) {
+                const auto *result =
+                        std::get_if<QIORingResult<QIORing::Operation::StatPath>>(&request.result);
+                QVERIFY(result);
+                metaData = result->metaData;
+            });
+    QVERIFY(ring.waitForRequest(ring.queueRequest(std::move(statRequest))));
+    QVERIFY(metaData.isDirectory());
+
+    QIORingRequest<QIORing::Operation::Rename> renameRequest;
+    renameRequest.oldPath = QtPrivate::toFilesystemPath(subdir);
+    renameRequest.newPath = QtPrivate::toFilesystemPath(renamed);
+    QCOMPARE(run(std::move(renameRequest)), QFileDevice::NoError);
+    QVERIFY(!QFileInfo::exists(subdir));
+
+    // Not a file:
+    QIORingRequest<QIORing::Operation::Unlink> unlinkRequest;
+    unlinkRequest.path = QtPrivate::toFilesystemPath(renamed);
+    QCOMPARE(run(std::move(unlinkRequest)), QFileDevice::RemoveError);
+
+    QIORingRequest<QIORing::Operation::Unlink> rmdirRequest;
+    rmdirRequest.path = QtPrivate::toFilesystemPath(renamed);
+    rmdirRequest.directory = true;
+    QCOMPARE(run(std::move(rmdirRequest)), QFileDevice::NoError);
+    QVERIFY(!QFileInfo::exists(renamed));
+
+    QIORingRequest<QIORing::Operation::StatPath> missingRequest;
+    missingRequest.path = QtPrivate::toFilesystemPath(renamed);
+    QCOMPARE(run(std::move(missingRequest)), QFileDevice::OpenError);
+}
+
+void tst_QIORing::allocateAndFlushRange()
+{
+    QIORing ring;
+    QVERIFY(ring.ensureInitialized());
+    if (!ring.isAvailable(QIORing::Operation::Allocate)
+        || !ring.isAvailable(QIORing::Operation::FlushRange)) {
+        QSKIP("fallocate and ranged fsync are not available on this system");
+    }
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("allocated");
+    const qintptr fd = openHelper(&ring, path, QIODevice::ReadWrite);
+    const auto closeGuard = qScopeGuard([fd] { closeFile(fd); });
+
+    QIORingRequest<QIORing::Operation::Allocate> allocateRequest;
+    allocateRequest.fd = fd;
+    allocateRequest.offset = 0;
+    allocateRequest.length = 64 * 1024;
+    bool allocated = false;
+    allocateRequest.setCallback(
+            [&allocated](const QIORingRequest<QIORing::Operation::Allocate> &request) {
+                allocated = request.result.index() == 1;
+            });
+    QVERIFY(ring.waitForRequest(ring.queueRequest(std::move(allocateRequest))));
+    if (!allocated)
+        QSKIP("The file system does not support fallocate");
+    QCOMPARE(QFileInfo(path).size(), 64 * 1024);
+
+    QIORingRequest<QIORing::Operation::FlushRange> flushRequest;
+    flushRequest.fd = fd;
+    flushRequest.offset = 4096;
+    flushRequest.length = 4096;
+    flushRequest.dataOnly = true;
+    bool flushed = false;
+    flushRequest.setCallback(
+            [&flushed](const QIORingRequest<QIORing::Operation::FlushRange> &request) {
+                flushed = request.result.index() == 1;
+            });
+    QVERIFY(ring.waitForRequest(ring.queueRequest(std::move(flushRequest))));
+    QVERIFY(flushed);
+}
+
+void tst_QIORing::linkedOpenReadClose()
+{
+    QIORing ring;
+    QVERIFY(ring.ensureInitialized());
+    const qint32 slot = ring.allocateFileSlot();
+    if (slot < 0)
+        QSKIP("Fixed files are not supported on this system");
+    const auto releaseGuard = qScopeGuard([&] { ring.releaseFileSlot(slot); });
+
+    QList<QIORing::Operation> order;
+    QIORingRequest<QIORing::Operation::Open> openRequest;
+    openRequest.path = QtPrivate::toFilesystemPath(QFINDTESTDATA("data/input.txt"));
+    openRequest.flags = QIODevice::ReadOnly;
+    openRequest.fixedFileSlot = slot;
+    openRequest.requestFlags = QIORing::RequestFlag::Link;
+    openRequest.setCallback([&](const QIORingRequest<QIORing::Operation::Open> &request) {
+        order.append(QIORing::Operation::Open);
+        const auto *result = std::get_if<QIORingResult<QIORing::Operation::Open>>(&request.result);
+        QVERIFY(result);
+        QCOMPARE(result->fd, slot);
+    });
+
+    std::array<std::byte, 32> buffer{};
+    qint64 bytesRead = -1;
+    QIORingRequest<QIORing::Operation::Read> readRequest;
+    readRequest.fd = slot;
+    readRequest.offset = 0;
+    readRequest.destination = buffer;
+    readRequest.requestFlags = QIORing::RequestFlag::FixedFile | QIORing::RequestFlag::HardLink;
+    readRequest.setCallback([&](const QIORingRequest<QIORing::Operation::Read> &request) {
+        order.append(QIORing::Operation::Read);
+        const auto *result = std::get_if<QIORingResult<QIORing::Operation::Read>>(&request.result);
+        QVERIFY(result);
+        bytesRead = result->bytesRead;
+    });
+
+    bool closed = false;
+    QIORingRequest<QIORing::Operation::Close> closeRequest;
+    closeRequest.fd = slot;
+    closeRequest.requestFlags = QIORing::RequestFlag::FixedFile;
+    closeRequest.setCallback([&](const QIORingRequest<QIORing::Operation::Close> &request) {
+        order.append(QIORing::Operation::Close);
+        closed = request.result.index() == 1;
+    });
+
+    ring.queueRequest(std::move(openRequest));
+    ring.queueRequest(std::move(readRequest));
+    QVERIFY(ring.waitForRequest(ring.queueRequest(std::move(closeRequest))));
+    // QIORing::Operation has no exported meta object, so QCOMPARE can't print it
+    QVERIFY(order == QList({ QIORing::Operation::Open, QIORing::Operation::Read,
+                             QIORing::Operation::Close }));
+    QCOMPARE(bytesRead, 11);
+    QCOMPARE(QByteArrayView(buffer.data(), bytesRead), "lorem ipsum");
+    QVERIFY(closed);
+    // The close freed the slot:
+    QCOMPARE(ring.allocateFileSlot(), slot);
+
+    // The read must not run if the open fails:
+    QIORingRequest<QIORing::Operation::Open> failingOpen;
+    failingOpen.path = QtPrivate::toFilesystemPath(QFINDTESTDATA("data") + "/nonexistent"_L1);
+    failingOpen.flags = QIODevice::ReadOnly | QIODevice::ExistingOnly;
+    failingOpen.fixedFileSlot = slot;
+    failingOpen.requestFlags = QIORing::RequestFlag::Link;
+    QIORingRequest<QIORing::Operation::Read> cancelledRead;
+    cancelledRead.fd = slot;
+    cancelledRead.offset = 0;
+    cancelledRead.destination = buffer;
+    cancelledRead.requestFlags = QIORing::RequestFlag::FixedFile;
+    QFileDevice::FileError readError = QFileDevice::NoError;
+    cancelledRead.setCallback([&](const QIORingRequest<QIORing::Operation::Read> &request) {
+        if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result))
+            readError = *err;
+    });
+    ring.queueRequest(std::move(failingOpen));
+    QVERIFY(ring.waitForRequest(ring.queueRequest(std::move(cancelledRead))));
+    QCOMPARE(readError, QFileDevice::AbortError);
+}
+
+void tst_QIORing::oversizedLinkedRead()
+{
+#if defined(Q_OS_LINUX) && defined(QT_DEBUG)
+    constexpr qsizetype ReadWriteLimit = 16;
+    QAtomicScopedValueRollback maxRWLen(QtPrivate::testMaxReadWriteLen,
+                                        ReadWriteLimit,
+                                        std::memory_order_relaxed);
+
+    QIORing ring;
+    QVERIFY(ring.ensureInitialized());
+    const qintptr fd = openHelper(&ring, QFINDTESTDATA("data/input.txt"), QIODevice::ReadOnly);
+    const auto closeGuard = qScopeGuard([fd] { closeFile(fd); });
+
+    // A linked read can't be split up, so the whole chain fails instead of
+    // reading less than requested:
+    std::array<std::byte, ReadWriteLimit + 1> buffer{};
+    QFileDevice::FileError errors[2] = {};
+    const auto storeError = [&errors](int i) {
+        return [&errors, i](const QIORingRequest<QIORing::Operation::Read> &request) {
+            if (const auto *err = std::get_if<QFileDevice::FileError>(&request.result))
+                errors[i] = *err;
+        };
+    };
+    QIORingRequest<QIORing::Operation::Read> first;
+    first.fd = fd;
+    first.offset = 0;
+    first.destination = buffer;
+    first.requestFlags = QIORing::RequestFlag::Link;
+    first.setCallback(storeError(0));
+    QIORingRequest<QIORing::Operation::Read> second;
+    second.fd = fd;
+    second.offset = 0;
+    second.destination = QSpan(buffer).first(ReadWriteLimit);
+    second.setCallback(storeError(1));
+
+    ring.queueRequest(std::move(first));
+    QVERIFY(!ring.queueRequest(std::move(second))); // completed immediately
+    QCOMPARE(errors[0], QFileDevice::ResourceError);
+    QCOMPARE(errors[1], QFileDevice::ResourceError);
+#else
+    QSKIP("This test is only relevant for debug builds on Linux");
+#endif
+}
+
+void tst_QIORing::registeredBuffers()
+{
+    QIORing ring;
+    QVERIFY(ring.ensureInitialized());
+
+    std::array<std::byte, 4096> first{};
+    std::array<std::byte, 4096> second{};
+    const QSpan<std::byte> buffers[] = { first, second };
+    const qint32 index = ring.registerBuffers(buffers);
+    if (index < 0)
+        QSKIP("Registered buffers are not supported on this system");
+    const auto unregisterGuard = qScopeGuard([&] { ring.unregisterBuffers(index, 2); });
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const qintptr fd = openHelper(&ring, dir.filePath("fixed"), QIODevice::ReadWrite);
+    const auto closeGuard = qScopeGuard([fd] { closeFile(fd); });
+
+    std::fill(second.begin(), second.end(), std::byte('q'));
+    QIORingRequest<QIORing::Operation::Write> writeRequest;
+    writeRequest.fd = fd;
+    writeRequest.offset = 0;
+    writeRequest.source = QSpan(second).first(100);
+    writeRequest.bufferIndex = index + 1;
+    qint64 written = -1;
+    writeRequest.setCallback([&](const QIORingRequest<QIORing::Operation::Write> &request) {
+        const auto *result = std::get_if<QIORingResult<QIORing::Operation::Write>>(&request.result);
+        QVERIFY(result);
+        written = result->bytesWritten;
+    });
+    QVERIFY(ring.waitForRequest(ring.queueRequest(std::move(writeRequest))));
+    QCOMPARE(written, 100);
+
+    // Read into the middle of the first buffer:
+    QIORingRequest<QIORing::Operation::Read> readRequest;
+    readRequest.fd = fd;
+    readRequest.offset = 0;
+    readRequest.destination = QSpan(first).subspan(1000, 100);
+    readRequest.bufferIndex = index;
+    qint64 bytesRead = -1;
+    readRequest.setCallback([&](const QIORingRequest<QIORing::Operation::Read> &request) {
+        const auto *result = std::get_if<QIORingResult<QIORing::Operation::Read>>(&request.result);
+        QVERIFY(result);
+        bytesRead = result->bytesRead;
+    });
+    QVERIFY(ring.waitForRequest(ring.queueRequest(std::move(readRequest))));
+    QCOMPARE(bytesRead, 100);
+    QVERIFY(std::all_of(first.begin() + 1000, first.begin() + 1100,
+                        [](std::byte b) { return b == std::byte('q'); }));
+    QCOMPARE(first[999], std::byte(0));
+}
+
 void tst_QIORing::fireAndForget()
 {
     QIORing ring;
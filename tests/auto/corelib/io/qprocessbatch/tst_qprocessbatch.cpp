@@ -0,0 +1,217 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+
+#include <QtCore/private/qprocessbatch_p.h>
+
+#include <signal.h>
+
+using namespace Qt::StringLiterals;
+using namespace std::chrono_literals;
+
+class tst_QProcessBatch : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void empty();
+    void outputAndExitCode_data();
+    void outputAndExitCode();
+    void channelModes_data();
+    void channelModes();
+    void failedToStart();
+    void crashed();
+    void workingDirectory();
+    void environment();
+    void manyProcesses();
+    void deadline();
+};
+
+static QProcessBatch::Job shell(const QString &script)
+{
+    QProcessBatch::Job job;
+    job.program = u"/bin/sh"_s;
+    job.arguments = { u"-c"_s, script };
+    return job;
+}
+
+void tst_QProcessBatch::empty()
+{
+    QVERIFY(QProcessBatch::run({}).isEmpty());
+}
+
+void tst_QProcessBatch::outputAndExitCode_data()
+{
+    QTest::addColumn<QString>("script");
+    QTest::addColumn<QByteArray>("standardOutput");
+    QTest::addColumn<QByteArray>("standardError");
+    QTest::addColumn<int>("exitCode");
+
+    QTest::newRow("silent") << u"true"_s << QByteArray() << QByteArray() << 0;
+    QTest::newRow("exit-code") << u"exit 42"_s << QByteArray() << QByteArray() << 42;
+    QTest::newRow("output") << u"echo out; echo err >&2; exit 3"_s
+                            << QByteArray("out\n") << QByteArray("err\n") << 3;
+    // more than fits in a pipe
+    QTest::newRow("large-output") << u"head -c 1000000 /dev/zero"_s
+                                  << QByteArray(1000000, '\0') << QByteArray() << 0;
+    QTest::newRow("no-input") << u"cat"_s << QByteArray() << QByteArray() << 0;
+}
+
+void tst_QProcessBatch::outputAndExitCode()
+{
+    QFETCH(QString, script);
+    QFETCH(QByteArray, standardOutput);
+    QFETCH(QByteArray, standardError);
+    QFETCH(int, exitCode);
+
+    const QProcessBatch::Job jobs[] = { shell(script) };
+    const QList<QProcessBatch::Result> results = QProcessBatch::run(jobs);
+    QCOMPARE(results.size(), 1);
+    const QProcessBatch::Result &result = results.first();
+    QCOMPARE(result.error, QProcess::UnknownError);
+    QVERIFY(result.errorString.isEmpty());
+    QVERIFY(result.processId > 0);
+    QCOMPARE(result.exitStatus, QProcess::NormalExit);
+    QCOMPARE(result.exitCode, exitCode);
+    QCOMPARE(result.standardOutput.size(), standardOutput.size());
+    QCOMPARE(result.standardOutput, standardOutput);
+    QCOMPARE(result.standardError, standardError);
+}
+
+void tst_QProcessBatch::channelModes_data()
+{
+    QTest::addColumn<QProcess::ProcessChannelMode>("mode");
+    QTest::addColumn<QByteArray>("standardOutput");
+    QTest::addColumn<QByteArray>("standardError");
+
+    QTest::newRow("separate") << QProcess::SeparateChannels
+                              << QByteArray("out\n") << QByteArray("err\n");
+    QTest::newRow("merged") << QProcess::MergedChannels
+                            << QByteArray("out\nerr\n") << QByteArray();
+    QTest::newRow("forwarded-output") << QProcess::ForwardedOutputChannel
+                                      << QByteArray() << QByteArray("err\n");
+    QTest::newRow("forwarded-error") << QProcess::ForwardedErrorChannel
+                                     << QByteArray("out\n") << QByteArray();
+}
+
+void tst_QProcessBatch::channelModes()
+{
+    QFETCH(QProcess::ProcessChannelMode, mode);
+    QFETCH(QByteArray, standardOutput);
+    QFETCH(QByteArray, standardError);
+
+    QProcessBatch::Job job = shell(u"echo out; echo err >&2"_s);
+    job.channelMode = mode;
+    const QList<QProcessBatch::Result> results = QProcessBatch::run({ &job, 1 });
+    QCOMPARE(results.first().standardOutput, standardOutput);
+    QCOMPARE(results.first().standardError, standardError);
+}
+
+void tst_QProcessBatch::failedToStart()
+{
+    QProcessBatch::Job missing;
+    missing.program = u"this-program-does-not-exist"_s;
+    QProcessBatch::Job notExecutable;
+    notExecutable.program = QDir::rootPath();
+    const QProcessBatch::Job jobs[] = { missing, shell(u"exit 7"_s), notExecutable };
+
+    const QList<QProcessBatch::Result> results = QProcessBatch::run(jobs);
+    QCOMPARE(results.size(), 3);
+    QCOMPARE(results[0].error, QProcess::FailedToStart);
+    QVERIFY(!results[0].errorString.isEmpty());
+    QCOMPARE(results[0].processId, qint64(0));
+    // the others are not affected
+    QCOMPARE(results[1].error, QProcess::UnknownError);
+    QCOMPARE(results[1].exitCode, 7);
+    QCOMPARE(results[2].error, QProcess::FailedToStart);
+}
+
+void tst_QProcessBatch::crashed()
+{
+    const QProcessBatch::Job jobs[] = { shell(u"echo before; kill -9 $$"_s) };
+    const QList<QProcessBatch::Result> results = QProcessBatch::run(jobs);
+    const QProcessBatch::Result &result = results.first();
+    QCOMPARE(result.error, QProcess::Crashed);
+    QCOMPARE(result.exitStatus, QProcess::CrashExit);
+    QCOMPARE(result.exitCode, SIGKILL);
+    QCOMPARE(result.standardOutput, "before\n");
+}
+
+void tst_QProcessBatch::workingDirectory()
+{
+    QTemporaryDir dir;
+    QVERIFY2(dir.isValid(), qPrintable(dir.errorString()));
+
+    QProcessBatch::Job job = shell(u"pwd -P"_s);
+    job.workingDirectory = dir.path();
+    QProcessBatch::Job missing = job;
+    missing.workingDirectory = dir.filePath(u"missing"_s);
+    const QProcessBatch::Job jobs[] = { job, missing };
+
+    const QList<QProcessBatch::Result> results = QProcessBatch::run(jobs);
+    QCOMPARE(results[0].error, QProcess::UnknownError);
+    QCOMPARE(QString::fromLocal8Bit(results[0].standardOutput).trimmed(),
+             QDir(dir.path()).canonicalPath());
+    QCOMPARE(results[1].error, QProcess::FailedToStart);
+}
+
+void tst_QProcessBatch::environment()
+{
+    QProcessBatch::Job job = shell(u"echo \"$QPROCESSBATCH_TEST\""_s);
+    job.environment = QProcessEnvironment::systemEnvironment();
+    job.environment.insert(u"QPROCESSBATCH_TEST"_s, u"first"_s);
+    QProcessBatch::Job other = job;
+    other.environment.insert(u"QPROCESSBATCH_TEST"_s, u"second"_s);
+    const QProcessBatch::Job jobs[] = { job, job, other, shell(u"echo \"$QPROCESSBATCH_TEST\""_s) };
+
+    const QList<QProcessBatch::Result> results = QProcessBatch::run(jobs);
+    QCOMPARE(results[0].standardOutput, "first\n");
+    QCOMPARE(results[1].standardOutput, "first\n");
+    QCOMPARE(results[2].standardOutput, "second\n");
+    // inherited
+    QCOMPARE(results[3].standardOutput, qgetenv("QPROCESSBATCH_TEST") + '\n');
+}
+
+void tst_QProcessBatch::manyProcesses()
+{
+    QList<QProcessBatch::Job> jobs;
+    for (int i = 0; i < 200; ++i)
+        jobs.append(shell(u"echo %1; exit %2"_s.arg(i).arg(i % 7)));
+
+    const QList<QProcessBatch::Result> results = QProcessBatch::run(jobs, 8);
+    QCOMPARE(results.size(), jobs.size());
+    for (int i = 0; i < results.size(); ++i) {
+        QCOMPARE(results[i].error, QProcess::UnknownError);
+        QCOMPARE(results[i].exitCode, i % 7);
+        QCOMPARE(results[i].standardOutput, QByteArray::number(i) + '\n');
+    }
+}
+
+void tst_QProcessBatch::deadline()
+{
+    const QProcessBatch::Job jobs[] = { shell(u"echo fast"_s), shell(u"sleep 60"_s),
+                                        shell(u"sleep 60"_s), shell(u"true"_s) };
+
+    QElapsedTimer timer;
+    timer.start();
+    const QList<QProcessBatch::Result> results = QProcessBatch::run(jobs, 2, QDeadlineTimer(500ms));
+    QCOMPARE_LT(timer.durationElapsed(), 30s);
+
+    QCOMPARE(results[0].error, QProcess::UnknownError);
+    QCOMPARE(results[0].standardOutput, "fast\n");
+    // killed
+    QCOMPARE(results[1].error, QProcess::Timedout);
+    QCOMPARE(results[1].exitStatus, QProcess::CrashExit);
+    QVERIFY(results[1].processId > 0);
+    QCOMPARE(results[2].error, QProcess::Timedout);
+    // never started, as the other two were still running
+    QCOMPARE(results[3].error, QProcess::Timedout);
+    QCOMPARE(results[3].processId, qint64(0));
+}
+
+QTEST_MAIN(tst_QProcessBatch)
+#include "tst_qprocessbatch.moc"
@@ -732,6 +732,133 @@ void tst_QCoreApplication::deliverInDefinedOrder()
     QObject::connect(&obj, SIGNAL(done()), &app, SLOT(quit()));
     app.exec();
 }
+
+// An event carrying the same payload as the queued calls below.
+class SequenceEvent : public QEvent
+{
+public:
+    SequenceEvent(int producer, int sequence)
+        : QEvent(QEvent::User), producer(producer), sequence(sequence)
+    {}
+    int producer;
+    int sequence;
+};
+
+class SequenceReceiver : public QObject
+{
+public:
+    void record(int producer, int sequence)
+    {
+        if (sequence != lastSequence.value(producer, -1) + 1)
+            ++outOfOrder;
+        lastSequence[producer] = sequence;
+        ++received;
+    }
+
+    QHash<int, int> lastSequence;
+    int outOfOrder = 0;
+    int received = 0;
+
+protected:
+    bool event(QEvent *e) override
+    {
+        if (e->type() != QEvent::User)
+            return QObject::event(e);
+        const auto *se = static_cast<SequenceEvent *>(e);
+        record(se->producer, se->sequence);
+        return true;
+    }
+};
+
+void tst_QCoreApplication::queuedCallsFromThreads()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    // Queued calls and other events from the same thread must arrive in the
+    // order they were posted, even though they take different paths.
+    constexpr int Producers = 4;
+    constexpr int PostsPerProducer = 5000;
+    SequenceReceiver receiver;
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int producer = 0; producer < Producers; ++producer) {
+        threads.emplace_back(QThread::create([&receiver, producer] {
+            for (int sequence = 0; sequence < PostsPerProducer; ++sequence) {
+                if (sequence % 7 == 0) {
+                    QCoreApplication::postEvent(&receiver, new SequenceEvent(producer, sequence));
+                } else {
+                    QMetaObject::invokeMethod(&receiver, [&receiver, producer, sequence] {
+                        receiver.record(producer, sequence);
+                    }, Qt::QueuedConnection);
+                }
+            }
+        }));
+        threads.back()->start();
+    }
+
+    QTRY_COMPARE_WITH_TIMEOUT(receiver.received, Producers * PostsPerProducer, 60s);
+    for (const auto &thread : threads)
+        QVERIFY(thread->wait());
+    QCOMPARE(receiver.outOfOrder, 0);
+}
+
+void tst_QCoreApplication::removePostedQueuedCalls()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    SequenceReceiver receiver;
+    std::unique_ptr<QThread> thread(QThread::create([&receiver] {
+        for (int sequence = 0; sequence < 10; ++sequence) {
+            QMetaObject::invokeMethod(&receiver, [&receiver, sequence] {
+                receiver.record(0, sequence);
+            }, Qt::QueuedConnection);
+        }
+        QCoreApplication::postEvent(&receiver, new SequenceEvent(0, 10));
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+
+    QCoreApplication::removePostedEvents(&receiver, QEvent::MetaCall);
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(receiver.received, 1);
+    QCOMPARE(receiver.lastSequence.value(0), 10);
+}
+
+void tst_QCoreApplication::queuedCallsFollowMovedObject()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    SequenceReceiver receiver;
+    QThread *deliveryThread = nullptr;
+    std::unique_ptr<QThread> producer(QThread::create([&] {
+        for (int sequence = 0; sequence < 10; ++sequence) {
+            QMetaObject::invokeMethod(&receiver, [&, sequence] {
+                deliveryThread = QThread::currentThread();
+                receiver.record(0, sequence);
+            }, Qt::QueuedConnection);
+        }
+    }));
+    producer->start();
+    QVERIFY(producer->wait());
+
+    QThread target;
+    target.start();
+    receiver.moveToThread(&target);
+
+    QTRY_COMPARE(receiver.received, 10);
+    QCOMPARE(deliveryThread, &target);
+    QCOMPARE(receiver.outOfOrder, 0);
+
+    QMetaObject::invokeMethod(&receiver, [&] { receiver.moveToThread(app.thread()); },
+                              Qt::BlockingQueuedConnection);
+    target.quit();
+    QVERIFY(target.wait());
+}
 #endif // QT_CONFIG(thread)
 
 void tst_QCoreApplication::applicationPid()
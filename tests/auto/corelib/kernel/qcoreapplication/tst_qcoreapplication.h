@@ -28,6 +28,9 @@ private slots:
     void removePostedEvents();
 #if QT_CONFIG(thread)
     void deliverInDefinedOrder();
+    void queuedCallsFromThreads();
+    void removePostedQueuedCalls();
+    void queuedCallsFollowMovedObject();
 #endif
     void applicationPid();
 #ifdef QT_BUILD_INTERNAL
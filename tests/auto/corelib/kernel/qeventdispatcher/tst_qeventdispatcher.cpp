@@ -19,6 +19,13 @@ static bool glibDisabled = []() {
 }();
 #endif
 
+#ifdef USE_EPOLL
+static bool epollEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER", "epoll");
+    return true;
+}();
+#endif
+
 #include <chrono>
 
 #ifndef QTEST_THROW_ON_FAIL
@@ -457,10 +464,11 @@ void tst_QEventDispatcher::postEventFromEventHandler()
 
     const QByteArrayView eventDispatcherName(QAbstractEventDispatcher::instance()->metaObject()->className());
     qDebug() << eventDispatcherName;
-    // QXcbUnixEventDispatcher and QEventDispatcherUNIX do not do this correctly on any platform;
-    // both Windows event dispatchers fail as well.
+    // QXcbUnixEventDispatcher, QEventDispatcherUNIX and QEventDispatcherEpoll do not do this
+    // correctly on any platform; both Windows event dispatchers fail as well.
     const bool knownToFail = eventDispatcherName.contains("UNIX")
                           || eventDispatcherName.contains("Unix")
+                          || eventDispatcherName.contains("Epoll")
                           || eventDispatcherName.contains("Win32")
                           || eventDispatcherName.contains("WindowsGui")
                           || eventDispatcherName.contains("Android");
@@ -0,0 +1,200 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qthread.h>
+#include <QtCore/private/qeventpool_p.h>
+
+#include <algorithm>
+#include <memory>
+
+using namespace std::chrono_literals;
+
+class tst_QEventPool : public QObject
+{
+    Q_OBJECT
+private slots:
+    void crossThreadFree();
+    void freeAfterThreadExit();
+    void exhaustionFallsBackToHeap();
+    void largeObjects();
+    void queuedCalls();
+};
+
+static constexpr size_t ObjectSize = 64;
+static constexpr int Count = 100;
+
+static quint64 heapAllocationsSince(const QEventPool::Counters &before)
+{
+    return QEventPool::counters().heapAllocations - before.heapAllocations;
+}
+
+void tst_QEventPool::crossThreadFree()
+{
+    // Blocks allocated by a thread and freed by another one go back to the
+    // allocating thread, which reuses them instead of going to the heap.
+    QList<void *> first;
+    QList<void *> second;
+    quint64 secondHeapAllocations = ~quint64(0);
+    QSemaphore allocated;
+    QSemaphore freed;
+
+    std::unique_ptr<QThread> thread(QThread::create([&] {
+        for (int i = 0; i < Count; ++i)
+            first.append(QEventPool::allocate(ObjectSize));
+        allocated.release();
+        freed.acquire();
+
+        const QEventPool::Counters before = QEventPool::counters();
+        for (int i = 0; i < Count; ++i)
+            second.append(QEventPool::allocate(ObjectSize));
+        secondHeapAllocations = heapAllocationsSince(before);
+        for (void *ptr : std::as_const(second))
+            QEventPool::deallocate(ptr, ObjectSize);
+    }));
+    thread->start();
+
+    QVERIFY(allocated.tryAcquire(1, 10s));
+    for (void *ptr : std::as_const(first))
+        QEventPool::deallocate(ptr, ObjectSize);
+    freed.release();
+    QVERIFY(thread->wait(10s));
+
+    QCOMPARE(secondHeapAllocations, quint64(0));
+    std::sort(first.begin(), first.end());
+    std::sort(second.begin(), second.end());
+    QCOMPARE(second, first);
+}
+
+void tst_QEventPool::freeAfterThreadExit()
+{
+    // The pool of an exited thread stays alive until its last block is
+    // freed. Some blocks are freed while the thread runs, some after it
+    // exited, and some by yet another thread.
+    const QEventPool::Counters before = QEventPool::counters();
+    QList<void *> blocks;
+    QSemaphore allocated;
+    QSemaphore freed;
+
+    std::unique_ptr<QThread> thread(QThread::create([&] {
+        for (int i = 0; i < 3 * Count; ++i)
+            blocks.append(QEventPool::allocate(ObjectSize));
+        allocated.release();
+        freed.acquire();
+    }));
+    thread->start();
+
+    QVERIFY(allocated.tryAcquire(1, 10s));
+    for (int i = 0; i < Count; ++i)
+        QEventPool::deallocate(blocks.at(i), ObjectSize);
+    freed.release();
+    QVERIFY(thread->wait(10s));
+
+    // the counters of the exited thread are kept
+    const QEventPool::Counters after = QEventPool::counters();
+    QCOMPARE(after.allocations - before.allocations, quint64(3 * Count));
+
+    for (int i = Count; i < 2 * Count; ++i)
+        QEventPool::deallocate(blocks.at(i), ObjectSize);
+
+    std::unique_ptr<QThread> other(QThread::create([&] {
+        for (int i = 2 * Count; i < 3 * Count; ++i)
+            QEventPool::deallocate(blocks.at(i), ObjectSize);
+    }));
+    other->start();
+    QVERIFY(other->wait(10s));
+}
+
+void tst_QEventPool::exhaustionFallsBackToHeap()
+{
+    // A thread starts without free blocks and keeps at most MaxCachedBlocks
+    // of them, so the allocations beyond that go to the heap again.
+    constexpr int Extra = 16;
+    constexpr int Total = QEventPool::MaxCachedBlocks + Extra;
+    quint64 firstHeapAllocations = 0;
+    quint64 secondHeapAllocations = 0;
+
+    std::unique_ptr<QThread> thread(QThread::create([&] {
+        QList<void *> blocks;
+        blocks.reserve(Total);
+
+        QEventPool::Counters before = QEventPool::counters();
+        for (int i = 0; i < Total; ++i)
+            blocks.append(QEventPool::allocate(ObjectSize));
+        firstHeapAllocations = heapAllocationsSince(before);
+        for (void *ptr : std::as_const(blocks))
+            QEventPool::deallocate(ptr, ObjectSize);
+        blocks.clear();
+
+        before = QEventPool::counters();
+        for (int i = 0; i < Total; ++i)
+            blocks.append(QEventPool::allocate(ObjectSize));
+        secondHeapAllocations = heapAllocationsSince(before);
+        for (void *ptr : std::as_const(blocks))
+            QEventPool::deallocate(ptr, ObjectSize);
+    }));
+    thread->start();
+    QVERIFY(thread->wait(10s));
+
+    QCOMPARE(firstHeapAllocations, quint64(Total));
+    QCOMPARE(secondHeapAllocations, quint64(Extra));
+}
+
+void tst_QEventPool::largeObjects()
+{
+    // objects that don't fit into a block always come from the heap
+    const QEventPool::Counters before = QEventPool::counters();
+    for (int i = 0; i < 2; ++i) {
+        void *ptr = QEventPool::allocate(QEventPool::MaxObjectSize + 1);
+        QVERIFY(ptr);
+        memset(ptr, 0xcc, QEventPool::MaxObjectSize + 1);
+        QEventPool::deallocate(ptr, QEventPool::MaxObjectSize + 1);
+    }
+    const QEventPool::Counters after = QEventPool::counters();
+    QCOMPARE(after.allocations - before.allocations, quint64(2));
+    QCOMPARE(after.heapAllocations - before.heapAllocations, quint64(2));
+
+    void *ptr = QEventPool::allocate(QEventPool::MaxObjectSize);
+    memset(ptr, 0xcc, QEventPool::MaxObjectSize);
+    QEventPool::deallocate(ptr, QEventPool::MaxObjectSize);
+}
+
+void tst_QEventPool::queuedCalls()
+{
+    // The events of queued calls from a worker thread to this one are
+    // allocated by the worker and freed here. Once they went around, the
+    // worker doesn't need the heap for them anymore.
+    QObject receiver;
+    int calls = 0;
+    quint64 secondHeapAllocations = ~quint64(0);
+    QSemaphore posted;
+    QSemaphore delivered;
+
+    std::unique_ptr<QThread> thread(QThread::create([&] {
+        for (int i = 0; i < Count; ++i)
+            QMetaObject::invokeMethod(&receiver, [&] { ++calls; }, Qt::QueuedConnection);
+        posted.release();
+        delivered.acquire();
+
+        const QEventPool::Counters before = QEventPool::counters();
+        for (int i = 0; i < Count; ++i)
+            QMetaObject::invokeMethod(&receiver, [&] { ++calls; }, Qt::QueuedConnection);
+        secondHeapAllocations = heapAllocationsSince(before);
+        posted.release();
+    }));
+    thread->start();
+
+    QVERIFY(posted.tryAcquire(1, 10s));
+    QTRY_COMPARE(calls, Count);
+    delivered.release();
+    QVERIFY(posted.tryAcquire(1, 10s));
+    QTRY_COMPARE(calls, 2 * Count);
+    QVERIFY(thread->wait(10s));
+
+    QCOMPARE(secondHeapAllocations, quint64(0));
+}
+
+QTEST_MAIN(tst_QEventPool)
+
+#include "tst_qeventpool.moc"
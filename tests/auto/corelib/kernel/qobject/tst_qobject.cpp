@@ -161,6 +161,11 @@ private slots:
     void disconnectQueuedConnection_pendingEventsAreDelivered();
     void timerWithNegativeInterval();
     void emptyQueuedMetaCallEvent();
+    void emitBatch();
+    void emitBatchQueued();
+    void emitBatchSingleShot();
+    void emitBatchReceiverDeleted();
+    void emitBatchAcrossThreads();
 };
 
 struct QObjectCreatedOnShutdown
@@ -9123,5 +9128,206 @@ void tst_QObject::emptyQueuedMetaCallEvent()
 #endif
 }
 
+class BatchSender : public QObject
+{
+    Q_OBJECT
+signals:
+    void valueChanged(int value, const QString &text);
+};
+
+class BatchReceiver : public QObject
+{
+    Q_OBJECT
+public:
+    QList<std::pair<int, QString>> received;
+    int metaCallEvents = 0;
+
+public slots:
+    void onValueChanged(int value, const QString &text) { received.emplaceBack(value, text); }
+
+protected:
+    bool event(QEvent *e) override
+    {
+        if (e->type() == QEvent::MetaCall)
+            ++metaCallEvents;
+        return QObject::event(e);
+    }
+};
+
+static QList<std::tuple<int, QString>> makeBatch(int size)
+{
+    QList<std::tuple<int, QString>> batch;
+    for (int i = 0; i < size; ++i)
+        batch.emplaceBack(i, QString::number(i * 10));
+    return batch;
+}
+
+static QList<std::pair<int, QString>> expectedBatch(int size)
+{
+    QList<std::pair<int, QString>> expected;
+    for (int i = 0; i < size; ++i)
+        expected.emplaceBack(i, QString::number(i * 10));
+    return expected;
+}
+
+void tst_QObject::emitBatch()
+{
+    BatchSender sender;
+    BatchReceiver receiver;
+    QList<int> functorValues;
+    QList<qsizetype> receivedBeforeFunctor;
+    connect(&sender, &BatchSender::valueChanged, &receiver, &BatchReceiver::onValueChanged);
+    connect(&sender, &BatchSender::valueChanged, &receiver, [&](int value) {
+        functorValues.append(value);
+        receivedBeforeFunctor.append(receiver.received.size());
+    });
+
+    const auto batch = makeBatch(3);
+    QObject::emitBatch(&sender, &BatchSender::valueChanged, batch);
+    QCOMPARE(receiver.received, expectedBatch(3));
+    QCOMPARE(functorValues, QList<int>({ 0, 1, 2 }));
+    // every slot sees the whole batch before the next one is invoked
+    QCOMPARE(receivedBeforeFunctor, QList<qsizetype>({ 3, 3, 3 }));
+
+    // nothing is emitted for an empty batch
+    QObject::emitBatch(&sender, &BatchSender::valueChanged, {});
+    QCOMPARE(receiver.received.size(), 3);
+
+    // nor when signals are blocked
+    {
+        QSignalBlocker blocker(&sender);
+        QObject::emitBatch(&sender, &BatchSender::valueChanged, batch);
+    }
+    QCOMPARE(receiver.received.size(), 3);
+    QCOMPARE(functorValues.size(), 3);
+
+    // a batch emission is a regular emission for old-style connections
+    BatchReceiver stringReceiver;
+    connect(&sender, SIGNAL(valueChanged(int,QString)), &stringReceiver, SLOT(onValueChanged(int,QString)));
+    QObject::emitBatch(&sender, &BatchSender::valueChanged, batch);
+    QCOMPARE(stringReceiver.received, expectedBatch(3));
+    QCOMPARE(stringReceiver.metaCallEvents, 0);
+}
+
+void tst_QObject::emitBatchQueued()
+{
+    BatchSender sender;
+    BatchReceiver receiver;
+    BatchReceiver stringReceiver;
+    connect(&sender, &BatchSender::valueChanged, &receiver, &BatchReceiver::onValueChanged,
+            Qt::QueuedConnection);
+    connect(&sender, SIGNAL(valueChanged(int,QString)), &stringReceiver,
+            SLOT(onValueChanged(int,QString)), Qt::QueuedConnection);
+
+    {
+        const auto batch = makeBatch(100);
+        QObject::emitBatch(&sender, &BatchSender::valueChanged, batch);
+        // the argument values are copied; the batch goes out of scope before delivery
+    }
+    QVERIFY(receiver.received.isEmpty());
+    QVERIFY(stringReceiver.received.isEmpty());
+
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(receiver.received, expectedBatch(100));
+    QCOMPARE(stringReceiver.received, expectedBatch(100));
+    // one event per receiver carries the whole batch
+    QCOMPARE(receiver.metaCallEvents, 1);
+    QCOMPARE(stringReceiver.metaCallEvents, 1);
+
+    // an undelivered batch is destroyed along with its receiver
+    {
+        BatchReceiver doomed;
+        connect(&sender, &BatchSender::valueChanged, &doomed, &BatchReceiver::onValueChanged,
+                Qt::QueuedConnection);
+        QObject::emitBatch(&sender, &BatchSender::valueChanged, makeBatch(10));
+    }
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(receiver.received.size(), 110);
+}
+
+void tst_QObject::emitBatchSingleShot()
+{
+    BatchSender sender;
+    BatchReceiver direct;
+    BatchReceiver queued;
+    connect(&sender, &BatchSender::valueChanged, &direct, &BatchReceiver::onValueChanged,
+            Qt::SingleShotConnection);
+    connect(&sender, &BatchSender::valueChanged, &queued, &BatchReceiver::onValueChanged,
+            static_cast<Qt::ConnectionType>(Qt::QueuedConnection | Qt::SingleShotConnection));
+
+    const auto batch = makeBatch(5);
+    QObject::emitBatch(&sender, &BatchSender::valueChanged, batch);
+    QCOMPARE(direct.received, expectedBatch(1));
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(queued.received, expectedBatch(1));
+
+    QObject::emitBatch(&sender, &BatchSender::valueChanged, batch);
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(direct.received.size(), 1);
+    QCOMPARE(queued.received.size(), 1);
+}
+
+void tst_QObject::emitBatchReceiverDeleted()
+{
+    for (Qt::ConnectionType type : { Qt::DirectConnection, Qt::QueuedConnection }) {
+        BatchSender sender;
+        auto receiver = new BatchReceiver;
+        QPointer<BatchReceiver> guard(receiver);
+        int calls = 0;
+        connect(&sender, &BatchSender::valueChanged, receiver, [&](int value) {
+            ++calls;
+            if (value == 1)
+                delete receiver;
+        }, type);
+
+        QObject::emitBatch(&sender, &BatchSender::valueChanged, makeBatch(5));
+        QCoreApplication::sendPostedEvents();
+        QVERIFY(!guard);
+        QCOMPARE(calls, 2);
+    }
+
+    // a slot disconnecting itself stops the rest of the batch
+    BatchSender sender;
+    BatchReceiver receiver;
+    int calls = 0;
+    QMetaObject::Connection connection;
+    connection = connect(&sender, &BatchSender::valueChanged, &receiver, [&](int value) {
+        ++calls;
+        if (value == 2)
+            QObject::disconnect(connection);
+    });
+    QObject::emitBatch(&sender, &BatchSender::valueChanged, makeBatch(5));
+    QCOMPARE(calls, 3);
+}
+
+void tst_QObject::emitBatchAcrossThreads()
+{
+    QThread thread;
+    thread.start();
+    auto cleanup = qScopeGuard([&thread] {
+        thread.quit();
+        thread.wait();
+    });
+
+    BatchSender sender;
+    BatchReceiver queued;
+    BatchReceiver blocking;
+    queued.moveToThread(&thread);
+    blocking.moveToThread(&thread);
+    connect(&sender, &BatchSender::valueChanged, &queued, &BatchReceiver::onValueChanged);
+    connect(&sender, &BatchSender::valueChanged, &blocking, &BatchReceiver::onValueChanged,
+            Qt::BlockingQueuedConnection);
+
+    QObject::emitBatch(&sender, &BatchSender::valueChanged, makeBatch(50));
+    // blocking queued connections have delivered the batch when emitBatch() returns
+    QCOMPARE(blocking.received, expectedBatch(50));
+
+    // flush the receiver thread's queue
+    QMetaObject::invokeMethod(&queued, [] {}, Qt::BlockingQueuedConnection);
+    QCOMPARE(queued.received, expectedBatch(50));
+    QCOMPARE(queued.metaCallEvents, 2);
+    QCOMPARE(blocking.metaCallEvents, 1);
+}
+
 QTEST_MAIN(tst_QObject)
 #include "tst_qobject.moc"
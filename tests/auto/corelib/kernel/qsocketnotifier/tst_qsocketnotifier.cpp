@@ -19,6 +19,13 @@
 #endif
 #include <limits>
 
+#ifdef USE_EPOLL
+static bool epollEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER", "epoll");
+    return true;
+}();
+#endif
+
 #if defined (Q_CC_MSVC) && defined(max)
 #  undef max
 #  undef min
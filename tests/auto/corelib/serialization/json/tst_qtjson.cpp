@@ -5,6 +5,7 @@
 #include <QTest>
 #include <QtTest/private/qcomparisontesthelper_p.h>
 #include <QMap>
+#include <QRandomGenerator>
 #include <QVariantList>
 
 QT_WARNING_DISABLE_DEPRECATED
@@ -97,7 +98,10 @@ private Q_SLOTS:
     void fromJson();
     void fromJsonErrors();
     void parseNumbers();
+    void parseNumberConversions_data();
+    void parseNumberConversions();
     void parseStrings();
+    void parseStringBoundaries();
     void parseDuplicateKeys();
     void parseTopLevel_data();
     void parseTopLevel();
@@ -2775,6 +2779,100 @@ void tst_QtJson::parseNumbers()
     }
 }
 
+void tst_QtJson::parseNumberConversions_data()
+{
+    QTest::addColumn<QByteArray>("number");
+
+    const char *numbers[] = {
+        // from the JSON benchmark's numbers.json
+        "1234567890", "-9876.543210", "0.123456789e-12", "1.234567890E+34", "23456789012E66",
+        // integers around the limits of the direct conversion
+        "-0", "123456789012345678", "-123456789012345678", "1234567890123456789",
+        "9007199254740993", "9223372036854775807", "-9223372036854775808",
+        "9223372036854775808", "18446744073709551616", "123456789012345678901234567890",
+        // decimals around the limits of the direct conversion
+        "0.1", "0.3", "-0.0", "4.35", "1.0", "100.000", "1e22", "1e23", "1e-22", "1e-23",
+        "9007199254740992e-10", "9007199254740993e-10", "0.000000000000000000001",
+        "1.7976931348623157e308", "2.2250738585072014e-308", "4.9e-324", "1e0001",
+        "12345678901234567890.5", "0.1234567890123456789", "3.141592653589793238462643",
+    };
+    for (const char *number : numbers)
+        QTest::newRow(number) << QByteArray(number);
+
+    // a sweep of round-trippable and shortest representations
+    QRandomGenerator rng(0x5eed);
+    for (int i = 0; i < 200; ++i) {
+        const double d = std::ldexp(rng.generateDouble() - 0.5, rng.bounded(-80, 80));
+        const QByteArray full = QByteArray::number(d, 'g', 17);
+        const QByteArray shortest = QByteArray::number(d, 'g', QLocale::FloatingPointShortest);
+        const QByteArray fixed = QByteArray::number(d, 'f', rng.bounded(0, 12));
+        QTest::addRow("random-%d-full", i) << full;
+        QTest::addRow("random-%d-shortest", i) << shortest;
+        QTest::addRow("random-%d-fixed", i) << fixed;
+    }
+}
+
+void tst_QtJson::parseNumberConversions()
+{
+    QFETCH(QByteArray, number);
+
+    // The parser must give exactly the same result as QByteArray's conversions
+    QJsonValue expected;
+    bool ok;
+    if (const qint64 n = number.toLongLong(&ok); ok)
+        expected = QJsonValue(n);
+    else if (const double d = number.toDouble(&ok); ok)
+        expected = QJsonValue(d);
+    QVERIFY(!expected.isUndefined());
+
+    const QJsonValue val = QJsonValue::fromJson(number);
+    QCOMPARE(val.type(), QJsonValue::Double);
+    QCOMPARE(val.toInteger(-1), expected.toInteger(-1));
+    const double actual = val.toDouble();
+    const double reference = expected.toDouble();
+    QVERIFY2(memcmp(&actual, &reference, sizeof(double)) == 0,
+             QByteArray::number(actual, 'g', 17) + " != " + QByteArray::number(reference, 'g', 17));
+    QCOMPARE(QJsonValue::fromJson("[" + number + "]").toArray().at(0), val);
+}
+
+void tst_QtJson::parseStringBoundaries()
+{
+    // Place quotes, escapes, non-ASCII characters and whitespace at each offset
+    // around the boundaries of the vectorized scanners
+    for (qsizetype length = 0; length < 80; ++length) {
+        for (qsizetype pos = 0; pos <= length; ++pos) {
+            const QByteArray prefix(pos, 'a');
+            const QByteArray suffix(length - pos, 'b');
+            const QByteArray whitespace = QByteArray(pos, ' ') + QByteArray(length - pos, '\n');
+
+            const QByteArray plain = '"' + prefix + suffix + '"';
+            QCOMPARE(QJsonValue::fromJson(whitespace + plain + whitespace).toString(),
+                     QLatin1StringView(prefix + suffix));
+
+            const QByteArray escaped = '"' + prefix + "\\\"" + suffix + '"';
+            QCOMPARE(QJsonValue::fromJson(escaped).toString(),
+                     QLatin1StringView(prefix + '"' + suffix));
+
+            const QByteArray nonAscii = '"' + prefix + UNICODE_DJE + suffix + '"';
+            QCOMPARE(QJsonValue::fromJson(nonAscii).toString(),
+                     QString::fromUtf8(prefix + UNICODE_DJE + suffix));
+
+            const QByteArray mixed = '"' + prefix + UNICODE_DJE "\\t" + suffix + '"';
+            QCOMPARE(QJsonValue::fromJson(mixed).toString(),
+                     QString::fromUtf8(prefix + UNICODE_DJE "\t" + suffix));
+
+            QJsonParseError error;
+            const QByteArray invalid = '"' + prefix + INVALID_UNICODE + suffix + '"';
+            QVERIFY(QJsonValue::fromJson(invalid, &error).isUndefined());
+            QCOMPARE(error.error, QJsonParseError::IllegalUTF8String);
+
+            const QByteArray unterminated = '"' + prefix + suffix;
+            QVERIFY(QJsonValue::fromJson(unterminated, &error).isUndefined());
+            QCOMPARE(error.error, QJsonParseError::UnterminatedString);
+        }
+    }
+}
+
 void tst_QtJson::parseStrings()
 {
     const char *strings [] =
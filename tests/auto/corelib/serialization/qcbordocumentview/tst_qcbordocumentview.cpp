@@ -0,0 +1,378 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QCborArray>
+#include <QCborDocumentView>
+#include <QCborMap>
+#include <QCborValue>
+#include <QDateTime>
+#include <QUrl>
+
+using namespace Qt::StringLiterals;
+
+class tst_QCborDocumentView : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void toCborValue_data();
+    void toCborValue();
+    void errors_data();
+    void errors();
+    void lookup();
+    void integerKeys();
+    void integersOutOfRange();
+    void duplicateKeys();
+    void iteration();
+    void tags();
+    void strings_data();
+    void strings();
+    void simpleTypes();
+    void rawData();
+};
+
+template <size_t N> static QByteArray raw(const char (&data)[N])
+{
+    return QByteArray::fromRawData(data, N - 1);
+}
+
+static QByteArray largeDocument()
+{
+    QCborArray array;
+    for (int i = 0; i < 5000; ++i) {
+        QCborMap map;
+        map[u"id"_s] = i;
+        map[u"name"_s] = u"item %1 é中"_s.arg(i);
+        map[u"value"_s] = i / 7.0;
+        map[u"bytes"_s] = QByteArray::number(i);
+        map[i] = QCborArray{ u"a"_s, true, nullptr, QCborValue() };
+        map[u"nested"_s] = QCborMap{ { u"x"_s, QCborArray{ 1, 2, QCborArray{} } } };
+        array.append(map);
+    }
+    return QCborValue(array).toCbor();
+}
+
+void tst_QCborDocumentView::toCborValue_data()
+{
+    QTest::addColumn<QByteArray>("cbor");
+
+    QTest::newRow("integer") << raw("\x18\x2a");
+    QTest::newRow("negative") << raw("\x38\x63");
+    QTest::newRow("uint64-max") << raw("\x1b\xff\xff\xff\xff\xff\xff\xff\xff");
+    QTest::newRow("nint64-min") << raw("\x3b\x80\0\0\0\0\0\0\0");
+    QTest::newRow("qint64-min") << raw("\x3b\x7f\xff\xff\xff\xff\xff\xff\xff");
+    QTest::newRow("half") << raw("\xf9\x3e\x00");
+    QTest::newRow("float") << raw("\xfa\x3f\xc0\0\0");
+    QTest::newRow("double") << raw("\xfb\x3f\xf8\0\0\0\0\0\0");
+    QTest::newRow("false") << raw("\xf4");
+    QTest::newRow("null") << raw("\xf6");
+    QTest::newRow("undefined") << raw("\xf7");
+    QTest::newRow("simple-type") << raw("\xf8\xff");
+    QTest::newRow("bytearray") << raw("\x43" "abc");
+    QTest::newRow("string") << raw("\x63" "abc");
+    QTest::newRow("string-utf8") << raw("\x62\xc3\xa9");
+    QTest::newRow("chunked-bytearray") << raw("\x5f\x41z\x40\x42yx\xff");
+    QTest::newRow("chunked-string") << raw("\x7f\x61z\x62\xc3\xa9\xff");
+    QTest::newRow("empty-array") << raw("\x80");
+    QTest::newRow("indefinite-array") << raw("\x9f\x01\x9f\xff\xff");
+    QTest::newRow("map") << raw("\xa2\x61" "a\x01\x02\x80");
+    QTest::newRow("indefinite-map") << raw("\xbf\x61" "a\x01\xff");
+    QTest::newRow("tag") << raw("\xc1\x1a\x5a\x0a\x5a\x0a");
+    QTest::newRow("unknown-tag") << raw("\xd9\x12\x34\x01");
+    QTest::newRow("nested-tags") << raw("\xd8\x20\xd8\x21\x60");
+    QTest::newRow("large") << largeDocument();
+}
+
+void tst_QCborDocumentView::toCborValue()
+{
+    QFETCH(QByteArray, cbor);
+
+    QCborParserError expectedError;
+    const QCborValue expected = QCborValue::fromCbor(cbor, &expectedError);
+    QCOMPARE(expectedError.error, QCborError::NoError);
+
+    QCborParserError error;
+    const QCborDocumentView document = QCborDocumentView::fromCbor(cbor, &error);
+    QCOMPARE(error.error, QCborError::NoError);
+    QCOMPARE(error.offset, cbor.size());
+    QVERIFY(!document.isNull());
+    QCOMPARE(document.value().toCborValue(), expected);
+    QCOMPARE(document.value().isContainer(), expected.isContainer());
+    QCOMPARE(document.value().size(), expected.isArray() ? expected.toArray().size()
+                                      : expected.isMap() ? expected.toMap().size() : 0);
+    if (!expected.isTag()) {
+        QCOMPARE(document.value().type(), expected.type());
+        QCOMPARE(document.value().toInteger(-1), expected.toInteger(-1));
+        QCOMPARE(document.value().toDouble(-1), expected.toDouble(-1));
+    }
+}
+
+void tst_QCborDocumentView::errors_data()
+{
+    QTest::addColumn<QByteArray>("cbor");
+    QTest::addColumn<QCborError>("error");
+    QTest::addColumn<int>("offset");
+
+    QTest::newRow("empty") << QByteArray() << QCborError{ QCborError::EndOfFile } << 0;
+    QTest::newRow("truncated-integer") << raw("\x19\x01")
+                                       << QCborError{ QCborError::EndOfFile } << 0;
+    QTest::newRow("truncated-string") << raw("\x63" "ab") << QCborError{ QCborError::EndOfFile } << 0;
+    QTest::newRow("truncated-array") << raw("\x83\x01\x02")
+                                     << QCborError{ QCborError::EndOfFile } << 0;
+    QTest::newRow("truncated-nested") << raw("\x82\x01\x82\x02")
+                                      << QCborError{ QCborError::EndOfFile } << 2;
+    QTest::newRow("unterminated-array") << raw("\x9f\x01")
+                                        << QCborError{ QCborError::EndOfFile } << 1;
+    QTest::newRow("large-array") << raw("\x9a\x10\0\0\0\0\0")
+                                 << QCborError{ QCborError::EndOfFile } << 0;
+    QTest::newRow("huge-array") << raw("\x9b\x40\0\0\0\0\0\0\0\0\0")
+                                << QCborError{ QCborError::DataTooLarge } << 0;
+    QTest::newRow("unexpected-break") << raw("\x82\x01\xff") << QCborError{ QCborError::UnexpectedBreak } << 2;
+    QTest::newRow("break-as-map-value") << raw("\xbf\x01\xff")
+                                        << QCborError{ QCborError::UnexpectedBreak } << 2;
+    QTest::newRow("reserved-info") << raw("\x1c") << QCborError{ QCborError::IllegalNumber } << 0;
+    QTest::newRow("reserved-simple") << raw("\xfc") << QCborError{ QCborError::UnknownType } << 0;
+    QTest::newRow("indefinite-integer") << raw("\x1f") << QCborError{ QCborError::IllegalNumber } << 0;
+    QTest::newRow("illegal-simple-type") << raw("\xf8\x1f")
+                                         << QCborError{ QCborError::IllegalSimpleType } << 0;
+    QTest::newRow("invalid-utf8") << raw("\x81\x61\xff")
+                                  << QCborError{ QCborError::InvalidUtf8String } << 1;
+    QTest::newRow("invalid-utf8-chunk") << raw("\x7f\x61z\x61\xff\xff")
+                                        << QCborError{ QCborError::InvalidUtf8String } << 3;
+    QTest::newRow("mixed-chunks") << raw("\x7f\x41z\xff") << QCborError{ QCborError::IllegalType } << 1;
+    QTest::newRow("nested-chunks") << raw("\x5f\x5f\xff\xff")
+                                   << QCborError{ QCborError::IllegalNumber } << 1;
+    QTest::newRow("garbage") << raw("\x01\x02") << QCborError{ QCborError::GarbageAtEnd } << 1;
+    QTest::newRow("deep") << QByteArray(2000, '\x81') << QCborError{ QCborError::NestingTooDeep }
+                          << 1024;
+}
+
+void tst_QCborDocumentView::errors()
+{
+    QFETCH(QByteArray, cbor);
+    QFETCH(QCborError, error);
+    QFETCH(int, offset);
+
+    QCborParserError parserError;
+    const QCborDocumentView document = QCborDocumentView::fromCbor(cbor, &parserError);
+    QVERIFY(document.isNull());
+    QCOMPARE(parserError.error, error);
+    QCOMPARE(parserError.offset, offset);
+    QVERIFY(document.value().isUndefined());
+    QVERIFY(document[0].isUndefined());
+
+    // QCborValue reads one item only, so it doesn't know about garbage
+    if (error != QCborError::GarbageAtEnd) {
+        QCborParserError valueError;
+        QCborValue::fromCbor(cbor, &valueError);
+        QCOMPARE(valueError.error, error);
+    }
+}
+
+void tst_QCborDocumentView::lookup()
+{
+    const QCborMap map = {
+        { u"name"_s, u"Qt"_s },
+        { u"version"_s, QCborMap{ { u"major"_s, 6 }, { u"minor"_s, 12 } } },
+        { u"tags"_s, QCborArray{ u"core"_s, u"cbor"_s } },
+        { u"pi"_s, 3.25 },
+        { u"ok"_s, false },
+        { u"é"_s, nullptr },
+    };
+    const QCborDocumentView document = QCborDocumentView::fromCbor(QCborValue(map).toCbor());
+    QVERIFY(document.isMap());
+    QVERIFY(!document.isArray());
+
+    QCOMPARE(document["name"_L1].toString(), u"Qt");
+    QCOMPARE(document[u"version"]["minor"_L1].toInteger(), 12);
+    QCOMPARE(document["tags"_L1][1].toStringView(), "cbor");
+    QCOMPARE(document["pi"_L1].toDouble(), 3.25);
+    QCOMPARE(document["pi"_L1].toInteger(), 3);
+    QCOMPARE(document["ok"_L1].toBool(true), false);
+    QVERIFY(document[u"é"].isNull());
+    QVERIFY(document["\xc3\xa9"_ba].isNull());
+
+    QVERIFY(document.value().contains(u"tags"));
+    QVERIFY(!document.value().contains(u"missing"));
+    QVERIFY(document["missing"_L1]["chained"_L1][3].isUndefined());
+    QVERIFY(document["tags"_L1][2].isUndefined());
+    QVERIFY(document["tags"_L1][-1].isUndefined());
+    QVERIFY(document["name"_L1][0].isUndefined());
+    QCOMPARE(document["pi"_L1].toString(u"default"_s), u"default");
+    QCOMPARE(document["pi"_L1].toByteArray("default"), "default");
+
+    // copies share the index and keep views valid
+    QCborValueView tags;
+    {
+        QCborDocumentView copy = document;
+        tags = copy["tags"_L1];
+    }
+    QCOMPARE(tags.size(), 2);
+    QCOMPARE(tags[0].toString(), u"core");
+}
+
+void tst_QCborDocumentView::integerKeys()
+{
+    const QCborMap map = { { 1, u"one"_s }, { -2, u"minus two"_s }, { u"1"_s, u"string"_s } };
+    const QCborDocumentView document = QCborDocumentView::fromCbor(QCborValue(map).toCbor());
+    QCOMPARE(document[1].toString(), u"one");
+    QCOMPARE(document[-2].toString(), u"minus two");
+    QCOMPARE(document["1"_L1].toString(), u"string");
+    QVERIFY(document.value().contains(qint64(-2)));
+    QVERIFY(!document.value().contains(qint64(0)));
+    QVERIFY(document[0].isUndefined());
+}
+
+void tst_QCborDocumentView::integersOutOfRange()
+{
+    const QCborDocumentView document = QCborDocumentView::fromCbor(
+            raw("\x82\x1b\xff\xff\xff\xff\xff\xff\xff\xff"
+                "\x3b\xff\xff\xff\xff\xff\xff\xff\xff"));
+    QVERIFY(document[0].isDouble());
+    QCOMPARE(document[0].toDouble(), 18446744073709551616.);
+    QVERIFY(document[1].isDouble());
+    QCOMPARE(document[1].toDouble(), -18446744073709551616.);
+}
+
+void tst_QCborDocumentView::duplicateKeys()
+{
+    const QCborDocumentView document = QCborDocumentView::fromCbor(
+            raw("\xa3\x61" "a\x01\x61" "b\x02\x61" "a\x03"));
+    QCOMPARE(document["a"_L1].toInteger(), 3);
+    QCOMPARE(document.value().size(), 3);
+}
+
+void tst_QCborDocumentView::iteration()
+{
+    const QCborDocumentView document = QCborDocumentView::fromCbor(
+            raw("\xbf\x61x\x83\x01\x02\x03\x01\xa0\x61z\x9f\xff\xff"));
+    QCOMPARE(document.value().size(), 3);
+
+    QList<QCborValue> keys;
+    for (auto it = document.value().begin(); it != document.value().end(); ++it)
+        keys << it.key().toCborValue();
+    QCOMPARE(keys, QList<QCborValue>({ u"x"_s, 1, u"z"_s }));
+
+    qint64 sum = 0;
+    for (QCborValueView element : document["x"_L1])
+        sum += element.toInteger();
+    QCOMPARE(sum, 6);
+
+    QVERIFY(document["x"_L1].begin().key().isUndefined());
+    QVERIFY(document[1].isMap());
+    QCOMPARE(document[1].begin(), document[1].end());
+    QCOMPARE(document["z"_L1].begin(), document["z"_L1].end());
+    QCOMPARE(QCborValueView().begin(), QCborValueView().end());
+}
+
+void tst_QCborDocumentView::tags()
+{
+    const QDateTime dt = QDateTime::fromSecsSinceEpoch(1510099322, QTimeZone::UTC);
+    const QCborArray array = { QCborValue(dt), QCborValue(QUrl(u"https://qt.io"_s)),
+                               QCborValue(QCborTag(1234), 5) };
+    const QCborDocumentView document = QCborDocumentView::fromCbor(QCborValue(array).toCbor());
+
+    QVERIFY(document[0].isTag());
+    QCOMPARE(document[0].tag(), QCborKnownTags::DateTimeString);
+    QVERIFY(document[0].taggedValue().isString());
+    QCOMPARE(document[0].toCborValue().toDateTime(), dt);
+    QCOMPARE(document[1].tag(), QCborKnownTags::Url);
+    QCOMPARE(document[1].taggedValue().toString(), u"https://qt.io");
+    QCOMPARE(document[1].toCborValue().toUrl(), QUrl(u"https://qt.io"_s));
+    QCOMPARE(document[2].tag(), QCborTag(1234));
+    QCOMPARE(document[2].taggedValue().toInteger(), 5);
+
+    QCOMPARE(document[2].taggedValue().tag(QCborTag(7)), QCborTag(7));
+    QVERIFY(document[2].taggedValue().taggedValue().isUndefined());
+    QCOMPARE(document.value().size(), 3);
+}
+
+void tst_QCborDocumentView::strings_data()
+{
+    QTest::addColumn<QByteArray>("cbor");
+    QTest::addColumn<QCborValue>("expected");
+    QTest::addColumn<bool>("hasView");
+
+    QTest::newRow("ascii") << raw("\x81\x65plain") << QCborValue(u"plain"_s) << true;
+    QTest::newRow("empty") << raw("\x81\x60") << QCborValue(u""_s) << true;
+    QTest::newRow("utf8") << raw("\x81\x65\xc3\xa9\xe4\xb8\xad") << QCborValue(u"é中"_s) << true;
+    QTest::newRow("chunked") << raw("\x81\x7f\x61z\x62\xc3\xa9\xff") << QCborValue(u"zé"_s)
+                             << false;
+    QTest::newRow("bytes") << raw("\x81\x43\0\1\2") << QCborValue(QByteArray("\0\1\2", 3)) << true;
+    QTest::newRow("chunked-bytes") << raw("\x81\x5f\x41z\x40\x41y\xff")
+                                   << QCborValue(QByteArray("zy")) << false;
+}
+
+void tst_QCborDocumentView::strings()
+{
+    QFETCH(QByteArray, cbor);
+    QFETCH(QCborValue, expected);
+    QFETCH(bool, hasView);
+
+    const QCborDocumentView document = QCborDocumentView::fromCbor(cbor);
+    const QCborValueView value = document[0];
+    QCOMPARE(value.toCborValue(), expected);
+    QCOMPARE(value.toString(), expected.toString());
+    QCOMPARE(value.toByteArray(), expected.toByteArray());
+
+    const char *begin = document.data().constData();
+    if (expected.isString()) {
+        QVERIFY(value.isString());
+        QVERIFY(value.toByteArrayView().isNull());
+        if (hasView) {
+            QCOMPARE(value.toStringView(), expected.toString());
+            QVERIFY(value.toStringView().data() > begin);
+            QVERIFY(value.toStringView().data() <= begin + cbor.size());
+        } else {
+            QVERIFY(value.toStringView().isNull());
+        }
+
+        // lookups work on chunked keys too
+        QByteArray map = cbor;
+        map[0] = '\xa1';
+        map += '\xf5';
+        QVERIFY(QCborDocumentView::fromCbor(map)[expected.toString()].toBool());
+    } else {
+        QVERIFY(value.isByteArray());
+        QVERIFY(value.toStringView().isNull());
+        if (hasView)
+            QCOMPARE(value.toByteArrayView(), expected.toByteArray());
+        else
+            QVERIFY(value.toByteArrayView().isNull());
+    }
+}
+
+void tst_QCborDocumentView::simpleTypes()
+{
+    const QCborDocumentView document = QCborDocumentView::fromCbor(
+            raw("\x86\xf4\xf5\xf6\xf7\xe0\xf8\xff"));
+    QVERIFY(document[0].isFalse());
+    QVERIFY(document[0].isBool());
+    QVERIFY(document[1].isTrue());
+    QCOMPARE(document[1].toBool(), true);
+    QVERIFY(document[2].isNull());
+    QVERIFY(document[3].isUndefined());
+    QCOMPARE(document[4].toSimpleType(), QCborSimpleType(0));
+    QCOMPARE(document[5].toSimpleType(), QCborSimpleType(255));
+    QCOMPARE(document[5].type(), QCborValue::Type(QCborValue::SimpleType + 255));
+    for (int i = 0; i < 6; ++i)
+        QVERIFY(document[i].isSimpleType());
+    QVERIFY(!document.value().isSimpleType());
+    QCOMPARE(document.value().toSimpleType(QCborSimpleType::Null), QCborSimpleType::Null);
+}
+
+void tst_QCborDocumentView::rawData()
+{
+    // the data is referenced, not copied
+    static const char buffer[] = "\xa1\x63key\x65value";
+    const QByteArray data = QByteArray::fromRawData(buffer, sizeof(buffer) - 1);
+    const QCborDocumentView document = QCborDocumentView::fromCbor(data);
+    QCOMPARE(document.data().constData(), buffer);
+    QCOMPARE(document["key"_L1].toByteArrayView().data(), nullptr);
+    QCOMPARE(document["key"_L1].toStringView().data(), buffer + 6);
+}
+
+QTEST_MAIN(tst_QCborDocumentView)
+
+#include "tst_qcbordocumentview.moc"
@@ -9,6 +9,7 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QtEndian>
+#include <QTemporaryFile>
 
 #include <QtGui/QBitmap>
 #include <QtGui/QPainter>
@@ -182,6 +183,10 @@ private slots:
 
     void status_QList_QVector();
 
+    void stream_QList_bulk_data();
+    void stream_QList_bulk();
+    void status_QList_bulk();
+
     void streamToAndFromQByteArray();
 
     void streamRealDataTypes();
@@ -3243,6 +3248,182 @@ void tst_QDataStream::status_QList_QVector()
     }
 }
 
+template <typename T>
+static QList<T> bulkTestValues()
+{
+    // more than the 16 KiB used to byte-swap while writing
+    QList<T> values;
+    for (int i = 0; i < 3000; ++i) {
+        if constexpr (std::is_floating_point_v<T>)
+            values.append(T(i) / 8 - 100);
+        else
+            values.append(T(i * 37 - 1000));
+    }
+    return values;
+}
+
+template <typename T>
+static void checkBulkStreaming(QDataStream::ByteOrder byteOrder, int version,
+                               QDataStream::FloatingPointPrecision precision)
+{
+    const QList<T> values = bulkTestValues<T>();
+    const auto setUp = [&](QDataStream &stream) {
+        stream.setByteOrder(byteOrder);
+        stream.setVersion(version);
+        stream.setFloatingPointPrecision(precision);
+    };
+
+    // same format as streaming the elements one by one
+    QByteArray expected;
+    {
+        QDataStream stream(&expected, QIODevice::WriteOnly);
+        setUp(stream);
+        stream << quint32(values.size());
+        for (T value : values)
+            stream << value;
+    }
+    QByteArray data;
+    {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        setUp(stream);
+        QVERIFY(stream << values);
+    }
+    QCOMPARE(data, expected);
+
+    // reads the same as streaming the elements one by one
+    QList<T> expectedValues;
+    {
+        QDataStream stream(data);
+        setUp(stream);
+        quint32 size;
+        stream >> size;
+        for (quint32 i = 0; i < size; ++i) {
+            T value;
+            stream >> value;
+            expectedValues.append(value);
+        }
+    }
+
+    // from memory
+    {
+        QDataStream stream(data);
+        setUp(stream);
+        QList<T> read;
+        QVERIFY(stream >> read);
+        QVERIFY(read == expectedValues);
+        QVERIFY(stream.atEnd());
+    }
+
+    // from a device that isn't a QBuffer
+    {
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        QCOMPARE(file.write(data), data.size());
+        QVERIFY(file.seek(0));
+        QDataStream stream(&file);
+        setUp(stream);
+        QList<T> read;
+        QVERIFY(stream >> read);
+        QVERIFY(read == expectedValues);
+        QVERIFY(stream.atEnd());
+    }
+
+    // truncated
+    {
+        const QByteArray truncated = data.left(data.size() - 1);
+        QDataStream stream(truncated);
+        setUp(stream);
+        QList<T> read = { T(1) };
+        QVERIFY(!(stream >> read));
+        QCOMPARE(stream.status(), QDataStream::ReadPastEnd);
+        QVERIFY(read.isEmpty());
+    }
+}
+
+void tst_QDataStream::stream_QList_bulk_data()
+{
+    QTest::addColumn<QDataStream::ByteOrder>("byteOrder");
+    QTest::addColumn<int>("version");
+    QTest::addColumn<QDataStream::FloatingPointPrecision>("precision");
+
+    QTest::newRow("big-endian") << QDataStream::BigEndian
+                                << int(QDataStream::Qt_DefaultCompiledVersion)
+                                << QDataStream::DoublePrecision;
+    QTest::newRow("little-endian") << QDataStream::LittleEndian
+                                   << int(QDataStream::Qt_DefaultCompiledVersion)
+                                   << QDataStream::DoublePrecision;
+    QTest::newRow("single-precision") << QDataStream::BigEndian
+                                      << int(QDataStream::Qt_DefaultCompiledVersion)
+                                      << QDataStream::SinglePrecision;
+    QTest::newRow("qt-4.5") << QDataStream::BigEndian << int(QDataStream::Qt_4_5)
+                            << QDataStream::DoublePrecision;
+    QTest::newRow("qt-3.1") << QDataStream::LittleEndian << int(QDataStream::Qt_3_1)
+                            << QDataStream::DoublePrecision;
+}
+
+void tst_QDataStream::stream_QList_bulk()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+    QFETCH(int, version);
+    QFETCH(QDataStream::FloatingPointPrecision, precision);
+
+#define CHECK_BULK(T) \
+    checkBulkStreaming<T>(byteOrder, version, precision); \
+    if (QTest::currentTestFailed()) \
+        QFAIL("Failed for " #T)
+
+    CHECK_BULK(char);
+    CHECK_BULK(qint8);
+    CHECK_BULK(quint8);
+    CHECK_BULK(qint16);
+    CHECK_BULK(quint16);
+    CHECK_BULK(qint32);
+    CHECK_BULK(quint32);
+    CHECK_BULK(qint64);
+    CHECK_BULK(quint64);
+    CHECK_BULK(char16_t);
+    CHECK_BULK(char32_t);
+    CHECK_BULK(float);
+    CHECK_BULK(double);
+#undef CHECK_BULK
+}
+
+void tst_QDataStream::status_QList_bulk()
+{
+    const QList<qint32> values = bulkTestValues<qint32>();
+    QByteArray data;
+    {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        QVERIFY(stream << values);
+    }
+
+    // a failed read in a transaction can be retried with more data
+    QBuffer buffer;
+    buffer.setData(data.left(data.size() / 2));
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QDataStream stream(&buffer);
+    QList<qint32> read;
+    stream.startTransaction();
+    stream >> read;
+    QVERIFY(!stream.commitTransaction());
+    QVERIFY(read.isEmpty());
+    QCOMPARE(buffer.pos(), 0);
+
+    buffer.buffer().append(data.mid(data.size() / 2));
+    stream.startTransaction();
+    stream >> read;
+    QVERIFY(stream.commitTransaction());
+    QCOMPARE(read, values);
+    QVERIFY(stream.atEnd());
+
+    // the latched status is kept
+    QDataStream failed(data);
+    failed.setStatus(QDataStream::ReadCorruptData);
+    failed >> read;
+    QCOMPARE(failed.status(), QDataStream::ReadCorruptData);
+    QCOMPARE(read, values);
+}
+
 void tst_QDataStream::streamToAndFromQByteArray()
 {
     QByteArray data;
@@ -0,0 +1,281 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonDocumentView>
+#include <QJsonObject>
+#include <QJsonParseError>
+
+using namespace Qt::StringLiterals;
+
+class tst_QJsonDocumentView : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void toJsonValue_data();
+    void toJsonValue();
+    void errors_data();
+    void errors();
+    void lookup();
+    void duplicateKeys();
+    void iteration();
+    void strings_data();
+    void strings();
+    void numbers_data();
+    void numbers();
+    void rawData();
+};
+
+static QByteArray largeDocument()
+{
+    QJsonArray array;
+    for (int i = 0; i < 5000; ++i) {
+        QJsonObject object;
+        object["id"_L1] = i;
+        object["name"_L1] = u"item \"%1\"\né中"_s.arg(i);
+        object["value"_L1] = i / 7.0;
+        object["tags"_L1] = QJsonArray{ u"a"_s, u"b]"_s, true, QJsonValue::Null };
+        object["nested"_L1] = QJsonObject{ { "x"_L1, QJsonArray{ 1, 2, QJsonArray{} } } };
+        array.append(object);
+    }
+    return QJsonDocument(array).toJson();
+}
+
+void tst_QJsonDocumentView::toJsonValue_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("object") << QByteArray(R"({"a": [1, 2.5, "three", {"b": null}], "c": true})");
+    QTest::newRow("empty-object") << QByteArray("{}");
+    QTest::newRow("empty-array") << QByteArray(" [ ] ");
+    QTest::newRow("duplicates") << QByteArray(R"({"a": 1, "b": 2, "a": 3})");
+    QTest::newRow("escapes") << QByteArray(R"(["A\n", "\ud800", "a\"b", "é\/"])");
+    QTest::newRow("numbers") << QByteArray("[0, -0, 1e3, 1.0, -1.5e-3, 9007199254740993, "
+                                           "18446744073709551616]");
+    QTest::newRow("nested") << QByteArray("[[[[[[[[[[{}]]]]]]]]]]");
+    QTest::newRow("control-character") << QByteArray("[\"a\tb\"]");
+    QTest::newRow("bom") << QByteArray("\xef\xbb\xbf[1]");
+    QTest::newRow("string") << QByteArray(R"("top")");
+    QTest::newRow("number") << QByteArray("42");
+    QTest::newRow("null") << QByteArray("null");
+    QTest::newRow("large") << largeDocument();
+}
+
+void tst_QJsonDocumentView::toJsonValue()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonParseError expectedError;
+    const QJsonValue expected = QJsonValue::fromJson(json, &expectedError);
+    QCOMPARE(expectedError.error, QJsonParseError::NoError);
+
+    QJsonParseError error;
+    const QJsonDocumentView document = QJsonDocumentView::fromJson(json, &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    QVERIFY(!document.isNull());
+    QCOMPARE(document.data(), json);
+    QCOMPARE(document.value().type(), expected.type());
+    QCOMPARE(document.value().toJsonValue(), expected);
+    if (expected.isArray())
+        QCOMPARE(document.value().size(), expected.toArray().size());
+}
+
+void tst_QJsonDocumentView::errors_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("empty") << QByteArray();
+    QTest::newRow("spaces") << QByteArray("  ");
+    QTest::newRow("missing-separator") << QByteArray("[1 2]");
+    QTest::newRow("missing-colon") << QByteArray("{\"a\" 1}");
+    QTest::newRow("unterminated-object") << QByteArray("{\"a\": 1 ]");
+    QTest::newRow("unterminated-array") << QByteArray("[1, 2}");
+    QTest::newRow("key-not-string") << QByteArray("{1: 2}");
+    QTest::newRow("trailing-comma-object") << QByteArray("{\"a\": 1,}");
+    QTest::newRow("trailing-comma-array") << QByteArray("[1,]");
+    QTest::newRow("illegal-value") << QByteArray("[tru]");
+    QTest::newRow("illegal-number") << QByteArray("[-]");
+    QTest::newRow("illegal-escape") << QByteArray(R"(["\u12x4"])");
+    QTest::newRow("illegal-utf8") << QByteArray("[\"\xff\"]");
+    QTest::newRow("garbage") << QByteArray("{} x");
+    QTest::newRow("deep") << QByteArray(2000, '[');
+    QTest::newRow("premature-object") << QByteArray("{\"a\": [1");
+    QTest::newRow("premature-string") << QByteArray("[\"abc");
+}
+
+void tst_QJsonDocumentView::errors()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonParseError expected;
+    QJsonValue::fromJson(json, &expected);
+    QVERIFY(expected.error != QJsonParseError::NoError);
+
+    QJsonParseError error;
+    const QJsonDocumentView document = QJsonDocumentView::fromJson(json, &error);
+    QVERIFY(document.isNull());
+    QCOMPARE(error.error, expected.error);
+    QCOMPARE(error.offset, expected.offset);
+
+    QVERIFY(document.value().isUndefined());
+    QVERIFY(document["a"_L1].isUndefined());
+    QCOMPARE(document.data(), QByteArray());
+}
+
+void tst_QJsonDocumentView::lookup()
+{
+    const QJsonDocumentView document = QJsonDocumentView::fromJson(
+            R"({"name": "Qt", "version": {"major": 6, "minor": 12},
+                "tags": ["core", "json"], "pi": 3.25, "ok": false, "none": null})");
+    QVERIFY(document.isObject());
+    QVERIFY(!document.isArray());
+
+    QCOMPARE(document["name"_L1].toString(), u"Qt");
+    QCOMPARE(document[u"version"]["minor"_L1].toInteger(), 12);
+    QCOMPARE(document["version"_L1]["major"_L1].toDouble(), 6.);
+    QCOMPARE(document["tags"_L1][1].toString(), u"json");
+    QCOMPARE(document["pi"_L1].toDouble(), 3.25);
+    QVERIFY(!document["pi"_L1].isInteger());
+    QCOMPARE(document["pi"_L1].toInteger(-1), -1);
+    QVERIFY(document["ok"_L1].isBool());
+    QCOMPARE(document["ok"_L1].toBool(true), false);
+    QVERIFY(document["none"_L1].isNull());
+
+    QVERIFY(document.value().contains(u"tags"));
+    QVERIFY(!document.value().contains(u"missing"));
+    QVERIFY(document["missing"_L1].isUndefined());
+    QVERIFY(document["missing"_L1]["chained"_L1][3].isUndefined());
+    QVERIFY(document["tags"_L1][2].isUndefined());
+    QVERIFY(document["tags"_L1][-1].isUndefined());
+    QVERIFY(document["tags"_L1]["core"_L1].isUndefined());
+    QVERIFY(document[0].isUndefined());
+    QCOMPARE(document["name"_L1].toString(u"default"_s), u"Qt");
+    QCOMPARE(document["pi"_L1].toString(u"default"_s), u"default");
+
+    // copies share the index and keep views valid
+    QJsonValueView tags;
+    {
+        QJsonDocumentView copy = document;
+        tags = copy["tags"_L1];
+    }
+    QCOMPARE(tags.size(), 2);
+    QCOMPARE(tags[0].toStringView(), "core");
+}
+
+void tst_QJsonDocumentView::duplicateKeys()
+{
+    const QByteArray json = R"({"a": 1, "b": 2, "a": 3})";
+    const QJsonDocumentView document = QJsonDocumentView::fromJson(json);
+    // the last one wins, as in QJsonObject
+    QCOMPARE(document["a"_L1].toInteger(), QJsonDocument::fromJson(json)["a"_L1].toInteger());
+    QCOMPARE(document["a"_L1].toInteger(), 3);
+    // but all are visited
+    QCOMPARE(document.value().size(), 3);
+}
+
+void tst_QJsonDocumentView::iteration()
+{
+    const QJsonDocumentView document = QJsonDocumentView::fromJson(
+            R"({"x": [1, 2, 3], "y": {}, "z": "s"})");
+
+    QStringList keys;
+    for (auto it = document.value().begin(); it != document.value().end(); ++it)
+        keys << it.key().toString();
+    QCOMPARE(keys, QStringList({ u"x"_s, u"y"_s, u"z"_s }));
+
+    qint64 sum = 0;
+    for (QJsonValueView element : document["x"_L1]) {
+        QVERIFY(element.isInteger());
+        QVERIFY(element.isDouble());
+        sum += element.toInteger();
+    }
+    QCOMPARE(sum, 6);
+
+    QVERIFY(document["x"_L1].begin().key().isUndefined());
+    QCOMPARE(document["y"_L1].begin(), document["y"_L1].end());
+    QCOMPARE(document["z"_L1].begin(), document["z"_L1].end());
+    QCOMPARE(QJsonValueView().begin(), QJsonValueView().end());
+}
+
+void tst_QJsonDocumentView::strings_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QString>("expected");
+    QTest::addColumn<bool>("hasView");
+
+    QTest::newRow("ascii") << QByteArray(R"(["plain"])") << u"plain"_s << true;
+    QTest::newRow("empty") << QByteArray(R"([""])") << QString(u""_s) << true;
+    QTest::newRow("utf8") << QByteArray(R"(["é中😀"])") << u"é中😀"_s << true;
+    QTest::newRow("escaped") << QByteArray(R"(["a\tbé"])") << u"a\tbé"_s << false;
+    QTest::newRow("surrogates") << QByteArray(R"(["\ud83d\ude00"])") << u"😀"_s << false;
+}
+
+void tst_QJsonDocumentView::strings()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QString, expected);
+    QFETCH(bool, hasView);
+
+    const QJsonDocumentView document = QJsonDocumentView::fromJson(json);
+    const QJsonValueView value = document[0];
+    QVERIFY(value.isString());
+    QCOMPARE(value.toString(), expected);
+    QCOMPARE(value.toJsonValue(), QJsonDocument::fromJson(json).array().at(0));
+    if (hasView) {
+        QCOMPARE(value.toStringView(), expected);
+        // points into the data
+        const char *begin = document.data().constData();
+        QVERIFY(value.toStringView().data() > begin);
+        QVERIFY(value.toStringView().data() < begin + json.size());
+    } else {
+        QVERIFY(value.toStringView().isNull());
+    }
+
+    // lookups work on escaped keys too
+    const QByteArray object = "{" + json.mid(1, json.size() - 2) + ": true}";
+    QVERIFY(QJsonDocumentView::fromJson(object)[expected].toBool());
+}
+
+void tst_QJsonDocumentView::numbers_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("zero") << QByteArray("0");
+    QTest::newRow("negative") << QByteArray("-42");
+    QTest::newRow("max") << QByteArray("9223372036854775807");
+    QTest::newRow("integral-fraction") << QByteArray("3.000");
+    QTest::newRow("exponent") << QByteArray("1e3");
+    QTest::newRow("fraction") << QByteArray("0.25");
+    QTest::newRow("too-large") << QByteArray("1e300");
+    QTest::newRow("beyond-qint64") << QByteArray("18446744073709551616");
+}
+
+void tst_QJsonDocumentView::numbers()
+{
+    QFETCH(QByteArray, json);
+
+    const QJsonValue expected = QJsonDocument::fromJson("[" + json + "]").array().at(0);
+    const QJsonValueView value = QJsonDocumentView::fromJson(json).value();
+    QVERIFY(value.isDouble());
+    QCOMPARE(value.isInteger(), expected.toInteger(-1) != -1 || expected.toDouble() == -1);
+    QCOMPARE(value.toInteger(-1), expected.toInteger(-1));
+    QCOMPARE(value.toDouble(), expected.toDouble());
+    QCOMPARE(value.toJsonValue(), expected);
+}
+
+void tst_QJsonDocumentView::rawData()
+{
+    // the data is referenced, not copied
+    static const char buffer[] = R"({"key": "value"})";
+    const QByteArray raw = QByteArray::fromRawData(buffer, sizeof(buffer) - 1);
+    const QJsonDocumentView document = QJsonDocumentView::fromJson(raw);
+    QCOMPARE(document.data().constData(), buffer);
+    QCOMPARE(document["key"_L1].toStringView().data(), buffer + 9);
+}
+
+QTEST_MAIN(tst_QJsonDocumentView)
+
+#include "tst_qjsondocumentview.moc"
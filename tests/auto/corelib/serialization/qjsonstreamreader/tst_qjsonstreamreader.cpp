@@ -0,0 +1,541 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QBuffer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonStreamReader>
+
+#include <functional>
+
+using namespace Qt::StringLiterals;
+
+class tst_QJsonStreamReader : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void tokens_data();
+    void tokens();
+    void readValue_data();
+    void readValue();
+    void numbers_data();
+    void numbers();
+    void errors_data();
+    void errors();
+    void incremental_data() { readValue_data(); }
+    void incremental();
+    void device();
+    void splitTopLevelValue_data();
+    void splitTopLevelValue();
+    void sequentialDevice();
+    void skipCurrentValue();
+    void skipIncremental();
+    void containerDepth();
+};
+
+// Describes every token, so that two ways of reading can be compared.
+// feed() is called to add more data when the reader ran out of it.
+static QString dump(QJsonStreamReader &reader, const std::function<bool()> &feed = {})
+{
+    QString result;
+    while (true) {
+        const QJsonStreamReader::TokenType type = reader.readNext();
+        if (type == QJsonStreamReader::Invalid && feed
+                && reader.error().error == QJsonParseError::PrematureEndOfDocument && feed()) {
+            continue;
+        }
+        if (!reader.name().isNull())
+            result += reader.name() + u':';
+        switch (type) {
+        case QJsonStreamReader::StartObject:
+            result += u'{';
+            break;
+        case QJsonStreamReader::EndObject:
+            result += u'}';
+            break;
+        case QJsonStreamReader::StartArray:
+            result += u'[';
+            break;
+        case QJsonStreamReader::EndArray:
+            result += u']';
+            break;
+        case QJsonStreamReader::String:
+            result += u'"' + reader.toString() + u'"';
+            break;
+        case QJsonStreamReader::Number:
+            if (reader.isInteger())
+                result += QString::number(reader.toInteger());
+            else
+                result += QString::number(reader.toDouble(), 'g', QLocale::FloatingPointShortest);
+            break;
+        case QJsonStreamReader::Bool:
+            result += reader.toBool() ? u"true" : u"false";
+            break;
+        case QJsonStreamReader::Null:
+            result += u"null";
+            break;
+        case QJsonStreamReader::EndDocument:
+            return result;
+        case QJsonStreamReader::Invalid:
+        case QJsonStreamReader::NoToken:
+            return result + u"<error: " + reader.errorString() + u'>';
+        }
+        result += u' ';
+    }
+}
+
+static QByteArray largeDocument()
+{
+    QJsonArray array;
+    for (int i = 0; i < 5000; ++i) {
+        QJsonObject object;
+        object["id"_L1] = i;
+        object["name"_L1] = u"item \"%1\"\né中"_s.arg(i);
+        object["value"_L1] = i / 7.0;
+        object["tags"_L1] = QJsonArray{ u"a"_s, u"b]"_s, true, QJsonValue::Null };
+        object["nested"_L1] = QJsonObject{ { "x"_L1, QJsonArray{ 1, 2, QJsonArray{} } } };
+        array.append(object);
+    }
+    return QJsonDocument(array).toJson();
+}
+
+void tst_QJsonStreamReader::tokens_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("empty-object") << QByteArray("{}") << u"{ } "_s;
+    QTest::newRow("empty-array") << QByteArray(" [ ] ") << u"[ ] "_s;
+    QTest::newRow("scalars") << QByteArray("[true,false,null,1,-2.5,\"x\"]")
+                             << u"[ true false null 1 -2.5 \"x\" ] "_s;
+    QTest::newRow("object") << QByteArray("{\"a\": 1, \"b\": [\"c\", {}], \"d\": {\"e\": null}}")
+                            << u"{ a:1 b:[ \"c\" { } ] d:{ e:null } } "_s;
+    QTest::newRow("whitespace") << QByteArray("\r\n\t{ \"a\" :\n1 }\n\n")
+                                << u"{ a:1 } "_s;
+    QTest::newRow("bom") << QByteArray("\xef\xbb\xbf[1]") << u"[ 1 ] "_s;
+    QTest::newRow("escapes") << QByteArray(R"(["\"\\\/\b\f\n\r\té😀"])")
+                             << u"[ \"\"\\/\b\f\n\r\té\U0001F600\" ] "_s;
+    QTest::newRow("utf8") << QByteArray("{\"\xc3\xa9\": \"\xe4\xb8\xad\"}")
+                          << u"{ é:\"中\" } "_s;
+    QTest::newRow("top-level-string") << QByteArray("\"text\"") << u"\"text\" "_s;
+    QTest::newRow("top-level-number") << QByteArray("42") << u"42 "_s;
+    QTest::newRow("top-level-literal") << QByteArray(" null ") << u"null "_s;
+}
+
+void tst_QJsonStreamReader::tokens()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QString, expected);
+
+    QJsonStreamReader reader(json);
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+    QCOMPARE(dump(reader), expected);
+    QVERIFY(!reader.hasError());
+    QVERIFY(reader.atEnd());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QJsonStreamReader::readValue_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("object") << QByteArray(R"({"a": [1, 2.5, "three", {"b": null}], "c": true})");
+    QTest::newRow("duplicates") << QByteArray(R"({"a": 1, "b": 2, "a": 3})");
+    QTest::newRow("escapes") << QByteArray(R"(["A\n", "\ud800", "a\"b"])");
+    QTest::newRow("numbers") << QByteArray("[0, -0, 1e3, 1.0, -1.5e-3, 9007199254740993, "
+                                           "18446744073709551616]");
+    QTest::newRow("nested") << QByteArray("[[[[[[[[[[{}]]]]]]]]]]");
+    QTest::newRow("large") << largeDocument();
+}
+
+void tst_QJsonStreamReader::readValue()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(json, &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+
+    QJsonStreamReader reader(json);
+    QVERIFY(reader.readNextValue());
+    const QJsonValue value = reader.readValue();
+    QVERIFY2(!reader.hasError(), qPrintable(reader.errorString()));
+    QCOMPARE(value, document.isArray() ? QJsonValue(document.array())
+                                       : QJsonValue(document.object()));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    QCOMPARE(reader.currentOffset(), json.size());
+}
+
+void tst_QJsonStreamReader::numbers_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<bool>("isInteger");
+    QTest::addColumn<qint64>("integer");
+    QTest::addColumn<double>("number");
+
+    QTest::newRow("zero") << QByteArray("0") << true << qint64(0) << 0.;
+    QTest::newRow("negative") << QByteArray("-42") << true << qint64(-42) << -42.;
+    QTest::newRow("max") << QByteArray("9223372036854775807") << true
+                         << std::numeric_limits<qint64>::max() << 9223372036854775807.;
+    QTest::newRow("integral-fraction") << QByteArray("3.000") << true << qint64(3) << 3.;
+    QTest::newRow("exponent") << QByteArray("1e3") << true << qint64(1000) << 1000.;
+    QTest::newRow("fraction") << QByteArray("0.25") << false << qint64(0) << 0.25;
+    QTest::newRow("too-large") << QByteArray("1e300") << false << qint64(0) << 1e300;
+}
+
+void tst_QJsonStreamReader::numbers()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(bool, isInteger);
+    QFETCH(qint64, integer);
+    QFETCH(double, number);
+
+    for (const QByteArray &input : { json, "[" + json + "]" }) {
+        QJsonStreamReader reader(input);
+        if (input.startsWith('['))
+            QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+        QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+        QCOMPARE(reader.isInteger(), isInteger);
+        QCOMPARE(reader.toInteger(-1), isInteger ? integer : -1);
+        QCOMPARE(reader.toDouble(), number);
+        QCOMPARE(reader.readValue(), QJsonDocument::fromJson("[" + json + "]").array().at(0));
+    }
+}
+
+void tst_QJsonStreamReader::errors_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QJsonParseError::ParseError>("error");
+    QTest::addColumn<int>("offset");
+
+    QTest::newRow("missing-separator") << QByteArray("[1 2]")
+                                       << QJsonParseError::MissingValueSeparator << 3;
+    QTest::newRow("missing-colon") << QByteArray("{\"a\" 1}")
+                                   << QJsonParseError::MissingNameSeparator << 5;
+    QTest::newRow("unterminated-object") << QByteArray("{\"a\": 1 ]")
+                                         << QJsonParseError::UnterminatedObject << 8;
+    QTest::newRow("key-not-string") << QByteArray("{1: 2}")
+                                    << QJsonParseError::UnterminatedObject << 1;
+    QTest::newRow("trailing-comma-object") << QByteArray("{\"a\": 1,}")
+                                           << QJsonParseError::MissingObject << 8;
+    QTest::newRow("trailing-comma-array") << QByteArray("[1,]")
+                                          << QJsonParseError::MissingObject << 3;
+    QTest::newRow("illegal-value") << QByteArray("[tru]") << QJsonParseError::IllegalValue << 1;
+    QTest::newRow("illegal-number") << QByteArray("[-]") << QJsonParseError::IllegalNumber << 1;
+    QTest::newRow("illegal-escape") << QByteArray(R"(["\u12x4"])")
+                                    << QJsonParseError::IllegalEscapeSequence << 2;
+    QTest::newRow("illegal-utf8") << QByteArray("[\"\xff\"]")
+                                  << QJsonParseError::IllegalUTF8String << 2;
+    QTest::newRow("garbage") << QByteArray("{} x") << QJsonParseError::GarbageAtEnd << 3;
+    QTest::newRow("deep") << QByteArray(2000, '[') << QJsonParseError::DeepNesting << 1024;
+    QTest::newRow("premature-object") << QByteArray("{\"a\": [1")
+                                      << QJsonParseError::PrematureEndOfDocument << 8;
+    QTest::newRow("premature-string") << QByteArray("[\"abc")
+                                      << QJsonParseError::PrematureEndOfDocument << 5;
+    QTest::newRow("premature-empty") << QByteArray("  ")
+                                     << QJsonParseError::PrematureEndOfDocument << 2;
+}
+
+void tst_QJsonStreamReader::errors()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QJsonParseError::ParseError, error);
+    QFETCH(int, offset);
+
+    QJsonStreamReader reader(json);
+    while (!reader.atEnd())
+        reader.readNext();
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::Invalid);
+    QVERIFY(reader.hasError());
+    QCOMPARE(reader.error().error, error);
+    QCOMPARE(reader.error().offset, offset);
+    QVERIFY(!reader.errorString().isEmpty());
+
+    // errors other than running out of data are final
+    if (error != QJsonParseError::PrematureEndOfDocument) {
+        reader.addData("]}");
+        QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    }
+
+    // same error as QJsonDocument, as far as it can tell. The offsets differ:
+    // the reader points at the offending character, not past it.
+    QJsonParseError documentError;
+    QJsonDocument::fromJson(json, &documentError);
+    if (error != QJsonParseError::PrematureEndOfDocument)
+        QCOMPARE(documentError.error, error);
+}
+
+void tst_QJsonStreamReader::incremental()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonStreamReader complete(json);
+    const QString expected = dump(complete);
+    QVERIFY(!expected.contains(u"<error"));
+
+    // Feed the data in pieces that split every kind of token
+    for (qsizetype chunkSize : { 1, 2, 3, 7, 1000 }) {
+        if (json.size() > 100000 && chunkSize < 1000)
+            continue;
+        QJsonStreamReader reader;
+        qsizetype fed = 0;
+        bool ended = false;
+        const auto feed = [&] {
+            if (reader.error().offset != fed)
+                return false;
+            if (fed >= json.size()) {
+                if (ended)
+                    return false;
+                reader.setEndOfInput();
+                ended = true;
+                return true;
+            }
+            const QByteArray chunk = json.mid(fed, chunkSize);
+            reader.addData(chunk);
+            fed += chunk.size();
+            return true;
+        };
+        QCOMPARE(dump(reader, feed), expected);
+    }
+}
+
+void tst_QJsonStreamReader::device()
+{
+    const QByteArray json = largeDocument();
+    QJsonStreamReader fromArray(json);
+    const QString expected = dump(fromArray);
+
+    QBuffer buffer;
+    buffer.setData(json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader reader(&buffer);
+    QCOMPARE(reader.device(), &buffer);
+    QCOMPARE(dump(reader), expected);
+    QVERIFY(!reader.hasError());
+
+    // top-level numbers end with the device
+    QBuffer number;
+    number.setData("  1234");
+    QVERIFY(number.open(QIODevice::ReadOnly));
+    reader.setDevice(&number);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toInteger(), 1234);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+
+    reader.clear();
+    QCOMPARE(reader.device(), nullptr);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error().error, QJsonParseError::PrematureEndOfDocument);
+}
+
+void tst_QJsonStreamReader::splitTopLevelValue_data()
+{
+    QTest::addColumn<QByteArrayList>("chunks");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("number") << QByteArrayList{ "12", "34" } << u"1234 "_s;
+    QTest::newRow("number-whitespace") << QByteArrayList{ " 12", "34 " } << u"1234 "_s;
+    QTest::newRow("number-fraction") << QByteArrayList{ "1", ".", "5" } << u"1.5 "_s;
+    QTest::newRow("number-exponent") << QByteArrayList{ "-2e", "1" } << u"-20 "_s;
+    QTest::newRow("number-then-whitespace") << QByteArrayList{ "12", " " } << u"12 "_s;
+    QTest::newRow("literal") << QByteArrayList{ "tr", "ue" } << u"true "_s;
+    QTest::newRow("string") << QByteArrayList{ "\"a", "b\"" } << uR"("ab" )"_s;
+    QTest::newRow("garbage") << QByteArrayList{ "{}", "  x" }
+                             << u"{ } <error: garbage at the end of the document>"_s;
+    QTest::newRow("number-garbage") << QByteArrayList{ "12", "x" }
+                                    << u"12 <error: garbage at the end of the document>"_s;
+}
+
+void tst_QJsonStreamReader::splitTopLevelValue()
+{
+    QFETCH(QByteArrayList, chunks);
+    QFETCH(QString, expected);
+
+    // the document can't end before setEndOfInput()
+    QJsonStreamReader reader;
+    qsizetype next = 0;
+    const auto feed = [&] {
+        if (next < chunks.size()) {
+            reader.addData(chunks.at(next++));
+            return true;
+        }
+        if (next++ == chunks.size()) {
+            reader.setEndOfInput();
+            return true;
+        }
+        return false;
+    };
+    QCOMPARE(dump(reader, feed), expected);
+
+    // same as all at once
+    QJsonStreamReader complete(chunks.join());
+    QCOMPARE(dump(complete), expected);
+}
+
+// A sequential device that only has what was written to it so far
+class PacketDevice : public QIODevice
+{
+public:
+    PacketDevice() { open(QIODevice::ReadOnly); }
+
+    bool isSequential() const override { return true; }
+    qint64 bytesAvailable() const override { return data.size() + QIODevice::bytesAvailable(); }
+    void receive(const QByteArray &packet)
+    {
+        data += packet;
+        emit readyRead();
+    }
+
+protected:
+    qint64 readData(char *buffer, qint64 maxSize) override
+    {
+        const qint64 n = qMin(maxSize, qint64(data.size()));
+        memcpy(buffer, data.constData(), n);
+        data.remove(0, n);
+        return n;
+    }
+    qint64 writeData(const char *, qint64) override { return -1; }
+
+private:
+    QByteArray data;
+};
+
+void tst_QJsonStreamReader::sequentialDevice()
+{
+    PacketDevice device;
+    QJsonStreamReader reader(&device);
+
+    // the device is at its end between the packets
+    device.receive("12");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error().error, QJsonParseError::PrematureEndOfDocument);
+    device.receive("34");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error().error, QJsonParseError::PrematureEndOfDocument);
+    reader.setEndOfInput();
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toInteger(), 1234);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+
+    // trailing data that arrives later is still an error
+    PacketDevice other;
+    reader.setDevice(&other);
+    other.receive("[1]");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error().error, QJsonParseError::PrematureEndOfDocument);
+    other.receive(" ,");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error().error, QJsonParseError::GarbageAtEnd);
+
+    // closing the device ends the input
+    PacketDevice closed;
+    reader.setDevice(&closed);
+    closed.receive("5");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    closed.close();
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toInteger(), 5);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QJsonStreamReader::skipCurrentValue()
+{
+    const QByteArray json = R"({"skip": {"a": ["]", "}", "\"]"], "b": [[{}]]},)"
+                            R"( "read": [1, {"c": 2}], "scalar": "x", "last": [])"
+                            R"( })";
+    QJsonStreamReader reader(json);
+    QVERIFY(reader.readNextValue());
+    QVERIFY(reader.isStartObject());
+
+    QVERIFY(reader.readNextValue());
+    QCOMPARE(reader.name(), u"skip");
+    QVERIFY(reader.skipCurrentValue());
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.containerDepth(), 1);
+
+    QVERIFY(reader.readNextValue());
+    QCOMPARE(reader.name(), u"read");
+    QCOMPARE(reader.readValue(), QJsonValue(QJsonArray{ 1, QJsonObject{ { "c"_L1, 2 } } }));
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::EndArray);
+
+    QVERIFY(reader.readNextValue());
+    QCOMPARE(reader.name(), u"scalar");
+    QVERIFY(reader.skipCurrentValue());
+    QCOMPARE(reader.toString(), u"x");
+
+    QVERIFY(reader.readNextValue());
+    QCOMPARE(reader.name(), u"last");
+    QVERIFY(reader.skipCurrentValue());
+    QVERIFY(reader.isEndArray());
+
+    QVERIFY(!reader.readNextValue());
+    QVERIFY(reader.isEndObject());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+
+    QJsonStreamReader mismatched("[{]}");
+    mismatched.readNext();
+    QVERIFY(!mismatched.skipCurrentValue());
+    QCOMPARE(mismatched.error().error, QJsonParseError::UnterminatedObject);
+    QCOMPARE(mismatched.error().offset, 2);
+}
+
+void tst_QJsonStreamReader::skipIncremental()
+{
+    const QByteArray json = largeDocument();
+    QJsonStreamReader reader;
+    reader.addData(json.left(1000));
+    QVERIFY(reader.readNextValue());
+    QVERIFY(reader.isStartArray());
+
+    // the first element gets skipped in pieces, the rest all at once
+    QVERIFY(reader.readNextValue());
+    qsizetype fed = 1000;
+    while (!reader.skipCurrentValue()) {
+        QCOMPARE(reader.error().error, QJsonParseError::PrematureEndOfDocument);
+        reader.addData(json.mid(fed, 1));
+        ++fed;
+    }
+    QVERIFY(reader.isEndObject());
+    QVERIFY(fed < 1000 + 400);
+
+    reader.addData(json.mid(fed));
+    int count = 1;
+    while (reader.readNextValue()) {
+        QVERIFY(reader.isStartObject());
+        QVERIFY(reader.skipCurrentValue());
+        ++count;
+    }
+    QVERIFY(reader.isEndArray());
+    QCOMPARE(count, 5000);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error().error, QJsonParseError::PrematureEndOfDocument);
+    reader.setEndOfInput();
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QJsonStreamReader::containerDepth()
+{
+    QJsonStreamReader reader(R"({"a": [1]})");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.containerDepth(), 0);
+    QCOMPARE(reader.parentContainerType(), QJsonValue::Null);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.containerDepth(), 1);
+    QCOMPARE(reader.parentContainerType(), QJsonValue::Object);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.containerDepth(), 2);
+    QCOMPARE(reader.parentContainerType(), QJsonValue::Array);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.containerDepth(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.containerDepth(), 0);
+}
+
+QTEST_MAIN(tst_QJsonStreamReader)
+#include "tst_qjsonstreamreader.moc"
@@ -0,0 +1,288 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QBuffer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonStreamReader>
+#include <QJsonStreamWriter>
+
+using namespace Qt::StringLiterals;
+
+class tst_QJsonStreamWriter : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void toJson_data();
+    void toJson();
+    void appendValue_data() { toJson_data(); }
+    void appendValue();
+    void strings_data();
+    void strings();
+    void numbers();
+    void device();
+    void roundTrip();
+    void mismatchedEnd();
+};
+
+static void write(QJsonStreamWriter &writer, const QJsonValue &value)
+{
+    switch (value.type()) {
+    case QJsonValue::Object: {
+        writer.startObject();
+        const QJsonObject object = value.toObject();
+        for (auto it = object.begin(); it != object.end(); ++it) {
+            writer.appendKey(it.key());
+            write(writer, it.value());
+        }
+        QVERIFY(writer.endObject());
+        break;
+    }
+    case QJsonValue::Array:
+        writer.startArray();
+        for (const QJsonValue &element : value.toArray())
+            write(writer, element);
+        QVERIFY(writer.endArray());
+        break;
+    case QJsonValue::String:
+        writer.append(value.toString());
+        break;
+    case QJsonValue::Double:
+        if (value.toInteger(-1) != -1 || value.toDouble() == -1)
+            writer.append(value.toInteger());
+        else
+            writer.append(value.toDouble());
+        break;
+    case QJsonValue::Bool:
+        writer.append(value.toBool());
+        break;
+    case QJsonValue::Null:
+    case QJsonValue::Undefined:
+        writer.appendNull();
+        break;
+    }
+}
+
+void tst_QJsonStreamWriter::toJson_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QJsonDocument::JsonFormat>("format");
+
+    const QByteArray documents[] = {
+        "{}",
+        "[]",
+        R"({"a": 1, "b": [true, false, null], "c": {"d": "e", "f": {}}, "g": []})",
+        R"([[[]], [{}], 1.5, -2, "x\ny", {"\"key\"": [1, [2, [3]]]}])",
+        R"({"unicode": "é中😀", "control": "\u0001\t"})",
+    };
+    for (const QByteArray &document : documents) {
+        QTest::addRow("indented:%s", document.constData()) << document << QJsonDocument::Indented;
+        QTest::addRow("compact:%s", document.constData()) << document << QJsonDocument::Compact;
+    }
+}
+
+void tst_QJsonStreamWriter::toJson()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QJsonDocument::JsonFormat, format);
+
+    const QJsonDocument document = QJsonDocument::fromJson(json);
+    QVERIFY(!document.isNull());
+
+    QByteArray output;
+    QJsonStreamWriter writer(&output);
+    QCOMPARE(writer.format(), QJsonDocument::Indented);
+    writer.setFormat(format);
+    QCOMPARE(writer.format(), format);
+    write(writer, document.isObject() ? QJsonValue(document.object())
+                                      : QJsonValue(document.array()));
+    QCOMPARE(output, document.toJson(format));
+    QVERIFY(!writer.hasError());
+}
+
+void tst_QJsonStreamWriter::appendValue()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QJsonDocument::JsonFormat, format);
+
+    const QJsonDocument document = QJsonDocument::fromJson(json);
+
+    // Nest the document's contents in a container written by the writer
+    QByteArray output;
+    QJsonStreamWriter writer(&output);
+    writer.setFormat(format);
+    writer.startObject();
+    writer.appendKey("first"_L1);
+    writer.appendValue(document.isObject() ? QJsonValue(document.object())
+                                           : QJsonValue(document.array()));
+    writer.appendKey(u"second");
+    writer.startArray();
+    writer.appendValue(document.isObject() ? QJsonValue(document.object())
+                                           : QJsonValue(document.array()));
+    writer.appendValue(42);
+    writer.appendValue(QJsonValue());
+    writer.endArray();
+    writer.endObject();
+
+    QJsonObject expected;
+    expected["first"_L1] = document.isObject() ? QJsonValue(document.object())
+                                               : QJsonValue(document.array());
+    expected["second"_L1] = QJsonArray{ expected["first"_L1], 42, QJsonValue::Null };
+    QCOMPARE(output, QJsonDocument(expected).toJson(format));
+}
+
+void tst_QJsonStreamWriter::strings_data()
+{
+    QTest::addColumn<QString>("string");
+
+    QTest::newRow("empty") << u""_s;
+    QTest::newRow("ascii") << u"hello world"_s;
+    QTest::newRow("escapes") << u"\"quoted\" back\\slash\b\f\n\r\t\x01\x1f/"_s;
+    QTest::newRow("latin1") << u"café ÿ"_s;
+    QTest::newRow("unicode") << u"中文 \U0001F600"_s;
+}
+
+void tst_QJsonStreamWriter::strings()
+{
+    QFETCH(QString, string);
+
+    const QByteArray expected = QJsonDocument(QJsonArray{ string }).toJson(QJsonDocument::Compact);
+    const QByteArray utf8 = string.toUtf8();
+    const QByteArray latin1 = string.toLatin1();
+
+    QByteArray fromUtf16, fromUtf8, fromLatin1;
+    {
+        QJsonStreamWriter writer(&fromUtf16);
+        writer.setFormat(QJsonDocument::Compact);
+        writer.startArray();
+        writer.append(string);
+        writer.endArray();
+    }
+    {
+        QJsonStreamWriter writer(&fromUtf8);
+        writer.setFormat(QJsonDocument::Compact);
+        writer.startArray();
+        writer.append(QUtf8StringView(utf8));
+        writer.endArray();
+    }
+    QCOMPARE(fromUtf16, expected);
+    QCOMPARE(fromUtf8, expected);
+
+    if (QString::fromLatin1(latin1) == string) {
+        QJsonStreamWriter writer(&fromLatin1);
+        writer.setFormat(QJsonDocument::Compact);
+        writer.startArray();
+        writer.append(QLatin1StringView(latin1));
+        writer.endArray();
+        QCOMPARE(fromLatin1, expected);
+    }
+}
+
+void tst_QJsonStreamWriter::numbers()
+{
+    QByteArray output;
+    QJsonStreamWriter writer(&output);
+    writer.setFormat(QJsonDocument::Compact);
+    writer.startArray();
+    writer.append(0);
+    writer.append(-1);
+    writer.append(std::numeric_limits<qint64>::min());
+    writer.append(std::numeric_limits<quint64>::max());
+    writer.append(0.1);
+    writer.append(1e300);
+    writer.append(qInf());
+    writer.append(qQNaN());
+    writer.append(nullptr);
+    writer.append("text");
+    writer.endArray();
+    QCOMPARE(output, "[0,-1,-9223372036854775808,18446744073709551615,0.1,1e+300,null,null,"
+                     "null,\"text\"]");
+}
+
+void tst_QJsonStreamWriter::device()
+{
+    // Enough output to be flushed in several blocks
+    QJsonArray array;
+    for (int i = 0; i < 10000; ++i)
+        array.append(QJsonObject{ { "index"_L1, i }, { "text"_L1, u"value %1"_s.arg(i) } });
+
+    const QByteArray expected = QJsonDocument(array).toJson();
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    {
+        QJsonStreamWriter writer(&buffer);
+        QCOMPARE(writer.device(), &buffer);
+        writer.startArray();
+        for (const QJsonValue &value : std::as_const(array)) {
+            write(writer, value);
+            if (buffer.size())
+                QVERIFY(buffer.size() < expected.size());
+        }
+        writer.endArray();
+        QVERIFY(buffer.size() > 0);
+        writer.flush();
+        QVERIFY(!writer.hasError());
+    }
+    QCOMPARE(buffer.data(), expected);
+
+    QBuffer readOnly;
+    QVERIFY(readOnly.open(QIODevice::ReadOnly));
+    QJsonStreamWriter writer(&readOnly);
+    writer.append(true);
+    QTest::ignoreMessage(QtWarningMsg, "QIODevice::write (QBuffer): ReadOnly device");
+    writer.flush();
+    QVERIFY(writer.hasError());
+}
+
+void tst_QJsonStreamWriter::roundTrip()
+{
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::ReadWrite));
+    {
+        QJsonStreamWriter writer(&buffer);
+        writer.startObject();
+        writer.appendKey("key with \"quotes\""_L1);
+        writer.startArray();
+        for (int i = 0; i < 1000; ++i)
+            writer.append(i * 0.5);
+        writer.endArray();
+        writer.appendKey(u8"ключ");
+        writer.append(u"значение");
+        writer.endObject();
+    }
+
+    QVERIFY(buffer.seek(0));
+    QJsonStreamReader reader(&buffer);
+    QVERIFY(reader.readNextValue());
+    QVERIFY(reader.readNextValue());
+    QCOMPARE(reader.name(), u"key with \"quotes\"");
+    for (int i = 0; i < 1000; ++i) {
+        QVERIFY(reader.readNextValue());
+        QCOMPARE(reader.toDouble(), i * 0.5);
+    }
+    QVERIFY(!reader.readNextValue());
+    QVERIFY(reader.readNextValue());
+    QCOMPARE(reader.name(), u"ключ");
+    QCOMPARE(reader.toString(), u"значение");
+    QVERIFY(!reader.readNextValue());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QJsonStreamWriter::mismatchedEnd()
+{
+    QByteArray output;
+    QJsonStreamWriter writer(&output);
+    QVERIFY(!writer.endArray());
+    QVERIFY(!writer.endObject());
+    writer.startArray();
+    QVERIFY(!writer.endObject());
+    QVERIFY(writer.endArray());
+    QVERIFY(!writer.endArray());
+}
+
+QTEST_MAIN(tst_QJsonStreamWriter)
+#include "tst_qjsonstreamwriter.moc"
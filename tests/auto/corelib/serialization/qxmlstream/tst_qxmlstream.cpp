@@ -615,6 +615,11 @@ private slots:
     void crashInUTF16Codec() const;
     void hasAttributeSignature() const;
     void hasAttribute() const;
+    void attributeAccessors_data() const;
+    void attributeAccessors() const;
+    void arenaParsing() const;
+    void readUtf8InChunks_data() const;
+    void readUtf8InChunks() const;
     void writeWithUtf8Codec() const;
     void writeWithStandalone() const;
     void writeCharacters_data() const;
@@ -1926,6 +1931,166 @@ void tst_QXmlStream::hasAttribute() const
     QT_TEST_EQUALITY_OPS(attrValue1, attrValue2, true);
 }
 
+void tst_QXmlStream::attributeAccessors_data() const
+{
+    QTest::addColumn<bool>("arenaParsing");
+
+    QTest::newRow("default") << false;
+    QTest::newRow("arena") << true;
+}
+
+void tst_QXmlStream::attributeAccessors() const
+{
+    QFETCH(bool, arenaParsing);
+
+    auto xml = QStringLiteral("<!DOCTYPE e [ <!ATTLIST e def CDATA 'fallback'> ]>"
+                              "<e"
+                              "  xmlns:p='http://example.com/2'"
+                              "  xmlns='http://example.com/'"
+                              "  attr1='value'"
+                              "  p:attr2='value2'"
+                              "  emptyAttr=''"
+                              "  α='β'"
+                              "  >"
+                              "    <noAttributes/>"
+                              "</e>");
+
+    QXmlStreamReader reader(xml);
+    reader.setArenaParsing(arenaParsing);
+    QCOMPARE(reader.arenaParsing(), arenaParsing);
+
+    QCOMPARE(reader.readNext(), QXmlStreamReader::StartDocument);
+    QCOMPARE(reader.readNext(), QXmlStreamReader::DTD);
+    QCOMPARE(reader.attributeCount(), 0);
+    QCOMPARE(reader.readNext(), QXmlStreamReader::StartElement);
+    QCOMPARE(reader.attributeCount(), 5);
+
+    // the accessors and the attribute list agree
+    const QXmlStreamAttributes atts = reader.attributes();
+    QCOMPARE(atts.size(), reader.attributeCount());
+    for (qsizetype i = 0; i < atts.size(); ++i) {
+        QCOMPARE(reader.attributeName(i), atts.at(i).name());
+        QCOMPARE(reader.attributeNamespaceUri(i), atts.at(i).namespaceUri());
+        QCOMPARE(reader.attributeQualifiedName(i), atts.at(i).qualifiedName());
+        QCOMPARE(reader.attributeValue(i), atts.at(i).value());
+        QCOMPARE(reader.isAttributeDefault(i), atts.at(i).isDefault());
+    }
+
+    QCOMPARE(reader.attributeName(1), u"attr2");
+    QCOMPARE(reader.attributeNamespaceUri(1), u"http://example.com/2");
+    QCOMPARE(reader.attributeQualifiedName(1), u"p:attr2");
+    QCOMPARE(reader.attributeValue(1), u"value2");
+    QVERIFY(!reader.isAttributeDefault(1));
+    QCOMPARE(reader.attributeName(4), u"def");
+    QCOMPARE(reader.attributeValue(4), u"fallback");
+    QVERIFY(reader.isAttributeDefault(4));
+
+    // lookups
+    QCOMPARE(reader.attributeValue(u"attr1"), u"value");
+    QCOMPARE(reader.attributeValue("p:attr2"_L1), u"value2");
+    QCOMPARE(reader.attributeValue(u8"α"), u"β");
+    QCOMPARE(reader.attributeValue(u"def"), u"fallback");
+    QVERIFY(!reader.attributeValue(u"emptyAttr").isNull());
+    QVERIFY(reader.attributeValue(u"emptyAttr").isEmpty());
+    QVERIFY(reader.attributeValue(u"DOESNOTEXIST").isNull());
+    QCOMPARE(reader.attributeValue(QString(), u"attr1"), u"value");
+    QCOMPARE(reader.attributeValue(u"http://example.com/2", u"attr2"), u"value2");
+    /* Attributes do not pick up the default namespace. */
+    QVERIFY(reader.attributeValue(u"http://example.com/", u"attr1").isNull());
+    QVERIFY(reader.attributeValue(u"WRONG_NAMESPACE", u"attr2").isNull());
+
+    QCOMPARE(reader.readNext(), QXmlStreamReader::Characters);
+    QCOMPARE(reader.attributeCount(), 0);
+    QCOMPARE(reader.readNext(), QXmlStreamReader::StartElement);
+    QCOMPARE(reader.attributeCount(), 0);
+    QVERIFY(reader.attributes().isEmpty());
+    QVERIFY(reader.attributeValue(u"attr1").isNull());
+
+    while (!reader.atEnd())
+        reader.readNext();
+    QVERIFY(!reader.hasError());
+
+    // the list returned by attributes() stays valid after the reader moved on
+    QCOMPARE(atts.value(u"attr1"), u"value");
+    QCOMPARE(atts.value(u"http://example.com/2", u"attr2"), u"value2");
+}
+
+void tst_QXmlStream::arenaParsing() const
+{
+    QXmlStreamReader reader;
+    QVERIFY(!reader.arenaParsing());
+    reader.setArenaParsing(true);
+    QVERIFY(reader.arenaParsing());
+
+    // the reader produces the same tokens with and without the arena
+    QFile file(QFINDTESTDATA("data/org_module.xml"));
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray xml = file.readAll();
+    QXmlStreamReader expected(xml);
+    reader.addData(xml);
+    while (!expected.atEnd()) {
+        QCOMPARE(reader.readNext(), expected.readNext());
+        QCOMPARE(reader.name(), expected.name());
+        QCOMPARE(reader.namespaceUri(), expected.namespaceUri());
+        QCOMPARE(reader.text(), expected.text());
+        QCOMPARE(reader.attributes(), expected.attributes());
+    }
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.hasError());
+
+    // clear() keeps the setting
+    reader.clear();
+    QVERIFY(reader.arenaParsing());
+}
+
+void tst_QXmlStream::readUtf8InChunks_data() const
+{
+    QTest::addColumn<int>("chunkSize");
+    QTest::addColumn<bool>("useDevice");
+
+    QTest::newRow("whole") << 0 << false;
+    QTest::newRow("1-byte") << 1 << false;
+    QTest::newRow("3-bytes") << 3 << false;
+    QTest::newRow("device") << 0 << true;
+}
+
+void tst_QXmlStream::readUtf8InChunks() const
+{
+    QFETCH(int, chunkSize);
+    QFETCH(bool, useDevice);
+
+    // long enough to span several device reads, with multi-byte sequences
+    // that straddle the chunk boundaries
+    QString text;
+    for (int i = 0; i < 4000; ++i)
+        text += u"aß€\U0001F600"_s;
+    const QByteArray xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?><doc a=\"ä€\">"
+            + text.toUtf8() + "</doc>";
+
+    QBuffer buffer;
+    QXmlStreamReader reader;
+    if (useDevice) {
+        buffer.setData(xml);
+        QVERIFY(buffer.open(QIODevice::ReadOnly));
+        reader.setDevice(&buffer);
+    } else if (chunkSize == 0) {
+        reader.addData(xml);
+    } else {
+        for (qsizetype i = 0; i < xml.size(); i += chunkSize)
+            reader.addData(xml.mid(i, chunkSize));
+    }
+
+    QCOMPARE(reader.readNext(), QXmlStreamReader::StartDocument);
+    QCOMPARE(reader.readNext(), QXmlStreamReader::StartElement);
+    QCOMPARE(reader.attributeValue(u"a"), u"ä€");
+    QString result;
+    while (reader.readNext() == QXmlStreamReader::Characters)
+        result += reader.text();
+    QCOMPARE(reader.tokenType(), QXmlStreamReader::EndElement);
+    QVERIFY2(!reader.hasError(), qPrintable(reader.errorString()));
+    QCOMPARE(result, text);
+}
+
 void tst_QXmlStream::writeWithUtf8Codec() const
 {
     QByteArray outarray;
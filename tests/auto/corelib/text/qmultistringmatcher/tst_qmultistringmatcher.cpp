@@ -0,0 +1,280 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <qmultistringmatcher.h>
+
+using namespace Qt::StringLiterals;
+using Match = QMultiStringMatcher::Match;
+
+class tst_QMultiStringMatcher : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void defaults();
+    void setters();
+    void match_data();
+    void match();
+    void matchAll_data();
+    void matchAll();
+    void caseFolding();
+};
+
+char *toString(const Match &m)
+{
+    return qstrdup(qPrintable(u"(%1, %2, %3)"_s.arg(m.position).arg(m.length).arg(m.patternIndex)));
+}
+
+static bool foldedEqual(QByteArrayView lhs, QByteArrayView rhs, Qt::CaseSensitivity cs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+    for (qsizetype i = 0; i < lhs.size(); ++i) {
+        const auto fold = [cs](char c) {
+            return cs == Qt::CaseInsensitive && c >= 'A' && c <= 'Z' ? char(c - 'A' + 'a') : c;
+        };
+        if (fold(lhs[i]) != fold(rhs[i]))
+            return false;
+    }
+    return true;
+}
+
+// Reference implementations that try every pattern at every position.
+// Duplicate patterns are only reported under their first index.
+static QList<Match> bruteForce(const QStringList &patterns, Qt::CaseSensitivity cs,
+                               QStringView haystack, qsizetype from)
+{
+    QList<Match> result;
+    for (qsizetype pos = from; pos < haystack.size(); ++pos) {
+        QList<Match> here;
+        for (qsizetype i = 0; i < patterns.size(); ++i) {
+            const QString &pattern = patterns.at(i);
+            if (pattern.isEmpty() || pos + pattern.size() > haystack.size())
+                continue;
+            if (haystack.sliced(pos, pattern.size()).compare(pattern, cs) != 0)
+                continue;
+            if (std::none_of(here.cbegin(), here.cend(), [&](const Match &m) {
+                    return patterns.at(m.patternIndex).compare(pattern, cs) == 0; })) {
+                here.append({ pos, pattern.size(), i });
+            }
+        }
+        std::sort(here.begin(), here.end(), [](const Match &lhs, const Match &rhs) {
+            return lhs.length < rhs.length;
+        });
+        result += here;
+    }
+    return result;
+}
+
+static QList<Match> bruteForce(const QStringList &patterns, Qt::CaseSensitivity cs,
+                               QByteArrayView haystack, qsizetype from)
+{
+    QList<Match> result;
+    for (qsizetype pos = from; pos < haystack.size(); ++pos) {
+        QList<Match> here;
+        for (qsizetype i = 0; i < patterns.size(); ++i) {
+            const QByteArray pattern = patterns.at(i).toUtf8();
+            if (pattern.isEmpty() || pos + pattern.size() > haystack.size())
+                continue;
+            if (!foldedEqual(haystack.sliced(pos, pattern.size()), pattern, cs))
+                continue;
+            if (std::none_of(here.cbegin(), here.cend(), [&](const Match &m) {
+                    return foldedEqual(patterns.at(m.patternIndex).toUtf8(), pattern, cs); })) {
+                here.append({ pos, pattern.size(), i });
+            }
+        }
+        std::sort(here.begin(), here.end(), [](const Match &lhs, const Match &rhs) {
+            return lhs.length < rhs.length;
+        });
+        result += here;
+    }
+    return result;
+}
+
+// The leftmost match, and of those the longest.
+static Match leftmostLongest(const QList<Match> &all)
+{
+    Match best;
+    for (const Match &m : all) {
+        if (!best.isValid() || m.position < best.position
+                || (m.position == best.position && m.length > best.length)) {
+            best = m;
+        }
+    }
+    return best;
+}
+
+void tst_QMultiStringMatcher::defaults()
+{
+    QMultiStringMatcher matcher;
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseSensitive);
+    QCOMPARE(matcher.patterns(), QStringList());
+    QCOMPARE(matcher.indexIn(u"foo"), -1);
+    QCOMPARE(matcher.indexIn(QLatin1StringView("foo")), -1);
+    QCOMPARE(matcher.indexIn(QByteArrayView("foo")), -1);
+    QVERIFY(!matcher.match(u"foo").isValid());
+    QVERIFY(matcher.matchAll(u"foo").isEmpty());
+
+    const QMultiStringMatcher empty({ QString(), QString() });
+    QCOMPARE(empty.indexIn(u"foo"), -1);
+    QVERIFY(empty.matchAll(u"foo").isEmpty());
+}
+
+void tst_QMultiStringMatcher::setters()
+{
+    QMultiStringMatcher matcher;
+    matcher.setCaseSensitivity(Qt::CaseInsensitive);
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseInsensitive);
+    matcher.setPatterns({ u"bar"_s, u"baz"_s });
+    QCOMPARE(matcher.patterns(), QStringList({ u"bar"_s, u"baz"_s }));
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseInsensitive);
+    QCOMPARE(matcher.indexIn(u"foo BAZ"), 4);
+
+    const QMultiStringMatcher copy = matcher;
+    matcher.setCaseSensitivity(Qt::CaseSensitive);
+    QCOMPARE(matcher.indexIn(u"foo BAZ"), -1);
+    QCOMPARE(copy.indexIn(u"foo BAZ"), 4);
+    QCOMPARE(matcher.indexIn(u"foo baz bar"), 4);
+
+    matcher = copy;
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseInsensitive);
+    QCOMPARE(matcher.indexIn(u"foo BAZ"), 4);
+}
+
+void tst_QMultiStringMatcher::match_data()
+{
+    QTest::addColumn<QStringList>("patterns");
+    QTest::addColumn<bool>("caseInsensitive");
+    QTest::addColumn<QString>("haystack");
+    QTest::addColumn<int>("from");
+    QTest::addColumn<int>("position");
+    QTest::addColumn<int>("length");
+    QTest::addColumn<int>("patternIndex");
+
+    const QStringList he = { u"he"_s, u"she"_s, u"his"_s, u"hers"_s };
+    QTest::newRow("classic") << he << false << u"ushers"_s << 0 << 1 << 3 << 1;
+    QTest::newRow("classic-from") << he << false << u"ushers"_s << 2 << 2 << 4 << 3;
+    QTest::newRow("classic-none") << he << false << u"usher"_s << 4 << -1 << 0 << -1;
+    QTest::newRow("from-past-end") << he << false << u"he"_s << 3 << -1 << 0 << -1;
+    QTest::newRow("negative-from") << he << false << u"he"_s << -1 << -1 << 0 << -1;
+    QTest::newRow("leftmost-ends-later")
+            << QStringList{ u"bc"_s, u"abcd"_s } << false << u"xabcd"_s << 0 << 1 << 4 << 1;
+    QTest::newRow("longest-at-position")
+            << QStringList{ u"ab"_s, u"abc"_s, u"a"_s } << false << u"abcab"_s << 0 << 0 << 3 << 1;
+    QTest::newRow("duplicates")
+            << QStringList{ u"x"_s, u"foo"_s, u"foo"_s } << false << u"a foo"_s << 0 << 2 << 3 << 1;
+    QTest::newRow("case-sensitive")
+            << QStringList{ u"Foo"_s } << false << u"foo Foo"_s << 0 << 4 << 3 << 0;
+    QTest::newRow("case-insensitive")
+            << QStringList{ u"Foo"_s } << true << u"fOO Foo"_s << 0 << 0 << 3 << 0;
+    QTest::newRow("case-insensitive-duplicates")
+            << QStringList{ u"FOO"_s, u"foo"_s } << true << u"a Foo"_s << 0 << 2 << 3 << 0;
+    QTest::newRow("unicode")
+            << QStringList{ u"мир"_s, u"世界"_s } << false
+            << u"hello 世界, привет мир"_s
+            << 0 << 6 << 2 << 1;
+    QTest::newRow("unicode-case-insensitive")
+            << QStringList{ u"мир"_s } << true
+            << u"ПРИВЕТ МИР"_s << 0 << 7 << 3 << 0;
+    QTest::newRow("surrogates")
+            << QStringList{ u"\U0001F600!"_s } << false << u"a\U0001F600\U0001F600!"_s << 0 << 3 << 3 << 0;
+}
+
+void tst_QMultiStringMatcher::match()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(bool, caseInsensitive);
+    QFETCH(QString, haystack);
+    QFETCH(int, from);
+    QFETCH(int, position);
+    QFETCH(int, length);
+    QFETCH(int, patternIndex);
+
+    const Qt::CaseSensitivity cs = caseInsensitive ? Qt::CaseInsensitive : Qt::CaseSensitive;
+    const QMultiStringMatcher matcher(patterns, cs);
+    const Match expected = { position, length, patternIndex };
+    QCOMPARE(matcher.match(haystack, from), expected);
+    QCOMPARE(matcher.indexIn(haystack, from), position);
+
+    const QByteArray utf8 = haystack.toUtf8();
+    const QList<Match> all = bruteForce(patterns, cs, utf8, qMax(from, 0));
+    QCOMPARE(matcher.match(QByteArrayView(utf8), from), from < 0 ? Match() : leftmostLongest(all));
+
+    const QByteArray latin1 = haystack.toLatin1();
+    if (QString::fromLatin1(latin1) == haystack)
+        QCOMPARE(matcher.match(QLatin1StringView(latin1), from), expected);
+}
+
+void tst_QMultiStringMatcher::matchAll_data()
+{
+    QTest::addColumn<QStringList>("patterns");
+    QTest::addColumn<QString>("haystack");
+
+    QTest::newRow("classic") << QStringList{ u"he"_s, u"she"_s, u"his"_s, u"hers"_s }
+                             << u"ushers and she said his hers is HERS"_s;
+    QTest::newRow("overlapping") << QStringList{ u"a"_s, u"aa"_s, u"aaa"_s, u"ab"_s, u"b"_s }
+                                 << u"aaaabaaAbAB"_s;
+    QTest::newRow("prefixes") << QStringList{ u"abcd"_s, u"bc"_s, u"c"_s, u"bcd"_s, u"x"_s }
+                              << u"abcdbcabcXabcD"_s;
+    QTest::newRow("latin1") << QStringList{ u"été"_s, u"ÉT"_s, u"straße"_s }
+                            << u"ÉTÉ in der STRAßE, été"_s;
+    QTest::newRow("mixed") << QStringList{ u"мир"_s, u"世"_s, u"KB"_s,
+                                           u"\U0001F600"_s, u"\u00b5s"_s }
+                           << u"МИР 世界 12 kb, 3 \u00b5S \U0001F600\U0001F600"_s;
+
+    QString log;
+    for (int i = 0; i < 50; ++i)
+        log += u"line %1: WARNING timeout in module foo/bar (error %2)\n"_s.arg(i).arg(i % 7);
+    QTest::newRow("log") << QStringList{ u"error"_s, u"warn"_s, u"Warning"_s, u"timeout in"_s,
+                                         u"foo/bar"_s, u"bar (e"_s, u"3)"_s, u"nope"_s }
+                         << log;
+}
+
+void tst_QMultiStringMatcher::matchAll()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(QString, haystack);
+
+    for (Qt::CaseSensitivity cs : { Qt::CaseSensitive, Qt::CaseInsensitive }) {
+        const QMultiStringMatcher matcher(patterns, cs);
+        for (qsizetype from : { 0, 1, 5 }) {
+            const QList<Match> expected = bruteForce(patterns, cs, QStringView(haystack), from);
+            QCOMPARE(matcher.matchAll(haystack, from), expected);
+            QCOMPARE(matcher.match(haystack, from), leftmostLongest(expected));
+
+            const QByteArray latin1 = haystack.toLatin1();
+            if (QString::fromLatin1(latin1) == haystack) {
+                QCOMPARE(matcher.matchAll(QLatin1StringView(latin1), from), expected);
+                QCOMPARE(matcher.match(QLatin1StringView(latin1), from), leftmostLongest(expected));
+            }
+
+            const QByteArray utf8 = haystack.toUtf8();
+            const QList<Match> expectedUtf8 = bruteForce(patterns, cs, utf8, from);
+            QCOMPARE(matcher.matchAll(QByteArrayView(utf8), from), expectedUtf8);
+            QCOMPARE(matcher.match(QByteArrayView(utf8), from), leftmostLongest(expectedUtf8));
+        }
+    }
+}
+
+void tst_QMultiStringMatcher::caseFolding()
+{
+    const QMultiStringMatcher matcher({ u"k"_s, u"μ"_s, u"\U00010428"_s }, Qt::CaseInsensitive);
+    // KELVIN SIGN folds to 'k'
+    QCOMPARE(matcher.match(u"aK"), Match({ 1, 1, 0 }));
+    // MICRO SIGN folds to GREEK SMALL LETTER MU, also in Latin-1
+    QCOMPARE(matcher.match(u"aµ"), Match({ 1, 1, 1 }));
+    QCOMPARE(matcher.match(QLatin1StringView("a\xb5")), Match({ 1, 1, 1 }));
+    // DESERET CAPITAL LETTER LONG I folds to the small letter
+    QCOMPARE(matcher.match(u"a\U00010400"), Match({ 1, 2, 2 }));
+    // unpaired surrogates only match themselves
+    QCOMPARE(matcher.match(QStringView(u"\U00010400").first(1)), Match());
+
+    // byte arrays are only folded in the US-ASCII range
+    QCOMPARE(matcher.match(QByteArrayView("aK")), Match({ 1, 1, 0 }));
+    QCOMPARE(matcher.match(QByteArrayView("\xce\x9c")), Match());
+    QCOMPARE(matcher.match(QByteArrayView("\xce\xbc")), Match({ 0, 2, 1 }));
+}
+
+QTEST_APPLESS_MAIN(tst_QMultiStringMatcher)
+#include "tst_qmultistringmatcher.moc"
@@ -70,6 +70,12 @@ private slots:
     void QStringAndQStringViewEquivalence();
     void threadSafety_data();
     void threadSafety();
+    void compiledMatch_data();
+    void compiledMatch();
+    void compiledMatchBatch();
+    void matchAfterDeepBacktracking();
+    void compiledThreadSafety_data();
+    void compiledThreadSafety();
 
     void returnsViewsIntoOriginalString();
     void wildcard_data();
@@ -2405,6 +2411,165 @@ void tst_QRegularExpression::threadSafety()
     }
 }
 
+void tst_QRegularExpression::compiledMatch_data()
+{
+    normalMatch_data();
+}
+
+void tst_QRegularExpression::compiledMatch()
+{
+    QFETCH(QRegularExpression, regexp);
+    QFETCH(QString, subject);
+    QFETCH(qsizetype, offset);
+    QFETCH(QRegularExpression::MatchOptions, matchOptions);
+
+    const QCompiledRegularExpression compiled(regexp, matchOptions);
+    QCOMPARE(compiled.isValid(), regexp.isValid());
+    QCOMPARE(compiled.regularExpression(), regexp);
+    QCOMPARE(compiled.matchOptions(), matchOptions);
+    if (!regexp.isValid()) {
+        QCOMPARE(compiled.captureCount(), -1);
+        QList<qsizetype> offsets(2, 0);
+        QVERIFY(!compiled.match(subject, offsets, offset));
+        QCOMPARE(offsets, QList<qsizetype>({ -1, -1 }));
+        return;
+    }
+    QCOMPARE(compiled.captureCount(), regexp.captureCount());
+
+    const QRegularExpressionMatch expected =
+            regexp.matchView(subject, offset, QRegularExpression::NormalMatch, matchOptions);
+
+    // one pair more than there are capturing groups, which must be unset
+    const int pairs = regexp.captureCount() + 2;
+    QList<qsizetype> offsets(2 * pairs, 0);
+    QCOMPARE(compiled.match(subject, offsets, offset), expected.hasMatch());
+    for (int i = 0; i < pairs; ++i) {
+        QCOMPARE(offsets.at(2 * i), expected.capturedStart(i));
+        QCOMPARE(offsets.at(2 * i + 1), expected.capturedEnd(i));
+    }
+
+    // a buffer that is too small only gets the first groups, an odd size
+    // leaves the last entry unset
+    QList<qsizetype> start(1, 0);
+    QCOMPARE(compiled.match(subject, start, offset), expected.hasMatch());
+    QCOMPARE(start.at(0), expected.hasMatch() ? expected.capturedStart(0) : -1);
+    QList<qsizetype> odd(3, 0);
+    QCOMPARE(compiled.match(subject, odd, offset), expected.hasMatch());
+    QCOMPARE(odd.at(1), expected.hasMatch() ? expected.capturedEnd(0) : -1);
+    QCOMPARE(odd.at(2), expected.hasMatch() && pairs > 2 ? expected.capturedStart(1) : -1);
+
+    QCOMPARE(compiled.match(subject, {}, offset), expected.hasMatch());
+
+    // copies share the compiled pattern
+    const QCompiledRegularExpression copy = compiled;
+    QCOMPARE(copy.match(subject, offsets, offset), expected.hasMatch());
+    QCOMPARE(offsets.at(0), expected.capturedStart(0));
+}
+
+void tst_QRegularExpression::compiledMatchBatch()
+{
+    const QCompiledRegularExpression re(QRegularExpression(QStringLiteral("(\\d+)-(\\d+)?")));
+    QCOMPARE(re.captureCount(), 2);
+
+    const QList<QStringView> subjects = { u"a 12-34", u"none", u"5-", u"", u"77-8" };
+    QList<qsizetype> offsets(subjects.size() * 6, 0);
+    QCOMPARE(re.matchBatch(subjects, offsets), 3);
+    const QList<qsizetype> expected = {
+        2, 7, 2, 4, 5, 7,
+        -1, -1, -1, -1, -1, -1,
+        0, 2, 0, 1, -1, -1,
+        -1, -1, -1, -1, -1, -1,
+        0, 4, 0, 2, 3, 4,
+    };
+    QCOMPARE(offsets, expected);
+
+    QCOMPARE(re.matchBatch(subjects), 3);
+
+    // only the whole match
+    offsets.resize(subjects.size() * 2);
+    QCOMPARE(re.matchBatch(subjects, offsets), 3);
+    QCOMPARE(offsets, QList<qsizetype>({ 2, 7, -1, -1, 0, 2, -1, -1, 0, 4 }));
+
+    QCOMPARE(re.matchBatch({}, offsets), 0);
+
+    const QCompiledRegularExpression invalid;
+    QVERIFY(!invalid.isValid());
+    QCOMPARE(invalid.captureCount(), -1);
+    QCOMPARE(invalid.matchBatch(subjects, offsets), 0);
+    QCOMPARE(offsets, QList<qsizetype>(subjects.size() * 2, -1));
+}
+
+void tst_QRegularExpression::matchAfterDeepBacktracking()
+{
+    // Without the JIT, such a match grows the interpreter's heap frames far
+    // beyond what the thread's match data keeps, so the match data is
+    // recreated afterwards. The following matches must not notice.
+    const QRegularExpression regexp(QStringLiteral("^(?:(a)|b)+$"));
+    const QString deep = QString(20000, u'a') + u'c';
+    const QString shallow = QStringLiteral("ab");
+
+    QVERIFY(!regexp.match(deep).hasMatch());
+    QRegularExpressionMatch match = regexp.match(shallow);
+    QVERIFY(match.hasMatch());
+    QCOMPARE(match.capturedStart(1), 0);
+
+    const QCompiledRegularExpression re(regexp);
+    const QList<QStringView> subjects = { deep, shallow, deep, shallow };
+    QList<qsizetype> offsets(subjects.size() * 4, 0);
+    QCOMPARE(re.matchBatch(subjects, offsets), 2);
+    const QList<qsizetype> expected = {
+        -1, -1, -1, -1,
+        0, 2, 0, 1,
+        -1, -1, -1, -1,
+        0, 2, 0, 1,
+    };
+    QCOMPARE(offsets, expected);
+
+    qsizetype single[4];
+    QVERIFY(!re.match(deep, single));
+    QVERIFY(re.match(shallow, single));
+    QCOMPARE(single[2], 0);
+}
+
+void tst_QRegularExpression::compiledThreadSafety_data()
+{
+    threadSafety_data();
+}
+
+void tst_QRegularExpression::compiledThreadSafety()
+{
+#if defined(Q_OS_WASM)
+    QSKIP("This test misbehaves on WASM. Investigation needed (QTBUG-110067)");
+#endif
+
+    QFETCH(QString, pattern);
+    QFETCH(QString, subject);
+
+    const QRegularExpressionMatch expected = QRegularExpression(pattern).match(subject);
+    const QCompiledRegularExpression re{QRegularExpression(pattern)};
+    const int threadCount = qMax(QThread::idealThreadCount(), 4);
+
+    QAtomicInt failures = 0;
+    QList<QThread *> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.append(QThread::create([&] {
+            qsizetype offsets[2];
+            for (int j = 0; j < 20; ++j) {
+                if (re.match(subject, offsets) != expected.hasMatch()
+                        || offsets[0] != expected.capturedStart()
+                        || offsets[1] != expected.capturedEnd()) {
+                    failures.ref();
+                }
+            }
+        }));
+        threads.last()->start();
+    }
+    for (QThread *thread : std::as_const(threads))
+        thread->wait();
+    qDeleteAll(threads);
+    QCOMPARE(failures.loadRelaxed(), 0);
+}
+
 void tst_QRegularExpression::returnsViewsIntoOriginalString()
 {
     // https://bugreports.qt.io/browse/QTBUG-98653
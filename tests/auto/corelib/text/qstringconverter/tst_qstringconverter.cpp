@@ -144,6 +144,8 @@ private slots:
     void convertUtf8();
     void convertUtf8CharByChar_data() { convertUtf8_data(); }
     void convertUtf8CharByChar();
+    void convertUtf8MultiByte_data();
+    void convertUtf8MultiByte();
     void roundtrip_data();
     void roundtrip();
 
@@ -390,6 +392,53 @@ void tst_QStringConverter::convertUtf8CharByChar()
     QCOMPARE(reencoded, ba);
 }
 
+void tst_QStringConverter::convertUtf8MultiByte_data()
+{
+    QTest::addColumn<QString>("text");
+
+    // long enough to go through the vectorized multi-byte code
+    auto addRow = [](const char *name, QStringView sample) {
+        QString text;
+        while (text.size() < 200)
+            text += sample;
+        QTest::newRow(name) << text;
+    };
+    addRow("latin1", u"déjà vu, naïve élève ");
+    addRow("cyrillic", u"Съешь же ещё ");
+    addRow("cjk", u"漢字仅名中文日本語");
+    addRow("korean", u"한국어 텍스트 ");
+    addRow("emoji", u"\U0001f600\U0001f680\U0001f9d1\U00010000\U0010ffff");
+    addRow("mixed", u"aéЖ中\U0001f600￿߿ࠀ퟿ ");
+}
+
+void tst_QStringConverter::convertUtf8MultiByte()
+{
+    QFETCH(QString, text);
+
+    QByteArray utf8;
+    QStringEncoder encoder(QStringEncoder::Utf8);
+    for (qsizetype i = 0; i < text.size(); ++i)
+        utf8 += encoder.encode(QStringView(text).sliced(i, 1));
+    QVERIFY(!encoder.hasError());
+
+    QCOMPARE(text.toUtf8(), utf8);
+    QCOMPARE(QString::fromUtf8(utf8), text);
+    QVERIFY(QUtf8StringView(utf8).isValidUtf8());
+
+    // errors anywhere in a window must be handled like the scalar code does
+    for (qsizetype i = 0; i < 64 && i < utf8.size(); ++i) {
+        for (char bad : { '\x80', '\xc0', '\xe0', '\xed', '\xf4', '\xff' }) {
+            QByteArray input = utf8;
+            input[i] = bad;
+            // the stateful decoder has a separate, scalar implementation
+            QStringDecoder decoder(QStringDecoder::Utf8);
+            const QString expected = decoder.decode(input);
+            QCOMPARE(QString::fromUtf8(input), expected);
+            QCOMPARE(QUtf8StringView(input).isValidUtf8(), !decoder.hasError());
+        }
+    }
+}
+
 void tst_QStringConverter::convertL1U16()
 {
     const QLatin1StringView latin1("some plain latin1 text");
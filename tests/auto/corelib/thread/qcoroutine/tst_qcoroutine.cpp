@@ -0,0 +1,479 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QtCore/qbuffer.h>
+#include <QtCore/qcoroutine.h>
+#include <QtCore/qexception.h>
+#include <QtCore/qthread.h>
+
+#include <memory>
+
+using namespace Qt::StringLiterals;
+
+class tst_QCoroutine : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void readyFuture();
+    void pendingFuture();
+    void futureFromThread();
+    void voidFuture();
+    void chainedCoroutines();
+    void severalAwaiters();
+    void awaitWithContinuation();
+    void canceledFuture();
+    void cancelCoroutine();
+#ifndef QT_NO_EXCEPTIONS
+    void exception();
+#endif
+    void signal();
+    void signalArguments();
+    void signalSenderDestroyed();
+    void signalFromThread();
+    void readyRead();
+    void readyReadClosed();
+    void bytesWritten();
+    void frameRecycling();
+};
+
+class Emitter : public QObject
+{
+    Q_OBJECT
+signals:
+    void triggered();
+    void valueChanged(int value);
+    void pairChanged(int value, const QString &text);
+};
+
+#if defined(QT_COROUTINES_SUPPORTED)
+
+// A write-only device that reports its pending data as written on flush().
+class PendingDevice : public QIODevice
+{
+public:
+    PendingDevice() { open(QIODevice::WriteOnly); }
+
+    qint64 bytesToWrite() const override { return pending; }
+    void flushPending() { emit bytesWritten(std::exchange(pending, 0)); }
+
+protected:
+    qint64 readData(char *, qint64) override { return -1; }
+    qint64 writeData(const char *, qint64 size) override
+    {
+        pending += size;
+        return size;
+    }
+
+private:
+    qint64 pending = 0;
+};
+
+// Sets the flag when it goes out of scope, i.e. when the coroutine ends.
+struct ScopeFlag
+{
+    bool *flag;
+    ~ScopeFlag() { *flag = true; }
+};
+
+static QFuture<int> addOne(QFuture<int> future)
+{
+    const int value = co_await future;
+    co_return value + 1;
+}
+
+static QFuture<int> addOneTracked(QFuture<int> future, bool *resumed, bool *destroyed)
+{
+    ScopeFlag guard{destroyed};
+    const int value = co_await future;
+    *resumed = true;
+    co_return value + 1;
+}
+
+static QFuture<QThread *> resumingThread(QFuture<void> future)
+{
+    co_await future;
+    co_return QThread::currentThread();
+}
+
+void tst_QCoroutine::readyFuture()
+{
+    QFuture<int> future = addOne(QtFuture::makeReadyValueFuture(41));
+    QVERIFY(future.isFinished());
+    QCOMPARE(future.result(), 42);
+}
+
+void tst_QCoroutine::pendingFuture()
+{
+    QPromise<int> promise;
+    promise.start();
+    QFuture<int> future = addOne(promise.future());
+    QVERIFY(!future.isFinished());
+
+    promise.addResult(1);
+    promise.finish();
+    // resumes from the event loop
+    QVERIFY(!future.isFinished());
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), 2);
+}
+
+void tst_QCoroutine::futureFromThread()
+{
+    QPromise<void> promise;
+    promise.start();
+    QFuture<QThread *> future = resumingThread(promise.future());
+
+    std::unique_ptr<QThread> thread(QThread::create([&promise] { promise.finish(); }));
+    thread->start();
+    QVERIFY(thread->wait());
+
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), QThread::currentThread());
+}
+
+void tst_QCoroutine::voidFuture()
+{
+    bool done = false;
+    auto coroutine = [&done](QFuture<void> future) -> QFuture<void> {
+        co_await future;
+        done = true;
+    };
+
+    QPromise<void> promise;
+    promise.start();
+    QFuture<void> future = coroutine(promise.future());
+    QVERIFY(!done);
+    promise.finish();
+    QTRY_VERIFY(future.isFinished());
+    QVERIFY(done);
+    QVERIFY(!future.isCanceled());
+}
+
+void tst_QCoroutine::chainedCoroutines()
+{
+    QPromise<int> promise;
+    promise.start();
+    QFuture<int> future = addOne(addOne(addOne(promise.future())));
+
+    promise.addResult(0);
+    promise.finish();
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), 3);
+}
+
+void tst_QCoroutine::severalAwaiters()
+{
+    QPromise<int> promise;
+    promise.start();
+    QFuture<int> first = addOne(promise.future());
+    QFuture<int> second = addOne(promise.future());
+
+    promise.addResult(1);
+    promise.finish();
+    QTRY_VERIFY(first.isFinished() && second.isFinished());
+    QCOMPARE(first.result(), 2);
+    QCOMPARE(second.result(), 2);
+}
+
+void tst_QCoroutine::awaitWithContinuation()
+{
+    // continuation first
+    {
+        QPromise<int> promise;
+        promise.start();
+        QFuture<int> then = promise.future().then([](int value) { return value * 2; });
+        QFuture<int> awaited = addOne(promise.future());
+
+        promise.addResult(20);
+        promise.finish();
+        QTRY_VERIFY(awaited.isFinished());
+        QCOMPARE(awaited.result(), 21);
+        QVERIFY(then.isFinished());
+        QCOMPARE(then.result(), 40);
+    }
+
+    // awaited first
+    {
+        QPromise<int> promise;
+        promise.start();
+        QFuture<int> awaited = addOne(promise.future());
+        QFuture<int> then = promise.future().then([](int value) { return value * 2; });
+
+        promise.addResult(20);
+        promise.finish();
+        QVERIFY(then.isFinished());
+        QCOMPARE(then.result(), 40);
+        QTRY_VERIFY(awaited.isFinished());
+        QCOMPARE(awaited.result(), 21);
+    }
+}
+
+void tst_QCoroutine::canceledFuture()
+{
+    bool resumed = false;
+    bool destroyed = false;
+    QPromise<int> promise;
+    promise.start();
+    QFuture<int> future = addOneTracked(promise.future(), &resumed, &destroyed);
+
+    promise.future().cancel();
+    promise.finish();
+    QTRY_VERIFY(destroyed);
+    QVERIFY(!resumed);
+    QVERIFY(future.isFinished());
+    QVERIFY(future.isCanceled());
+    QCOMPARE(future.resultCount(), 0);
+}
+
+void tst_QCoroutine::cancelCoroutine()
+{
+    bool resumed = false;
+    bool destroyed = false;
+    QPromise<int> promise;
+    promise.start();
+    QFuture<int> future = addOneTracked(promise.future(), &resumed, &destroyed);
+
+    future.cancel();
+    promise.addResult(1);
+    promise.finish();
+    QTRY_VERIFY(destroyed);
+    QVERIFY(!resumed);
+    QVERIFY(future.isFinished());
+    QVERIFY(future.isCanceled());
+}
+
+#ifndef QT_NO_EXCEPTIONS
+void tst_QCoroutine::exception()
+{
+    // propagates to the future of the coroutine
+    {
+        QPromise<int> promise;
+        promise.start();
+        QFuture<int> future = addOne(promise.future());
+        promise.setException(std::make_exception_ptr(QException()));
+        promise.finish();
+        QTRY_VERIFY(future.isFinished());
+        QVERIFY_THROWS_EXCEPTION(QException, future.result());
+    }
+
+    // can be caught in the coroutine
+    {
+        auto coroutine = [](QFuture<int> future) -> QFuture<int> {
+            try {
+                co_return co_await future;
+            } catch (const QException &) {
+                co_return -1;
+            }
+        };
+        QPromise<int> promise;
+        promise.start();
+        QFuture<int> future = coroutine(promise.future());
+        promise.setException(std::make_exception_ptr(QException()));
+        promise.finish();
+        QTRY_VERIFY(future.isFinished());
+        QCOMPARE(future.result(), -1);
+    }
+}
+#endif
+
+void tst_QCoroutine::signal()
+{
+    Emitter emitter;
+    auto coroutine = [](Emitter *emitter) -> QFuture<int> {
+        const bool triggered = co_await QtCoroutine::waitForSignal(emitter, &Emitter::triggered);
+        if (!triggered)
+            co_return -1;
+        const std::optional<int> value =
+                co_await QtCoroutine::waitForSignal(emitter, &Emitter::valueChanged);
+        co_return value.value_or(-1);
+    };
+
+    QFuture<int> future = coroutine(&emitter);
+    emit emitter.triggered();
+    // queued, the value is emitted before the coroutine waits for it
+    emit emitter.valueChanged(1);
+    QTest::qWait(0);
+    QVERIFY(!future.isFinished());
+
+    emit emitter.valueChanged(42);
+    // only the first emission counts
+    emit emitter.valueChanged(43);
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), 42);
+}
+
+void tst_QCoroutine::signalArguments()
+{
+    Emitter emitter;
+    auto coroutine = [](Emitter *emitter) -> QFuture<QString> {
+        const auto pair = co_await QtCoroutine::waitForSignal(emitter, &Emitter::pairChanged);
+        if (!pair)
+            co_return QString();
+        co_return QString::number(std::get<0>(*pair)) + std::get<1>(*pair);
+    };
+
+    QFuture<QString> future = coroutine(&emitter);
+    emit emitter.pairChanged(7, u"up"_s);
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), u"7up"_s);
+}
+
+void tst_QCoroutine::signalSenderDestroyed()
+{
+    auto emitter = std::make_unique<Emitter>();
+    auto coroutine = [](Emitter *emitter) -> QFuture<bool> {
+        const std::optional<int> value =
+                co_await QtCoroutine::waitForSignal(emitter, &Emitter::valueChanged);
+        co_return value.has_value();
+    };
+
+    QFuture<bool> future = coroutine(emitter.get());
+    emitter.reset();
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), false);
+}
+
+void tst_QCoroutine::signalFromThread()
+{
+    Emitter emitter;
+    auto coroutine = [](Emitter *emitter) -> QFuture<QThread *> {
+        co_await QtCoroutine::waitForSignal(emitter, &Emitter::valueChanged);
+        co_return QThread::currentThread();
+    };
+
+    QFuture<QThread *> future = coroutine(&emitter);
+    std::unique_ptr<QThread> thread(QThread::create([&emitter] { emit emitter.valueChanged(1); }));
+    thread->start();
+    QVERIFY(thread->wait());
+
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), QThread::currentThread());
+}
+
+void tst_QCoroutine::readyRead()
+{
+    auto coroutine = [](QIODevice *device) -> QFuture<QByteArray> {
+        if (!co_await QtCoroutine::waitForReadyRead(device))
+            co_return QByteArray();
+        co_return device->readAll();
+    };
+
+    // data is already there
+    {
+        QBuffer buffer;
+        buffer.setData("ready");
+        QVERIFY(buffer.open(QIODevice::ReadOnly));
+        QFuture<QByteArray> future = coroutine(&buffer);
+        QVERIFY(future.isFinished());
+        QCOMPARE(future.result(), "ready");
+    }
+
+    // data arrives later
+    {
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::ReadWrite));
+        QFuture<QByteArray> future = coroutine(&buffer);
+        QVERIFY(!future.isFinished());
+        buffer.write("later");
+        buffer.seek(0);
+        QTRY_VERIFY(future.isFinished());
+        QCOMPARE(future.result(), "later");
+    }
+}
+
+void tst_QCoroutine::readyReadClosed()
+{
+    auto coroutine = [](QIODevice *device) -> QFuture<bool> {
+        co_return co_await QtCoroutine::waitForReadyRead(device);
+    };
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QFuture<bool> future = coroutine(&buffer);
+    QVERIFY(!future.isFinished());
+    buffer.close();
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), false);
+
+    // not readable at all
+    future = coroutine(&buffer);
+    QVERIFY(future.isFinished());
+    QCOMPARE(future.result(), false);
+}
+
+void tst_QCoroutine::bytesWritten()
+{
+    auto coroutine = [](QIODevice *device) -> QFuture<qint64> {
+        co_return co_await QtCoroutine::waitForBytesWritten(device);
+    };
+
+    PendingDevice device;
+    QFuture<qint64> future = coroutine(&device);
+    // nothing to write
+    QVERIFY(future.isFinished());
+    QCOMPARE(future.result(), 0);
+
+    device.write("pending");
+    future = coroutine(&device);
+    QVERIFY(!future.isFinished());
+    device.flushPending();
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), 7);
+
+    device.write("closed");
+    future = coroutine(&device);
+    device.close();
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), -1);
+}
+
+void tst_QCoroutine::frameRecycling()
+{
+    void *frame = QtPrivate::allocateCoroutineFrame(100);
+    QtPrivate::deallocateCoroutineFrame(frame, 100);
+    // same size class
+    void *recycled = QtPrivate::allocateCoroutineFrame(120);
+    QCOMPARE(recycled, frame);
+    QtPrivate::deallocateCoroutineFrame(recycled, 120);
+
+    // frames of a coroutine that is called in a loop come from the cache
+    QPromise<int> promise;
+    promise.start();
+    promise.addResult(1);
+    promise.finish();
+    for (int i = 0; i < 10; ++i)
+        QCOMPARE(addOne(promise.future()).result(), 2);
+}
+
+#else // QT_COROUTINES_SUPPORTED
+
+#define SKIP_ALL(name) \
+    void tst_QCoroutine::name() { QSKIP("This compiler doesn't support C++20 coroutines"); }
+SKIP_ALL(readyFuture)
+SKIP_ALL(pendingFuture)
+SKIP_ALL(futureFromThread)
+SKIP_ALL(voidFuture)
+SKIP_ALL(chainedCoroutines)
+SKIP_ALL(severalAwaiters)
+SKIP_ALL(awaitWithContinuation)
+SKIP_ALL(canceledFuture)
+SKIP_ALL(cancelCoroutine)
+#ifndef QT_NO_EXCEPTIONS
+SKIP_ALL(exception)
+#endif
+SKIP_ALL(signal)
+SKIP_ALL(signalArguments)
+SKIP_ALL(signalSenderDestroyed)
+SKIP_ALL(signalFromThread)
+SKIP_ALL(readyRead)
+SKIP_ALL(readyReadClosed)
+SKIP_ALL(bytesWritten)
+SKIP_ALL(frameRecycling)
+#undef SKIP_ALL
+
+#endif // QT_COROUTINES_SUPPORTED
+
+QTEST_MAIN(tst_QCoroutine)
+#include "tst_qcoroutine.moc"
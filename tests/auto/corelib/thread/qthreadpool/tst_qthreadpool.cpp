@@ -16,6 +16,7 @@
 #endif
 
 using namespace std::chrono_literals;
+using namespace Qt::StringLiterals;
 
 typedef void (*FunctionPointer)();
 
@@ -81,6 +82,13 @@ private slots:
     void clear();
     void clearWithAutoDelete();
     void tryTake();
+    void workStealing();
+    void workStealingPriority();
+    void workStealingTryTake();
+    void workStealingTryTakeFromOtherThread();
+    void workStealingIdleThread();
+    void workStealingClear();
+    void workStealingEnabledLater();
     void waitForDoneTimeout();
     void destroyingWaitsForTasksToFinish();
     void stackSize();
@@ -1243,6 +1251,214 @@ void tst_QThreadPool::tryTake()
     delete runnables[0]; // if the pool deletes them then we'll get double-free crash
 }
 
+void tst_QThreadPool::workStealing()
+{
+    // splits itself until the depth is reached, like a parallel quicksort
+    class Splitter : public QRunnable
+    {
+    public:
+        QThreadPool &pool;
+        QAtomicInt &leaves;
+        int depth;
+        Splitter(QThreadPool &pool, QAtomicInt &leaves, int depth)
+            : pool(pool), leaves(leaves), depth(depth) {}
+        void run() override
+        {
+            if (depth == 0) {
+                leaves.ref();
+                return;
+            }
+            pool.start(new Splitter(pool, leaves, depth - 1));
+            pool.start(new Splitter(pool, leaves, depth - 1));
+        }
+    };
+
+    TestThreadPool threadPool;
+    QVERIFY(!threadPool.isWorkStealingEnabled());
+    threadPool.setWorkStealingEnabled(true);
+    QVERIFY(threadPool.isWorkStealingEnabled());
+    threadPool.setMaxThreadCount(4);
+
+    for (int i = 0; i < 5; ++i) {
+        QAtomicInt leaves = 0;
+        threadPool.start(new Splitter(threadPool, leaves, 14));
+        WAIT_FOR_DONE(threadPool);
+        QCOMPARE(leaves.loadRelaxed(), 1 << 14);
+        QCOMPARE(threadPool.activeThreadCount(), 0);
+    }
+}
+
+void tst_QThreadPool::workStealingPriority()
+{
+    TestThreadPool threadPool;
+    threadPool.setWorkStealingEnabled(true);
+    threadPool.setMaxThreadCount(1); // keep everything on one thread
+
+    QMutex mutex;
+    QStringList order;
+    const auto record = [&](const QString &name) {
+        return [&, name] {
+            QMutexLocker locker(&mutex);
+            order << name;
+        };
+    };
+
+    threadPool.start([&] {
+        threadPool.start(record(u"local1"_s));
+        threadPool.start(record(u"local2"_s));
+        threadPool.start(record(u"high"_s), 1);
+        threadPool.start(record(u"local3"_s));
+    });
+    WAIT_FOR_DONE(threadPool);
+
+    // higher priorities first, then the local tasks, newest first
+    const QStringList expected = { u"high"_s, u"local3"_s, u"local2"_s, u"local1"_s };
+    QCOMPARE(order, expected);
+}
+
+void tst_QThreadPool::workStealingTryTake()
+{
+    TestThreadPool threadPool;
+    threadPool.setWorkStealingEnabled(true);
+    threadPool.setMaxThreadCount(1);
+
+    QAtomicInt childRuns = 0;
+    QAtomicInt otherRuns = 0;
+    bool taken = false;
+    threadPool.start([&] {
+        // the child ends up in the middle of the local deque
+        threadPool.start([&] { otherRuns.ref(); });
+        QRunnable *child = QRunnable::create([&] { childRuns.ref(); });
+        threadPool.start(child);
+        threadPool.start([&] { otherRuns.ref(); });
+
+        taken = threadPool.tryTake(child);
+        if (taken) {
+            // ownership was transferred to us
+            child->run();
+            delete child;
+        }
+    });
+    WAIT_FOR_DONE(threadPool);
+
+    QVERIFY(taken);
+    QCOMPARE(childRuns.loadRelaxed(), 1);
+    QCOMPARE(otherRuns.loadRelaxed(), 2);
+}
+
+void tst_QThreadPool::workStealingTryTakeFromOtherThread()
+{
+    TestThreadPool threadPool;
+    threadPool.setWorkStealingEnabled(true);
+    threadPool.setMaxThreadCount(1);
+
+    QSemaphore spawned;
+    QSemaphore proceed;
+    QAtomicInt childRuns = 0;
+    QAtomicInt otherRuns = 0;
+    QRunnable *child = QRunnable::create([&] { childRuns.ref(); });
+    threadPool.start([&] {
+        threadPool.start([&] { otherRuns.ref(); });
+        threadPool.start(child);
+        threadPool.start([&] { otherRuns.ref(); });
+        spawned.release();
+        proceed.acquire();
+    });
+
+    // the child is in the middle of the deque of the pool's thread
+    QVERIFY(spawned.tryAcquire(1, 60s));
+    QVERIFY(threadPool.tryTake(child));
+    QVERIFY(!threadPool.tryTake(child));
+    proceed.release();
+    WAIT_FOR_DONE(threadPool);
+
+    QCOMPARE(childRuns.loadRelaxed(), 0);
+    QCOMPARE(otherRuns.loadRelaxed(), 2);
+    delete child; // ownership was transferred to us
+}
+
+void tst_QThreadPool::workStealingIdleThread()
+{
+    // The parent waits for a child it started while the other thread was
+    // busy, so the child is in the parent's deque and only the other thread
+    // can run it. That thread has to find it there instead of going to
+    // sleep, no matter how its task's end and the start of the child
+    // interleave.
+    TestThreadPool threadPool;
+    threadPool.setWorkStealingEnabled(true);
+    threadPool.setMaxThreadCount(2);
+
+    for (int i = 0; i < 100; ++i) {
+        QSemaphore otherStarted;
+        QSemaphore otherMayFinish;
+        QSemaphore childDone;
+        bool childRan = false;
+        threadPool.start([&] {
+            otherStarted.release();
+            otherMayFinish.acquire();
+        });
+        QVERIFY(otherStarted.tryAcquire(1, 60s));
+        threadPool.start([&] {
+            threadPool.start([&] { childDone.release(); });
+            otherMayFinish.release();
+            childRan = childDone.tryAcquire(1, 60s);
+        });
+        WAIT_FOR_DONE(threadPool);
+        QVERIFY2(childRan, QByteArray::number(i));
+    }
+}
+
+void tst_QThreadPool::workStealingClear()
+{
+    TestThreadPool threadPool;
+    threadPool.setWorkStealingEnabled(true);
+    threadPool.setMaxThreadCount(1);
+
+    QSemaphore spawned;
+    QSemaphore proceed;
+    QAtomicInt runs = 0;
+    threadPool.start([&] {
+        for (int i = 0; i < 10; ++i)
+            threadPool.start([&] { runs.ref(); });
+        spawned.release();
+        proceed.acquire();
+    });
+
+    QVERIFY(spawned.tryAcquire(1, 60s));
+    threadPool.clear();
+    proceed.release();
+    WAIT_FOR_DONE(threadPool);
+    QCOMPARE(runs.loadRelaxed(), 0);
+}
+
+void tst_QThreadPool::workStealingEnabledLater()
+{
+    // A thread started before work stealing was enabled must still find
+    // the tasks in the deques of the threads started after.
+    TestThreadPool threadPool;
+    threadPool.setMaxThreadCount(2);
+
+    QSemaphore otherStarted;
+    QSemaphore otherMayFinish;
+    QSemaphore childDone;
+    bool childRan = false;
+    threadPool.start([&] {
+        otherStarted.release();
+        otherMayFinish.acquire();
+    });
+    QVERIFY(otherStarted.tryAcquire(1, 60s));
+
+    threadPool.setWorkStealingEnabled(true);
+    threadPool.start([&] {
+        // both threads are busy, so the child stays in this thread's deque
+        threadPool.start([&] { childDone.release(); });
+        otherMayFinish.release();
+        childRan = childDone.tryAcquire(1, 60s);
+    });
+    WAIT_FOR_DONE(threadPool);
+    QVERIFY(childRan);
+}
+
 void tst_QThreadPool::destroyingWaitsForTasksToFinish()
 {
     QElapsedTimer total, pass;
@@ -0,0 +1,581 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <qflathash.h>
+#include <qhash.h>
+#include <qrandom.h>
+#include <qset.h>
+
+#include <private/qcomparisontesthelper_p.h>
+
+using namespace Qt::StringLiterals;
+
+class tst_QFlatHash : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void comparisonCompiles();
+    void insertAndLookup();
+    void operatorBracket();
+    void remove();
+    void take();
+    void randomOperations_data();
+    void randomOperations();
+    void collidingKeys();
+    void implicitSharing();
+    void iterate();
+    void eraseWhileIterating();
+    void removeIf();
+    void reserveAndSqueeze();
+    void tombstonesDoNotGrowTable();
+    void tryEmplace();
+    void insertOrAssign();
+    void emplaceReferencingOwnElement();
+    void heterogeneousLookup();
+    void nonTrivialTypes();
+    void compare();
+    void keysAndValues();
+    void rangeConstructor();
+};
+
+namespace {
+struct BadHashKey
+{
+    int value = 0;
+    friend bool operator==(BadHashKey lhs, BadHashKey rhs) noexcept
+    { return lhs.value == rhs.value; }
+    friend bool operator!=(BadHashKey lhs, BadHashKey rhs) noexcept
+    { return lhs.value != rhs.value; }
+};
+size_t qHash(BadHashKey key, size_t seed = 0) noexcept
+{
+    // only a handful of different hashes, so that probe sequences get long
+    return ::qHash(key.value % 4, seed) & ~size_t(0x7f);
+}
+
+struct Counted
+{
+    static inline int instances = 0;
+    int value = 0;
+
+    Counted(int v = 0) : value(v) { ++instances; }
+    Counted(const Counted &other) : value(other.value) { ++instances; }
+    Counted &operator=(const Counted &other) = default;
+    ~Counted() { --instances; }
+    friend bool operator==(const Counted &lhs, const Counted &rhs) noexcept
+    { return lhs.value == rhs.value; }
+    friend bool operator!=(const Counted &lhs, const Counted &rhs) noexcept
+    { return lhs.value != rhs.value; }
+};
+} // unnamed namespace
+
+void tst_QFlatHash::comparisonCompiles()
+{
+    QTestPrivate::testEqualityOperatorsCompile<QFlatHash<int, int>>();
+    QTestPrivate::testEqualityOperatorsCompile<QFlatHash<QString, QString>>();
+}
+
+void tst_QFlatHash::insertAndLookup()
+{
+    QFlatHash<int, int> hash;
+    QVERIFY(hash.isEmpty());
+    QCOMPARE(hash.size(), 0);
+    QCOMPARE(hash.capacity(), 0);
+    QVERIFY(!hash.contains(1));
+    QCOMPARE(hash.value(1), 0);
+    QCOMPARE(hash.value(1, 42), 42);
+    QCOMPARE(hash.find(1), hash.end());
+    QCOMPARE(hash.constFind(1), hash.constEnd());
+
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i * 2);
+    QCOMPARE(hash.size(), 1000);
+    QVERIFY(hash.capacity() >= 1000);
+    QVERIFY(hash.load_factor() <= (QFlatHash<int, int>::max_load_factor()));
+    for (int i = 0; i < 1000; ++i) {
+        QVERIFY(hash.contains(i));
+        QCOMPARE(hash.value(i), i * 2);
+        QCOMPARE(hash.count(i), 1);
+        auto it = hash.constFind(i);
+        QVERIFY(it != hash.constEnd());
+        QCOMPARE(it.key(), i);
+        QCOMPARE(it.value(), i * 2);
+    }
+    QVERIFY(!hash.contains(1000));
+    QVERIFY(!hash.contains(-1));
+
+    // insert() replaces the value of an existing key
+    auto it = hash.insert(7, -7);
+    QCOMPARE(it.key(), 7);
+    QCOMPARE(*it, -7);
+    QCOMPARE(hash.size(), 1000);
+    QCOMPARE(hash.value(7), -7);
+}
+
+void tst_QFlatHash::operatorBracket()
+{
+    QFlatHash<QString, int> hash;
+    hash[u"one"_s] = 1;
+    hash[u"two"_s] = 2;
+    ++hash[u"one"_s];
+    QCOMPARE(hash.size(), 2);
+    QCOMPARE(hash.value(u"one"_s), 2);
+    QCOMPARE(hash[u"three"_s], 0);
+    QCOMPARE(hash.size(), 3);
+
+    const QFlatHash<QString, int> &constHash = hash;
+    QCOMPARE(constHash[u"four"_s], 0);
+    QCOMPARE(hash.size(), 3);
+}
+
+void tst_QFlatHash::remove()
+{
+    QFlatHash<int, QString> hash;
+    QVERIFY(!hash.remove(1));
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, QString::number(i));
+
+    QVERIFY(hash.remove(50));
+    QVERIFY(!hash.remove(50));
+    QCOMPARE(hash.size(), 99);
+    QVERIFY(!hash.contains(50));
+    for (int i = 0; i < 100; ++i) {
+        if (i != 50)
+            QCOMPARE(hash.value(i), QString::number(i));
+    }
+
+    // re-inserting a removed key reuses its bucket or a tombstone
+    hash.insert(50, u"fifty"_s);
+    QCOMPARE(hash.value(50), u"fifty"_s);
+    QCOMPARE(hash.size(), 100);
+
+    hash.clear();
+    QVERIFY(hash.isEmpty());
+    QVERIFY(!hash.contains(0));
+}
+
+void tst_QFlatHash::take()
+{
+    QFlatHash<int, QString> hash;
+    QCOMPARE(hash.take(1), QString());
+    hash.insert(1, u"one"_s);
+    hash.insert(2, u"two"_s);
+    QCOMPARE(hash.take(1), u"one"_s);
+    QCOMPARE(hash.take(1), QString());
+    QCOMPARE(hash.size(), 1);
+    QCOMPARE(hash.value(2), u"two"_s);
+}
+
+void tst_QFlatHash::randomOperations_data()
+{
+    QTest::addColumn<int>("keyRange");
+    QTest::addColumn<int>("operations");
+
+    QTest::newRow("dense") << 64 << 20000;
+    QTest::newRow("medium") << 2000 << 50000;
+    QTest::newRow("sparse") << 100000 << 50000;
+}
+
+void tst_QFlatHash::randomOperations()
+{
+    QFETCH(int, keyRange);
+    QFETCH(int, operations);
+
+    QRandomGenerator rng(keyRange);
+    QFlatHash<int, int> hash;
+    QHash<int, int> reference;
+    for (int i = 0; i < operations; ++i) {
+        const int key = int(rng.bounded(keyRange));
+        switch (rng.bounded(4)) {
+        case 0:
+        case 1:
+            hash.insert(key, i);
+            reference.insert(key, i);
+            break;
+        case 2:
+            QCOMPARE(hash.remove(key), reference.remove(key));
+            break;
+        case 3:
+            QCOMPARE(hash.value(key, -1), reference.value(key, -1));
+            break;
+        }
+        QCOMPARE(hash.size(), reference.size());
+    }
+
+    qsizetype visited = 0;
+    for (auto it = hash.cbegin(); it != hash.cend(); ++it) {
+        QCOMPARE(reference.value(it.key(), -1), it.value());
+        ++visited;
+    }
+    QCOMPARE(visited, reference.size());
+    for (auto it = reference.cbegin(); it != reference.cend(); ++it)
+        QCOMPARE(hash.value(it.key(), -1), it.value());
+}
+
+void tst_QFlatHash::collidingKeys()
+{
+    QFlatHash<BadHashKey, int> hash;
+    for (int i = 0; i < 500; ++i)
+        hash.insert(BadHashKey{i}, i);
+    QCOMPARE(hash.size(), 500);
+    for (int i = 0; i < 500; ++i)
+        QCOMPARE(hash.value(BadHashKey{i}, -1), i);
+    QVERIFY(!hash.contains(BadHashKey{500}));
+
+    for (int i = 0; i < 500; i += 2)
+        QVERIFY(hash.remove(BadHashKey{i}));
+    QCOMPARE(hash.size(), 250);
+    for (int i = 0; i < 500; ++i)
+        QCOMPARE(hash.value(BadHashKey{i}, -1), i % 2 ? i : -1);
+}
+
+void tst_QFlatHash::implicitSharing()
+{
+    QFlatHash<int, QString> hash;
+    hash.insert(1, u"one"_s);
+    hash.insert(2, u"two"_s);
+
+    QFlatHash<int, QString> copy = hash;
+    QVERIFY(copy.isSharedWith(hash));
+    QVERIFY(!hash.isDetached());
+
+    copy.insert(3, u"three"_s);
+    QVERIFY(!copy.isSharedWith(hash));
+    QCOMPARE(hash.size(), 2);
+    QCOMPARE(copy.size(), 3);
+    QVERIFY(!hash.contains(3));
+
+    copy = hash;
+    copy.remove(1);
+    QVERIFY(hash.contains(1));
+    QVERIFY(!copy.contains(1));
+
+    copy = hash;
+    QCOMPARE(copy.take(2), u"two"_s);
+    QCOMPARE(hash.value(2), u"two"_s);
+
+    copy = hash;
+    copy[1] = u"uno"_s;
+    QCOMPARE(hash.value(1), u"one"_s);
+    QCOMPARE(copy.value(1), u"uno"_s);
+
+    // non-const find() detaches, const lookups don't
+    copy = hash;
+    QVERIFY(std::as_const(copy).find(1) != std::as_const(copy).end());
+    QVERIFY(copy.isSharedWith(hash));
+    *copy.find(1) = u"eins"_s;
+    QVERIFY(!copy.isSharedWith(hash));
+    QCOMPARE(hash.value(1), u"one"_s);
+
+    QFlatHash<int, QString> moved = std::move(copy);
+    QCOMPARE(moved.value(1), u"eins"_s);
+}
+
+void tst_QFlatHash::iterate()
+{
+    QFlatHash<int, int> hash;
+    QCOMPARE(hash.begin(), hash.end());
+    QCOMPARE(hash.cbegin(), hash.cend());
+
+    QSet<int> expected;
+    for (int i = 0; i < 300; ++i) {
+        hash.insert(i * 7, i);
+        expected.insert(i * 7);
+    }
+
+    QSet<int> seen;
+    for (auto it = hash.begin(); it != hash.end(); ++it) {
+        QCOMPARE(it.value() * 7, it.key());
+        seen.insert(it.key());
+    }
+    QCOMPARE(seen, expected);
+
+    seen.clear();
+    for (auto [key, value] : hash.asKeyValueRange()) {
+        QCOMPARE(value * 7, key);
+        seen.insert(key);
+    }
+    QCOMPARE(seen, expected);
+
+    seen.clear();
+    for (auto it = hash.keyBegin(); it != hash.keyEnd(); ++it)
+        seen.insert(*it);
+    QCOMPARE(seen, expected);
+
+    int sum = 0;
+    for (int value : std::as_const(hash))
+        sum += value;
+    QCOMPARE(sum, 299 * 300 / 2);
+
+    // mutate through iterators
+    for (auto it = hash.begin(); it != hash.end(); ++it)
+        it.value() = -it.value();
+    QCOMPARE(hash.value(7), -1);
+
+    QFlatHashIterator<int, int> javaIt(hash);
+    int count = 0;
+    while (javaIt.hasNext()) {
+        javaIt.next();
+        ++count;
+    }
+    QCOMPARE(count, 300);
+}
+
+void tst_QFlatHash::eraseWhileIterating()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i);
+
+    // erase() never moves other elements, so every element is visited once
+    QSet<int> seen;
+    for (auto it = hash.begin(); it != hash.end(); ) {
+        QVERIFY(!seen.contains(it.key()));
+        seen.insert(it.key());
+        if (it.key() % 3 == 0)
+            it = hash.erase(it);
+        else
+            ++it;
+    }
+    QCOMPARE(seen.size(), 1000);
+    QCOMPARE(hash.size(), 666);
+
+    // erasing through a const_iterator of a shared hash detaches
+    QFlatHash<int, int> copy = hash;
+    auto it = copy.constFind(1);
+    copy.erase(it);
+    QVERIFY(hash.contains(1));
+    QVERIFY(!copy.contains(1));
+    QCOMPARE(copy.size(), 665);
+}
+
+void tst_QFlatHash::removeIf()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i * i);
+    QCOMPARE(hash.removeIf([](auto it) { return it.key() % 2 == 0; }), 50);
+    QCOMPARE(hash.size(), 50);
+    QCOMPARE(erase_if(hash, [](std::pair<const int &, int &> p) { return p.second > 2500; }), 25);
+    QCOMPARE(hash.size(), 25);
+    for (auto it = hash.cbegin(); it != hash.cend(); ++it) {
+        QCOMPARE(it.key() % 2, 1);
+        QVERIFY(it.value() <= 2500);
+    }
+}
+
+void tst_QFlatHash::reserveAndSqueeze()
+{
+    QFlatHash<int, int> hash;
+    hash.reserve(1000);
+    QVERIFY(hash.capacity() >= 1000);
+    const qsizetype capacity = hash.capacity();
+    const size_t buckets = hash.bucket_count();
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i);
+    QCOMPARE(hash.capacity(), capacity);
+    QCOMPARE(hash.bucket_count(), buckets);
+
+    for (int i = 10; i < 1000; ++i)
+        hash.remove(i);
+    hash.squeeze();
+    QVERIFY(hash.capacity() < capacity);
+    QVERIFY(hash.capacity() >= 10);
+    for (int i = 0; i < 10; ++i)
+        QCOMPARE(hash.value(i, -1), i);
+
+    QFlatHash<int, int> shared = hash;
+    shared.reserve(5000);
+    QVERIFY(shared.capacity() >= 5000);
+    QVERIFY(hash.capacity() < 5000);
+    QCOMPARE(shared, hash);
+}
+
+void tst_QFlatHash::tombstonesDoNotGrowTable()
+{
+    // A sliding window of keys leaves tombstones behind; they must be
+    // cleaned up instead of making the table grow without bounds.
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i);
+    for (int i = 100; i < 100000; ++i) {
+        hash.insert(i, i);
+        hash.remove(i - 100);
+    }
+    QCOMPARE(hash.size(), 100);
+    QVERIFY(hash.bucket_count() <= 256);
+    for (int i = 99900; i < 100000; ++i)
+        QCOMPARE(hash.value(i, -1), i);
+}
+
+void tst_QFlatHash::tryEmplace()
+{
+    QFlatHash<int, QString> hash;
+    auto r = hash.tryEmplace(1, u"one"_s);
+    QVERIFY(r.inserted);
+    QCOMPARE(r.iterator.key(), 1);
+    QCOMPARE(*r.iterator, u"one"_s);
+
+    r = hash.tryEmplace(1, u"uno"_s);
+    QVERIFY(!r.inserted);
+    QCOMPARE(*r.iterator, u"one"_s);
+
+    r = hash.tryInsert(2, u"two"_s);
+    QVERIFY(r.inserted);
+    QCOMPARE(hash.size(), 2);
+
+    auto [it, inserted] = hash.try_emplace(3, 3, u'x');
+    QVERIFY(inserted);
+    QCOMPARE(it->second, u"xxx"_s);
+
+    // tryEmplace() on a shared hash detaches even if nothing is inserted
+    QFlatHash<int, QString> copy = hash;
+    r = copy.tryEmplace(1);
+    QVERIFY(!r.inserted);
+    *r.iterator = u"changed"_s;
+    QCOMPARE(hash.value(1), u"one"_s);
+}
+
+void tst_QFlatHash::insertOrAssign()
+{
+    QFlatHash<QString, int> hash;
+    auto r = hash.insertOrAssign(u"a"_s, 1);
+    QVERIFY(r.inserted);
+    r = hash.insertOrAssign(u"a"_s, 2);
+    QVERIFY(!r.inserted);
+    QCOMPARE(hash.value(u"a"_s), 2);
+    auto [it, inserted] = hash.insert_or_assign(u"b"_s, 3);
+    QVERIFY(inserted);
+    QCOMPARE(it->second, 3);
+}
+
+void tst_QFlatHash::emplaceReferencingOwnElement()
+{
+    // The arguments may refer to an element that a rehash moves around
+    QFlatHash<int, QString> hash;
+    hash.insert(0, u"zero"_s);
+    for (int i = 1; i < 200; ++i) {
+        hash.emplace(i, hash[0]);
+        hash.tryEmplace(i + 1000, hash[0]);
+    }
+    for (int i = 1; i < 200; ++i) {
+        QCOMPARE(hash.value(i), u"zero"_s);
+        QCOMPARE(hash.value(i + 1000), u"zero"_s);
+    }
+
+    QFlatHash<int, QString> shared = hash;
+    shared.emplace(5000, shared[0]);
+    QCOMPARE(shared.value(5000), u"zero"_s);
+}
+
+void tst_QFlatHash::heterogeneousLookup()
+{
+    QFlatHash<QString, int> hash;
+    hash.insert(u"alpha"_s, 1);
+    hash.insert(u"beta"_s, 2);
+
+    const QString text = u"alpha beta gamma"_s;
+    const QStringView alpha = QStringView(text).first(5);
+    const QStringView gamma = QStringView(text).last(5);
+    QVERIFY(hash.contains(alpha));
+    QVERIFY(!hash.contains(gamma));
+    QCOMPARE(hash.value(alpha), 1);
+    QCOMPARE(hash.value(gamma, -1), -1);
+    QCOMPARE(hash.count(alpha), 1);
+    QCOMPARE(hash.constFind(alpha).key(), u"alpha"_s);
+    QCOMPARE(hash.value("beta"_L1), 2);
+    QCOMPARE(std::as_const(hash)[QStringView(u"beta")], 2);
+
+    hash[gamma] = 3;
+    QCOMPARE(hash.value(u"gamma"_s), 3);
+    auto r = hash.tryEmplace(QStringView(u"delta"), 4);
+    QVERIFY(r.inserted);
+    QCOMPARE(r.iterator.key(), u"delta"_s);
+
+    QVERIFY(hash.remove(QStringView(u"delta")));
+    QCOMPARE(hash.take(gamma), 3);
+    QCOMPARE(hash.size(), 2);
+
+    QFlatHash<QByteArray, int> bytes;
+    bytes.insert("key"_ba, 7);
+    QCOMPARE(bytes.value(QByteArrayView("key")), 7);
+    QVERIFY(!bytes.contains(QByteArrayView("ke")));
+}
+
+void tst_QFlatHash::nonTrivialTypes()
+{
+    QCOMPARE(Counted::instances, 0);
+    {
+        QFlatHash<int, Counted> hash;
+        for (int i = 0; i < 500; ++i)
+            hash.insert(i, Counted(i));
+        QCOMPARE(Counted::instances, 500);
+        for (int i = 0; i < 500; i += 2)
+            hash.remove(i);
+        QCOMPARE(Counted::instances, 250);
+
+        QFlatHash<int, Counted> copy = hash;
+        copy.insert(1000, Counted(1000));
+        QCOMPARE(Counted::instances, 501);
+        copy.squeeze();
+        QCOMPARE(Counted::instances, 501);
+        QCOMPARE(copy.value(1).value, 1);
+    }
+    QCOMPARE(Counted::instances, 0);
+
+    QFlatHash<QString, QStringList> strings;
+    for (int i = 0; i < 100; ++i)
+        strings[QString::number(i)].append(QString::number(i * i));
+    QCOMPARE(strings.value(u"9"_s), QStringList{ u"81"_s });
+}
+
+void tst_QFlatHash::compare()
+{
+    QFlatHash<int, int> a;
+    QFlatHash<int, int> b;
+    QT_TEST_EQUALITY_OPS(a, b, true);
+    for (int i = 0; i < 100; ++i) {
+        a.insert(i, i);
+        b.insert(99 - i, 99 - i);
+    }
+    QT_TEST_EQUALITY_OPS(a, b, true);
+    QCOMPARE(qHash(a), qHash(b));
+    b[50] = 0;
+    QT_TEST_EQUALITY_OPS(a, b, false);
+    b.remove(50);
+    QT_TEST_EQUALITY_OPS(a, b, false);
+}
+
+void tst_QFlatHash::keysAndValues()
+{
+    QFlatHash<int, QString> hash = { { 1, u"a"_s }, { 2, u"b"_s }, { 3, u"a"_s } };
+    QList<int> keys = hash.keys();
+    std::sort(keys.begin(), keys.end());
+    QCOMPARE(keys, QList<int>({ 1, 2, 3 }));
+    keys = hash.keys(u"a"_s);
+    std::sort(keys.begin(), keys.end());
+    QCOMPARE(keys, QList<int>({ 1, 3 }));
+    QStringList values = hash.values();
+    values.sort();
+    QCOMPARE(values, QStringList({ u"a"_s, u"a"_s, u"b"_s }));
+    QCOMPARE(hash.key(u"b"_s), 2);
+    QCOMPARE(hash.key(u"z"_s, -1), -1);
+}
+
+void tst_QFlatHash::rangeConstructor()
+{
+    const QHash<int, int> source = { { 1, 10 }, { 2, 20 }, { 3, 30 } };
+    QFlatHash<int, int> fromQt(source.cbegin(), source.cend());
+    QCOMPARE(fromQt.size(), 3);
+    QCOMPARE(fromQt.value(2), 20);
+
+    const std::vector<std::pair<int, int>> pairs = { { 4, 40 }, { 5, 50 } };
+    QFlatHash<int, int> fromStd(pairs.begin(), pairs.end());
+    QCOMPARE(fromStd.size(), 2);
+    QCOMPARE(fromStd.value(5), 50);
+}
+
+QTEST_APPLESS_MAIN(tst_QFlatHash)
+#include "tst_qflathash.moc"
@@ -5,14 +5,16 @@
 
 #include <QTest>
 
-#include <private/qflatmap_p.h>
 #include <qbytearray.h>
+#include <qflatmap.h>
 #include <qstring.h>
 #include <qstringview.h>
 #include <qvarlengtharray.h>
 
 #include <algorithm>
+#include <atomic>
 #include <list>
+#include <thread>
 #include <tuple>
 
 static constexpr bool is_even(int n) { return n % 2 == 0; }
@@ -49,6 +51,10 @@ private slots:
     void try_emplace_and_insert_or_assign();
     void viewIterators();
     void varLengthArray();
+    void lowerBound();
+    void bulkConstruction();
+    void implicitSharing();
+    void frozenConcurrentReads();
 
 private:
     template <typename Compare>
@@ -727,5 +733,97 @@ void tst_QFlatMap::varLengthArray()
     QVERIFY(m.isEmpty());
 }
 
+void tst_QFlatMap::lowerBound()
+{
+    // every size up to a few powers of two, looking up every key and every gap
+    for (int size = 0; size < 70; ++size) {
+        QFlatMap<int, int> m;
+        for (int i = 0; i < size; ++i)
+            m.insert(2 * i, i);
+        const QList<int> &keys = m.keys();
+        for (int key = -1; key <= 2 * size; ++key) {
+            const auto expected = std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+            QCOMPARE(std::as_const(m).lower_bound(key) - m.cbegin(), expected);
+            QCOMPARE(m.contains(key), key >= 0 && key < 2 * size && key % 2 == 0);
+        }
+    }
+}
+
+void tst_QFlatMap::bulkConstruction()
+{
+    using Map = QFlatMap<int, QByteArray>;
+
+    const Map sorted(Map::key_container_type{ 1, 2, 3 },
+                     Map::mapped_container_type{ "een", "twee", "dree" });
+    QCOMPARE(sorted.keys(), QList<int>({ 1, 2, 3 }));
+    QCOMPARE(sorted.values(), QList<QByteArray>({ "een", "twee", "dree" }));
+
+    const Map unsorted(Map::key_container_type{ 3, 1, 2, 1 },
+                       Map::mapped_container_type{ "dree", "een", "twee", "one" });
+    QCOMPARE(unsorted.keys(), QList<int>({ 1, 2, 3 }));
+    // the first of several equivalent keys is retained
+    QCOMPARE(unsorted.values(), QList<QByteArray>({ "een", "twee", "dree" }));
+
+    const Map sortedWithDuplicates(Map::key_container_type{ 1, 1, 2 },
+                                   Map::mapped_container_type{ "een", "one", "twee" });
+    QCOMPARE(sortedWithDuplicates.keys(), QList<int>({ 1, 2 }));
+    QCOMPARE(sortedWithDuplicates.value(1), "een");
+}
+
+void tst_QFlatMap::implicitSharing()
+{
+    QFlatMap<int, QByteArray> m;
+    m.insert(1, "een");
+    m.insert(2, "twee");
+
+    QFlatMap<int, QByteArray> copy = m;
+    QCOMPARE(copy.keys().constData(), m.keys().constData());
+    QCOMPARE(copy.values().constData(), m.values().constData());
+
+    copy.insert(3, "dree");
+    QCOMPARE(m.size(), 2);
+    QCOMPARE(copy.size(), 3);
+    QVERIFY(copy.keys().constData() != m.keys().constData());
+}
+
+void tst_QFlatMap::frozenConcurrentReads()
+{
+    QFlatMap<QString, int, std::less<>> m;
+    m.reserve(1000);
+    for (int i = 0; i < 500; ++i)
+        m.insert(QString::number(i), i);
+    QCOMPARE(m.capacity(), 1000);
+
+    const auto &frozen = m.freeze();
+    QCOMPARE(&frozen, &m);
+    QCOMPARE(frozen.capacity(), 500);
+
+    // a copy held elsewhere keeps sharing the data, which must not make
+    // readers of the frozen map write to it
+    const auto copy = frozen;
+
+    std::atomic<int> failures = 0;
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            for (int i = 0; i < 500; ++i) {
+                const QString key = QString::number(i);
+                if (frozen.value(QStringView(key), -1) != i || !frozen.contains(key))
+                    ++failures;
+                if (frozen.contains(QStringView(u"missing")))
+                    ++failures;
+            }
+            for (auto it = frozen.begin(); it != frozen.end(); ++it) {
+                if (it.key() != QString::number(it.value()))
+                    ++failures;
+            }
+        });
+    }
+    for (std::thread &reader : readers)
+        reader.join();
+    QCOMPARE(failures.load(), 0);
+    QCOMPARE(copy.size(), 500);
+}
+
 QTEST_APPLESS_MAIN(tst_QFlatMap)
 #include "tst_qflatmap.moc"
@@ -0,0 +1,170 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <qflatset.h>
+#include <qset.h>
+
+#include <private/qcomparisontesthelper_p.h>
+
+using namespace Qt::StringLiterals;
+
+class tst_QFlatSet : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void comparisonCompiles();
+    void insertAndContains();
+    void remove();
+    void iterate();
+    void implicitSharing();
+    void setOperations();
+    void removeIf();
+    void heterogeneousLookup();
+    void compare();
+};
+
+void tst_QFlatSet::comparisonCompiles()
+{
+    QTestPrivate::testEqualityOperatorsCompile<QFlatSet<int>>();
+    QTestPrivate::testEqualityOperatorsCompile<QFlatSet<QString>>();
+}
+
+void tst_QFlatSet::insertAndContains()
+{
+    QFlatSet<int> set;
+    QVERIFY(set.isEmpty());
+    QVERIFY(!set.contains(1));
+
+    for (int i = 0; i < 1000; ++i)
+        set.insert(i * 3);
+    set << 0 << 3;
+    QCOMPARE(set.size(), 1000);
+    for (int i = 0; i < 3000; ++i)
+        QCOMPARE(set.contains(i), i % 3 == 0);
+
+    const QFlatSet<int> initialized = { 1, 2, 2, 3 };
+    QCOMPARE(initialized.size(), 3);
+
+    const QList<int> list = { 5, 6, 5 };
+    const QFlatSet fromRange(list.begin(), list.end());
+    QCOMPARE(fromRange.size(), 2);
+    QVERIFY(fromRange.contains(6));
+}
+
+void tst_QFlatSet::remove()
+{
+    QFlatSet<QString> set = { u"a"_s, u"b"_s, u"c"_s };
+    QVERIFY(set.remove(u"b"_s));
+    QVERIFY(!set.remove(u"b"_s));
+    QCOMPARE(set.size(), 2);
+    set -= u"a"_s;
+    QCOMPARE(set.values(), QStringList{ u"c"_s });
+    set.clear();
+    QVERIFY(set.isEmpty());
+}
+
+void tst_QFlatSet::iterate()
+{
+    QFlatSet<int> set;
+    QSet<int> expected;
+    for (int i = 0; i < 500; ++i) {
+        set.insert(i * 11);
+        expected.insert(i * 11);
+    }
+    QSet<int> seen;
+    for (int value : std::as_const(set))
+        seen.insert(value);
+    QCOMPARE(seen, expected);
+
+    for (auto it = set.begin(); it != set.end(); ) {
+        if (*it % 2)
+            it = set.erase(it);
+        else
+            ++it;
+    }
+    QCOMPARE(set.size(), 250);
+    QVERIFY(set.find(22) != set.end());
+    QVERIFY(set.constFind(11) == set.constEnd());
+}
+
+void tst_QFlatSet::implicitSharing()
+{
+    QFlatSet<int> set = { 1, 2, 3 };
+    QFlatSet<int> copy = set;
+    QVERIFY(copy.isSharedWith(set));
+    copy.insert(4);
+    QVERIFY(!copy.isSharedWith(set));
+    QCOMPARE(set.size(), 3);
+    QCOMPARE(copy.size(), 4);
+}
+
+void tst_QFlatSet::setOperations()
+{
+    const QFlatSet<int> a = { 1, 2, 3, 4 };
+    const QFlatSet<int> b = { 3, 4, 5 };
+
+    QCOMPARE(a | b, QFlatSet<int>({ 1, 2, 3, 4, 5 }));
+    QCOMPARE(a + b, QFlatSet<int>({ 1, 2, 3, 4, 5 }));
+    QCOMPARE(a & b, QFlatSet<int>({ 3, 4 }));
+    QCOMPARE(a - b, QFlatSet<int>({ 1, 2 }));
+    QVERIFY(a.intersects(b));
+    QVERIFY(!a.intersects(QFlatSet<int>({ 7, 8 })));
+    QVERIFY(a.contains(QFlatSet<int>({ 1, 4 })));
+    QVERIFY(!a.contains(b));
+
+    QFlatSet<int> c = a;
+    c.intersect(c);
+    QCOMPARE(c, a);
+    c.subtract(c);
+    QVERIFY(c.isEmpty());
+    c.unite(b);
+    QCOMPARE(c, b);
+    c.intersect(QFlatSet<int>());
+    QVERIFY(c.isEmpty());
+}
+
+void tst_QFlatSet::removeIf()
+{
+    QFlatSet<int> set;
+    for (int i = 0; i < 100; ++i)
+        set.insert(i);
+    QCOMPARE(set.removeIf([](int i) { return i >= 10; }), 90);
+    QCOMPARE(set.size(), 10);
+
+    QFlatSet<int> copy = set;
+    QCOMPARE(erase_if(copy, [](int i) { return i % 2; }), 5);
+    QCOMPARE(copy.size(), 5);
+    QCOMPARE(set.size(), 10);
+}
+
+void tst_QFlatSet::heterogeneousLookup()
+{
+    QFlatSet<QString> set = { u"left"_s, u"right"_s };
+    const QString text = u"left or right"_s;
+    QVERIFY(set.contains(QStringView(text).first(4)));
+    QVERIFY(!set.contains(QStringView(text).sliced(5, 2)));
+    QVERIFY(set.contains("right"_L1));
+    QVERIFY(set.find(QStringView(text).last(5)) != set.end());
+    QVERIFY(set.remove(QStringView(text).last(5)));
+    QCOMPARE(set.size(), 1);
+}
+
+void tst_QFlatSet::compare()
+{
+    QFlatSet<int> a;
+    QFlatSet<int> b;
+    QT_TEST_EQUALITY_OPS(a, b, true);
+    for (int i = 0; i < 50; ++i) {
+        a.insert(i);
+        b.insert(49 - i);
+    }
+    QT_TEST_EQUALITY_OPS(a, b, true);
+    QCOMPARE(qHash(a), qHash(b));
+    b.remove(0);
+    QT_TEST_EQUALITY_OPS(a, b, false);
+}
+
+QTEST_APPLESS_MAIN(tst_QFlatSet)
+#include "tst_qflatset.moc"
@@ -0,0 +1,200 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+// Included first: TBB, which libstdc++ uses for the parallel execution
+// policies, has members called emit.
+#if defined(QT_BENCH_EXECUTION_POLICIES) && __has_include(<execution>)
+#  include <execution>
+#  if defined(__cpp_lib_parallel_algorithm)
+#    define HAVE_EXECUTION_POLICIES
+#  endif
+#endif
+
+#include <QtConcurrent/qtconcurrentalgorithm.h>
+#include <QtCore/QList>
+#include <QtCore/QRandomGenerator>
+#include <QTest>
+
+#include <algorithm>
+#include <numeric>
+
+class tst_QtConcurrentAlgorithm : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void sort_data();
+    void sort();
+    void inclusiveScan_data();
+    void inclusiveScan();
+    void exclusiveScan_data();
+    void exclusiveScan();
+    void transformReduce_data();
+    void transformReduce();
+};
+
+enum Implementation {
+    Sequential,
+    QtConcurrentAlgorithm,
+    ParallelPolicy,
+};
+Q_DECLARE_METATYPE(Implementation)
+
+static void addRows()
+{
+    QTest::addColumn<Implementation>("implementation");
+    QTest::addColumn<int>("size");
+
+    for (int size : { 10000, 1000000, 10000000 }) {
+        QTest::addRow("std-%d", size) << Sequential << size;
+        QTest::addRow("QtConcurrent-%d", size) << QtConcurrentAlgorithm << size;
+#ifdef HAVE_EXECUTION_POLICIES
+        QTest::addRow("std-par-%d", size) << ParallelPolicy << size;
+#endif
+    }
+}
+
+static QList<qint64> randomList(int size)
+{
+    QList<qint64> list(size);
+    QRandomGenerator random(size);
+    for (qint64 &value : list)
+        value = qint64(random.generate());
+    return list;
+}
+
+void tst_QtConcurrentAlgorithm::sort_data()
+{
+    addRows();
+}
+
+void tst_QtConcurrentAlgorithm::sort()
+{
+    QFETCH(Implementation, implementation);
+    QFETCH(int, size);
+
+    const QList<qint64> input = randomList(size);
+    QList<qint64> list;
+
+    // Every implementation pays for copying the input
+    QBENCHMARK {
+        list = input;
+        list.detach();
+
+        switch (implementation) {
+        case Sequential:
+            std::sort(list.begin(), list.end());
+            break;
+        case QtConcurrentAlgorithm:
+            QtConcurrent::blockingSort(list);
+            break;
+        case ParallelPolicy:
+#ifdef HAVE_EXECUTION_POLICIES
+            std::sort(std::execution::par, list.begin(), list.end());
+#endif
+            break;
+        }
+    }
+    QVERIFY(std::is_sorted(list.cbegin(), list.cend()));
+}
+
+void tst_QtConcurrentAlgorithm::inclusiveScan_data()
+{
+    addRows();
+}
+
+void tst_QtConcurrentAlgorithm::inclusiveScan()
+{
+    QFETCH(Implementation, implementation);
+    QFETCH(int, size);
+
+    const QList<qint64> input = randomList(size);
+    QList<qint64> output(size);
+
+    QBENCHMARK {
+        switch (implementation) {
+        case Sequential:
+            std::inclusive_scan(input.cbegin(), input.cend(), output.begin());
+            break;
+        case QtConcurrentAlgorithm:
+            QtConcurrent::blockingInclusiveScan(input.cbegin(), input.cend(), output.begin());
+            break;
+        case ParallelPolicy:
+#ifdef HAVE_EXECUTION_POLICIES
+            std::inclusive_scan(std::execution::par, input.cbegin(), input.cend(),
+                                output.begin());
+#endif
+            break;
+        }
+    }
+}
+
+void tst_QtConcurrentAlgorithm::exclusiveScan_data()
+{
+    addRows();
+}
+
+void tst_QtConcurrentAlgorithm::exclusiveScan()
+{
+    QFETCH(Implementation, implementation);
+    QFETCH(int, size);
+
+    const QList<qint64> input = randomList(size);
+    QList<qint64> output(size);
+
+    QBENCHMARK {
+        switch (implementation) {
+        case Sequential:
+            std::exclusive_scan(input.cbegin(), input.cend(), output.begin(), qint64(0));
+            break;
+        case QtConcurrentAlgorithm:
+            QtConcurrent::blockingExclusiveScan(input.cbegin(), input.cend(), output.begin(),
+                                                qint64(0));
+            break;
+        case ParallelPolicy:
+#ifdef HAVE_EXECUTION_POLICIES
+            std::exclusive_scan(std::execution::par, input.cbegin(), input.cend(),
+                                output.begin(), qint64(0));
+#endif
+            break;
+        }
+    }
+}
+
+void tst_QtConcurrentAlgorithm::transformReduce_data()
+{
+    addRows();
+}
+
+void tst_QtConcurrentAlgorithm::transformReduce()
+{
+    QFETCH(Implementation, implementation);
+    QFETCH(int, size);
+
+    const QList<qint64> input = randomList(size);
+    const auto bits = [](qint64 value) { return qint64(qPopulationCount(quint64(value))); };
+    qint64 result = 0;
+
+    QBENCHMARK {
+        switch (implementation) {
+        case Sequential:
+            result = std::transform_reduce(input.cbegin(), input.cend(), qint64(0),
+                                           std::plus<>(), bits);
+            break;
+        case QtConcurrentAlgorithm:
+            result = QtConcurrent::blockingTransformReduce(input.cbegin(), input.cend(),
+                                                           qint64(0), std::plus<>(), bits);
+            break;
+        case ParallelPolicy:
+#ifdef HAVE_EXECUTION_POLICIES
+            result = std::transform_reduce(std::execution::par, input.cbegin(), input.cend(),
+                                           qint64(0), std::plus<>(), bits);
+#endif
+            break;
+        }
+    }
+    QVERIFY(result > 0);
+}
+
+QTEST_MAIN(tst_QtConcurrentAlgorithm)
+#include "tst_bench_qtconcurrentalgorithm.moc"
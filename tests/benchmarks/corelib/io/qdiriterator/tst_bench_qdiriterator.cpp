@@ -4,6 +4,7 @@
 #include <QDirIterator>
 #include <QDirListing>
 #include <QString>
+#include <QTimeZone>
 #include <qplatformdefs.h>
 
 #ifdef Q_OS_WIN
@@ -26,6 +27,8 @@
 
 using namespace Qt::StringLiterals;
 
+Q_DECLARE_METATYPE(QDirListing::IteratorFlags)
+
 constexpr bool forceStat = false;
 
 class tst_QDirIterator : public QObject
@@ -48,6 +51,10 @@ private slots:
     void diriterator_data() { data(); }
     void dirlisting();
     void dirlisting_data() { data(); }
+    void dirlistingParallel();
+    void dirlistingParallel_data() { data(); }
+    void dirlistingWithMetaData_data();
+    void dirlistingWithMetaData();
     void fsiterator();
     void fsiterator_data() { data(); }
     void stdRecursiveDirectoryIterator();
@@ -226,6 +233,78 @@ void tst_QDirIterator::dirlisting()
     qDebug() << count;
 }
 
+void tst_QDirIterator::dirlistingParallel()
+{
+    QFETCH(QByteArray, dirpath);
+
+    using F = QDirListing::IteratorFlag;
+
+    int count = 0;
+
+    QBENCHMARK {
+        int c = 0;
+
+        QDirListing dir(dirpath, F::Recursive | F::IncludeHidden | F::Parallel);
+
+        for (const auto &dirEntry : dir) {
+            const auto path = dirEntry.filePath();
+            if (forceStat)
+                dirEntry.size();
+            ++c;
+        }
+        count = c;
+    }
+    qDebug() << count;
+}
+
+void tst_QDirIterator::dirlistingWithMetaData_data()
+{
+    const char hereRelative[] = "tests/benchmarks/corelib/io/qdiriterator";
+    QByteArray dir(QT_TESTCASE_SOURCEDIR);
+    dir.chop(sizeof(hereRelative));
+    dir += "/src/corelib";
+
+    if (!QFileInfo(QString::fromLocal8Bit(dir)).isDir())
+        QSKIP("Missing Qt directory");
+
+    QTest::addColumn<QByteArray>("dirpath");
+    QTest::addColumn<QDirListing::IteratorFlags>("flags");
+
+    using F = QDirListing::IteratorFlag;
+    QTest::newRow("lazy") << dir << QDirListing::IteratorFlags{};
+    QTest::newRow("prefetch") << dir << QDirListing::IteratorFlags{F::PrefetchMetaData};
+    QTest::newRow("parallel-lazy") << dir << QDirListing::IteratorFlags{F::Parallel};
+    QTest::newRow("parallel-prefetch") << dir << (F::Parallel | F::PrefetchMetaData);
+}
+
+// Like an indexer, which needs the size and modification time of every file
+void tst_QDirIterator::dirlistingWithMetaData()
+{
+    QFETCH(QByteArray, dirpath);
+    QFETCH(QDirListing::IteratorFlags, flags);
+
+    using F = QDirListing::IteratorFlag;
+
+    int count = 0;
+    qint64 totalSize = 0;
+
+    QBENCHMARK {
+        int c = 0;
+        qint64 size = 0;
+
+        QDirListing dir(dirpath, flags | F::Recursive | F::IncludeHidden | F::FilesOnly);
+
+        for (const auto &dirEntry : dir) {
+            size += dirEntry.size();
+            dirEntry.lastModified(QTimeZone::UTC);
+            ++c;
+        }
+        count = c;
+        totalSize = size;
+    }
+    qDebug() << count << totalSize;
+}
+
 void tst_QDirIterator::fsiterator()
 {
     QFETCH(QByteArray, dirpath);
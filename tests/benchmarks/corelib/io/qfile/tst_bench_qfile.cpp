@@ -81,7 +81,13 @@ private slots:
     void readBigFile_posix() { readBigFile(); }
     void readBigFile_Win32() { readBigFile(); }
 
+    void readBigFileQueued_data();
+    void readBigFileQueued();
+    void writeBigFileQueued_data();
+    void writeBigFileQueued();
+
 private:
+    void queued_data();
     void readFile_data(BenchmarkType type, QIODevice::OpenModeFlag t, QIODevice::OpenModeFlag b);
     void readBigFile();
     void readSmallFiles();
@@ -292,6 +298,61 @@ void tst_qfile::readBigFile()
     }
 }
 
+void tst_qfile::queued_data()
+{
+    QTest::addColumn<int>("depth");
+    QTest::addColumn<int>("blockSize");
+
+    for (int blockSize : { 4096, 65536 }) {
+        for (int depth : { 0, 4, 16 })
+            QTest::addRow("depth%d-block%d", depth, blockSize) << depth << blockSize;
+    }
+}
+
+void tst_qfile::readBigFileQueued_data()
+{
+    queued_data();
+}
+
+void tst_qfile::readBigFileQueued()
+{
+    QFETCH(int, depth);
+    QFETCH(int, blockSize);
+
+    QByteArray buffer(blockSize, Qt::Uninitialized);
+    QFile file(tempDir.filename);
+    file.setIOQueueDepth(depth);
+    QVERIFY(file.open(QIODevice::ReadOnly | QIODevice::Unbuffered));
+    QBENCHMARK {
+        while (file.read(buffer.data(), blockSize) > 0) {}
+        file.seek(0);
+    }
+}
+
+void tst_qfile::writeBigFileQueued_data()
+{
+    queued_data();
+}
+
+void tst_qfile::writeBigFileQueued()
+{
+    QFETCH(int, depth);
+    QFETCH(int, blockSize);
+
+    const QByteArray block(blockSize, 'q');
+    QFile file(tempDir.filePath("writeQueued"));
+    file.setIOQueueDepth(depth);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Unbuffered));
+    QBENCHMARK {
+        file.seek(0);
+        for (qint64 written = 0; written < TF_SIZE; written += blockSize)
+            file.write(block);
+        QVERIFY(file.flush());
+    }
+    file.close();
+    QFile::remove(file.fileName());
+}
+
 void tst_qfile::seek_data()
 {
     QTest::addColumn<tst_qfile::BenchmarkType>("testType");
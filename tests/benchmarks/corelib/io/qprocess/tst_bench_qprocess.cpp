@@ -5,6 +5,11 @@
 #include <QSignalSpy>
 #include <QtCore/QProcess>
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QThread>
+#include <QtCore/private/qprocessbatch_p.h>
+
+#include <memory>
+#include <vector>
 
 class tst_QProcess : public QObject
 {
@@ -13,6 +18,8 @@ class tst_QProcess : public QObject
 private slots:
 
     void echoTest_performance();
+    void launchMany_data();
+    void launchMany();
 };
 
 #ifdef Q_OS_WIN
@@ -66,5 +73,64 @@ void tst_QProcess::echoTest_performance()
     QVERIFY(process.waitForFinished());
 }
 
+void tst_QProcess::launchMany_data()
+{
+    QTest::addColumn<bool>("batch");
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("QProcess-10k") << false << 10000;
+    QTest::newRow("QProcessBatch-10k") << true << 10000;
+}
+
+void tst_QProcess::launchMany()
+{
+    QFETCH(bool, batch);
+    QFETCH(int, count);
+
+    // A build tool's workload: many short-lived processes, some of them
+    // running at the same time, whose exit codes and output are needed.
+    // The loopback helper exits as soon as it sees the end of its input.
+    const QString program = QFINDTESTDATA("../testProcessLoopback/testProcessLoopback" EXE);
+    QVERIFY(!program.isEmpty());
+    const int concurrency = QThread::idealThreadCount();
+
+    if (batch) {
+        QProcessBatch::Job job;
+        job.program = program;
+        const QList<QProcessBatch::Job> jobs(count, job);
+        QList<QProcessBatch::Result> results;
+        QBENCHMARK_ONCE {
+            results = QProcessBatch::run(jobs, concurrency);
+        }
+        for (const QProcessBatch::Result &result : std::as_const(results)) {
+            QCOMPARE(result.error, QProcess::UnknownError);
+            QCOMPARE(result.exitCode, 0);
+        }
+        return;
+    }
+
+    QBENCHMARK_ONCE {
+        std::vector<std::unique_ptr<QProcess>> running;
+        int started = 0;
+        int finished = 0;
+        while (finished < count) {
+            while (started < count && started - finished < concurrency) {
+                auto process = std::make_unique<QProcess>();
+                process->setStandardInputFile(QProcess::nullDevice());
+                process->start(program);
+                running.push_back(std::move(process));
+                ++started;
+            }
+            QProcess &oldest = *running.front();
+            QVERIFY(oldest.waitForFinished());
+            QCOMPARE(oldest.exitCode(), 0);
+            oldest.readAllStandardOutput();
+            oldest.readAllStandardError();
+            running.erase(running.begin());
+            ++finished;
+        }
+    }
+}
+
 QTEST_MAIN(tst_QProcess)
 #include "tst_bench_qprocess.moc"
@@ -6,7 +6,10 @@
 #include <QtCore/qjsonarray.h>
 #include <QVariantMap>
 #include <qjsondocument.h>
+#include <qjsondocumentview.h>
 #include <qjsonobject.h>
+#include <qjsonstreamreader.h>
+#include <qjsonstreamwriter.h>
 
 class BenchmarkQtJson: public QObject
 {
@@ -23,6 +26,10 @@ private Q_SLOTS:
     void parseNumbers();
     void parseJson();
     void parseJsonToVariant();
+    void streamReadJson_data();
+    void streamReadJson();
+    void streamWriteJson_data();
+    void streamWriteJson();
 
     void jsonObjectInsert();
     void variantMapInsert();
@@ -121,6 +128,123 @@ void BenchmarkQtJson::parseJsonToVariant()
     }
 }
 
+// test.json repeated in a top-level array, to measure throughput on a larger input
+static QByteArray largeTestJson()
+{
+    QFile file(QFINDTESTDATA("test.json"));
+    if (!file.open(QFile::ReadOnly))
+        return QByteArray();
+    const QByteArray content = file.readAll();
+    QByteArray json = "[";
+    for (int i = 0; i < 100; ++i) {
+        if (i)
+            json += ',';
+        json += content;
+    }
+    json += ']';
+    return json;
+}
+
+void BenchmarkQtJson::streamReadJson_data()
+{
+    QTest::addColumn<int>("mode");
+
+    QTest::newRow("QJsonDocument") << 0;
+    QTest::newRow("QJsonStreamReader-tokens") << 1;
+    QTest::newRow("QJsonStreamReader-readValue") << 2;
+    QTest::newRow("QJsonStreamReader-skip") << 3;
+    QTest::newRow("QJsonDocumentView") << 4;
+    QTest::newRow("QJsonDocumentView-lookup") << 5;
+}
+
+void BenchmarkQtJson::streamReadJson()
+{
+    QFETCH(int, mode);
+
+    const QByteArray testJson = largeTestJson();
+    QVERIFY(!testJson.isEmpty());
+
+    QBENCHMARK {
+        switch (mode) {
+        case 0: {
+            QJsonDocument doc = QJsonDocument::fromJson(testJson);
+            QVERIFY(doc.isArray());
+            break;
+        }
+        case 1: {
+            QJsonStreamReader reader(testJson);
+            while (!reader.atEnd())
+                reader.readNext();
+            QVERIFY(!reader.hasError());
+            break;
+        }
+        case 2: {
+            QJsonStreamReader reader(testJson);
+            reader.readNext();
+            QVERIFY(reader.readValue().isArray());
+            break;
+        }
+        case 3: {
+            QJsonStreamReader reader(testJson);
+            reader.readNext();
+            while (reader.readNextValue())
+                reader.skipCurrentValue();
+            QVERIFY(!reader.hasError());
+            break;
+        }
+        case 4: {
+            QJsonDocumentView view = QJsonDocumentView::fromJson(testJson);
+            QVERIFY(view.isArray());
+            break;
+        }
+        case 5: {
+            QJsonDocumentView view = QJsonDocumentView::fromJson(testJson);
+            qint64 sum = 0;
+            for (QJsonValueView pattern : view.value())
+                sum += pattern[8][u"integer"].toInteger();
+            QCOMPARE(sum, 100 * 1234567890LL);
+            break;
+        }
+        }
+    }
+}
+
+void BenchmarkQtJson::streamWriteJson_data()
+{
+    QTest::addColumn<QJsonDocument::JsonFormat>("format");
+    QTest::addColumn<bool>("stream");
+
+    QTest::newRow("QJsonDocument-indented") << QJsonDocument::Indented << false;
+    QTest::newRow("QJsonStreamWriter-indented") << QJsonDocument::Indented << true;
+    QTest::newRow("QJsonDocument-compact") << QJsonDocument::Compact << false;
+    QTest::newRow("QJsonStreamWriter-compact") << QJsonDocument::Compact << true;
+}
+
+void BenchmarkQtJson::streamWriteJson()
+{
+    QFETCH(QJsonDocument::JsonFormat, format);
+    QFETCH(bool, stream);
+
+    const QJsonDocument doc = QJsonDocument::fromJson(largeTestJson());
+    QVERIFY(doc.isArray());
+    const QJsonArray array = doc.array();
+
+    QBENCHMARK {
+        QByteArray json;
+        if (stream) {
+            QJsonStreamWriter writer(&json);
+            writer.setFormat(format);
+            writer.startArray();
+            for (const QJsonValue &value : array)
+                writer.appendValue(value);
+            writer.endArray();
+        } else {
+            json = doc.toJson(format);
+        }
+        QVERIFY(!json.isEmpty());
+    }
+}
+
 void BenchmarkQtJson::jsonObjectInsert()
 {
     QJsonObject object;
@@ -5,6 +5,24 @@
 #include <qtest.h>
 #include <qtesteventloop.h>
 
+#include <QtCore/private/qeventpool_p.h>
+
+#ifdef Q_OS_UNIX
+#  include <QtCore/private/qglobal_p.h>
+#  include <QtCore/private/qcore_unix_p.h>
+#  include <QtCore/private/qeventdispatcher_unix_p.h>
+#  if QT_CONFIG(epoll)
+#    include <QtCore/private/qeventdispatcher_epoll_p.h>
+#  endif
+#  include <sys/resource.h>
+#  if __has_include(<sys/eventfd.h>)
+#    include <sys/eventfd.h>
+#  endif
+#endif
+
+#include <memory>
+#include <vector>
+
 class PingPong : public QObject
 {
 public:
@@ -58,6 +76,86 @@ int EventTester::foo(int bar)
     return bar + 1;
 }
 
+class QueuedSender : public QObject
+{
+    Q_OBJECT
+signals:
+    void ping();
+};
+
+// Counts the pings and posted events it receives, stopping the event loop
+// once it got the expected number.
+class PingCounter : public QObject
+{
+public:
+    void receive()
+    {
+        if (--remaining == 0)
+            QTestEventLoop::instance().exitLoop();
+    }
+
+    int remaining = 0;
+
+protected:
+    bool event(QEvent *e) override
+    {
+        if (e->type() != QEvent::User)
+            return QObject::event(e);
+        receive();
+        return true;
+    }
+};
+
+#ifdef Q_OS_UNIX
+// One wake-up source per notifier: an eventfd where available (a single file
+// descriptor each), a pipe otherwise.
+struct NotifierFd
+{
+#if __has_include(<sys/eventfd.h>)
+    static constexpr int FdsPerNotifier = 1;
+#else
+    static constexpr int FdsPerNotifier = 2;
+#endif
+
+    int readFd = -1;
+    int writeFd = -1;
+
+    bool open()
+    {
+#if __has_include(<sys/eventfd.h>)
+        readFd = writeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        return readFd != -1;
+#else
+        int fds[2];
+        if (qt_safe_pipe(fds, O_NONBLOCK) == -1)
+            return false;
+        readFd = fds[0];
+        writeFd = fds[1];
+        return true;
+#endif
+    }
+
+    void close()
+    {
+        if (writeFd != readFd)
+            qt_safe_close(writeFd);
+        qt_safe_close(readFd);
+    }
+
+    void signal()
+    {
+        const quint64 one = 1;
+        qt_safe_write(writeFd, &one, sizeof(one));
+    }
+
+    void drain()
+    {
+        quint64 value;
+        qt_safe_read(readFd, &value, sizeof(value));
+    }
+};
+#endif
+
 class EventsBench : public QObject
 {
     Q_OBJECT
@@ -71,10 +169,33 @@ private slots:
     void sendEvent();
     void postEvent_data();
     void postEvent();
+    void postFromThreads_data();
+    void postFromThreads();
+    void queuedCallAllocations_data();
+    void queuedCallAllocations();
+#ifdef Q_OS_UNIX
+    void socketNotifiers_data();
+    void socketNotifiers();
+
+private:
+    rlim_t openFileLimit = 0;
+#endif
 };
 
 void EventsBench::initTestCase()
 {
+#ifdef Q_OS_UNIX
+    // the larger socketNotifiers() rows need many file descriptors
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+        if (limit.rlim_cur < limit.rlim_max) {
+            limit.rlim_cur = limit.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &limit);
+            getrlimit(RLIMIT_NOFILE, &limit);
+        }
+        openFileLimit = limit.rlim_cur;
+    }
+#endif
 }
 
 void EventsBench::cleanupTestCase()
@@ -145,6 +266,198 @@ void EventsBench::postEvent()
     }
 }
 
+void EventsBench::postFromThreads_data()
+{
+    QTest::addColumn<bool>("queuedSignals");
+    QTest::addColumn<int>("producers");
+
+    for (bool queuedSignals : { true, false }) {
+        for (int producers : { 1, 2, 4, 8 }) {
+            QTest::addRow("%s:%d", queuedSignals ? "queuedSignal" : "postEvent", producers)
+                    << queuedSignals << producers;
+        }
+    }
+}
+
+// Measures the throughput of several threads emitting queued signals, or
+// posting plain events, at a single object in the main thread.
+void EventsBench::postFromThreads()
+{
+    QFETCH(bool, queuedSignals);
+    QFETCH(int, producers);
+    const int postsPerProducer = 20000;
+
+    PingCounter counter;
+    QueuedSender sender;
+    connect(&sender, &QueuedSender::ping, &counter, &PingCounter::receive, Qt::QueuedConnection);
+
+    QBENCHMARK {
+        counter.remaining = producers * postsPerProducer;
+
+        QSemaphore go;
+        std::vector<std::unique_ptr<QThread>> threads;
+        for (int i = 0; i < producers; ++i) {
+            threads.emplace_back(QThread::create([&] {
+                go.acquire();
+                for (int n = 0; n < postsPerProducer; ++n) {
+                    if (queuedSignals)
+                        emit sender.ping();
+                    else
+                        QCoreApplication::postEvent(&counter, new QEvent(QEvent::User));
+                }
+            }));
+            threads.back()->start();
+        }
+        go.release(producers);
+
+        QTestEventLoop::instance().enterLoop(60);
+        QVERIFY(!QTestEventLoop::instance().timeout());
+        for (const auto &thread : threads)
+            thread->wait();
+    }
+}
+
+void EventsBench::queuedCallAllocations_data()
+{
+    QTest::addColumn<int>("producers");
+
+    QTest::newRow("sameThread") << 0;
+    for (int producers : { 1, 4 })
+        QTest::addRow("fromThreads:%d", producers) << producers;
+}
+
+// Reports how many of the queued call events had to be allocated on the heap
+// rather than reused from QEventPool, per 1000 calls, once the pools are
+// warmed up. The receiver processes the calls in rounds, like a GUI thread
+// draining its queue once per frame.
+void EventsBench::queuedCallAllocations()
+{
+    QFETCH(int, producers);
+    const int rounds = 50;
+    const int callsPerRound = 1000;
+
+    PingCounter counter;
+    QueuedSender sender;
+    connect(&sender, &QueuedSender::ping, &counter, &PingCounter::receive, Qt::QueuedConnection);
+
+    // one semaphore per producer, so that each does its share of every round
+    auto go = std::make_unique<QSemaphore[]>(producers);
+    QSemaphore done;
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int i = 0; i < producers; ++i) {
+        threads.emplace_back(QThread::create([&, i] {
+            for (int round = 0; round <= rounds; ++round) {
+                go[i].acquire();
+                for (int n = 0; n < callsPerRound / producers; ++n)
+                    emit sender.ping();
+                done.release();
+            }
+        }));
+        threads.back()->start();
+    }
+
+    auto runRound = [&] {
+        if (producers == 0) {
+            for (int n = 0; n < callsPerRound; ++n)
+                emit sender.ping();
+        } else {
+            for (int i = 0; i < producers; ++i)
+                go[i].release();
+            done.acquire(producers);
+        }
+        QCoreApplication::sendPostedEvents();
+    };
+
+    // the first round warms up the pools
+    runRound();
+    const QEventPool::Counters before = QEventPool::counters();
+    for (int round = 0; round < rounds; ++round)
+        runRound();
+    const QEventPool::Counters after = QEventPool::counters();
+    for (const auto &thread : threads)
+        thread->wait();
+
+    const quint64 allocations = after.allocations - before.allocations;
+    QCOMPARE_GE(allocations, quint64(rounds * callsPerRound));
+    const quint64 heapAllocations = after.heapAllocations - before.heapAllocations;
+    QTest::setBenchmarkResult(1000. * heapAllocations / allocations, QTest::Events);
+}
+
+#ifdef Q_OS_UNIX
+void EventsBench::socketNotifiers_data()
+{
+    QTest::addColumn<QByteArray>("dispatcher");
+    QTest::addColumn<int>("idleNotifiers");
+
+    QByteArrayList dispatchers = { "poll" };
+#if QT_CONFIG(epoll)
+    dispatchers << "epoll";
+#endif
+    for (const QByteArray &dispatcher : std::as_const(dispatchers)) {
+        for (int count : { 10, 100, 1000, 10000, 50000 })
+            QTest::addRow("%s:%d", dispatcher.constData(), count) << dispatcher << count;
+    }
+}
+
+// Measures the round-trip of waking up one notifier in an event loop that
+// also watches \a idleNotifiers descriptors which never become ready.
+void EventsBench::socketNotifiers()
+{
+    QFETCH(QByteArray, dispatcher);
+    QFETCH(int, idleNotifiers);
+
+    if (rlim_t(idleNotifiers + 1) * NotifierFd::FdsPerNotifier + 64 > openFileLimit)
+        QSKIP("Not enough file descriptors available");
+
+    std::vector<NotifierFd> fds(idleNotifiers + 1);
+    for (NotifierFd &fd : fds) {
+        if (!fd.open()) {
+            for (NotifierFd &opened : fds) {
+                if (opened.readFd != -1)
+                    opened.close();
+            }
+            QSKIP("Could not create enough notifier file descriptors");
+        }
+    }
+    NotifierFd &active = fds.back();
+
+    QThread thread;
+#if QT_CONFIG(epoll)
+    if (dispatcher == "epoll")
+        thread.setEventDispatcher(new QEventDispatcherEpoll);
+    else
+#endif
+        thread.setEventDispatcher(new QEventDispatcherUNIX);
+    thread.start();
+
+    QSemaphore activations;
+    auto owner = std::make_unique<QObject>();
+    owner->moveToThread(&thread);
+    QMetaObject::invokeMethod(owner.get(), [&] {
+        QSocketNotifier *notifier = nullptr;
+        for (const NotifierFd &fd : fds)
+            notifier = new QSocketNotifier(fd.readFd, QSocketNotifier::Read, owner.get());
+        // the last one belongs to the active descriptor
+        QObject::connect(notifier, &QSocketNotifier::activated, notifier, [&] {
+            active.drain();
+            activations.release();
+        });
+    }, Qt::BlockingQueuedConnection);
+
+    QBENCHMARK {
+        active.signal();
+        activations.acquire();
+    }
+
+    owner.release()->deleteLater();
+    thread.quit();
+    thread.wait();
+
+    for (NotifierFd &fd : fds)
+        fd.close();
+}
+#endif
+
 QTEST_MAIN(EventsBench)
 
 #include "tst_bench_events.moc"
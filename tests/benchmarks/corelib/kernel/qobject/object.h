@@ -22,6 +22,7 @@ signals:
     void signal7();
     void signal8();
     void signal9();
+    void dataReady(int index, double value);
 public slots:
     void slot0();
     void slot1();
@@ -33,6 +34,7 @@ public slots:
     void slot7();
     void slot8();
     void slot9();
+    void consume(int index, double value);
 };
 
 #endif // OBJECT_H
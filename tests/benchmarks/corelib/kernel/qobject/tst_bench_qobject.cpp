@@ -20,6 +20,8 @@ private slots:
     void signal_slot_benchmark_data();
     void signal_many_receivers();
     void signal_many_receivers_data();
+    void batched_emission();
+    void batched_emission_data();
     void qproperty_benchmark_data();
     void qproperty_benchmark();
     void dynamic_property_benchmark();
@@ -179,6 +181,60 @@ void tst_QObject::signal_many_receivers()
     }
 }
 
+void tst_QObject::batched_emission_data()
+{
+    QTest::addColumn<Qt::ConnectionType>("connectionType");
+    QTest::addColumn<bool>("batched");
+    QTest::addColumn<int>("batchSize");
+
+    const struct {
+        const char *name;
+        Qt::ConnectionType type;
+    } connectionTypes[] = {
+        { "direct", Qt::DirectConnection },
+        { "queued", Qt::QueuedConnection },
+    };
+    for (const auto &connectionType : connectionTypes) {
+        for (bool batched : { false, true }) {
+            for (int batchSize : { 16, 1024 }) {
+                QTest::addRow("%s:%s:%d", connectionType.name, batched ? "emitBatch" : "loop",
+                              batchSize)
+                        << connectionType.type << batched << batchSize;
+            }
+        }
+    }
+}
+
+// Delivers a batch of data feed updates to a few receivers, either by
+// emitting the signal once per update or with a single QObject::emitBatch().
+void tst_QObject::batched_emission()
+{
+    QFETCH(Qt::ConnectionType, connectionType);
+    QFETCH(bool, batched);
+    QFETCH(int, batchSize);
+
+    Object sender;
+    Object receivers[4];
+    for (Object &receiver : receivers)
+        QObject::connect(&sender, &Object::dataReady, &receiver, &Object::consume, connectionType);
+
+    QList<std::tuple<int, double>> batch;
+    batch.reserve(batchSize);
+    for (int i = 0; i < batchSize; ++i)
+        batch.emplace_back(i, i * 0.5);
+
+    QBENCHMARK {
+        if (batched) {
+            QObject::emitBatch(&sender, &Object::dataReady, batch);
+        } else {
+            for (const auto &[index, value] : std::as_const(batch))
+                emit sender.dataReady(index, value);
+        }
+        if (connectionType == Qt::QueuedConnection)
+            QCoreApplication::sendPostedEvents();
+    }
+}
+
 void tst_QObject::qproperty_benchmark_data()
 {
     QTest::addColumn<QByteArray>("name");
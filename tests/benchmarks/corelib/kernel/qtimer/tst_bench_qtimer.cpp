@@ -0,0 +1,88 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QBasicTimer>
+#include <QCoreApplication>
+#include <QTest>
+
+#include <memory>
+
+using namespace std::chrono_literals;
+
+class tst_QTimer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void restart_data();
+    void restart();
+    void startStop_data() { restart_data(); }
+    void startStop();
+};
+
+// Gives the timers distinct, long enough intervals that none of them fires
+// while the benchmark runs, like per-connection timeouts on a busy server.
+static std::chrono::milliseconds intervalFor(int i)
+{
+    return 10s + std::chrono::milliseconds(i % 5000);
+}
+
+void tst_QTimer::restart_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<Qt::TimerType>("timerType");
+
+    const struct {
+        const char *name;
+        Qt::TimerType type;
+    } types[] = {
+        { "precise", Qt::PreciseTimer },
+        { "coarse", Qt::CoarseTimer },
+        { "verycoarse", Qt::VeryCoarseTimer },
+    };
+    for (const auto &type : types) {
+        for (int count : { 1000, 10000, 100000 })
+            QTest::addRow("%s:%d", type.name, count) << count << type.type;
+    }
+}
+
+// Restarts every timer once per iteration, the way a timeout is re-armed
+// whenever data arrives on a connection.
+void tst_QTimer::restart()
+{
+    QFETCH(int, count);
+    QFETCH(Qt::TimerType, timerType);
+
+    QObject receiver;
+    auto timers = std::make_unique<QBasicTimer[]>(count);
+    for (int i = 0; i < count; ++i)
+        timers[i].start(intervalFor(i), timerType, &receiver);
+
+    QBENCHMARK {
+        for (int i = 0; i < count; ++i)
+            timers[i].start(intervalFor(i), timerType, &receiver);
+    }
+
+    for (int i = 0; i < count; ++i)
+        timers[i].stop();
+}
+
+void tst_QTimer::startStop()
+{
+    QFETCH(int, count);
+    QFETCH(Qt::TimerType, timerType);
+
+    QObject receiver;
+    auto timers = std::make_unique<QBasicTimer[]>(count);
+
+    QBENCHMARK {
+        for (int i = 0; i < count; ++i)
+            timers[i].start(intervalFor(i), timerType, &receiver);
+        for (int i = 0; i < count; ++i)
+            timers[i].stop();
+    }
+}
+
+QTEST_MAIN(tst_QTimer)
+
+#include "tst_bench_qtimer.moc"
@@ -0,0 +1,163 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QBuffer>
+#include <QDataStream>
+#include <QTemporaryFile>
+
+#include <QTest>
+
+class tst_QDataStream : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void writeList_data();
+    void writeList();
+    void readList_data() { writeList_data(); }
+    void readList();
+    void readListFromFile_data() { writeList_data(); }
+    void readListFromFile();
+    void readElements_data() { writeList_data(); }
+    void readElements();
+};
+
+enum ElementType { Int16, Int32, Int64, Double };
+static constexpr qsizetype ElementCount = 1 << 20;
+
+template <typename T>
+static QList<T> sampleList()
+{
+    QList<T> list(ElementCount);
+    for (qsizetype i = 0; i < list.size(); ++i)
+        list[i] = T(i * 7 - 3);
+    return list;
+}
+
+template <typename T>
+static QByteArray serialized(QDataStream::ByteOrder byteOrder)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setByteOrder(byteOrder);
+    stream << sampleList<T>();
+    return data;
+}
+
+// Calls f with a default-constructed value of the type selected by the
+// "type" column
+template <typename Func>
+static void withElementType(Func f)
+{
+    QFETCH(int, type);
+    switch (ElementType(type)) {
+    case Int16:
+        return f(qint16());
+    case Int32:
+        return f(qint32());
+    case Int64:
+        return f(qint64());
+    case Double:
+        return f(double());
+    }
+}
+
+void tst_QDataStream::writeList_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<QDataStream::ByteOrder>("byteOrder");
+
+    const std::pair<const char *, ElementType> types[] = {
+        { "qint16", Int16 }, { "qint32", Int32 }, { "qint64", Int64 }, { "double", Double },
+    };
+    for (auto [name, type] : types) {
+        QTest::addRow("%s-big-endian", name) << int(type) << QDataStream::BigEndian;
+        QTest::addRow("%s-little-endian", name) << int(type) << QDataStream::LittleEndian;
+    }
+}
+
+void tst_QDataStream::writeList()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+
+    withElementType([&](auto value) {
+        using T = decltype(value);
+        const QList<T> list = sampleList<T>();
+        QByteArray data;
+        data.reserve(ElementCount * sizeof(T) + 16);
+        QBENCHMARK {
+            data.clear();
+            QDataStream stream(&data, QIODevice::WriteOnly);
+            stream.setByteOrder(byteOrder);
+            stream << list;
+        }
+        QCOMPARE(data.size(), ElementCount * qsizetype(sizeof(T)) + 4);
+    });
+}
+
+void tst_QDataStream::readList()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+
+    withElementType([&](auto value) {
+        using T = decltype(value);
+        const QByteArray data = serialized<T>(byteOrder);
+        QList<T> list;
+        QBENCHMARK {
+            QDataStream stream(data);
+            stream.setByteOrder(byteOrder);
+            stream >> list;
+        }
+        QCOMPARE(list.size(), ElementCount);
+    });
+}
+
+void tst_QDataStream::readListFromFile()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+
+    withElementType([&](auto value) {
+        using T = decltype(value);
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        file.write(serialized<T>(byteOrder));
+        QList<T> list;
+        QBENCHMARK {
+            file.seek(0);
+            QDataStream stream(&file);
+            stream.setByteOrder(byteOrder);
+            stream >> list;
+        }
+        QCOMPARE(list.size(), ElementCount);
+    });
+}
+
+// The element-by-element equivalent of readList(), for comparison
+void tst_QDataStream::readElements()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+
+    withElementType([&](auto value) {
+        using T = decltype(value);
+        const QByteArray data = serialized<T>(byteOrder);
+        QList<T> list;
+        QBENCHMARK {
+            QDataStream stream(data);
+            stream.setByteOrder(byteOrder);
+            quint32 size;
+            stream >> size;
+            list.clear();
+            list.reserve(size);
+            for (quint32 i = 0; i < size; ++i) {
+                T element;
+                stream >> element;
+                list.append(element);
+            }
+        }
+        QCOMPARE(list.size(), ElementCount);
+    });
+}
+
+QTEST_MAIN(tst_QDataStream)
+
+#include "tst_bench_qdatastream.moc"
@@ -0,0 +1,147 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QBuffer>
+#include <QXmlStreamReader>
+
+#include <QTest>
+
+using namespace Qt::StringLiterals;
+
+class tst_QXmlStreamReader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void read_data();
+    void read();
+    void readAttributeViews_data() { read_data(); }
+    void readAttributeViews();
+
+private:
+    QByteArray ascii;
+    QByteArray utf8;
+};
+
+enum Source { ByteArray, Device, String };
+
+static QByteArray sampleDocument(bool nonAscii)
+{
+    const QByteArray text = nonAscii ? "Grüße aus Zürich, ½ € – ✓"_ba
+                                     : "The quick brown fox jumps over the lazy dog"_ba;
+    QByteArray xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<catalog>\n"_ba;
+    for (int i = 0; i < 20000; ++i) {
+        xml += "  <item id=\"" + QByteArray::number(i) + "\" kind=\"book\" price=\""
+                + QByteArray::number(i % 100) + ".95\">\n"
+               "    <title lang=\"en\">" + text + "</title>\n"
+               "    <note/>\n"
+               "  </item>\n";
+    }
+    xml += "</catalog>\n";
+    return xml;
+}
+
+void tst_QXmlStreamReader::initTestCase()
+{
+    ascii = sampleDocument(false);
+    utf8 = sampleDocument(true);
+}
+
+void tst_QXmlStreamReader::read_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<int>("source");
+
+    QTest::newRow("ascii-bytearray") << ascii << int(ByteArray);
+    QTest::newRow("ascii-device") << ascii << int(Device);
+    QTest::newRow("utf8-bytearray") << utf8 << int(ByteArray);
+    QTest::newRow("utf8-device") << utf8 << int(Device);
+    QTest::newRow("utf8-string") << utf8 << int(String);
+}
+
+// Sets up the reader on the data selected by the current row
+static void setup(QXmlStreamReader &reader, QBuffer &buffer, const QByteArray &data,
+                  const QString &string, Source source)
+{
+    switch (source) {
+    case ByteArray:
+        reader.addData(data);
+        break;
+    case Device:
+        buffer.setData(data);
+        buffer.open(QIODevice::ReadOnly);
+        reader.setDevice(&buffer);
+        break;
+    case String:
+        reader.addData(string);
+        break;
+    }
+}
+
+void tst_QXmlStreamReader::read()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(int, source);
+    const QString string = QString::fromUtf8(data);
+
+    qsizetype total = 0;
+    QBENCHMARK {
+        QBuffer buffer;
+        QXmlStreamReader reader;
+        setup(reader, buffer, data, string, Source(source));
+        total = 0;
+        while (!reader.atEnd()) {
+            switch (reader.readNext()) {
+            case QXmlStreamReader::StartElement:
+                total += reader.name().size();
+                for (const QXmlStreamAttribute &attribute : reader.attributes())
+                    total += attribute.value().size();
+                break;
+            case QXmlStreamReader::Characters:
+                total += reader.text().size();
+                break;
+            default:
+                break;
+            }
+        }
+        QVERIFY(!reader.hasError());
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QXmlStreamReader::readAttributeViews()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(int, source);
+    const QString string = QString::fromUtf8(data);
+
+    qsizetype total = 0;
+    QBENCHMARK {
+        QBuffer buffer;
+        QXmlStreamReader reader;
+        reader.setArenaParsing(true);
+        setup(reader, buffer, data, string, Source(source));
+        total = 0;
+        while (!reader.atEnd()) {
+            switch (reader.readNext()) {
+            case QXmlStreamReader::StartElement:
+                total += reader.name().size();
+                for (qsizetype i = 0; i < reader.attributeCount(); ++i)
+                    total += reader.attributeValue(i).size();
+                break;
+            case QXmlStreamReader::Characters:
+                total += reader.text().size();
+                break;
+            default:
+                break;
+            }
+        }
+        QVERIFY(!reader.hasError());
+    }
+    QVERIFY(total > 0);
+}
+
+QTEST_MAIN(tst_QXmlStreamReader)
+
+#include "tst_bench_qxmlstream.moc"
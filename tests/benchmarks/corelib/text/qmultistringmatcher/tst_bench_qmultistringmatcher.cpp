@@ -0,0 +1,197 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QTest>
+
+#include <QMultiStringMatcher>
+#include <QRandomGenerator>
+#include <QStringMatcher>
+
+using namespace Qt::StringLiterals;
+
+class tst_QMultiStringMatcher : public QObject
+{
+    Q_OBJECT
+
+    void keywords_data() const;
+private slots:
+    void initTestCase();
+
+    // The number of log lines that contain any of the keywords
+    void stringMatcher_data() const { keywords_data(); }
+    void stringMatcher() const;
+    void multiStringMatcher_data() const { keywords_data(); }
+    void multiStringMatcher() const;
+    void multiStringMatcherLatin1_data() const { keywords_data(); }
+    void multiStringMatcherLatin1() const;
+    void multiStringMatcherUtf8_data() const { keywords_data(); }
+    void multiStringMatcherUtf8() const;
+
+    // All occurrences of the keywords
+    void matchAll_data() const { keywords_data(); }
+    void matchAll() const;
+
+    void construct_data() const { keywords_data(); }
+    void construct() const;
+
+private:
+    QStringList lines;
+    QList<QByteArray> latin1Lines;
+    QList<QByteArray> utf8Lines;
+};
+
+static QString randomWord(QRandomGenerator &rng)
+{
+    QString word;
+    const int length = rng.bounded(3, 10);
+    for (int i = 0; i < length; ++i)
+        word += QChar(u'a' + rng.bounded(26));
+    return word;
+}
+
+static QStringList keywords(int count)
+{
+    QRandomGenerator rng(count);
+    QStringList result = { u"refused"_s, u"error"_s, u"timeout"_s, u"denied"_s };
+    result = result.mid(0, qMin(count, 4));
+    while (result.size() < count)
+        result.append(randomWord(rng));
+    return result;
+}
+
+void tst_QMultiStringMatcher::initTestCase()
+{
+    QRandomGenerator rng(42);
+    const QString messages[] = {
+        u"connection to %1 refused"_s,
+        u"request %1 completed in %2 ms"_s,
+        u"Error: permission denied for %1"_s,
+        u"cache hit for %1, %2 entries"_s,
+        u"TIMEOUT waiting for %1 after %2 ms"_s,
+        u"user %1 logged in from %2"_s,
+    };
+    for (int i = 0; i < 10000; ++i) {
+        const QString &message = messages[rng.bounded(int(std::size(messages)))];
+        lines.append(u"2026-10-16 12:%1:%2 [worker-%3] "_s.arg(i / 60 % 60).arg(i % 60).arg(i % 8)
+                     + message.arg(randomWord(rng)).arg(rng.bounded(1000)));
+        latin1Lines.append(lines.last().toLatin1());
+        utf8Lines.append(lines.last().toUtf8());
+    }
+}
+
+void tst_QMultiStringMatcher::keywords_data() const
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("caseInsensitive");
+
+    for (int count : { 1, 4, 16, 64 }) {
+        QTest::addRow("%d-keywords", count) << count << false;
+        QTest::addRow("%d-keywords-ci", count) << count << true;
+    }
+}
+
+void tst_QMultiStringMatcher::stringMatcher() const
+{
+    QFETCH(int, count);
+    QFETCH(bool, caseInsensitive);
+
+    const Qt::CaseSensitivity cs = caseInsensitive ? Qt::CaseInsensitive : Qt::CaseSensitive;
+    std::vector<QStringMatcher> matchers;
+    for (const QString &keyword : keywords(count))
+        matchers.emplace_back(keyword, cs);
+
+    qsizetype found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (const QString &line : lines) {
+            for (const QStringMatcher &matcher : matchers) {
+                if (matcher.indexIn(line) >= 0) {
+                    ++found;
+                    break;
+                }
+            }
+        }
+    }
+    QVERIFY(found > 0);
+}
+
+void tst_QMultiStringMatcher::multiStringMatcher() const
+{
+    QFETCH(int, count);
+    QFETCH(bool, caseInsensitive);
+
+    const QMultiStringMatcher matcher(keywords(count),
+                                      caseInsensitive ? Qt::CaseInsensitive : Qt::CaseSensitive);
+    qsizetype found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (const QString &line : lines)
+            found += matcher.indexIn(line) >= 0;
+    }
+    QVERIFY(found > 0);
+}
+
+void tst_QMultiStringMatcher::multiStringMatcherLatin1() const
+{
+    QFETCH(int, count);
+    QFETCH(bool, caseInsensitive);
+
+    const QMultiStringMatcher matcher(keywords(count),
+                                      caseInsensitive ? Qt::CaseInsensitive : Qt::CaseSensitive);
+    qsizetype found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (const QByteArray &line : latin1Lines)
+            found += matcher.indexIn(QLatin1StringView(line)) >= 0;
+    }
+    QVERIFY(found > 0);
+}
+
+void tst_QMultiStringMatcher::multiStringMatcherUtf8() const
+{
+    QFETCH(int, count);
+    QFETCH(bool, caseInsensitive);
+
+    const QMultiStringMatcher matcher(keywords(count),
+                                      caseInsensitive ? Qt::CaseInsensitive : Qt::CaseSensitive);
+    qsizetype found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (const QByteArray &line : utf8Lines)
+            found += matcher.indexIn(QByteArrayView(line)) >= 0;
+    }
+    QVERIFY(found > 0);
+}
+
+void tst_QMultiStringMatcher::matchAll() const
+{
+    QFETCH(int, count);
+    QFETCH(bool, caseInsensitive);
+
+    const QMultiStringMatcher matcher(keywords(count),
+                                      caseInsensitive ? Qt::CaseInsensitive : Qt::CaseSensitive);
+    qsizetype found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (const QString &line : lines)
+            found += matcher.matchAll(line).size();
+    }
+    QVERIFY(found > 0);
+}
+
+void tst_QMultiStringMatcher::construct() const
+{
+    QFETCH(int, count);
+    QFETCH(bool, caseInsensitive);
+
+    const QStringList patterns = keywords(count);
+    QBENCHMARK {
+        QMultiStringMatcher matcher(patterns,
+                                    caseInsensitive ? Qt::CaseInsensitive : Qt::CaseSensitive);
+        Q_UNUSED(matcher);
+    }
+}
+
+QTEST_MAIN(tst_QMultiStringMatcher)
+
+#include "tst_bench_qmultistringmatcher.moc"
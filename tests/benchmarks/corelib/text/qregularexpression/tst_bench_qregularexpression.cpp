@@ -45,8 +45,20 @@ private slots:
     void queryMatchResultsByGroupIndex();
     void queryMatchResultsByGroupName();
     void iterateThroughGlobalMatchResults();
+
+    void matchCompiled();
+    void matchLines();
+    void matchLinesCompiled();
 };
 
+static QList<QString> linesToMatch()
+{
+    QList<QString> lines;
+    for (int i = 0; i < 1000; ++i)
+        lines.append(QString::number(i) + u' ' + textToMatch.sliced(i % 20));
+    return lines;
+}
+
 void tst_QRegularExpressionBenchmark::createDefault()
 {
     QBENCHMARK {
@@ -270,6 +282,55 @@ void tst_QRegularExpressionBenchmark::iterateThroughGlobalMatchResults()
     }
 }
 
+/*!
+    \internal This benchmark measures the performance of
+    QCompiledRegularExpression::match(), which neither locks nor allocates,
+    to compare with matchCustomOptimized().
+*/
+void tst_QRegularExpressionBenchmark::matchCompiled()
+{
+    const QCompiledRegularExpression re(QRegularExpression(nonEmptyPattern, nonEmptyPatternOptions));
+    qsizetype offsets[6];
+    QBENCHMARK {
+        bool matched = re.match(textToMatch, offsets);
+        Q_UNUSED(matched);
+    }
+}
+
+/*!
+    \internal These benchmarks match a pattern against many short subjects,
+    with QRegularExpression::matchView() and with
+    QCompiledRegularExpression::matchBatch().
+*/
+void tst_QRegularExpressionBenchmark::matchLines()
+{
+    const QList<QString> lines = linesToMatch();
+    QRegularExpression re(nonEmptyPattern, nonEmptyPatternOptions);
+    re.optimize();
+    QList<qsizetype> offsets(lines.size() * 6);
+    QBENCHMARK {
+        for (qsizetype i = 0; i < lines.size(); ++i) {
+            const QRegularExpressionMatch match = re.matchView(lines.at(i));
+            for (int group = 0; group < 3; ++group) {
+                offsets[i * 6 + group * 2] = match.capturedStart(group);
+                offsets[i * 6 + group * 2 + 1] = match.capturedEnd(group);
+            }
+        }
+    }
+}
+
+void tst_QRegularExpressionBenchmark::matchLinesCompiled()
+{
+    const QList<QString> lines = linesToMatch();
+    const QList<QStringView> views(lines.cbegin(), lines.cend());
+    const QCompiledRegularExpression re(QRegularExpression(nonEmptyPattern, nonEmptyPatternOptions));
+    QList<qsizetype> offsets(lines.size() * 6);
+    QBENCHMARK {
+        qsizetype matched = re.matchBatch(views, offsets);
+        Q_UNUSED(matched);
+    }
+}
+
 QTEST_MAIN(tst_QRegularExpressionBenchmark)
 
 #include "tst_bench_qregularexpression.moc"
@@ -28,6 +28,12 @@ private slots:
     void toCaseFolded_data();
     void toCaseFolded();
 
+    // Converting:
+    void fromUtf8_data();
+    void fromUtf8();
+    void toUtf8_data() { fromUtf8_data(); }
+    void toUtf8();
+
     // Serializing:
     void number_qlonglong_data();
     void number_qlonglong() { number_impl<qlonglong>(); }
@@ -203,6 +209,44 @@ void tst_QString::toCaseFolded()
     }
 }
 
+void tst_QString::fromUtf8_data()
+{
+    QTest::addColumn<QString>("s");
+
+    auto addRow = [](const char *name, QStringView sample) {
+        QString s;
+        while (s.size() < 4096)
+            s += sample;
+        QTest::newRow(name) << s;
+    };
+    addRow("ascii", u"The quick brown fox jumps over the lazy dog. ");
+    addRow("latin1", u"Zwölf Boxkämpfer jagen Viktor quer über den großen Sylter Deich. ");
+    addRow("cyrillic", u"Съешь же ещё этих мягких французских булок, да выпей чаю. ");
+    addRow("cjk", u"天地玄黄宇宙洪荒日月盈昃辰宿列张寒来暑往秋收冬藏");
+    addRow("korean", u"키스의 고유조건은 입술끼리 만나야 하고 특별한 기술은 필요치 않다. ");
+    addRow("emoji", u"\U0001f600\U0001f603\U0001f604\U0001f601\U0001f606\U0001f605\U0001f923\U0001f602");
+    addRow("mixed", u"Qt: Съешь 天地 키스 \U0001f600 Zwölf ");
+}
+
+void tst_QString::fromUtf8()
+{
+    QFETCH(QString, s);
+    const QByteArray utf8 = s.toUtf8();
+
+    QBENCHMARK {
+        [[maybe_unused]] auto r = QString::fromUtf8(utf8);
+    }
+}
+
+void tst_QString::toUtf8()
+{
+    QFETCH(QString, s);
+
+    QBENCHMARK {
+        [[maybe_unused]] auto r = s.toUtf8();
+    }
+}
+
 template <typename Integer>
 void tst_QString::number_impl()
 {
@@ -36,6 +36,9 @@ private slots:
     void compareStringsWithErrors_data();
     void compareStringsWithErrors();
 
+    void isValidUtf8_data();
+    void isValidUtf8();
+
 private:
     void equalStrings_data();
     void compareStringsCaseSensitive_data();
@@ -258,6 +261,37 @@ void tst_QUtf8StringView::compareStringsWithErrors()
     QCOMPARE(-result, rhv.compare(lhv, cs));
 }
 
+void tst_QUtf8StringView::isValidUtf8_data()
+{
+    QTest::addColumn<QByteArray>("utf8");
+
+    auto addRow = [](const char *name, QStringView sample) {
+        QString s;
+        while (s.size() < 4096)
+            s += sample;
+        QTest::newRow(name) << s.toUtf8();
+    };
+    addRow("ascii", u"The quick brown fox jumps over the lazy dog. ");
+    addRow("latin1", u"Zwölf Boxkämpfer jagen Viktor quer über den großen Sylter Deich. ");
+    addRow("cyrillic", u"Съешь же ещё этих мягких французских булок, да выпей чаю. ");
+    addRow("cjk", u"天地玄黄宇宙洪荒日月盈昃辰宿列张寒来暑往秋收冬藏");
+    addRow("korean", u"키스의 고유조건은 입술끼리 만나야 하고 특별한 기술은 필요치 않다. ");
+    addRow("emoji", u"\U0001f600\U0001f603\U0001f604\U0001f601\U0001f606\U0001f605\U0001f923\U0001f602");
+    addRow("mixed", u"Qt: Съешь 天地 키스 \U0001f600 Zwölf ");
+}
+
+void tst_QUtf8StringView::isValidUtf8()
+{
+    QFETCH(QByteArray, utf8);
+    QUtf8StringView view(utf8);
+    bool result = false;
+
+    QBENCHMARK {
+        result = view.isValidUtf8();
+    };
+    QVERIFY(result);
+}
+
 QTEST_MAIN(tst_QUtf8StringView)
 
 #include "tst_bench_qutf8stringview.moc"
@@ -28,6 +28,8 @@ private slots:
 #endif
     void then();
     void thenVoid();
+    void thenChain_data();
+    void thenChain();
     void onCanceled();
     void onCanceledVoid();
 #ifndef QT_NO_EXCEPTIONS
@@ -156,6 +158,44 @@ void tst_QFuture::thenVoid()
     }
 }
 
+void tst_QFuture::thenChain_data()
+{
+    QTest::addColumn<int>("stages");
+    QTest::addColumn<bool>("attachBeforeFinish");
+
+    for (int stages : {1, 5}) {
+        QTest::addRow("ready:%d", stages) << stages << false;
+        QTest::addRow("pending:%d", stages) << stages << true;
+    }
+}
+
+void tst_QFuture::thenChain()
+{
+    QFETCH(int, stages);
+    QFETCH(bool, attachBeforeFinish);
+
+    const auto attach = [stages](QFuture<int> future) {
+        for (int i = 0; i < stages; ++i)
+            future = future.then([](int value) { return value + 1; });
+        return future;
+    };
+
+    int result = 0;
+    QBENCHMARK {
+        QPromise<int> promise;
+        QFuture<int> future = promise.future();
+        if (attachBeforeFinish)
+            future = attach(future);
+        promise.start();
+        promise.addResult(0);
+        promise.finish();
+        if (!attachBeforeFinish)
+            future = attach(future);
+        result = future.result();
+    }
+    QCOMPARE(result, stages);
+}
+
 void tst_QFuture::onCanceled()
 {
     QFutureInterface<int> fi;
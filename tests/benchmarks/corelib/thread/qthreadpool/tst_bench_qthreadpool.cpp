@@ -15,6 +15,8 @@ public:
 private slots:
     void startRunnables();
     void activeThreadCount();
+    void recursiveSplit_data();
+    void recursiveSplit();
 };
 
 tst_QThreadPool::tst_QThreadPool()
@@ -50,6 +52,68 @@ void tst_QThreadPool::activeThreadCount()
     }
 }
 
+// Splits itself in two until the depth is reached, doing a little work in
+// each leaf, like a divide and conquer algorithm.
+class SplitRunnable : public QRunnable
+{
+public:
+    SplitRunnable(QThreadPool &pool, QAtomicInt &leaves, int depth)
+        : pool(pool), leaves(leaves), depth(depth) {}
+
+    void run() override
+    {
+        if (depth == 0) {
+            volatile int sink = 0;
+            for (int i = 0; i < 200; ++i)
+                sink = sink + i;
+            leaves.ref();
+            return;
+        }
+        pool.start(new SplitRunnable(pool, leaves, depth - 1));
+        pool.start(new SplitRunnable(pool, leaves, depth - 1));
+    }
+
+private:
+    QThreadPool &pool;
+    QAtomicInt &leaves;
+    int depth;
+};
+
+void tst_QThreadPool::recursiveSplit_data()
+{
+    QTest::addColumn<bool>("workStealing");
+    QTest::addColumn<int>("threadCount");
+
+    const int ideal = QThread::idealThreadCount();
+    for (bool workStealing : { false, true }) {
+        for (int threads = 1; threads < ideal; threads *= 2) {
+            QTest::addRow("%s:%d", workStealing ? "stealing" : "shared", threads)
+                    << workStealing << threads;
+        }
+        QTest::addRow("%s:%d", workStealing ? "stealing" : "shared", ideal)
+                << workStealing << ideal;
+    }
+}
+
+void tst_QThreadPool::recursiveSplit()
+{
+    QFETCH(bool, workStealing);
+    QFETCH(int, threadCount);
+
+    const int depth = 16;
+    QThreadPool threadPool;
+    threadPool.setWorkStealingEnabled(workStealing);
+    threadPool.setMaxThreadCount(threadCount);
+    threadPool.setExpiryTimeout(-1);
+
+    QBENCHMARK {
+        QAtomicInt leaves = 0;
+        threadPool.start(new SplitRunnable(threadPool, leaves, depth));
+        while (leaves.loadRelaxed() < (1 << depth))
+            QThread::yieldCurrentThread();
+    }
+}
+
 QTEST_MAIN(tst_QThreadPool)
 
 #include "tst_bench_qthreadpool.moc"
@@ -3,19 +3,51 @@
 #include <QString>
 #include <QMap>
 #include <QHash>
+#include <QFlatHash>
 
 #include <qtest.h>
 
 class tst_associative_containers : public QObject
 {
     Q_OBJECT
+public:
+    enum Container { Hash, Map, FlatHash };
+    Q_ENUM(Container)
+
 private slots:
     void insert_data();
     void insert();
     void lookup_data();
     void lookup();
+    void lookupMissing_data();
+    void lookupMissing();
+    void lookupPointer_data();
+    void lookupPointer();
+    void lookupStringView_data();
+    void lookupStringView();
+    void removeAndInsert_data();
+    void removeAndInsert();
+
+private:
+    void containers_data(bool withMap = true);
 };
 
+void tst_associative_containers::containers_data(bool withMap)
+{
+    QTest::addColumn<Container>("container");
+    QTest::addColumn<int>("size");
+
+    for (int size = 10; size < 20000; size += 100) {
+
+        const QByteArray sizeString = QByteArray::number(size);
+
+        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << Hash << size;
+        if (withMap)
+            QTest::newRow(QByteArray("map--" + sizeString).constData()) << Map << size;
+        QTest::newRow(QByteArray("flathash--" + sizeString).constData()) << FlatHash << size;
+    }
+}
+
 template <typename T>
 void testInsert(int size)
 {
@@ -29,30 +61,24 @@ void testInsert(int size)
 
 void tst_associative_containers::insert_data()
 {
-    QTest::addColumn<bool>("useHash");
-    QTest::addColumn<int>("size");
-
-    for (int size = 10; size < 20000; size += 100) {
-
-        const QByteArray sizeString = QByteArray::number(size);
-
-        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << true << size;
-        QTest::newRow(QByteArray("map--" + sizeString).constData()) << false << size;
-    }
+    containers_data();
 }
 
 void tst_associative_containers::insert()
 {
-    QFETCH(bool, useHash);
+    QFETCH(Container, container);
     QFETCH(int, size);
 
-    QHash<int, int> testHash;
-    QMap<int, int> testMap;
-
-    if (useHash) {
+    switch (container) {
+    case Hash:
         testInsert<QHash<int, int> >(size);
-    } else {
+        break;
+    case Map:
         testInsert<QMap<int, int> >(size);
+        break;
+    case FlatHash:
+        testInsert<QFlatHash<int, int> >(size);
+        break;
     }
 }
 
@@ -61,16 +87,7 @@ void tst_associative_containers::lookup_data()
 //    setReportType(LineChartReport);
 //    setChartTitle("Time to call value(), with an increasing number of items in the container");
 
-    QTest::addColumn<bool>("useHash");
-    QTest::addColumn<int>("size");
-
-    for (int size = 10; size < 20000; size += 100) {
-
-        const QByteArray sizeString = QByteArray::number(size);
-
-        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << true << size;
-        QTest::newRow(QByteArray("map--" + sizeString).constData()) << false << size;
-    }
+    containers_data();
 }
 
 template <typename T>
@@ -93,14 +110,157 @@ void testLookup(int size)
 
 void tst_associative_containers::lookup()
 {
-    QFETCH(bool, useHash);
+    QFETCH(Container, container);
     QFETCH(int, size);
 
-    if (useHash) {
+    switch (container) {
+    case Hash:
         testLookup<QHash<int, int> >(size);
-    } else {
+        break;
+    case Map:
         testLookup<QMap<int, int> >(size);
+        break;
+    case FlatHash:
+        testLookup<QFlatHash<int, int> >(size);
+        break;
+    }
+}
+
+void tst_associative_containers::lookupMissing_data()
+{
+    containers_data(false);
+}
+
+template <typename T>
+void testLookupMissing(int size)
+{
+    T container;
+
+    for (int i = 0; i < size; ++i)
+        container.insert(2 * i, i);
+
+    qsizetype found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (int i = 0; i < size; ++i)
+            found += container.contains(2 * i + 1);
+    }
+    QCOMPARE(found, 0);
+}
+
+void tst_associative_containers::lookupMissing()
+{
+    QFETCH(Container, container);
+    QFETCH(int, size);
+
+    if (container == Hash)
+        testLookupMissing<QHash<int, int>>(size);
+    else
+        testLookupMissing<QFlatHash<int, int>>(size);
+}
+
+void tst_associative_containers::lookupPointer_data()
+{
+    containers_data(false);
+}
+
+template <typename T>
+void testLookupPointer(int size)
+{
+    std::vector<QString> objects(size);
+    T container;
+    for (int i = 0; i < size; ++i)
+        container.insert(&objects[i], i);
+
+    qsizetype sum = 0;
+    QBENCHMARK {
+        sum = 0;
+        for (const QString &object : objects)
+            sum += container.value(&object);
     }
+    QCOMPARE(sum, qsizetype(size) * (size - 1) / 2);
+}
+
+void tst_associative_containers::lookupPointer()
+{
+    QFETCH(Container, container);
+    QFETCH(int, size);
+
+    if (container == Hash)
+        testLookupPointer<QHash<const QString *, int>>(size);
+    else
+        testLookupPointer<QFlatHash<const QString *, int>>(size);
+}
+
+void tst_associative_containers::lookupStringView_data()
+{
+    containers_data(false);
+}
+
+template <typename T>
+void testLookupStringView(int size)
+{
+    T container;
+    QString text;
+    for (int i = 0; i < size; ++i) {
+        const QString key = u"key" + QString::number(i);
+        container.insert(key, i);
+        text += key + u' ';
+    }
+
+    const QList<QStringView> words = QStringView(text).trimmed().tokenize(u' ').toContainer();
+    qsizetype sum = 0;
+    QBENCHMARK {
+        sum = 0;
+        for (QStringView word : words)
+            sum += container.value(word);
+    }
+    QCOMPARE(sum, qsizetype(size) * (size - 1) / 2);
+}
+
+void tst_associative_containers::lookupStringView()
+{
+    QFETCH(Container, container);
+    QFETCH(int, size);
+
+    if (container == Hash)
+        testLookupStringView<QHash<QString, int>>(size);
+    else
+        testLookupStringView<QFlatHash<QString, int>>(size);
+}
+
+void tst_associative_containers::removeAndInsert_data()
+{
+    containers_data(false);
+}
+
+template <typename T>
+void testRemoveAndInsert(int size)
+{
+    T container;
+    for (int i = 0; i < size; ++i)
+        container.insert(i, i);
+
+    int next = size;
+    QBENCHMARK {
+        for (int i = 0; i < size; ++i) {
+            container.remove(next - size);
+            container.insert(next, next);
+            ++next;
+        }
+    }
+    QCOMPARE(container.size(), size);
+}
+
+void tst_associative_containers::removeAndInsert()
+{
+    QFETCH(Container, container);
+    QFETCH(int, size);
+
+    if (container == Hash)
+        testRemoveAndInsert<QHash<int, int>>(size);
+    else
+        testRemoveAndInsert<QFlatHash<int, int>>(size);
 }
 
 QTEST_MAIN(tst_associative_containers)
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 #include <QFile>
+#include <QFlatMap>
 #include <QMap>
 #include <QString>
 #include <QTest>
@@ -21,6 +22,14 @@ private slots:
     void lookup_int_string();
     void lookup_string_int();
 
+    void lookup_int_int_flatmap();
+    void lookup_string_int_flatmap();
+    void lookup_stringview_int_flatmap();
+    void lookup_scattered_int_int();
+    void lookup_scattered_int_int_flatmap();
+    void construction_unsorted_int_int();
+    void construction_unsorted_int_int_flatmap();
+
     void iteration();
     void toStdMap();
     void iterator_begin();
@@ -62,6 +71,8 @@ constexpr int huge = 100000; // one hundred thousand; simple integral data tests
 // Sum of i with 0 <= i < huge; overflows, but that's OK as long as it's unsigned:
 constexpr uint hugeSum = (uint(huge) / 2) * uint(huge - 1);
 constexpr int bigish = 5000; // five thousand; tests using XString's expensive <
+// Visits each of 0 <= i < huge exactly once, in an order with no locality.
+constexpr int scattered(int i) { return int(qint64(i) * 7919 % huge); }
 
 void tst_QMap::insertion_int_int()
 {
@@ -185,6 +196,115 @@ void tst_QMap::lookup_string_int()
     QCOMPARE(sum, hugeSum * count);
 }
 
+void tst_QMap::lookup_int_int_flatmap()
+{
+    QFlatMap<int, int> map;
+    for (int i = 0; i < huge; ++i)
+        map.insert(i, i);
+    QCOMPARE(map.size(), qsizetype(huge));
+
+    uint sum = 0, count = 0;
+    QBENCHMARK {
+        for (int i = 0; i < huge; ++i)
+             sum += map.value(i);
+        ++count;
+    }
+    QCOMPARE(sum, hugeSum * count);
+}
+
+void tst_QMap::lookup_string_int_flatmap()
+{
+    QFlatMap<QString, int> map;
+    const QStringList names = helloEachWorld(huge);
+    for (int i = 1; i < huge; ++i)
+        map.insert(names.at(i), i);
+    QCOMPARE(map.size() + 1, qsizetype(huge));
+
+    uint sum = 0, count = 0;
+    QBENCHMARK {
+        for (int i = 1; i < huge; ++i)
+            sum += map.value(names.at(i));
+        ++count;
+    }
+    QCOMPARE(sum, hugeSum * count);
+}
+
+void tst_QMap::lookup_stringview_int_flatmap()
+{
+    QFlatMap<QString, int, std::less<>> map;
+    const QStringList names = helloEachWorld(huge);
+    for (int i = 1; i < huge; ++i)
+        map.insert(names.at(i), i);
+    QCOMPARE(map.size() + 1, qsizetype(huge));
+
+    uint sum = 0, count = 0;
+    QBENCHMARK {
+        for (int i = 1; i < huge; ++i)
+            sum += map.value(QStringView(names.at(i)));
+        ++count;
+    }
+    QCOMPARE(sum, hugeSum * count);
+}
+
+void tst_QMap::lookup_scattered_int_int()
+{
+    QMap<int, int> map;
+    for (int i = 0; i < huge; ++i)
+        map.insert(scattered(i), scattered(i));
+    QCOMPARE(map.size(), qsizetype(huge));
+
+    uint sum = 0, count = 0;
+    QBENCHMARK {
+        for (int i = 0; i < huge; ++i)
+             sum += map.value(scattered(i));
+        ++count;
+    }
+    QCOMPARE(sum, hugeSum * count);
+}
+
+void tst_QMap::lookup_scattered_int_int_flatmap()
+{
+    QFlatMap<int, int> map;
+    for (int i = 0; i < huge; ++i)
+        map.insert(scattered(i), scattered(i));
+    const auto &frozen = map.freeze();
+    QCOMPARE(frozen.size(), qsizetype(huge));
+
+    uint sum = 0, count = 0;
+    QBENCHMARK {
+        for (int i = 0; i < huge; ++i)
+             sum += frozen.value(scattered(i));
+        ++count;
+    }
+    QCOMPARE(sum, hugeSum * count);
+}
+
+void tst_QMap::construction_unsorted_int_int()
+{
+    QList<int> keys(huge);
+    for (int i = 0; i < huge; ++i)
+        keys[i] = scattered(i);
+
+    QBENCHMARK {
+        QMap<int, int> map;
+        for (int key : std::as_const(keys))
+            map.insert(key, key);
+        QCOMPARE(map.size(), qsizetype(huge));
+    }
+}
+
+void tst_QMap::construction_unsorted_int_int_flatmap()
+{
+    QList<int> keys(huge);
+    for (int i = 0; i < huge; ++i)
+        keys[i] = scattered(i);
+
+    QBENCHMARK {
+        QFlatMap<int, int> map(keys, keys);
+        QCOMPARE(map.size(), qsizetype(huge));
+    }
+}
+
 // iteration speed doesn't depend on the type of the map.
 void tst_QMap::iteration()
 {